@@ -0,0 +1,227 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "debug".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "ns3::liblte" for configuration "debug"
+set_property(TARGET ns3::liblte APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::liblte PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libns3-dev-lte-debug.so"
+  IMPORTED_SONAME_DEBUG "libns3-dev-lte-debug.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::liblte )
+list(APPEND _cmake_import_check_files_for_ns3::liblte "${_IMPORT_PREFIX}/lib/libns3-dev-lte-debug.so" )
+
+# Import target "ns3::libwifi" for configuration "debug"
+set_property(TARGET ns3::libwifi APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::libwifi PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libns3-dev-wifi-debug.so"
+  IMPORTED_SONAME_DEBUG "libns3-dev-wifi-debug.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libwifi )
+list(APPEND _cmake_import_check_files_for_ns3::libwifi "${_IMPORT_PREFIX}/lib/libns3-dev-wifi-debug.so" )
+
+# Import target "ns3::raw-sock-creator" for configuration "debug"
+set_property(TARGET ns3::raw-sock-creator APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::raw-sock-creator PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/libexec/ns3/ns3-dev-raw-sock-creator-debug"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::raw-sock-creator )
+list(APPEND _cmake_import_check_files_for_ns3::raw-sock-creator "${_IMPORT_PREFIX}/libexec/ns3/ns3-dev-raw-sock-creator-debug" )
+
+# Import target "ns3::tap-device-creator" for configuration "debug"
+set_property(TARGET ns3::tap-device-creator APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::tap-device-creator PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/libexec/ns3/ns3-dev-tap-device-creator-debug"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::tap-device-creator )
+list(APPEND _cmake_import_check_files_for_ns3::tap-device-creator "${_IMPORT_PREFIX}/libexec/ns3/ns3-dev-tap-device-creator-debug" )
+
+# Import target "ns3::libfd-net-device" for configuration "debug"
+set_property(TARGET ns3::libfd-net-device APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::libfd-net-device PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libns3-dev-fd-net-device-debug.so"
+  IMPORTED_SONAME_DEBUG "libns3-dev-fd-net-device-debug.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libfd-net-device )
+list(APPEND _cmake_import_check_files_for_ns3::libfd-net-device "${_IMPORT_PREFIX}/lib/libns3-dev-fd-net-device-debug.so" )
+
+# Import target "ns3::libnetwork" for configuration "debug"
+set_property(TARGET ns3::libnetwork APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::libnetwork PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libns3-dev-network-debug.so"
+  IMPORTED_SONAME_DEBUG "libns3-dev-network-debug.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libnetwork )
+list(APPEND _cmake_import_check_files_for_ns3::libnetwork "${_IMPORT_PREFIX}/lib/libns3-dev-network-debug.so" )
+
+# Import target "ns3::libcore" for configuration "debug"
+set_property(TARGET ns3::libcore APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::libcore PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libns3-dev-core-debug.so"
+  IMPORTED_SONAME_DEBUG "libns3-dev-core-debug.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libcore )
+list(APPEND _cmake_import_check_files_for_ns3::libcore "${_IMPORT_PREFIX}/lib/libns3-dev-core-debug.so" )
+
+# Import target "ns3::libstats" for configuration "debug"
+set_property(TARGET ns3::libstats APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::libstats PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libns3-dev-stats-debug.so"
+  IMPORTED_SONAME_DEBUG "libns3-dev-stats-debug.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libstats )
+list(APPEND _cmake_import_check_files_for_ns3::libstats "${_IMPORT_PREFIX}/lib/libns3-dev-stats-debug.so" )
+
+# Import target "ns3::libspectrum" for configuration "debug"
+set_property(TARGET ns3::libspectrum APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::libspectrum PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libns3-dev-spectrum-debug.so"
+  IMPORTED_SONAME_DEBUG "libns3-dev-spectrum-debug.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libspectrum )
+list(APPEND _cmake_import_check_files_for_ns3::libspectrum "${_IMPORT_PREFIX}/lib/libns3-dev-spectrum-debug.so" )
+
+# Import target "ns3::libpropagation" for configuration "debug"
+set_property(TARGET ns3::libpropagation APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::libpropagation PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libns3-dev-propagation-debug.so"
+  IMPORTED_SONAME_DEBUG "libns3-dev-propagation-debug.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libpropagation )
+list(APPEND _cmake_import_check_files_for_ns3::libpropagation "${_IMPORT_PREFIX}/lib/libns3-dev-propagation-debug.so" )
+
+# Import target "ns3::libmobility" for configuration "debug"
+set_property(TARGET ns3::libmobility APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::libmobility PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libns3-dev-mobility-debug.so"
+  IMPORTED_SONAME_DEBUG "libns3-dev-mobility-debug.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libmobility )
+list(APPEND _cmake_import_check_files_for_ns3::libmobility "${_IMPORT_PREFIX}/lib/libns3-dev-mobility-debug.so" )
+
+# Import target "ns3::libantenna" for configuration "debug"
+set_property(TARGET ns3::libantenna APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::libantenna PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libns3-dev-antenna-debug.so"
+  IMPORTED_SONAME_DEBUG "libns3-dev-antenna-debug.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libantenna )
+list(APPEND _cmake_import_check_files_for_ns3::libantenna "${_IMPORT_PREFIX}/lib/libns3-dev-antenna-debug.so" )
+
+# Import target "ns3::libbuildings" for configuration "debug"
+set_property(TARGET ns3::libbuildings APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::libbuildings PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libns3-dev-buildings-debug.so"
+  IMPORTED_SONAME_DEBUG "libns3-dev-buildings-debug.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libbuildings )
+list(APPEND _cmake_import_check_files_for_ns3::libbuildings "${_IMPORT_PREFIX}/lib/libns3-dev-buildings-debug.so" )
+
+# Import target "ns3::libvirtual-net-device" for configuration "debug"
+set_property(TARGET ns3::libvirtual-net-device APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::libvirtual-net-device PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libns3-dev-virtual-net-device-debug.so"
+  IMPORTED_SONAME_DEBUG "libns3-dev-virtual-net-device-debug.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libvirtual-net-device )
+list(APPEND _cmake_import_check_files_for_ns3::libvirtual-net-device "${_IMPORT_PREFIX}/lib/libns3-dev-virtual-net-device-debug.so" )
+
+# Import target "ns3::libpoint-to-point" for configuration "debug"
+set_property(TARGET ns3::libpoint-to-point APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::libpoint-to-point PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libns3-dev-point-to-point-debug.so"
+  IMPORTED_SONAME_DEBUG "libns3-dev-point-to-point-debug.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libpoint-to-point )
+list(APPEND _cmake_import_check_files_for_ns3::libpoint-to-point "${_IMPORT_PREFIX}/lib/libns3-dev-point-to-point-debug.so" )
+
+# Import target "ns3::libapplications" for configuration "debug"
+set_property(TARGET ns3::libapplications APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::libapplications PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libns3-dev-applications-debug.so"
+  IMPORTED_SONAME_DEBUG "libns3-dev-applications-debug.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libapplications )
+list(APPEND _cmake_import_check_files_for_ns3::libapplications "${_IMPORT_PREFIX}/lib/libns3-dev-applications-debug.so" )
+
+# Import target "ns3::libinternet" for configuration "debug"
+set_property(TARGET ns3::libinternet APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::libinternet PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libns3-dev-internet-debug.so"
+  IMPORTED_SONAME_DEBUG "libns3-dev-internet-debug.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libinternet )
+list(APPEND _cmake_import_check_files_for_ns3::libinternet "${_IMPORT_PREFIX}/lib/libns3-dev-internet-debug.so" )
+
+# Import target "ns3::libbridge" for configuration "debug"
+set_property(TARGET ns3::libbridge APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::libbridge PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libns3-dev-bridge-debug.so"
+  IMPORTED_SONAME_DEBUG "libns3-dev-bridge-debug.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libbridge )
+list(APPEND _cmake_import_check_files_for_ns3::libbridge "${_IMPORT_PREFIX}/lib/libns3-dev-bridge-debug.so" )
+
+# Import target "ns3::libtraffic-control" for configuration "debug"
+set_property(TARGET ns3::libtraffic-control APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::libtraffic-control PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libns3-dev-traffic-control-debug.so"
+  IMPORTED_SONAME_DEBUG "libns3-dev-traffic-control-debug.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libtraffic-control )
+list(APPEND _cmake_import_check_files_for_ns3::libtraffic-control "${_IMPORT_PREFIX}/lib/libns3-dev-traffic-control-debug.so" )
+
+# Import target "ns3::libcsma" for configuration "debug"
+set_property(TARGET ns3::libcsma APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::libcsma PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libns3-dev-csma-debug.so"
+  IMPORTED_SONAME_DEBUG "libns3-dev-csma-debug.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libcsma )
+list(APPEND _cmake_import_check_files_for_ns3::libcsma "${_IMPORT_PREFIX}/lib/libns3-dev-csma-debug.so" )
+
+# Import target "ns3::libconfig-store" for configuration "debug"
+set_property(TARGET ns3::libconfig-store APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::libconfig-store PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libns3-dev-config-store-debug.so"
+  IMPORTED_SONAME_DEBUG "libns3-dev-config-store-debug.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libconfig-store )
+list(APPEND _cmake_import_check_files_for_ns3::libconfig-store "${_IMPORT_PREFIX}/lib/libns3-dev-config-store-debug.so" )
+
+# Import target "ns3::libenergy" for configuration "debug"
+set_property(TARGET ns3::libenergy APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ns3::libenergy PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libns3-dev-energy-debug.so"
+  IMPORTED_SONAME_DEBUG "libns3-dev-energy-debug.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libenergy )
+list(APPEND _cmake_import_check_files_for_ns3::libenergy "${_IMPORT_PREFIX}/lib/libns3-dev-energy-debug.so" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
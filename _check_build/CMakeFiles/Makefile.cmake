@@ -0,0 +1,361 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/VerifyGlobs.cmake"
+  "CMakeFiles/cmake.verify_globs"
+  "/root/repo/build-support/3rd-party/FindEigen3.cmake"
+  "/root/repo/build-support/3rd-party/FindHarfBuzz.cmake"
+  "/root/repo/build-support/3rd-party/FindSphinx.cmake"
+  "/root/repo/build-support/3rd-party/colored-messages.cmake"
+  "/root/repo/build-support/3rd-party/find-program-hints.cmake"
+  "/root/repo/build-support/Config.cmake.in"
+  "/root/repo/build-support/config-store-config-template.h"
+  "/root/repo/build-support/core-config-template.h"
+  "/root/repo/build-support/custom-modules/ns3-check-dependencies.cmake"
+  "/root/repo/build-support/custom-modules/ns3-cmake-package.cmake"
+  "/root/repo/build-support/custom-modules/ns3-compiler-and-linker-support.cmake"
+  "/root/repo/build-support/custom-modules/ns3-compiler-workarounds.cmake"
+  "/root/repo/build-support/custom-modules/ns3-configtable.cmake"
+  "/root/repo/build-support/custom-modules/ns3-contributions.cmake"
+  "/root/repo/build-support/custom-modules/ns3-executables.cmake"
+  "/root/repo/build-support/custom-modules/ns3-filter-modules.cmake"
+  "/root/repo/build-support/custom-modules/ns3-find-external-library.cmake"
+  "/root/repo/build-support/custom-modules/ns3-hidden-settings.cmake"
+  "/root/repo/build-support/custom-modules/ns3-lock.cmake"
+  "/root/repo/build-support/custom-modules/ns3-module-macros.cmake"
+  "/root/repo/build-support/custom-modules/ns3-ns3rc-parser.cmake"
+  "/root/repo/build-support/custom-modules/ns3-output-directory.cmake"
+  "/root/repo/build-support/custom-modules/ns3-platform-support.cmake"
+  "/root/repo/build-support/custom-modules/ns3-vcpkg-hunter.cmake"
+  "/root/repo/build-support/custom-modules/ns3-versioning.cmake"
+  "/root/repo/build-support/macros-and-definitions.cmake"
+  "/root/repo/build-support/pkgconfig-template.pc.in"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/scratch/CMakeLists.txt"
+  "/root/repo/scratch/nested-subdir/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/antenna/CMakeLists.txt"
+  "/root/repo/src/applications/CMakeLists.txt"
+  "/root/repo/src/bridge/CMakeLists.txt"
+  "/root/repo/src/buildings/CMakeLists.txt"
+  "/root/repo/src/config-store/CMakeLists.txt"
+  "/root/repo/src/core/CMakeLists.txt"
+  "/root/repo/src/csma/CMakeLists.txt"
+  "/root/repo/src/energy/CMakeLists.txt"
+  "/root/repo/src/fd-net-device/CMakeLists.txt"
+  "/root/repo/src/internet/CMakeLists.txt"
+  "/root/repo/src/lte/CMakeLists.txt"
+  "/root/repo/src/mobility/CMakeLists.txt"
+  "/root/repo/src/network/CMakeLists.txt"
+  "/root/repo/src/point-to-point/CMakeLists.txt"
+  "/root/repo/src/propagation/CMakeLists.txt"
+  "/root/repo/src/spectrum/CMakeLists.txt"
+  "/root/repo/src/stats/CMakeLists.txt"
+  "/root/repo/src/traffic-control/CMakeLists.txt"
+  "/root/repo/src/virtual-net-device/CMakeLists.txt"
+  "/root/repo/src/wifi/CMakeLists.txt"
+  "/root/repo/utils/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-ExactVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompilerABI.c"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompilerABI.cpp"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCompilerIdDetection.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompileFeatures.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerABI.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerId.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitIncludeInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseLibraryArchitecture.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystem.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCompilerCommon.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeUnixFindMake.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ADSP-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMCC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/AppleClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Borland-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Bruce-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompilerInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Comeau-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Cray-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Embarcadero-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Fujitsu-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/FujitsuClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GHS-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-FindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IAR-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-C-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-CXX-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Intel-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IntelLLVM-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/MSVC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVHPC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVIDIA-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/OpenWatcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PGI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PathScale-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SCO-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SDCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Tasking-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TinyCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Watcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGSL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLibXml2.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/FeatureTesting.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-Determine-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/ProcessorCount.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/eigen3/cmake/Eigen3ConfigVersion.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "/root/repo/build/include/ns3/config-store-config.h"
+  "/root/repo/build/include/ns3/core-config.h"
+  "pkgconfig/ns3-energy.pc"
+  "pkgconfig/ns3-config-store.pc"
+  "pkgconfig/ns3-csma.pc"
+  "pkgconfig/ns3-traffic-control.pc"
+  "pkgconfig/ns3-bridge.pc"
+  "pkgconfig/ns3-internet.pc"
+  "pkgconfig/ns3-applications.pc"
+  "pkgconfig/ns3-point-to-point.pc"
+  "pkgconfig/ns3-virtual-net-device.pc"
+  "pkgconfig/ns3-buildings.pc"
+  "pkgconfig/ns3-antenna.pc"
+  "pkgconfig/ns3-mobility.pc"
+  "pkgconfig/ns3-propagation.pc"
+  "pkgconfig/ns3-spectrum.pc"
+  "pkgconfig/ns3-stats.pc"
+  "pkgconfig/ns3-core.pc"
+  "pkgconfig/ns3-network.pc"
+  "pkgconfig/ns3-fd-net-device.pc"
+  "pkgconfig/ns3-wifi.pc"
+  "pkgconfig/ns3-lte.pc"
+  "ns3Config.cmake"
+  "ns3ConfigVersion.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/lte/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/wifi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/fd-net-device/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/network/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/stats/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/spectrum/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/propagation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/mobility/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/antenna/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/buildings/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/virtual-net-device/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/point-to-point/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/applications/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/internet/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/bridge/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/traffic-control/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/csma/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/config-store/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/energy/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "scratch/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "scratch/nested-subdir/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "CMakeFiles/copy_all_headers.dir/DependInfo.cmake"
+  "CMakeFiles/check-version.dir/DependInfo.cmake"
+  "CMakeFiles/test-runner-examples-as-tests.dir/DependInfo.cmake"
+  "CMakeFiles/all-test-targets.dir/DependInfo.cmake"
+  "CMakeFiles/run_test_py.dir/DependInfo.cmake"
+  "CMakeFiles/run-print-introspected-doxygen.dir/DependInfo.cmake"
+  "CMakeFiles/run-introspected-command-line.dir/DependInfo.cmake"
+  "CMakeFiles/assemble-introspected-command-line.dir/DependInfo.cmake"
+  "CMakeFiles/update_doxygen_version.dir/DependInfo.cmake"
+  "CMakeFiles/doxygen.dir/DependInfo.cmake"
+  "CMakeFiles/doxygen-no-build.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx_manual.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx_models.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx_tutorial.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx_contributing.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx_installation.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_energy.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_config-store.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_csma.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_traffic-control.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_bridge.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_internet.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_applications.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_point-to-point.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_virtual-net-device.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_buildings.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_antenna.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_mobility.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_propagation.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_spectrum.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_stats.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_core.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_network.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_fd-net-device.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_wifi.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_lte.dir/DependInfo.cmake"
+  "src/lte/CMakeFiles/liblte-obj.dir/DependInfo.cmake"
+  "src/lte/CMakeFiles/liblte.dir/DependInfo.cmake"
+  "src/lte/CMakeFiles/liblte-test.dir/DependInfo.cmake"
+  "src/wifi/CMakeFiles/libwifi-obj.dir/DependInfo.cmake"
+  "src/wifi/CMakeFiles/libwifi.dir/DependInfo.cmake"
+  "src/wifi/CMakeFiles/libwifi-test.dir/DependInfo.cmake"
+  "src/fd-net-device/CMakeFiles/raw-sock-creator.dir/DependInfo.cmake"
+  "src/fd-net-device/CMakeFiles/uninstall_raw-sock-creator.dir/DependInfo.cmake"
+  "src/fd-net-device/CMakeFiles/tap-device-creator.dir/DependInfo.cmake"
+  "src/fd-net-device/CMakeFiles/uninstall_tap-device-creator.dir/DependInfo.cmake"
+  "src/fd-net-device/CMakeFiles/libfd-net-device-obj.dir/DependInfo.cmake"
+  "src/fd-net-device/CMakeFiles/libfd-net-device.dir/DependInfo.cmake"
+  "src/network/CMakeFiles/libnetwork-obj.dir/DependInfo.cmake"
+  "src/network/CMakeFiles/libnetwork.dir/DependInfo.cmake"
+  "src/network/CMakeFiles/libnetwork-test.dir/DependInfo.cmake"
+  "src/core/CMakeFiles/libcore-obj.dir/DependInfo.cmake"
+  "src/core/CMakeFiles/libcore.dir/DependInfo.cmake"
+  "src/core/CMakeFiles/libcore-test.dir/DependInfo.cmake"
+  "src/stats/CMakeFiles/libstats-obj.dir/DependInfo.cmake"
+  "src/stats/CMakeFiles/libstats.dir/DependInfo.cmake"
+  "src/stats/CMakeFiles/libstats-test.dir/DependInfo.cmake"
+  "src/spectrum/CMakeFiles/libspectrum-obj.dir/DependInfo.cmake"
+  "src/spectrum/CMakeFiles/libspectrum.dir/DependInfo.cmake"
+  "src/spectrum/CMakeFiles/libspectrum-test.dir/DependInfo.cmake"
+  "src/propagation/CMakeFiles/libpropagation-obj.dir/DependInfo.cmake"
+  "src/propagation/CMakeFiles/libpropagation.dir/DependInfo.cmake"
+  "src/propagation/CMakeFiles/libpropagation-test.dir/DependInfo.cmake"
+  "src/mobility/CMakeFiles/libmobility-obj.dir/DependInfo.cmake"
+  "src/mobility/CMakeFiles/libmobility.dir/DependInfo.cmake"
+  "src/mobility/CMakeFiles/libmobility-test.dir/DependInfo.cmake"
+  "src/antenna/CMakeFiles/libantenna-obj.dir/DependInfo.cmake"
+  "src/antenna/CMakeFiles/libantenna.dir/DependInfo.cmake"
+  "src/antenna/CMakeFiles/libantenna-test.dir/DependInfo.cmake"
+  "src/buildings/CMakeFiles/libbuildings-obj.dir/DependInfo.cmake"
+  "src/buildings/CMakeFiles/libbuildings.dir/DependInfo.cmake"
+  "src/buildings/CMakeFiles/libbuildings-test.dir/DependInfo.cmake"
+  "src/virtual-net-device/CMakeFiles/libvirtual-net-device-obj.dir/DependInfo.cmake"
+  "src/virtual-net-device/CMakeFiles/libvirtual-net-device.dir/DependInfo.cmake"
+  "src/point-to-point/CMakeFiles/libpoint-to-point-obj.dir/DependInfo.cmake"
+  "src/point-to-point/CMakeFiles/libpoint-to-point.dir/DependInfo.cmake"
+  "src/point-to-point/CMakeFiles/libpoint-to-point-test.dir/DependInfo.cmake"
+  "src/applications/CMakeFiles/libapplications-obj.dir/DependInfo.cmake"
+  "src/applications/CMakeFiles/libapplications.dir/DependInfo.cmake"
+  "src/applications/CMakeFiles/libapplications-test.dir/DependInfo.cmake"
+  "src/internet/CMakeFiles/libinternet-obj.dir/DependInfo.cmake"
+  "src/internet/CMakeFiles/libinternet.dir/DependInfo.cmake"
+  "src/internet/CMakeFiles/libinternet-test.dir/DependInfo.cmake"
+  "src/bridge/CMakeFiles/libbridge-obj.dir/DependInfo.cmake"
+  "src/bridge/CMakeFiles/libbridge.dir/DependInfo.cmake"
+  "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/DependInfo.cmake"
+  "src/traffic-control/CMakeFiles/libtraffic-control.dir/DependInfo.cmake"
+  "src/traffic-control/CMakeFiles/libtraffic-control-test.dir/DependInfo.cmake"
+  "src/csma/CMakeFiles/libcsma-obj.dir/DependInfo.cmake"
+  "src/csma/CMakeFiles/libcsma.dir/DependInfo.cmake"
+  "src/config-store/CMakeFiles/libconfig-store-obj.dir/DependInfo.cmake"
+  "src/config-store/CMakeFiles/libconfig-store.dir/DependInfo.cmake"
+  "src/energy/CMakeFiles/libenergy-obj.dir/DependInfo.cmake"
+  "src/energy/CMakeFiles/libenergy.dir/DependInfo.cmake"
+  "src/energy/CMakeFiles/libenergy-test.dir/DependInfo.cmake"
+  "scratch/CMakeFiles/scratch_scratch-simulator.dir/DependInfo.cmake"
+  "scratch/CMakeFiles/scratch_subdir_scratch-subdir.dir/DependInfo.cmake"
+  "scratch/nested-subdir/CMakeFiles/scratch-nested-subdir-lib.dir/DependInfo.cmake"
+  "scratch/nested-subdir/CMakeFiles/scratch_nested-subdir_scratch-nested-subdir-executable.dir/DependInfo.cmake"
+  "utils/CMakeFiles/test-runner.dir/DependInfo.cmake"
+  "utils/CMakeFiles/bench-scheduler.dir/DependInfo.cmake"
+  "utils/CMakeFiles/bench-packets.dir/DependInfo.cmake"
+  "utils/CMakeFiles/print-introspected-doxygen.dir/DependInfo.cmake"
+  "utils/CMakeFiles/perf-io.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,56 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by CMake Version 3.25
+cmake_policy(SET CMP0009 NEW)
+
+# single_source_file_scratches at scratch/CMakeLists.txt:67 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/scratch/[^.]*.cc")
+set(OLD_GLOB
+  "/root/repo/scratch/scratch-simulator.cc"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_check_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# scratch_sources at scratch/CMakeLists.txt:98 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/scratch/nested-subdir/lib/[^.]*.cc")
+set(OLD_GLOB
+  "/root/repo/scratch/nested-subdir/lib/scratch-nested-subdir-library-source.cc"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_check_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# scratch_sources at scratch/CMakeLists.txt:98 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/scratch/subdir/[^.]*.cc")
+set(OLD_GLOB
+  "/root/repo/scratch/subdir/scratch-subdir-additional-header.cc"
+  "/root/repo/scratch/subdir/scratch-subdir.cc"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_check_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# scratch_subdirectories at scratch/CMakeLists.txt:74 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES true "/root/repo/scratch/**")
+set(OLD_GLOB
+  "/root/repo/scratch/.gitignore"
+  "/root/repo/scratch/CMakeLists.txt"
+  "/root/repo/scratch/nested-subdir"
+  "/root/repo/scratch/nested-subdir/CMakeLists.txt"
+  "/root/repo/scratch/nested-subdir/lib"
+  "/root/repo/scratch/nested-subdir/lib/scratch-nested-subdir-library-header.h"
+  "/root/repo/scratch/nested-subdir/lib/scratch-nested-subdir-library-source.cc"
+  "/root/repo/scratch/nested-subdir/scratch-nested-subdir-executable.cc"
+  "/root/repo/scratch/scratch-simulator.cc"
+  "/root/repo/scratch/subdir"
+  "/root/repo/scratch/subdir/scratch-subdir-additional-header.cc"
+  "/root/repo/scratch/subdir/scratch-subdir-additional-header.h"
+  "/root/repo/scratch/subdir/scratch-subdir.cc"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_check_build/CMakeFiles/cmake.verify_globs")
+endif()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/assemble-introspected-command-line"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/assemble-introspected-command-line.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sphinx_models"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/sphinx_models.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/uninstall_pkgconfig_antenna"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/uninstall_pkgconfig_antenna.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
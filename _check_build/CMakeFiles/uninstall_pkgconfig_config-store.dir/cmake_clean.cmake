@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/uninstall_pkgconfig_config-store"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/uninstall_pkgconfig_config-store.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/scratch/subdir/scratch-subdir-additional-header.cc" "scratch/CMakeFiles/scratch_subdir_scratch-subdir.dir/subdir/scratch-subdir-additional-header.cc.o" "gcc" "scratch/CMakeFiles/scratch_subdir_scratch-subdir.dir/subdir/scratch-subdir-additional-header.cc.o.d"
+  "/root/repo/scratch/subdir/scratch-subdir.cc" "scratch/CMakeFiles/scratch_subdir_scratch-subdir.dir/subdir/scratch-subdir.cc.o" "gcc" "scratch/CMakeFiles/scratch_subdir_scratch-subdir.dir/subdir/scratch-subdir.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_check_build/src/wifi/CMakeFiles/libwifi.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/lte/CMakeFiles/liblte.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/energy/CMakeFiles/libenergy.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/config-store/CMakeFiles/libconfig-store.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/csma/CMakeFiles/libcsma.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/applications/CMakeFiles/libapplications.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/internet/CMakeFiles/libinternet.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/traffic-control/CMakeFiles/libtraffic-control.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/bridge/CMakeFiles/libbridge.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/point-to-point/CMakeFiles/libpoint-to-point.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/virtual-net-device/CMakeFiles/libvirtual-net-device.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/buildings/CMakeFiles/libbuildings.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/spectrum/CMakeFiles/libspectrum.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/antenna/CMakeFiles/libantenna.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/propagation/CMakeFiles/libpropagation.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/mobility/CMakeFiles/libmobility.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/fd-net-device/CMakeFiles/libfd-net-device.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/network/CMakeFiles/libnetwork.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/stats/CMakeFiles/libstats.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/core/CMakeFiles/libcore.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,26 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src
+# Build directory: /root/repo/_check_build/src
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("lte")
+subdirs("wifi")
+subdirs("fd-net-device")
+subdirs("network")
+subdirs("core")
+subdirs("stats")
+subdirs("spectrum")
+subdirs("propagation")
+subdirs("mobility")
+subdirs("antenna")
+subdirs("buildings")
+subdirs("virtual-net-device")
+subdirs("point-to-point")
+subdirs("applications")
+subdirs("internet")
+subdirs("bridge")
+subdirs("traffic-control")
+subdirs("csma")
+subdirs("config-store")
+subdirs("energy")
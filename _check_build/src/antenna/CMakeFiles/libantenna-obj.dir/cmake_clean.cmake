@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libantenna-obj.dir/model/angles.cc.o"
+  "CMakeFiles/libantenna-obj.dir/model/angles.cc.o.d"
+  "CMakeFiles/libantenna-obj.dir/model/antenna-model.cc.o"
+  "CMakeFiles/libantenna-obj.dir/model/antenna-model.cc.o.d"
+  "CMakeFiles/libantenna-obj.dir/model/cosine-antenna-model.cc.o"
+  "CMakeFiles/libantenna-obj.dir/model/cosine-antenna-model.cc.o.d"
+  "CMakeFiles/libantenna-obj.dir/model/isotropic-antenna-model.cc.o"
+  "CMakeFiles/libantenna-obj.dir/model/isotropic-antenna-model.cc.o.d"
+  "CMakeFiles/libantenna-obj.dir/model/parabolic-antenna-model.cc.o"
+  "CMakeFiles/libantenna-obj.dir/model/parabolic-antenna-model.cc.o.d"
+  "CMakeFiles/libantenna-obj.dir/model/phased-array-model.cc.o"
+  "CMakeFiles/libantenna-obj.dir/model/phased-array-model.cc.o.d"
+  "CMakeFiles/libantenna-obj.dir/model/three-gpp-antenna-model.cc.o"
+  "CMakeFiles/libantenna-obj.dir/model/three-gpp-antenna-model.cc.o.d"
+  "CMakeFiles/libantenna-obj.dir/model/uniform-planar-array.cc.o"
+  "CMakeFiles/libantenna-obj.dir/model/uniform-planar-array.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libantenna-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
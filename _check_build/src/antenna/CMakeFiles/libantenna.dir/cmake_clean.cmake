@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/lib/libns3-dev-antenna-debug.pdb"
+  "/root/repo/build/lib/libns3-dev-antenna-debug.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libantenna.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
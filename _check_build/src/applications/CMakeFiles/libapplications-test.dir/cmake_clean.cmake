@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/lib/libns3-dev-applications-test-debug.pdb"
+  "/root/repo/build/lib/libns3-dev-applications-test-debug.so"
+  "CMakeFiles/libapplications-test.dir/test/bulk-send-application-test-suite.cc.o"
+  "CMakeFiles/libapplications-test.dir/test/bulk-send-application-test-suite.cc.o.d"
+  "CMakeFiles/libapplications-test.dir/test/three-gpp-http-client-server-test.cc.o"
+  "CMakeFiles/libapplications-test.dir/test/three-gpp-http-client-server-test.cc.o.d"
+  "CMakeFiles/libapplications-test.dir/test/udp-client-server-test.cc.o"
+  "CMakeFiles/libapplications-test.dir/test/udp-client-server-test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libapplications-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
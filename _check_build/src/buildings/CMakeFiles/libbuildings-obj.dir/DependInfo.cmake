@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/buildings/helper/building-allocator.cc" "src/buildings/CMakeFiles/libbuildings-obj.dir/helper/building-allocator.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-obj.dir/helper/building-allocator.cc.o.d"
+  "/root/repo/src/buildings/helper/building-container.cc" "src/buildings/CMakeFiles/libbuildings-obj.dir/helper/building-container.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-obj.dir/helper/building-container.cc.o.d"
+  "/root/repo/src/buildings/helper/building-position-allocator.cc" "src/buildings/CMakeFiles/libbuildings-obj.dir/helper/building-position-allocator.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-obj.dir/helper/building-position-allocator.cc.o.d"
+  "/root/repo/src/buildings/helper/buildings-helper.cc" "src/buildings/CMakeFiles/libbuildings-obj.dir/helper/buildings-helper.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-obj.dir/helper/buildings-helper.cc.o.d"
+  "/root/repo/src/buildings/model/building-list.cc" "src/buildings/CMakeFiles/libbuildings-obj.dir/model/building-list.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-obj.dir/model/building-list.cc.o.d"
+  "/root/repo/src/buildings/model/building.cc" "src/buildings/CMakeFiles/libbuildings-obj.dir/model/building.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-obj.dir/model/building.cc.o.d"
+  "/root/repo/src/buildings/model/buildings-channel-condition-model.cc" "src/buildings/CMakeFiles/libbuildings-obj.dir/model/buildings-channel-condition-model.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-obj.dir/model/buildings-channel-condition-model.cc.o.d"
+  "/root/repo/src/buildings/model/buildings-propagation-loss-model.cc" "src/buildings/CMakeFiles/libbuildings-obj.dir/model/buildings-propagation-loss-model.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-obj.dir/model/buildings-propagation-loss-model.cc.o.d"
+  "/root/repo/src/buildings/model/hybrid-buildings-propagation-loss-model.cc" "src/buildings/CMakeFiles/libbuildings-obj.dir/model/hybrid-buildings-propagation-loss-model.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-obj.dir/model/hybrid-buildings-propagation-loss-model.cc.o.d"
+  "/root/repo/src/buildings/model/itu-r-1238-propagation-loss-model.cc" "src/buildings/CMakeFiles/libbuildings-obj.dir/model/itu-r-1238-propagation-loss-model.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-obj.dir/model/itu-r-1238-propagation-loss-model.cc.o.d"
+  "/root/repo/src/buildings/model/mobility-building-info.cc" "src/buildings/CMakeFiles/libbuildings-obj.dir/model/mobility-building-info.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-obj.dir/model/mobility-building-info.cc.o.d"
+  "/root/repo/src/buildings/model/oh-buildings-propagation-loss-model.cc" "src/buildings/CMakeFiles/libbuildings-obj.dir/model/oh-buildings-propagation-loss-model.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-obj.dir/model/oh-buildings-propagation-loss-model.cc.o.d"
+  "/root/repo/src/buildings/model/random-walk-2d-outdoor-mobility-model.cc" "src/buildings/CMakeFiles/libbuildings-obj.dir/model/random-walk-2d-outdoor-mobility-model.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-obj.dir/model/random-walk-2d-outdoor-mobility-model.cc.o.d"
+  "/root/repo/src/buildings/model/three-gpp-v2v-channel-condition-model.cc" "src/buildings/CMakeFiles/libbuildings-obj.dir/model/three-gpp-v2v-channel-condition-model.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-obj.dir/model/three-gpp-v2v-channel-condition-model.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libbuildings-obj.dir/helper/building-allocator.cc.o"
+  "CMakeFiles/libbuildings-obj.dir/helper/building-allocator.cc.o.d"
+  "CMakeFiles/libbuildings-obj.dir/helper/building-container.cc.o"
+  "CMakeFiles/libbuildings-obj.dir/helper/building-container.cc.o.d"
+  "CMakeFiles/libbuildings-obj.dir/helper/building-position-allocator.cc.o"
+  "CMakeFiles/libbuildings-obj.dir/helper/building-position-allocator.cc.o.d"
+  "CMakeFiles/libbuildings-obj.dir/helper/buildings-helper.cc.o"
+  "CMakeFiles/libbuildings-obj.dir/helper/buildings-helper.cc.o.d"
+  "CMakeFiles/libbuildings-obj.dir/model/building-list.cc.o"
+  "CMakeFiles/libbuildings-obj.dir/model/building-list.cc.o.d"
+  "CMakeFiles/libbuildings-obj.dir/model/building.cc.o"
+  "CMakeFiles/libbuildings-obj.dir/model/building.cc.o.d"
+  "CMakeFiles/libbuildings-obj.dir/model/buildings-channel-condition-model.cc.o"
+  "CMakeFiles/libbuildings-obj.dir/model/buildings-channel-condition-model.cc.o.d"
+  "CMakeFiles/libbuildings-obj.dir/model/buildings-propagation-loss-model.cc.o"
+  "CMakeFiles/libbuildings-obj.dir/model/buildings-propagation-loss-model.cc.o.d"
+  "CMakeFiles/libbuildings-obj.dir/model/hybrid-buildings-propagation-loss-model.cc.o"
+  "CMakeFiles/libbuildings-obj.dir/model/hybrid-buildings-propagation-loss-model.cc.o.d"
+  "CMakeFiles/libbuildings-obj.dir/model/itu-r-1238-propagation-loss-model.cc.o"
+  "CMakeFiles/libbuildings-obj.dir/model/itu-r-1238-propagation-loss-model.cc.o.d"
+  "CMakeFiles/libbuildings-obj.dir/model/mobility-building-info.cc.o"
+  "CMakeFiles/libbuildings-obj.dir/model/mobility-building-info.cc.o.d"
+  "CMakeFiles/libbuildings-obj.dir/model/oh-buildings-propagation-loss-model.cc.o"
+  "CMakeFiles/libbuildings-obj.dir/model/oh-buildings-propagation-loss-model.cc.o.d"
+  "CMakeFiles/libbuildings-obj.dir/model/random-walk-2d-outdoor-mobility-model.cc.o"
+  "CMakeFiles/libbuildings-obj.dir/model/random-walk-2d-outdoor-mobility-model.cc.o.d"
+  "CMakeFiles/libbuildings-obj.dir/model/three-gpp-v2v-channel-condition-model.cc.o"
+  "CMakeFiles/libbuildings-obj.dir/model/three-gpp-v2v-channel-condition-model.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libbuildings-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
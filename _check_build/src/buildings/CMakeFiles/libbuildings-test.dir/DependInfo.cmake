@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/buildings/test/building-position-allocator-test.cc" "src/buildings/CMakeFiles/libbuildings-test.dir/test/building-position-allocator-test.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-test.dir/test/building-position-allocator-test.cc.o.d"
+  "/root/repo/src/buildings/test/buildings-channel-condition-model-test.cc" "src/buildings/CMakeFiles/libbuildings-test.dir/test/buildings-channel-condition-model-test.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-test.dir/test/buildings-channel-condition-model-test.cc.o.d"
+  "/root/repo/src/buildings/test/buildings-helper-test.cc" "src/buildings/CMakeFiles/libbuildings-test.dir/test/buildings-helper-test.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-test.dir/test/buildings-helper-test.cc.o.d"
+  "/root/repo/src/buildings/test/buildings-pathloss-test.cc" "src/buildings/CMakeFiles/libbuildings-test.dir/test/buildings-pathloss-test.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-test.dir/test/buildings-pathloss-test.cc.o.d"
+  "/root/repo/src/buildings/test/buildings-penetration-loss-pathloss-test.cc" "src/buildings/CMakeFiles/libbuildings-test.dir/test/buildings-penetration-loss-pathloss-test.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-test.dir/test/buildings-penetration-loss-pathloss-test.cc.o.d"
+  "/root/repo/src/buildings/test/buildings-shadowing-test.cc" "src/buildings/CMakeFiles/libbuildings-test.dir/test/buildings-shadowing-test.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-test.dir/test/buildings-shadowing-test.cc.o.d"
+  "/root/repo/src/buildings/test/outdoor-random-walk-test.cc" "src/buildings/CMakeFiles/libbuildings-test.dir/test/outdoor-random-walk-test.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-test.dir/test/outdoor-random-walk-test.cc.o.d"
+  "/root/repo/src/buildings/test/three-gpp-v2v-channel-condition-model-test.cc" "src/buildings/CMakeFiles/libbuildings-test.dir/test/three-gpp-v2v-channel-condition-model-test.cc.o" "gcc" "src/buildings/CMakeFiles/libbuildings-test.dir/test/three-gpp-v2v-channel-condition-model-test.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_check_build/src/buildings/CMakeFiles/libbuildings.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/propagation/CMakeFiles/libpropagation.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/mobility/CMakeFiles/libmobility.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/network/CMakeFiles/libnetwork.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/stats/CMakeFiles/libstats.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/core/CMakeFiles/libcore.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/lib/libns3-dev-buildings-test-debug.pdb"
+  "/root/repo/build/lib/libns3-dev-buildings-test-debug.so"
+  "CMakeFiles/libbuildings-test.dir/test/building-position-allocator-test.cc.o"
+  "CMakeFiles/libbuildings-test.dir/test/building-position-allocator-test.cc.o.d"
+  "CMakeFiles/libbuildings-test.dir/test/buildings-channel-condition-model-test.cc.o"
+  "CMakeFiles/libbuildings-test.dir/test/buildings-channel-condition-model-test.cc.o.d"
+  "CMakeFiles/libbuildings-test.dir/test/buildings-helper-test.cc.o"
+  "CMakeFiles/libbuildings-test.dir/test/buildings-helper-test.cc.o.d"
+  "CMakeFiles/libbuildings-test.dir/test/buildings-pathloss-test.cc.o"
+  "CMakeFiles/libbuildings-test.dir/test/buildings-pathloss-test.cc.o.d"
+  "CMakeFiles/libbuildings-test.dir/test/buildings-penetration-loss-pathloss-test.cc.o"
+  "CMakeFiles/libbuildings-test.dir/test/buildings-penetration-loss-pathloss-test.cc.o.d"
+  "CMakeFiles/libbuildings-test.dir/test/buildings-shadowing-test.cc.o"
+  "CMakeFiles/libbuildings-test.dir/test/buildings-shadowing-test.cc.o.d"
+  "CMakeFiles/libbuildings-test.dir/test/outdoor-random-walk-test.cc.o"
+  "CMakeFiles/libbuildings-test.dir/test/outdoor-random-walk-test.cc.o.d"
+  "CMakeFiles/libbuildings-test.dir/test/three-gpp-v2v-channel-condition-model-test.cc.o"
+  "CMakeFiles/libbuildings-test.dir/test/three-gpp-v2v-channel-condition-model-test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libbuildings-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/csma/helper/csma-helper.cc" "src/csma/CMakeFiles/libcsma-obj.dir/helper/csma-helper.cc.o" "gcc" "src/csma/CMakeFiles/libcsma-obj.dir/helper/csma-helper.cc.o.d"
+  "/root/repo/src/csma/model/backoff.cc" "src/csma/CMakeFiles/libcsma-obj.dir/model/backoff.cc.o" "gcc" "src/csma/CMakeFiles/libcsma-obj.dir/model/backoff.cc.o.d"
+  "/root/repo/src/csma/model/csma-channel.cc" "src/csma/CMakeFiles/libcsma-obj.dir/model/csma-channel.cc.o" "gcc" "src/csma/CMakeFiles/libcsma-obj.dir/model/csma-channel.cc.o.d"
+  "/root/repo/src/csma/model/csma-net-device.cc" "src/csma/CMakeFiles/libcsma-obj.dir/model/csma-net-device.cc.o" "gcc" "src/csma/CMakeFiles/libcsma-obj.dir/model/csma-net-device.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libcsma-obj.dir/helper/csma-helper.cc.o"
+  "CMakeFiles/libcsma-obj.dir/helper/csma-helper.cc.o.d"
+  "CMakeFiles/libcsma-obj.dir/model/backoff.cc.o"
+  "CMakeFiles/libcsma-obj.dir/model/backoff.cc.o.d"
+  "CMakeFiles/libcsma-obj.dir/model/csma-channel.cc.o"
+  "CMakeFiles/libcsma-obj.dir/model/csma-channel.cc.o.d"
+  "CMakeFiles/libcsma-obj.dir/model/csma-net-device.cc.o"
+  "CMakeFiles/libcsma-obj.dir/model/csma-net-device.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libcsma-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libenergy-obj.dir/helper/basic-energy-harvester-helper.cc.o"
+  "CMakeFiles/libenergy-obj.dir/helper/basic-energy-harvester-helper.cc.o.d"
+  "CMakeFiles/libenergy-obj.dir/helper/basic-energy-source-helper.cc.o"
+  "CMakeFiles/libenergy-obj.dir/helper/basic-energy-source-helper.cc.o.d"
+  "CMakeFiles/libenergy-obj.dir/helper/energy-harvester-container.cc.o"
+  "CMakeFiles/libenergy-obj.dir/helper/energy-harvester-container.cc.o.d"
+  "CMakeFiles/libenergy-obj.dir/helper/energy-harvester-helper.cc.o"
+  "CMakeFiles/libenergy-obj.dir/helper/energy-harvester-helper.cc.o.d"
+  "CMakeFiles/libenergy-obj.dir/helper/energy-model-helper.cc.o"
+  "CMakeFiles/libenergy-obj.dir/helper/energy-model-helper.cc.o.d"
+  "CMakeFiles/libenergy-obj.dir/helper/energy-source-container.cc.o"
+  "CMakeFiles/libenergy-obj.dir/helper/energy-source-container.cc.o.d"
+  "CMakeFiles/libenergy-obj.dir/helper/generic-battery-model-helper.cc.o"
+  "CMakeFiles/libenergy-obj.dir/helper/generic-battery-model-helper.cc.o.d"
+  "CMakeFiles/libenergy-obj.dir/helper/li-ion-energy-source-helper.cc.o"
+  "CMakeFiles/libenergy-obj.dir/helper/li-ion-energy-source-helper.cc.o.d"
+  "CMakeFiles/libenergy-obj.dir/helper/rv-battery-model-helper.cc.o"
+  "CMakeFiles/libenergy-obj.dir/helper/rv-battery-model-helper.cc.o.d"
+  "CMakeFiles/libenergy-obj.dir/model/basic-energy-harvester.cc.o"
+  "CMakeFiles/libenergy-obj.dir/model/basic-energy-harvester.cc.o.d"
+  "CMakeFiles/libenergy-obj.dir/model/basic-energy-source.cc.o"
+  "CMakeFiles/libenergy-obj.dir/model/basic-energy-source.cc.o.d"
+  "CMakeFiles/libenergy-obj.dir/model/device-energy-model-container.cc.o"
+  "CMakeFiles/libenergy-obj.dir/model/device-energy-model-container.cc.o.d"
+  "CMakeFiles/libenergy-obj.dir/model/device-energy-model.cc.o"
+  "CMakeFiles/libenergy-obj.dir/model/device-energy-model.cc.o.d"
+  "CMakeFiles/libenergy-obj.dir/model/energy-harvester.cc.o"
+  "CMakeFiles/libenergy-obj.dir/model/energy-harvester.cc.o.d"
+  "CMakeFiles/libenergy-obj.dir/model/energy-source.cc.o"
+  "CMakeFiles/libenergy-obj.dir/model/energy-source.cc.o.d"
+  "CMakeFiles/libenergy-obj.dir/model/generic-battery-model.cc.o"
+  "CMakeFiles/libenergy-obj.dir/model/generic-battery-model.cc.o.d"
+  "CMakeFiles/libenergy-obj.dir/model/li-ion-energy-source.cc.o"
+  "CMakeFiles/libenergy-obj.dir/model/li-ion-energy-source.cc.o.d"
+  "CMakeFiles/libenergy-obj.dir/model/rv-battery-model.cc.o"
+  "CMakeFiles/libenergy-obj.dir/model/rv-battery-model.cc.o.d"
+  "CMakeFiles/libenergy-obj.dir/model/simple-device-energy-model.cc.o"
+  "CMakeFiles/libenergy-obj.dir/model/simple-device-energy-model.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libenergy-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
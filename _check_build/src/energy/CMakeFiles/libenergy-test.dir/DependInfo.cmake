@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/energy/test/basic-energy-harvester-test.cc" "src/energy/CMakeFiles/libenergy-test.dir/test/basic-energy-harvester-test.cc.o" "gcc" "src/energy/CMakeFiles/libenergy-test.dir/test/basic-energy-harvester-test.cc.o.d"
+  "/root/repo/src/energy/test/li-ion-energy-source-test.cc" "src/energy/CMakeFiles/libenergy-test.dir/test/li-ion-energy-source-test.cc.o" "gcc" "src/energy/CMakeFiles/libenergy-test.dir/test/li-ion-energy-source-test.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_check_build/src/energy/CMakeFiles/libenergy.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/network/CMakeFiles/libnetwork.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/stats/CMakeFiles/libstats.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/core/CMakeFiles/libcore.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/lib/libns3-dev-energy-test-debug.pdb"
+  "/root/repo/build/lib/libns3-dev-energy-test-debug.so"
+  "CMakeFiles/libenergy-test.dir/test/basic-energy-harvester-test.cc.o"
+  "CMakeFiles/libenergy-test.dir/test/basic-energy-harvester-test.cc.o.d"
+  "CMakeFiles/libenergy-test.dir/test/li-ion-energy-source-test.cc.o"
+  "CMakeFiles/libenergy-test.dir/test/li-ion-energy-source-test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libenergy-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libfd-net-device-obj.dir/helper/creator-utils.cc.o"
+  "CMakeFiles/libfd-net-device-obj.dir/helper/creator-utils.cc.o.d"
+  "CMakeFiles/libfd-net-device-obj.dir/helper/emu-fd-net-device-helper.cc.o"
+  "CMakeFiles/libfd-net-device-obj.dir/helper/emu-fd-net-device-helper.cc.o.d"
+  "CMakeFiles/libfd-net-device-obj.dir/helper/encode-decode.cc.o"
+  "CMakeFiles/libfd-net-device-obj.dir/helper/encode-decode.cc.o.d"
+  "CMakeFiles/libfd-net-device-obj.dir/helper/fd-net-device-helper.cc.o"
+  "CMakeFiles/libfd-net-device-obj.dir/helper/fd-net-device-helper.cc.o.d"
+  "CMakeFiles/libfd-net-device-obj.dir/helper/tap-fd-net-device-helper.cc.o"
+  "CMakeFiles/libfd-net-device-obj.dir/helper/tap-fd-net-device-helper.cc.o.d"
+  "CMakeFiles/libfd-net-device-obj.dir/model/fd-net-device.cc.o"
+  "CMakeFiles/libfd-net-device-obj.dir/model/fd-net-device.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libfd-net-device-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/fd-net-device/helper/creator-utils.cc" "src/fd-net-device/CMakeFiles/raw-sock-creator.dir/helper/creator-utils.cc.o" "gcc" "src/fd-net-device/CMakeFiles/raw-sock-creator.dir/helper/creator-utils.cc.o.d"
+  "/root/repo/src/fd-net-device/helper/encode-decode.cc" "src/fd-net-device/CMakeFiles/raw-sock-creator.dir/helper/encode-decode.cc.o" "gcc" "src/fd-net-device/CMakeFiles/raw-sock-creator.dir/helper/encode-decode.cc.o.d"
+  "/root/repo/src/fd-net-device/helper/raw-sock-creator.cc" "src/fd-net-device/CMakeFiles/raw-sock-creator.dir/helper/raw-sock-creator.cc.o" "gcc" "src/fd-net-device/CMakeFiles/raw-sock-creator.dir/helper/raw-sock-creator.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/src/fd-net-device/ns3-dev-raw-sock-creator-debug"
+  "/root/repo/build/src/fd-net-device/ns3-dev-raw-sock-creator-debug.pdb"
+  "CMakeFiles/raw-sock-creator.dir/helper/creator-utils.cc.o"
+  "CMakeFiles/raw-sock-creator.dir/helper/creator-utils.cc.o.d"
+  "CMakeFiles/raw-sock-creator.dir/helper/encode-decode.cc.o"
+  "CMakeFiles/raw-sock-creator.dir/helper/encode-decode.cc.o.d"
+  "CMakeFiles/raw-sock-creator.dir/helper/raw-sock-creator.cc.o"
+  "CMakeFiles/raw-sock-creator.dir/helper/raw-sock-creator.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/raw-sock-creator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
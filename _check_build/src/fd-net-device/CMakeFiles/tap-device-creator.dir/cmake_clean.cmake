@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/src/fd-net-device/ns3-dev-tap-device-creator-debug"
+  "/root/repo/build/src/fd-net-device/ns3-dev-tap-device-creator-debug.pdb"
+  "CMakeFiles/tap-device-creator.dir/helper/creator-utils.cc.o"
+  "CMakeFiles/tap-device-creator.dir/helper/creator-utils.cc.o.d"
+  "CMakeFiles/tap-device-creator.dir/helper/encode-decode.cc.o"
+  "CMakeFiles/tap-device-creator.dir/helper/encode-decode.cc.o.d"
+  "CMakeFiles/tap-device-creator.dir/helper/tap-device-creator.cc.o"
+  "CMakeFiles/tap-device-creator.dir/helper/tap-device-creator.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tap-device-creator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/uninstall_tap-device-creator"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/uninstall_tap-device-creator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/fd-net-device
+# Build directory: /root/repo/_check_build/src/fd-net-device
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ctest-raw-sock-creator "ns3-dev-raw-sock-creator-debug")
+set_tests_properties(ctest-raw-sock-creator PROPERTIES  WORKING_DIRECTORY "/root/repo/build/src/fd-net-device/" _BACKTRACE_TRIPLES "/root/repo/build-support/custom-modules/ns3-executables.cmake;47;add_test;/root/repo/build-support/custom-modules/ns3-executables.cmake;122;set_runtime_outputdirectory;/root/repo/src/fd-net-device/CMakeLists.txt;156;build_exec;/root/repo/src/fd-net-device/CMakeLists.txt;0;")
+add_test(ctest-tap-device-creator "ns3-dev-tap-device-creator-debug")
+set_tests_properties(ctest-tap-device-creator PROPERTIES  WORKING_DIRECTORY "/root/repo/build/src/fd-net-device/" _BACKTRACE_TRIPLES "/root/repo/build-support/custom-modules/ns3-executables.cmake;47;add_test;/root/repo/build-support/custom-modules/ns3-executables.cmake;122;set_runtime_outputdirectory;/root/repo/src/fd-net-device/CMakeLists.txt;194;build_exec;/root/repo/src/fd-net-device/CMakeLists.txt;0;")
@@ -0,0 +1,193 @@
+# Install script for directory: /root/repo/src/internet
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-internet-debug.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-internet-debug.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-internet-debug.so"
+         RPATH "/usr/local/lib:$ORIGIN/:$ORIGIN/../lib")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/build/lib/libns3-dev-internet-debug.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-internet-debug.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-internet-debug.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-internet-debug.so"
+         OLD_RPATH "/root/repo/build/lib::::::::::::::::::"
+         NEW_RPATH "/usr/local/lib:$ORIGIN/:$ORIGIN/../lib")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-internet-debug.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/ns3" TYPE FILE FILES
+    "/root/repo/src/internet/helper/internet-stack-helper.h"
+    "/root/repo/src/internet/helper/internet-trace-helper.h"
+    "/root/repo/src/internet/helper/ipv4-address-helper.h"
+    "/root/repo/src/internet/helper/ipv4-global-routing-helper.h"
+    "/root/repo/src/internet/helper/ipv4-interface-container.h"
+    "/root/repo/src/internet/helper/ipv4-list-routing-helper.h"
+    "/root/repo/src/internet/helper/ipv4-routing-helper.h"
+    "/root/repo/src/internet/helper/ipv4-static-routing-helper.h"
+    "/root/repo/src/internet/helper/ipv6-address-helper.h"
+    "/root/repo/src/internet/helper/ipv6-interface-container.h"
+    "/root/repo/src/internet/helper/ipv6-list-routing-helper.h"
+    "/root/repo/src/internet/helper/ipv6-routing-helper.h"
+    "/root/repo/src/internet/helper/ipv6-static-routing-helper.h"
+    "/root/repo/src/internet/helper/neighbor-cache-helper.h"
+    "/root/repo/src/internet/helper/rip-helper.h"
+    "/root/repo/src/internet/helper/ripng-helper.h"
+    "/root/repo/src/internet/model/arp-cache.h"
+    "/root/repo/src/internet/model/arp-header.h"
+    "/root/repo/src/internet/model/arp-l3-protocol.h"
+    "/root/repo/src/internet/model/arp-queue-disc-item.h"
+    "/root/repo/src/internet/model/candidate-queue.h"
+    "/root/repo/src/internet/model/global-route-manager-impl.h"
+    "/root/repo/src/internet/model/global-route-manager.h"
+    "/root/repo/src/internet/model/global-router-interface.h"
+    "/root/repo/src/internet/model/icmpv4-l4-protocol.h"
+    "/root/repo/src/internet/model/icmpv4.h"
+    "/root/repo/src/internet/model/icmpv6-header.h"
+    "/root/repo/src/internet/model/icmpv6-l4-protocol.h"
+    "/root/repo/src/internet/model/ip-l4-protocol.h"
+    "/root/repo/src/internet/model/ipv4-address-generator.h"
+    "/root/repo/src/internet/model/ipv4-end-point-demux.h"
+    "/root/repo/src/internet/model/ipv4-end-point.h"
+    "/root/repo/src/internet/model/ipv4-global-routing.h"
+    "/root/repo/src/internet/model/ipv4-header.h"
+    "/root/repo/src/internet/model/ipv4-interface-address.h"
+    "/root/repo/src/internet/model/ipv4-interface.h"
+    "/root/repo/src/internet/model/ipv4-l3-protocol.h"
+    "/root/repo/src/internet/model/ipv4-list-routing.h"
+    "/root/repo/src/internet/model/ipv4-packet-filter.h"
+    "/root/repo/src/internet/model/ipv4-packet-info-tag.h"
+    "/root/repo/src/internet/model/ipv4-packet-probe.h"
+    "/root/repo/src/internet/model/ipv4-queue-disc-item.h"
+    "/root/repo/src/internet/model/ipv4-raw-socket-factory.h"
+    "/root/repo/src/internet/model/ipv4-raw-socket-impl.h"
+    "/root/repo/src/internet/model/ipv4-route.h"
+    "/root/repo/src/internet/model/ipv4-routing-protocol.h"
+    "/root/repo/src/internet/model/ipv4-routing-table-entry.h"
+    "/root/repo/src/internet/model/ipv4-static-routing.h"
+    "/root/repo/src/internet/model/ipv4.h"
+    "/root/repo/src/internet/model/ipv6-address-generator.h"
+    "/root/repo/src/internet/model/ipv6-end-point-demux.h"
+    "/root/repo/src/internet/model/ipv6-end-point.h"
+    "/root/repo/src/internet/model/ipv6-extension-demux.h"
+    "/root/repo/src/internet/model/ipv6-extension-header.h"
+    "/root/repo/src/internet/model/ipv6-extension.h"
+    "/root/repo/src/internet/model/ipv6-header.h"
+    "/root/repo/src/internet/model/ipv6-interface-address.h"
+    "/root/repo/src/internet/model/ipv6-interface.h"
+    "/root/repo/src/internet/model/ipv6-l3-protocol.h"
+    "/root/repo/src/internet/model/ipv6-list-routing.h"
+    "/root/repo/src/internet/model/ipv6-option-header.h"
+    "/root/repo/src/internet/model/ipv6-option.h"
+    "/root/repo/src/internet/model/ipv6-packet-filter.h"
+    "/root/repo/src/internet/model/ipv6-packet-info-tag.h"
+    "/root/repo/src/internet/model/ipv6-packet-probe.h"
+    "/root/repo/src/internet/model/ipv6-pmtu-cache.h"
+    "/root/repo/src/internet/model/ipv6-queue-disc-item.h"
+    "/root/repo/src/internet/model/ipv6-raw-socket-factory.h"
+    "/root/repo/src/internet/model/ipv6-route.h"
+    "/root/repo/src/internet/model/ipv6-routing-protocol.h"
+    "/root/repo/src/internet/model/ipv6-routing-table-entry.h"
+    "/root/repo/src/internet/model/ipv6-static-routing.h"
+    "/root/repo/src/internet/model/ipv6.h"
+    "/root/repo/src/internet/model/loopback-net-device.h"
+    "/root/repo/src/internet/model/ndisc-cache.h"
+    "/root/repo/src/internet/model/rip-header.h"
+    "/root/repo/src/internet/model/rip.h"
+    "/root/repo/src/internet/model/ripng-header.h"
+    "/root/repo/src/internet/model/ripng.h"
+    "/root/repo/src/internet/model/rtt-estimator.h"
+    "/root/repo/src/internet/model/tcp-bbr.h"
+    "/root/repo/src/internet/model/tcp-bic.h"
+    "/root/repo/src/internet/model/tcp-congestion-ops.h"
+    "/root/repo/src/internet/model/tcp-cubic.h"
+    "/root/repo/src/internet/model/tcp-dctcp.h"
+    "/root/repo/src/internet/model/tcp-header.h"
+    "/root/repo/src/internet/model/tcp-highspeed.h"
+    "/root/repo/src/internet/model/tcp-htcp.h"
+    "/root/repo/src/internet/model/tcp-hybla.h"
+    "/root/repo/src/internet/model/tcp-illinois.h"
+    "/root/repo/src/internet/model/tcp-l4-protocol.h"
+    "/root/repo/src/internet/model/tcp-ledbat.h"
+    "/root/repo/src/internet/model/tcp-linux-reno.h"
+    "/root/repo/src/internet/model/tcp-lp.h"
+    "/root/repo/src/internet/model/tcp-option-rfc793.h"
+    "/root/repo/src/internet/model/tcp-option-sack-permitted.h"
+    "/root/repo/src/internet/model/tcp-option-sack.h"
+    "/root/repo/src/internet/model/tcp-option-ts.h"
+    "/root/repo/src/internet/model/tcp-option-winscale.h"
+    "/root/repo/src/internet/model/tcp-option.h"
+    "/root/repo/src/internet/model/tcp-prr-recovery.h"
+    "/root/repo/src/internet/model/tcp-rate-ops.h"
+    "/root/repo/src/internet/model/tcp-recovery-ops.h"
+    "/root/repo/src/internet/model/tcp-rx-buffer.h"
+    "/root/repo/src/internet/model/tcp-scalable.h"
+    "/root/repo/src/internet/model/tcp-socket-base.h"
+    "/root/repo/src/internet/model/tcp-socket-factory.h"
+    "/root/repo/src/internet/model/tcp-socket-state.h"
+    "/root/repo/src/internet/model/tcp-socket.h"
+    "/root/repo/src/internet/model/tcp-tx-buffer.h"
+    "/root/repo/src/internet/model/tcp-tx-item.h"
+    "/root/repo/src/internet/model/tcp-vegas.h"
+    "/root/repo/src/internet/model/tcp-veno.h"
+    "/root/repo/src/internet/model/tcp-westwood-plus.h"
+    "/root/repo/src/internet/model/tcp-yeah.h"
+    "/root/repo/src/internet/model/udp-header.h"
+    "/root/repo/src/internet/model/udp-l4-protocol.h"
+    "/root/repo/src/internet/model/udp-socket-factory.h"
+    "/root/repo/src/internet/model/udp-socket.h"
+    "/root/repo/src/internet/model/windowed-filter.h"
+    "/root/repo/build/include/ns3/internet-module.h"
+    )
+endif()
+
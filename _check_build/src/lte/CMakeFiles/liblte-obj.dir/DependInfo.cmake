@@ -0,0 +1,146 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/lte/helper/cc-helper.cc" "src/lte/CMakeFiles/liblte-obj.dir/helper/cc-helper.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/helper/cc-helper.cc.o.d"
+  "/root/repo/src/lte/helper/emu-epc-helper.cc" "src/lte/CMakeFiles/liblte-obj.dir/helper/emu-epc-helper.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/helper/emu-epc-helper.cc.o.d"
+  "/root/repo/src/lte/helper/epc-helper.cc" "src/lte/CMakeFiles/liblte-obj.dir/helper/epc-helper.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/helper/epc-helper.cc.o.d"
+  "/root/repo/src/lte/helper/lte-global-pathloss-database.cc" "src/lte/CMakeFiles/liblte-obj.dir/helper/lte-global-pathloss-database.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/helper/lte-global-pathloss-database.cc.o.d"
+  "/root/repo/src/lte/helper/lte-helper.cc" "src/lte/CMakeFiles/liblte-obj.dir/helper/lte-helper.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/helper/lte-helper.cc.o.d"
+  "/root/repo/src/lte/helper/lte-hex-grid-enb-topology-helper.cc" "src/lte/CMakeFiles/liblte-obj.dir/helper/lte-hex-grid-enb-topology-helper.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/helper/lte-hex-grid-enb-topology-helper.cc.o.d"
+  "/root/repo/src/lte/helper/lte-stats-calculator.cc" "src/lte/CMakeFiles/liblte-obj.dir/helper/lte-stats-calculator.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/helper/lte-stats-calculator.cc.o.d"
+  "/root/repo/src/lte/helper/mac-stats-calculator.cc" "src/lte/CMakeFiles/liblte-obj.dir/helper/mac-stats-calculator.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/helper/mac-stats-calculator.cc.o.d"
+  "/root/repo/src/lte/helper/no-backhaul-epc-helper.cc" "src/lte/CMakeFiles/liblte-obj.dir/helper/no-backhaul-epc-helper.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/helper/no-backhaul-epc-helper.cc.o.d"
+  "/root/repo/src/lte/helper/phy-rx-stats-calculator.cc" "src/lte/CMakeFiles/liblte-obj.dir/helper/phy-rx-stats-calculator.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/helper/phy-rx-stats-calculator.cc.o.d"
+  "/root/repo/src/lte/helper/phy-stats-calculator.cc" "src/lte/CMakeFiles/liblte-obj.dir/helper/phy-stats-calculator.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/helper/phy-stats-calculator.cc.o.d"
+  "/root/repo/src/lte/helper/phy-tx-stats-calculator.cc" "src/lte/CMakeFiles/liblte-obj.dir/helper/phy-tx-stats-calculator.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/helper/phy-tx-stats-calculator.cc.o.d"
+  "/root/repo/src/lte/helper/point-to-point-epc-helper.cc" "src/lte/CMakeFiles/liblte-obj.dir/helper/point-to-point-epc-helper.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/helper/point-to-point-epc-helper.cc.o.d"
+  "/root/repo/src/lte/helper/radio-bearer-stats-calculator.cc" "src/lte/CMakeFiles/liblte-obj.dir/helper/radio-bearer-stats-calculator.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/helper/radio-bearer-stats-calculator.cc.o.d"
+  "/root/repo/src/lte/helper/radio-bearer-stats-connector.cc" "src/lte/CMakeFiles/liblte-obj.dir/helper/radio-bearer-stats-connector.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/helper/radio-bearer-stats-connector.cc.o.d"
+  "/root/repo/src/lte/helper/radio-environment-map-helper.cc" "src/lte/CMakeFiles/liblte-obj.dir/helper/radio-environment-map-helper.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/helper/radio-environment-map-helper.cc.o.d"
+  "/root/repo/src/lte/model/a2-a4-rsrq-handover-algorithm.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/a2-a4-rsrq-handover-algorithm.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/a2-a4-rsrq-handover-algorithm.cc.o.d"
+  "/root/repo/src/lte/model/a3-rsrp-handover-algorithm.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/a3-rsrp-handover-algorithm.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/a3-rsrp-handover-algorithm.cc.o.d"
+  "/root/repo/src/lte/model/component-carrier-enb.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/component-carrier-enb.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/component-carrier-enb.cc.o.d"
+  "/root/repo/src/lte/model/component-carrier-ue.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/component-carrier-ue.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/component-carrier-ue.cc.o.d"
+  "/root/repo/src/lte/model/component-carrier.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/component-carrier.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/component-carrier.cc.o.d"
+  "/root/repo/src/lte/model/cqa-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/cqa-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/cqa-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/model/epc-enb-application.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-enb-application.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-enb-application.cc.o.d"
+  "/root/repo/src/lte/model/epc-enb-s1-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-enb-s1-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-enb-s1-sap.cc.o.d"
+  "/root/repo/src/lte/model/epc-gtpc-header.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-gtpc-header.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-gtpc-header.cc.o.d"
+  "/root/repo/src/lte/model/epc-gtpu-header.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-gtpu-header.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-gtpu-header.cc.o.d"
+  "/root/repo/src/lte/model/epc-mme-application.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-mme-application.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-mme-application.cc.o.d"
+  "/root/repo/src/lte/model/epc-pgw-application.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-pgw-application.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-pgw-application.cc.o.d"
+  "/root/repo/src/lte/model/epc-s11-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-s11-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-s11-sap.cc.o.d"
+  "/root/repo/src/lte/model/epc-s1ap-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-s1ap-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-s1ap-sap.cc.o.d"
+  "/root/repo/src/lte/model/epc-sgw-application.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-sgw-application.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-sgw-application.cc.o.d"
+  "/root/repo/src/lte/model/epc-tft-classifier.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-tft-classifier.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-tft-classifier.cc.o.d"
+  "/root/repo/src/lte/model/epc-tft.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-tft.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-tft.cc.o.d"
+  "/root/repo/src/lte/model/epc-ue-nas.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-ue-nas.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-ue-nas.cc.o.d"
+  "/root/repo/src/lte/model/epc-x2-header.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-x2-header.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-x2-header.cc.o.d"
+  "/root/repo/src/lte/model/epc-x2-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-x2-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-x2-sap.cc.o.d"
+  "/root/repo/src/lte/model/epc-x2.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-x2.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/epc-x2.cc.o.d"
+  "/root/repo/src/lte/model/eps-bearer-tag.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/eps-bearer-tag.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/eps-bearer-tag.cc.o.d"
+  "/root/repo/src/lte/model/eps-bearer.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/eps-bearer.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/eps-bearer.cc.o.d"
+  "/root/repo/src/lte/model/fdbet-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/fdbet-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/fdbet-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/model/fdmt-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/fdmt-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/fdmt-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/model/fdtbfq-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/fdtbfq-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/fdtbfq-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/model/ff-mac-common.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/ff-mac-common.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/ff-mac-common.cc.o.d"
+  "/root/repo/src/lte/model/ff-mac-csched-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/ff-mac-csched-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/ff-mac-csched-sap.cc.o.d"
+  "/root/repo/src/lte/model/ff-mac-sched-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/ff-mac-sched-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/ff-mac-sched-sap.cc.o.d"
+  "/root/repo/src/lte/model/ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/model/lte-amc.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-amc.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-amc.cc.o.d"
+  "/root/repo/src/lte/model/lte-anr-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-anr-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-anr-sap.cc.o.d"
+  "/root/repo/src/lte/model/lte-anr.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-anr.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-anr.cc.o.d"
+  "/root/repo/src/lte/model/lte-as-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-as-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-as-sap.cc.o.d"
+  "/root/repo/src/lte/model/lte-asn1-header.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-asn1-header.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-asn1-header.cc.o.d"
+  "/root/repo/src/lte/model/lte-ccm-mac-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ccm-mac-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ccm-mac-sap.cc.o.d"
+  "/root/repo/src/lte/model/lte-ccm-rrc-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ccm-rrc-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ccm-rrc-sap.cc.o.d"
+  "/root/repo/src/lte/model/lte-chunk-processor.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-chunk-processor.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-chunk-processor.cc.o.d"
+  "/root/repo/src/lte/model/lte-common.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-common.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-common.cc.o.d"
+  "/root/repo/src/lte/model/lte-control-messages.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-control-messages.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-control-messages.cc.o.d"
+  "/root/repo/src/lte/model/lte-enb-cmac-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-enb-cmac-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-enb-cmac-sap.cc.o.d"
+  "/root/repo/src/lte/model/lte-enb-component-carrier-manager.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-enb-component-carrier-manager.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-enb-component-carrier-manager.cc.o.d"
+  "/root/repo/src/lte/model/lte-enb-cphy-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-enb-cphy-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-enb-cphy-sap.cc.o.d"
+  "/root/repo/src/lte/model/lte-enb-mac.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-enb-mac.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-enb-mac.cc.o.d"
+  "/root/repo/src/lte/model/lte-enb-net-device.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-enb-net-device.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-enb-net-device.cc.o.d"
+  "/root/repo/src/lte/model/lte-enb-phy-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-enb-phy-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-enb-phy-sap.cc.o.d"
+  "/root/repo/src/lte/model/lte-enb-phy.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-enb-phy.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-enb-phy.cc.o.d"
+  "/root/repo/src/lte/model/lte-enb-rrc.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-enb-rrc.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-enb-rrc.cc.o.d"
+  "/root/repo/src/lte/model/lte-ffr-algorithm.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ffr-algorithm.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ffr-algorithm.cc.o.d"
+  "/root/repo/src/lte/model/lte-ffr-distributed-algorithm.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ffr-distributed-algorithm.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ffr-distributed-algorithm.cc.o.d"
+  "/root/repo/src/lte/model/lte-ffr-enhanced-algorithm.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ffr-enhanced-algorithm.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ffr-enhanced-algorithm.cc.o.d"
+  "/root/repo/src/lte/model/lte-ffr-rrc-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ffr-rrc-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ffr-rrc-sap.cc.o.d"
+  "/root/repo/src/lte/model/lte-ffr-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ffr-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ffr-sap.cc.o.d"
+  "/root/repo/src/lte/model/lte-ffr-soft-algorithm.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ffr-soft-algorithm.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ffr-soft-algorithm.cc.o.d"
+  "/root/repo/src/lte/model/lte-fr-hard-algorithm.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-fr-hard-algorithm.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-fr-hard-algorithm.cc.o.d"
+  "/root/repo/src/lte/model/lte-fr-no-op-algorithm.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-fr-no-op-algorithm.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-fr-no-op-algorithm.cc.o.d"
+  "/root/repo/src/lte/model/lte-fr-soft-algorithm.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-fr-soft-algorithm.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-fr-soft-algorithm.cc.o.d"
+  "/root/repo/src/lte/model/lte-fr-strict-algorithm.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-fr-strict-algorithm.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-fr-strict-algorithm.cc.o.d"
+  "/root/repo/src/lte/model/lte-handover-algorithm.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-handover-algorithm.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-handover-algorithm.cc.o.d"
+  "/root/repo/src/lte/model/lte-handover-management-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-handover-management-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-handover-management-sap.cc.o.d"
+  "/root/repo/src/lte/model/lte-harq-phy.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-harq-phy.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-harq-phy.cc.o.d"
+  "/root/repo/src/lte/model/lte-interference.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-interference.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-interference.cc.o.d"
+  "/root/repo/src/lte/model/lte-mac-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-mac-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-mac-sap.cc.o.d"
+  "/root/repo/src/lte/model/lte-mi-error-model.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-mi-error-model.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-mi-error-model.cc.o.d"
+  "/root/repo/src/lte/model/lte-net-device.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-net-device.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-net-device.cc.o.d"
+  "/root/repo/src/lte/model/lte-pdcp-header.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-pdcp-header.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-pdcp-header.cc.o.d"
+  "/root/repo/src/lte/model/lte-pdcp-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-pdcp-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-pdcp-sap.cc.o.d"
+  "/root/repo/src/lte/model/lte-pdcp-tag.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-pdcp-tag.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-pdcp-tag.cc.o.d"
+  "/root/repo/src/lte/model/lte-pdcp.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-pdcp.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-pdcp.cc.o.d"
+  "/root/repo/src/lte/model/lte-phy-tag.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-phy-tag.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-phy-tag.cc.o.d"
+  "/root/repo/src/lte/model/lte-phy.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-phy.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-phy.cc.o.d"
+  "/root/repo/src/lte/model/lte-radio-bearer-info.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-radio-bearer-info.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-radio-bearer-info.cc.o.d"
+  "/root/repo/src/lte/model/lte-radio-bearer-tag.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-radio-bearer-tag.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-radio-bearer-tag.cc.o.d"
+  "/root/repo/src/lte/model/lte-rlc-am-header.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rlc-am-header.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rlc-am-header.cc.o.d"
+  "/root/repo/src/lte/model/lte-rlc-am.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rlc-am.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rlc-am.cc.o.d"
+  "/root/repo/src/lte/model/lte-rlc-header.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rlc-header.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rlc-header.cc.o.d"
+  "/root/repo/src/lte/model/lte-rlc-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rlc-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rlc-sap.cc.o.d"
+  "/root/repo/src/lte/model/lte-rlc-sdu-status-tag.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rlc-sdu-status-tag.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rlc-sdu-status-tag.cc.o.d"
+  "/root/repo/src/lte/model/lte-rlc-sequence-number.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rlc-sequence-number.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rlc-sequence-number.cc.o.d"
+  "/root/repo/src/lte/model/lte-rlc-tag.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rlc-tag.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rlc-tag.cc.o.d"
+  "/root/repo/src/lte/model/lte-rlc-tm.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rlc-tm.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rlc-tm.cc.o.d"
+  "/root/repo/src/lte/model/lte-rlc-um.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rlc-um.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rlc-um.cc.o.d"
+  "/root/repo/src/lte/model/lte-rlc.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rlc.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rlc.cc.o.d"
+  "/root/repo/src/lte/model/lte-rrc-header.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rrc-header.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rrc-header.cc.o.d"
+  "/root/repo/src/lte/model/lte-rrc-protocol-ideal.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rrc-protocol-ideal.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rrc-protocol-ideal.cc.o.d"
+  "/root/repo/src/lte/model/lte-rrc-protocol-real.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rrc-protocol-real.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rrc-protocol-real.cc.o.d"
+  "/root/repo/src/lte/model/lte-rrc-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rrc-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-rrc-sap.cc.o.d"
+  "/root/repo/src/lte/model/lte-spectrum-phy.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-spectrum-phy.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-spectrum-phy.cc.o.d"
+  "/root/repo/src/lte/model/lte-spectrum-signal-parameters.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-spectrum-signal-parameters.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-spectrum-signal-parameters.cc.o.d"
+  "/root/repo/src/lte/model/lte-spectrum-value-helper.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-spectrum-value-helper.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-spectrum-value-helper.cc.o.d"
+  "/root/repo/src/lte/model/lte-ue-ccm-rrc-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ue-ccm-rrc-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ue-ccm-rrc-sap.cc.o.d"
+  "/root/repo/src/lte/model/lte-ue-cmac-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ue-cmac-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ue-cmac-sap.cc.o.d"
+  "/root/repo/src/lte/model/lte-ue-component-carrier-manager.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ue-component-carrier-manager.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ue-component-carrier-manager.cc.o.d"
+  "/root/repo/src/lte/model/lte-ue-cphy-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ue-cphy-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ue-cphy-sap.cc.o.d"
+  "/root/repo/src/lte/model/lte-ue-mac.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ue-mac.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ue-mac.cc.o.d"
+  "/root/repo/src/lte/model/lte-ue-net-device.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ue-net-device.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ue-net-device.cc.o.d"
+  "/root/repo/src/lte/model/lte-ue-phy-sap.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ue-phy-sap.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ue-phy-sap.cc.o.d"
+  "/root/repo/src/lte/model/lte-ue-phy.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ue-phy.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ue-phy.cc.o.d"
+  "/root/repo/src/lte/model/lte-ue-power-control.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ue-power-control.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ue-power-control.cc.o.d"
+  "/root/repo/src/lte/model/lte-ue-rrc.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ue-rrc.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-ue-rrc.cc.o.d"
+  "/root/repo/src/lte/model/lte-vendor-specific-parameters.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-vendor-specific-parameters.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/lte-vendor-specific-parameters.cc.o.d"
+  "/root/repo/src/lte/model/no-op-component-carrier-manager.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/no-op-component-carrier-manager.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/no-op-component-carrier-manager.cc.o.d"
+  "/root/repo/src/lte/model/no-op-handover-algorithm.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/no-op-handover-algorithm.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/no-op-handover-algorithm.cc.o.d"
+  "/root/repo/src/lte/model/pf-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/pf-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/pf-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/model/pss-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/pss-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/pss-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/model/rem-spectrum-phy.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/rem-spectrum-phy.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/rem-spectrum-phy.cc.o.d"
+  "/root/repo/src/lte/model/rr-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/rr-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/rr-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/model/simple-ue-component-carrier-manager.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/simple-ue-component-carrier-manager.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/simple-ue-component-carrier-manager.cc.o.d"
+  "/root/repo/src/lte/model/tdbet-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/tdbet-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/tdbet-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/model/tdmt-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/tdmt-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/tdmt-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/model/tdtbfq-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/tdtbfq-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/tdtbfq-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/model/tta-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-obj.dir/model/tta-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-obj.dir/model/tta-ff-mac-scheduler.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,263 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/liblte-obj.dir/helper/cc-helper.cc.o"
+  "CMakeFiles/liblte-obj.dir/helper/cc-helper.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/helper/emu-epc-helper.cc.o"
+  "CMakeFiles/liblte-obj.dir/helper/emu-epc-helper.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/helper/epc-helper.cc.o"
+  "CMakeFiles/liblte-obj.dir/helper/epc-helper.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/helper/lte-global-pathloss-database.cc.o"
+  "CMakeFiles/liblte-obj.dir/helper/lte-global-pathloss-database.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/helper/lte-helper.cc.o"
+  "CMakeFiles/liblte-obj.dir/helper/lte-helper.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/helper/lte-hex-grid-enb-topology-helper.cc.o"
+  "CMakeFiles/liblte-obj.dir/helper/lte-hex-grid-enb-topology-helper.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/helper/lte-stats-calculator.cc.o"
+  "CMakeFiles/liblte-obj.dir/helper/lte-stats-calculator.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/helper/mac-stats-calculator.cc.o"
+  "CMakeFiles/liblte-obj.dir/helper/mac-stats-calculator.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/helper/no-backhaul-epc-helper.cc.o"
+  "CMakeFiles/liblte-obj.dir/helper/no-backhaul-epc-helper.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/helper/phy-rx-stats-calculator.cc.o"
+  "CMakeFiles/liblte-obj.dir/helper/phy-rx-stats-calculator.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/helper/phy-stats-calculator.cc.o"
+  "CMakeFiles/liblte-obj.dir/helper/phy-stats-calculator.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/helper/phy-tx-stats-calculator.cc.o"
+  "CMakeFiles/liblte-obj.dir/helper/phy-tx-stats-calculator.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/helper/point-to-point-epc-helper.cc.o"
+  "CMakeFiles/liblte-obj.dir/helper/point-to-point-epc-helper.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/helper/radio-bearer-stats-calculator.cc.o"
+  "CMakeFiles/liblte-obj.dir/helper/radio-bearer-stats-calculator.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/helper/radio-bearer-stats-connector.cc.o"
+  "CMakeFiles/liblte-obj.dir/helper/radio-bearer-stats-connector.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/helper/radio-environment-map-helper.cc.o"
+  "CMakeFiles/liblte-obj.dir/helper/radio-environment-map-helper.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/a2-a4-rsrq-handover-algorithm.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/a2-a4-rsrq-handover-algorithm.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/a3-rsrp-handover-algorithm.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/a3-rsrp-handover-algorithm.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/component-carrier-enb.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/component-carrier-enb.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/component-carrier-ue.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/component-carrier-ue.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/component-carrier.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/component-carrier.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/cqa-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/cqa-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/epc-enb-application.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/epc-enb-application.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/epc-enb-s1-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/epc-enb-s1-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/epc-gtpc-header.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/epc-gtpc-header.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/epc-gtpu-header.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/epc-gtpu-header.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/epc-mme-application.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/epc-mme-application.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/epc-pgw-application.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/epc-pgw-application.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/epc-s11-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/epc-s11-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/epc-s1ap-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/epc-s1ap-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/epc-sgw-application.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/epc-sgw-application.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/epc-tft-classifier.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/epc-tft-classifier.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/epc-tft.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/epc-tft.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/epc-ue-nas.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/epc-ue-nas.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/epc-x2-header.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/epc-x2-header.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/epc-x2-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/epc-x2-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/epc-x2.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/epc-x2.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/eps-bearer-tag.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/eps-bearer-tag.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/eps-bearer.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/eps-bearer.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/fdbet-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/fdbet-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/fdmt-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/fdmt-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/fdtbfq-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/fdtbfq-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/ff-mac-common.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/ff-mac-common.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/ff-mac-csched-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/ff-mac-csched-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/ff-mac-sched-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/ff-mac-sched-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-amc.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-amc.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-anr-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-anr-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-anr.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-anr.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-as-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-as-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-asn1-header.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-asn1-header.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-ccm-mac-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-ccm-mac-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-ccm-rrc-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-ccm-rrc-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-chunk-processor.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-chunk-processor.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-common.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-common.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-control-messages.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-control-messages.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-enb-cmac-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-enb-cmac-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-enb-component-carrier-manager.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-enb-component-carrier-manager.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-enb-cphy-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-enb-cphy-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-enb-mac.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-enb-mac.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-enb-net-device.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-enb-net-device.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-enb-phy-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-enb-phy-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-enb-phy.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-enb-phy.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-enb-rrc.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-enb-rrc.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-ffr-algorithm.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-ffr-algorithm.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-ffr-distributed-algorithm.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-ffr-distributed-algorithm.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-ffr-enhanced-algorithm.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-ffr-enhanced-algorithm.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-ffr-rrc-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-ffr-rrc-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-ffr-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-ffr-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-ffr-soft-algorithm.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-ffr-soft-algorithm.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-fr-hard-algorithm.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-fr-hard-algorithm.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-fr-no-op-algorithm.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-fr-no-op-algorithm.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-fr-soft-algorithm.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-fr-soft-algorithm.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-fr-strict-algorithm.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-fr-strict-algorithm.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-handover-algorithm.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-handover-algorithm.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-handover-management-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-handover-management-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-harq-phy.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-harq-phy.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-interference.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-interference.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-mac-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-mac-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-mi-error-model.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-mi-error-model.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-net-device.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-net-device.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-pdcp-header.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-pdcp-header.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-pdcp-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-pdcp-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-pdcp-tag.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-pdcp-tag.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-pdcp.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-pdcp.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-phy-tag.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-phy-tag.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-phy.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-phy.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-radio-bearer-info.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-radio-bearer-info.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-radio-bearer-tag.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-radio-bearer-tag.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-rlc-am-header.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-rlc-am-header.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-rlc-am.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-rlc-am.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-rlc-header.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-rlc-header.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-rlc-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-rlc-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-rlc-sdu-status-tag.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-rlc-sdu-status-tag.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-rlc-sequence-number.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-rlc-sequence-number.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-rlc-tag.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-rlc-tag.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-rlc-tm.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-rlc-tm.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-rlc-um.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-rlc-um.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-rlc.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-rlc.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-rrc-header.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-rrc-header.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-rrc-protocol-ideal.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-rrc-protocol-ideal.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-rrc-protocol-real.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-rrc-protocol-real.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-rrc-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-rrc-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-spectrum-phy.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-spectrum-phy.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-spectrum-signal-parameters.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-spectrum-signal-parameters.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-spectrum-value-helper.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-spectrum-value-helper.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-ue-ccm-rrc-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-ue-ccm-rrc-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-ue-cmac-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-ue-cmac-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-ue-component-carrier-manager.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-ue-component-carrier-manager.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-ue-cphy-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-ue-cphy-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-ue-mac.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-ue-mac.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-ue-net-device.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-ue-net-device.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-ue-phy-sap.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-ue-phy-sap.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-ue-phy.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-ue-phy.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-ue-power-control.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-ue-power-control.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-ue-rrc.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-ue-rrc.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/lte-vendor-specific-parameters.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/lte-vendor-specific-parameters.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/no-op-component-carrier-manager.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/no-op-component-carrier-manager.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/no-op-handover-algorithm.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/no-op-handover-algorithm.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/pf-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/pf-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/pss-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/pss-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/rem-spectrum-phy.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/rem-spectrum-phy.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/rr-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/rr-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/simple-ue-component-carrier-manager.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/simple-ue-component-carrier-manager.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/tdbet-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/tdbet-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/tdmt-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/tdmt-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/tdtbfq-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/tdtbfq-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-obj.dir/model/tta-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-obj.dir/model/tta-ff-mac-scheduler.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/liblte-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
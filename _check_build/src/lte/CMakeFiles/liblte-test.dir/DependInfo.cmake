@@ -0,0 +1,97 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/lte/test/epc-test-gtpu.cc" "src/lte/CMakeFiles/liblte-test.dir/test/epc-test-gtpu.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/epc-test-gtpu.cc.o.d"
+  "/root/repo/src/lte/test/epc-test-s1u-downlink.cc" "src/lte/CMakeFiles/liblte-test.dir/test/epc-test-s1u-downlink.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/epc-test-s1u-downlink.cc.o.d"
+  "/root/repo/src/lte/test/epc-test-s1u-uplink.cc" "src/lte/CMakeFiles/liblte-test.dir/test/epc-test-s1u-uplink.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/epc-test-s1u-uplink.cc.o.d"
+  "/root/repo/src/lte/test/lte-ffr-simple.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-ffr-simple.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-ffr-simple.cc.o.d"
+  "/root/repo/src/lte/test/lte-simple-helper.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-simple-helper.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-simple-helper.cc.o.d"
+  "/root/repo/src/lte/test/lte-simple-net-device.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-simple-net-device.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-simple-net-device.cc.o.d"
+  "/root/repo/src/lte/test/lte-simple-spectrum-phy.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-simple-spectrum-phy.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-simple-spectrum-phy.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-aggregation-throughput-scale.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-aggregation-throughput-scale.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-aggregation-throughput-scale.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-carrier-aggregation-configuration.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-carrier-aggregation-configuration.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-carrier-aggregation-configuration.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-carrier-aggregation.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-carrier-aggregation.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-carrier-aggregation.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-cell-selection.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-cell-selection.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-cell-selection.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-cqa-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-cqa-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-cqa-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-cqi-generation.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-cqi-generation.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-cqi-generation.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-deactivate-bearer.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-deactivate-bearer.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-deactivate-bearer.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-downlink-power-control.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-downlink-power-control.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-downlink-power-control.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-downlink-sinr.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-downlink-sinr.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-downlink-sinr.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-earfcn.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-earfcn.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-earfcn.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-entities.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-entities.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-entities.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-fdbet-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-fdbet-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-fdbet-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-fdmt-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-fdmt-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-fdmt-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-fdtbfq-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-fdtbfq-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-fdtbfq-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-frequency-reuse.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-frequency-reuse.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-frequency-reuse.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-harq.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-harq.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-harq.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-interference-fr.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-interference-fr.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-interference-fr.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-interference.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-interference.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-interference.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-ipv6-routing.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-ipv6-routing.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-ipv6-routing.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-link-adaptation.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-link-adaptation.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-link-adaptation.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-mimo.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-mimo.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-mimo.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-pathloss-model.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-pathloss-model.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-pathloss-model.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-pf-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-pf-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-pf-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-phy-error-model.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-phy-error-model.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-phy-error-model.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-primary-cell-change.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-primary-cell-change.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-primary-cell-change.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-pss-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-pss-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-pss-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-radio-link-failure.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-radio-link-failure.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-radio-link-failure.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-rlc-am-e2e.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-rlc-am-e2e.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-rlc-am-e2e.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-rlc-am-transmitter.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-rlc-am-transmitter.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-rlc-am-transmitter.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-rlc-um-e2e.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-rlc-um-e2e.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-rlc-um-e2e.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-rlc-um-transmitter.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-rlc-um-transmitter.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-rlc-um-transmitter.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-rr-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-rr-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-rr-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-secondary-cell-handover.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-secondary-cell-handover.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-secondary-cell-handover.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-secondary-cell-selection.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-secondary-cell-selection.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-secondary-cell-selection.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-spectrum-value-helper.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-spectrum-value-helper.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-spectrum-value-helper.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-tdbet-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-tdbet-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-tdbet-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-tdmt-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-tdmt-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-tdmt-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-tdtbfq-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-tdtbfq-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-tdtbfq-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-tta-ff-mac-scheduler.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-tta-ff-mac-scheduler.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-tta-ff-mac-scheduler.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-ue-measurements.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-ue-measurements.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-ue-measurements.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-ue-phy.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-ue-phy.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-ue-phy.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-uplink-power-control.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-uplink-power-control.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-uplink-power-control.cc.o.d"
+  "/root/repo/src/lte/test/lte-test-uplink-sinr.cc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-uplink-sinr.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/lte-test-uplink-sinr.cc.o.d"
+  "/root/repo/src/lte/test/test-asn1-encoding.cc" "src/lte/CMakeFiles/liblte-test.dir/test/test-asn1-encoding.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/test-asn1-encoding.cc.o.d"
+  "/root/repo/src/lte/test/test-epc-tft-classifier.cc" "src/lte/CMakeFiles/liblte-test.dir/test/test-epc-tft-classifier.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/test-epc-tft-classifier.cc.o.d"
+  "/root/repo/src/lte/test/test-lte-antenna.cc" "src/lte/CMakeFiles/liblte-test.dir/test/test-lte-antenna.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/test-lte-antenna.cc.o.d"
+  "/root/repo/src/lte/test/test-lte-epc-e2e-data.cc" "src/lte/CMakeFiles/liblte-test.dir/test/test-lte-epc-e2e-data.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/test-lte-epc-e2e-data.cc.o.d"
+  "/root/repo/src/lte/test/test-lte-handover-delay.cc" "src/lte/CMakeFiles/liblte-test.dir/test/test-lte-handover-delay.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/test-lte-handover-delay.cc.o.d"
+  "/root/repo/src/lte/test/test-lte-handover-failure.cc" "src/lte/CMakeFiles/liblte-test.dir/test/test-lte-handover-failure.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/test-lte-handover-failure.cc.o.d"
+  "/root/repo/src/lte/test/test-lte-handover-target.cc" "src/lte/CMakeFiles/liblte-test.dir/test/test-lte-handover-target.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/test-lte-handover-target.cc.o.d"
+  "/root/repo/src/lte/test/test-lte-rlc-header.cc" "src/lte/CMakeFiles/liblte-test.dir/test/test-lte-rlc-header.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/test-lte-rlc-header.cc.o.d"
+  "/root/repo/src/lte/test/test-lte-rrc.cc" "src/lte/CMakeFiles/liblte-test.dir/test/test-lte-rrc.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/test-lte-rrc.cc.o.d"
+  "/root/repo/src/lte/test/test-lte-x2-handover-measures.cc" "src/lte/CMakeFiles/liblte-test.dir/test/test-lte-x2-handover-measures.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/test-lte-x2-handover-measures.cc.o.d"
+  "/root/repo/src/lte/test/test-lte-x2-handover.cc" "src/lte/CMakeFiles/liblte-test.dir/test/test-lte-x2-handover.cc.o" "gcc" "src/lte/CMakeFiles/liblte-test.dir/test/test-lte-x2-handover.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_check_build/src/lte/CMakeFiles/liblte.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/fd-net-device/CMakeFiles/libfd-net-device.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/spectrum/CMakeFiles/libspectrum.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/buildings/CMakeFiles/libbuildings.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/virtual-net-device/CMakeFiles/libvirtual-net-device.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/point-to-point/CMakeFiles/libpoint-to-point.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/applications/CMakeFiles/libapplications.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/internet/CMakeFiles/libinternet.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/csma/CMakeFiles/libcsma.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/config-store/CMakeFiles/libconfig-store.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/antenna/CMakeFiles/libantenna.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/propagation/CMakeFiles/libpropagation.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/mobility/CMakeFiles/libmobility.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/bridge/CMakeFiles/libbridge.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/traffic-control/CMakeFiles/libtraffic-control.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/network/CMakeFiles/libnetwork.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/stats/CMakeFiles/libstats.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/core/CMakeFiles/libcore.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
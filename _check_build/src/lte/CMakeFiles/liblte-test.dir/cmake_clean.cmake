@@ -0,0 +1,131 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/lib/libns3-dev-lte-test-debug.pdb"
+  "/root/repo/build/lib/libns3-dev-lte-test-debug.so"
+  "CMakeFiles/liblte-test.dir/test/epc-test-gtpu.cc.o"
+  "CMakeFiles/liblte-test.dir/test/epc-test-gtpu.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/epc-test-s1u-downlink.cc.o"
+  "CMakeFiles/liblte-test.dir/test/epc-test-s1u-downlink.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/epc-test-s1u-uplink.cc.o"
+  "CMakeFiles/liblte-test.dir/test/epc-test-s1u-uplink.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-ffr-simple.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-ffr-simple.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-simple-helper.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-simple-helper.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-simple-net-device.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-simple-net-device.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-simple-spectrum-phy.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-simple-spectrum-phy.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-aggregation-throughput-scale.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-aggregation-throughput-scale.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-carrier-aggregation-configuration.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-carrier-aggregation-configuration.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-carrier-aggregation.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-carrier-aggregation.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-cell-selection.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-cell-selection.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-cqa-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-cqa-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-cqi-generation.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-cqi-generation.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-deactivate-bearer.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-deactivate-bearer.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-downlink-power-control.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-downlink-power-control.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-downlink-sinr.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-downlink-sinr.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-earfcn.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-earfcn.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-entities.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-entities.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-fdbet-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-fdbet-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-fdmt-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-fdmt-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-fdtbfq-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-fdtbfq-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-frequency-reuse.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-frequency-reuse.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-harq.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-harq.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-interference-fr.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-interference-fr.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-interference.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-interference.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-ipv6-routing.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-ipv6-routing.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-link-adaptation.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-link-adaptation.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-mimo.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-mimo.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-pathloss-model.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-pathloss-model.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-pf-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-pf-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-phy-error-model.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-phy-error-model.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-primary-cell-change.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-primary-cell-change.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-pss-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-pss-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-radio-link-failure.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-radio-link-failure.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-rlc-am-e2e.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-rlc-am-e2e.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-rlc-am-transmitter.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-rlc-am-transmitter.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-rlc-um-e2e.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-rlc-um-e2e.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-rlc-um-transmitter.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-rlc-um-transmitter.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-rr-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-rr-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-secondary-cell-handover.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-secondary-cell-handover.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-secondary-cell-selection.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-secondary-cell-selection.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-spectrum-value-helper.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-spectrum-value-helper.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-tdbet-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-tdbet-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-tdmt-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-tdmt-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-tdtbfq-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-tdtbfq-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-tta-ff-mac-scheduler.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-tta-ff-mac-scheduler.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-ue-measurements.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-ue-measurements.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-ue-phy.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-ue-phy.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-uplink-power-control.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-uplink-power-control.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/lte-test-uplink-sinr.cc.o"
+  "CMakeFiles/liblte-test.dir/test/lte-test-uplink-sinr.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/test-asn1-encoding.cc.o"
+  "CMakeFiles/liblte-test.dir/test/test-asn1-encoding.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/test-epc-tft-classifier.cc.o"
+  "CMakeFiles/liblte-test.dir/test/test-epc-tft-classifier.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/test-lte-antenna.cc.o"
+  "CMakeFiles/liblte-test.dir/test/test-lte-antenna.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/test-lte-epc-e2e-data.cc.o"
+  "CMakeFiles/liblte-test.dir/test/test-lte-epc-e2e-data.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/test-lte-handover-delay.cc.o"
+  "CMakeFiles/liblte-test.dir/test/test-lte-handover-delay.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/test-lte-handover-failure.cc.o"
+  "CMakeFiles/liblte-test.dir/test/test-lte-handover-failure.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/test-lte-handover-target.cc.o"
+  "CMakeFiles/liblte-test.dir/test/test-lte-handover-target.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/test-lte-rlc-header.cc.o"
+  "CMakeFiles/liblte-test.dir/test/test-lte-rlc-header.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/test-lte-rrc.cc.o"
+  "CMakeFiles/liblte-test.dir/test/test-lte-rrc.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/test-lte-x2-handover-measures.cc.o"
+  "CMakeFiles/liblte-test.dir/test/test-lte-x2-handover-measures.cc.o.d"
+  "CMakeFiles/liblte-test.dir/test/test-lte-x2-handover.cc.o"
+  "CMakeFiles/liblte-test.dir/test/test-lte-x2-handover.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/liblte-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
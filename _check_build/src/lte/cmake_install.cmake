@@ -0,0 +1,201 @@
+# Install script for directory: /root/repo/src/lte
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-lte-debug.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-lte-debug.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-lte-debug.so"
+         RPATH "/usr/local/lib:$ORIGIN/:$ORIGIN/../lib")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/build/lib/libns3-dev-lte-debug.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-lte-debug.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-lte-debug.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-lte-debug.so"
+         OLD_RPATH "/root/repo/build/lib::::::::::::::::::"
+         NEW_RPATH "/usr/local/lib:$ORIGIN/:$ORIGIN/../lib")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-lte-debug.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/ns3" TYPE FILE FILES
+    "/root/repo/src/lte/helper/emu-epc-helper.h"
+    "/root/repo/src/lte/helper/cc-helper.h"
+    "/root/repo/src/lte/helper/epc-helper.h"
+    "/root/repo/src/lte/helper/lte-global-pathloss-database.h"
+    "/root/repo/src/lte/helper/lte-helper.h"
+    "/root/repo/src/lte/helper/lte-hex-grid-enb-topology-helper.h"
+    "/root/repo/src/lte/helper/lte-stats-calculator.h"
+    "/root/repo/src/lte/helper/mac-stats-calculator.h"
+    "/root/repo/src/lte/helper/no-backhaul-epc-helper.h"
+    "/root/repo/src/lte/helper/phy-rx-stats-calculator.h"
+    "/root/repo/src/lte/helper/phy-stats-calculator.h"
+    "/root/repo/src/lte/helper/phy-tx-stats-calculator.h"
+    "/root/repo/src/lte/helper/point-to-point-epc-helper.h"
+    "/root/repo/src/lte/helper/radio-bearer-stats-calculator.h"
+    "/root/repo/src/lte/helper/radio-bearer-stats-connector.h"
+    "/root/repo/src/lte/helper/radio-environment-map-helper.h"
+    "/root/repo/src/lte/model/a2-a4-rsrq-handover-algorithm.h"
+    "/root/repo/src/lte/model/a3-rsrp-handover-algorithm.h"
+    "/root/repo/src/lte/model/component-carrier-enb.h"
+    "/root/repo/src/lte/model/component-carrier-ue.h"
+    "/root/repo/src/lte/model/component-carrier.h"
+    "/root/repo/src/lte/model/cqa-ff-mac-scheduler.h"
+    "/root/repo/src/lte/model/epc-enb-application.h"
+    "/root/repo/src/lte/model/epc-enb-s1-sap.h"
+    "/root/repo/src/lte/model/epc-gtpc-header.h"
+    "/root/repo/src/lte/model/epc-gtpu-header.h"
+    "/root/repo/src/lte/model/epc-mme-application.h"
+    "/root/repo/src/lte/model/epc-pgw-application.h"
+    "/root/repo/src/lte/model/epc-s11-sap.h"
+    "/root/repo/src/lte/model/epc-s1ap-sap.h"
+    "/root/repo/src/lte/model/epc-sgw-application.h"
+    "/root/repo/src/lte/model/epc-tft-classifier.h"
+    "/root/repo/src/lte/model/epc-tft.h"
+    "/root/repo/src/lte/model/epc-ue-nas.h"
+    "/root/repo/src/lte/model/epc-x2-header.h"
+    "/root/repo/src/lte/model/epc-x2-sap.h"
+    "/root/repo/src/lte/model/epc-x2.h"
+    "/root/repo/src/lte/model/eps-bearer-tag.h"
+    "/root/repo/src/lte/model/eps-bearer.h"
+    "/root/repo/src/lte/model/fdbet-ff-mac-scheduler.h"
+    "/root/repo/src/lte/model/fdmt-ff-mac-scheduler.h"
+    "/root/repo/src/lte/model/fdtbfq-ff-mac-scheduler.h"
+    "/root/repo/src/lte/model/ff-mac-common.h"
+    "/root/repo/src/lte/model/ff-mac-csched-sap.h"
+    "/root/repo/src/lte/model/ff-mac-sched-sap.h"
+    "/root/repo/src/lte/model/ff-mac-scheduler.h"
+    "/root/repo/src/lte/model/lte-amc.h"
+    "/root/repo/src/lte/model/lte-anr-sap.h"
+    "/root/repo/src/lte/model/lte-anr.h"
+    "/root/repo/src/lte/model/lte-as-sap.h"
+    "/root/repo/src/lte/model/lte-asn1-header.h"
+    "/root/repo/src/lte/model/lte-ccm-mac-sap.h"
+    "/root/repo/src/lte/model/lte-ccm-rrc-sap.h"
+    "/root/repo/src/lte/model/lte-chunk-processor.h"
+    "/root/repo/src/lte/model/lte-common.h"
+    "/root/repo/src/lte/model/lte-control-messages.h"
+    "/root/repo/src/lte/model/lte-enb-cmac-sap.h"
+    "/root/repo/src/lte/model/lte-enb-component-carrier-manager.h"
+    "/root/repo/src/lte/model/lte-enb-cphy-sap.h"
+    "/root/repo/src/lte/model/lte-enb-mac.h"
+    "/root/repo/src/lte/model/lte-enb-net-device.h"
+    "/root/repo/src/lte/model/lte-enb-phy-sap.h"
+    "/root/repo/src/lte/model/lte-enb-phy.h"
+    "/root/repo/src/lte/model/lte-enb-rrc.h"
+    "/root/repo/src/lte/model/lte-ffr-algorithm.h"
+    "/root/repo/src/lte/model/lte-ffr-distributed-algorithm.h"
+    "/root/repo/src/lte/model/lte-ffr-enhanced-algorithm.h"
+    "/root/repo/src/lte/model/lte-ffr-rrc-sap.h"
+    "/root/repo/src/lte/model/lte-ffr-sap.h"
+    "/root/repo/src/lte/model/lte-ffr-soft-algorithm.h"
+    "/root/repo/src/lte/model/lte-fr-hard-algorithm.h"
+    "/root/repo/src/lte/model/lte-fr-no-op-algorithm.h"
+    "/root/repo/src/lte/model/lte-fr-soft-algorithm.h"
+    "/root/repo/src/lte/model/lte-fr-strict-algorithm.h"
+    "/root/repo/src/lte/model/lte-handover-algorithm.h"
+    "/root/repo/src/lte/model/lte-handover-management-sap.h"
+    "/root/repo/src/lte/model/lte-harq-phy.h"
+    "/root/repo/src/lte/model/lte-interference.h"
+    "/root/repo/src/lte/model/lte-mac-sap.h"
+    "/root/repo/src/lte/model/lte-mi-error-model.h"
+    "/root/repo/src/lte/model/lte-net-device.h"
+    "/root/repo/src/lte/model/lte-pdcp-header.h"
+    "/root/repo/src/lte/model/lte-pdcp-sap.h"
+    "/root/repo/src/lte/model/lte-pdcp-tag.h"
+    "/root/repo/src/lte/model/lte-pdcp.h"
+    "/root/repo/src/lte/model/lte-phy-tag.h"
+    "/root/repo/src/lte/model/lte-phy.h"
+    "/root/repo/src/lte/model/lte-radio-bearer-info.h"
+    "/root/repo/src/lte/model/lte-radio-bearer-tag.h"
+    "/root/repo/src/lte/model/lte-rlc-am-header.h"
+    "/root/repo/src/lte/model/lte-rlc-am.h"
+    "/root/repo/src/lte/model/lte-rlc-header.h"
+    "/root/repo/src/lte/model/lte-rlc-sap.h"
+    "/root/repo/src/lte/model/lte-rlc-sdu-status-tag.h"
+    "/root/repo/src/lte/model/lte-rlc-sequence-number.h"
+    "/root/repo/src/lte/model/lte-rlc-tag.h"
+    "/root/repo/src/lte/model/lte-rlc-tm.h"
+    "/root/repo/src/lte/model/lte-rlc-um.h"
+    "/root/repo/src/lte/model/lte-rlc.h"
+    "/root/repo/src/lte/model/lte-rrc-header.h"
+    "/root/repo/src/lte/model/lte-rrc-protocol-ideal.h"
+    "/root/repo/src/lte/model/lte-rrc-protocol-real.h"
+    "/root/repo/src/lte/model/lte-rrc-sap.h"
+    "/root/repo/src/lte/model/lte-spectrum-phy.h"
+    "/root/repo/src/lte/model/lte-spectrum-signal-parameters.h"
+    "/root/repo/src/lte/model/lte-spectrum-value-helper.h"
+    "/root/repo/src/lte/model/lte-ue-ccm-rrc-sap.h"
+    "/root/repo/src/lte/model/lte-ue-cmac-sap.h"
+    "/root/repo/src/lte/model/lte-ue-component-carrier-manager.h"
+    "/root/repo/src/lte/model/lte-ue-cphy-sap.h"
+    "/root/repo/src/lte/model/lte-ue-mac.h"
+    "/root/repo/src/lte/model/lte-ue-net-device.h"
+    "/root/repo/src/lte/model/lte-ue-phy-sap.h"
+    "/root/repo/src/lte/model/lte-ue-phy.h"
+    "/root/repo/src/lte/model/lte-ue-power-control.h"
+    "/root/repo/src/lte/model/lte-ue-rrc.h"
+    "/root/repo/src/lte/model/lte-vendor-specific-parameters.h"
+    "/root/repo/src/lte/model/no-op-component-carrier-manager.h"
+    "/root/repo/src/lte/model/no-op-handover-algorithm.h"
+    "/root/repo/src/lte/model/pf-ff-mac-scheduler.h"
+    "/root/repo/src/lte/model/pss-ff-mac-scheduler.h"
+    "/root/repo/src/lte/model/rem-spectrum-phy.h"
+    "/root/repo/src/lte/model/rr-ff-mac-scheduler.h"
+    "/root/repo/src/lte/model/simple-ue-component-carrier-manager.h"
+    "/root/repo/src/lte/model/tdbet-ff-mac-scheduler.h"
+    "/root/repo/src/lte/model/tdmt-ff-mac-scheduler.h"
+    "/root/repo/src/lte/model/tdtbfq-ff-mac-scheduler.h"
+    "/root/repo/src/lte/model/tta-ff-mac-scheduler.h"
+    "/root/repo/build/include/ns3/lte-module.h"
+    )
+endif()
+
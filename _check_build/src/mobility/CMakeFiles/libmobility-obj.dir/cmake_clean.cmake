@@ -0,0 +1,49 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmobility-obj.dir/helper/group-mobility-helper.cc.o"
+  "CMakeFiles/libmobility-obj.dir/helper/group-mobility-helper.cc.o.d"
+  "CMakeFiles/libmobility-obj.dir/helper/mobility-helper.cc.o"
+  "CMakeFiles/libmobility-obj.dir/helper/mobility-helper.cc.o.d"
+  "CMakeFiles/libmobility-obj.dir/helper/ns2-mobility-helper.cc.o"
+  "CMakeFiles/libmobility-obj.dir/helper/ns2-mobility-helper.cc.o.d"
+  "CMakeFiles/libmobility-obj.dir/model/box.cc.o"
+  "CMakeFiles/libmobility-obj.dir/model/box.cc.o.d"
+  "CMakeFiles/libmobility-obj.dir/model/constant-acceleration-mobility-model.cc.o"
+  "CMakeFiles/libmobility-obj.dir/model/constant-acceleration-mobility-model.cc.o.d"
+  "CMakeFiles/libmobility-obj.dir/model/constant-position-mobility-model.cc.o"
+  "CMakeFiles/libmobility-obj.dir/model/constant-position-mobility-model.cc.o.d"
+  "CMakeFiles/libmobility-obj.dir/model/constant-velocity-helper.cc.o"
+  "CMakeFiles/libmobility-obj.dir/model/constant-velocity-helper.cc.o.d"
+  "CMakeFiles/libmobility-obj.dir/model/constant-velocity-mobility-model.cc.o"
+  "CMakeFiles/libmobility-obj.dir/model/constant-velocity-mobility-model.cc.o.d"
+  "CMakeFiles/libmobility-obj.dir/model/gauss-markov-mobility-model.cc.o"
+  "CMakeFiles/libmobility-obj.dir/model/gauss-markov-mobility-model.cc.o.d"
+  "CMakeFiles/libmobility-obj.dir/model/geographic-positions.cc.o"
+  "CMakeFiles/libmobility-obj.dir/model/geographic-positions.cc.o.d"
+  "CMakeFiles/libmobility-obj.dir/model/hierarchical-mobility-model.cc.o"
+  "CMakeFiles/libmobility-obj.dir/model/hierarchical-mobility-model.cc.o.d"
+  "CMakeFiles/libmobility-obj.dir/model/mobility-model.cc.o"
+  "CMakeFiles/libmobility-obj.dir/model/mobility-model.cc.o.d"
+  "CMakeFiles/libmobility-obj.dir/model/position-allocator.cc.o"
+  "CMakeFiles/libmobility-obj.dir/model/position-allocator.cc.o.d"
+  "CMakeFiles/libmobility-obj.dir/model/random-direction-2d-mobility-model.cc.o"
+  "CMakeFiles/libmobility-obj.dir/model/random-direction-2d-mobility-model.cc.o.d"
+  "CMakeFiles/libmobility-obj.dir/model/random-walk-2d-mobility-model.cc.o"
+  "CMakeFiles/libmobility-obj.dir/model/random-walk-2d-mobility-model.cc.o.d"
+  "CMakeFiles/libmobility-obj.dir/model/random-waypoint-mobility-model.cc.o"
+  "CMakeFiles/libmobility-obj.dir/model/random-waypoint-mobility-model.cc.o.d"
+  "CMakeFiles/libmobility-obj.dir/model/rectangle.cc.o"
+  "CMakeFiles/libmobility-obj.dir/model/rectangle.cc.o.d"
+  "CMakeFiles/libmobility-obj.dir/model/spatial-index.cc.o"
+  "CMakeFiles/libmobility-obj.dir/model/spatial-index.cc.o.d"
+  "CMakeFiles/libmobility-obj.dir/model/steady-state-random-waypoint-mobility-model.cc.o"
+  "CMakeFiles/libmobility-obj.dir/model/steady-state-random-waypoint-mobility-model.cc.o.d"
+  "CMakeFiles/libmobility-obj.dir/model/waypoint-mobility-model.cc.o"
+  "CMakeFiles/libmobility-obj.dir/model/waypoint-mobility-model.cc.o.d"
+  "CMakeFiles/libmobility-obj.dir/model/waypoint.cc.o"
+  "CMakeFiles/libmobility-obj.dir/model/waypoint.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libmobility-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
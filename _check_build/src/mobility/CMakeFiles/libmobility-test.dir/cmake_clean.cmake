@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/lib/libns3-dev-mobility-test-debug.pdb"
+  "/root/repo/build/lib/libns3-dev-mobility-test-debug.so"
+  "CMakeFiles/libmobility-test.dir/test/box-line-intersection-test.cc.o"
+  "CMakeFiles/libmobility-test.dir/test/box-line-intersection-test.cc.o.d"
+  "CMakeFiles/libmobility-test.dir/test/geo-to-cartesian-test.cc.o"
+  "CMakeFiles/libmobility-test.dir/test/geo-to-cartesian-test.cc.o.d"
+  "CMakeFiles/libmobility-test.dir/test/mobility-test-suite.cc.o"
+  "CMakeFiles/libmobility-test.dir/test/mobility-test-suite.cc.o.d"
+  "CMakeFiles/libmobility-test.dir/test/mobility-trace-test-suite.cc.o"
+  "CMakeFiles/libmobility-test.dir/test/mobility-trace-test-suite.cc.o.d"
+  "CMakeFiles/libmobility-test.dir/test/ns2-mobility-helper-test-suite.cc.o"
+  "CMakeFiles/libmobility-test.dir/test/ns2-mobility-helper-test-suite.cc.o.d"
+  "CMakeFiles/libmobility-test.dir/test/rand-cart-around-geo-test.cc.o"
+  "CMakeFiles/libmobility-test.dir/test/rand-cart-around-geo-test.cc.o.d"
+  "CMakeFiles/libmobility-test.dir/test/rectangle-closest-border-test.cc.o"
+  "CMakeFiles/libmobility-test.dir/test/rectangle-closest-border-test.cc.o.d"
+  "CMakeFiles/libmobility-test.dir/test/spatial-index-test.cc.o"
+  "CMakeFiles/libmobility-test.dir/test/spatial-index-test.cc.o.d"
+  "CMakeFiles/libmobility-test.dir/test/steady-state-random-waypoint-mobility-model-test.cc.o"
+  "CMakeFiles/libmobility-test.dir/test/steady-state-random-waypoint-mobility-model-test.cc.o.d"
+  "CMakeFiles/libmobility-test.dir/test/waypoint-mobility-model-test.cc.o"
+  "CMakeFiles/libmobility-test.dir/test/waypoint-mobility-model-test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libmobility-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/lib/libns3-dev-mobility-debug.pdb"
+  "/root/repo/build/lib/libns3-dev-mobility-debug.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libmobility.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/network/test/bit-serializer-test.cc" "src/network/CMakeFiles/libnetwork-test.dir/test/bit-serializer-test.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-test.dir/test/bit-serializer-test.cc.o.d"
+  "/root/repo/src/network/test/buffer-test.cc" "src/network/CMakeFiles/libnetwork-test.dir/test/buffer-test.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-test.dir/test/buffer-test.cc.o.d"
+  "/root/repo/src/network/test/drop-tail-queue-test-suite.cc" "src/network/CMakeFiles/libnetwork-test.dir/test/drop-tail-queue-test-suite.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-test.dir/test/drop-tail-queue-test-suite.cc.o.d"
+  "/root/repo/src/network/test/error-model-test-suite.cc" "src/network/CMakeFiles/libnetwork-test.dir/test/error-model-test-suite.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-test.dir/test/error-model-test-suite.cc.o.d"
+  "/root/repo/src/network/test/ipv6-address-test-suite.cc" "src/network/CMakeFiles/libnetwork-test.dir/test/ipv6-address-test-suite.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-test.dir/test/ipv6-address-test-suite.cc.o.d"
+  "/root/repo/src/network/test/lollipop-counter-test.cc" "src/network/CMakeFiles/libnetwork-test.dir/test/lollipop-counter-test.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-test.dir/test/lollipop-counter-test.cc.o.d"
+  "/root/repo/src/network/test/packet-metadata-test.cc" "src/network/CMakeFiles/libnetwork-test.dir/test/packet-metadata-test.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-test.dir/test/packet-metadata-test.cc.o.d"
+  "/root/repo/src/network/test/packet-socket-apps-test-suite.cc" "src/network/CMakeFiles/libnetwork-test.dir/test/packet-socket-apps-test-suite.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-test.dir/test/packet-socket-apps-test-suite.cc.o.d"
+  "/root/repo/src/network/test/packet-test-suite.cc" "src/network/CMakeFiles/libnetwork-test.dir/test/packet-test-suite.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-test.dir/test/packet-test-suite.cc.o.d"
+  "/root/repo/src/network/test/packetbb-test-suite.cc" "src/network/CMakeFiles/libnetwork-test.dir/test/packetbb-test-suite.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-test.dir/test/packetbb-test-suite.cc.o.d"
+  "/root/repo/src/network/test/pcap-file-test-suite.cc" "src/network/CMakeFiles/libnetwork-test.dir/test/pcap-file-test-suite.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-test.dir/test/pcap-file-test-suite.cc.o.d"
+  "/root/repo/src/network/test/sequence-number-test-suite.cc" "src/network/CMakeFiles/libnetwork-test.dir/test/sequence-number-test-suite.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-test.dir/test/sequence-number-test-suite.cc.o.d"
+  "/root/repo/src/network/test/test-data-rate.cc" "src/network/CMakeFiles/libnetwork-test.dir/test/test-data-rate.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-test.dir/test/test-data-rate.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_check_build/src/network/CMakeFiles/libnetwork.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/stats/CMakeFiles/libstats.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/core/CMakeFiles/libcore.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
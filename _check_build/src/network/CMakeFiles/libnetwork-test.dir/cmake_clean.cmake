@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/lib/libns3-dev-network-test-debug.pdb"
+  "/root/repo/build/lib/libns3-dev-network-test-debug.so"
+  "CMakeFiles/libnetwork-test.dir/test/bit-serializer-test.cc.o"
+  "CMakeFiles/libnetwork-test.dir/test/bit-serializer-test.cc.o.d"
+  "CMakeFiles/libnetwork-test.dir/test/buffer-test.cc.o"
+  "CMakeFiles/libnetwork-test.dir/test/buffer-test.cc.o.d"
+  "CMakeFiles/libnetwork-test.dir/test/drop-tail-queue-test-suite.cc.o"
+  "CMakeFiles/libnetwork-test.dir/test/drop-tail-queue-test-suite.cc.o.d"
+  "CMakeFiles/libnetwork-test.dir/test/error-model-test-suite.cc.o"
+  "CMakeFiles/libnetwork-test.dir/test/error-model-test-suite.cc.o.d"
+  "CMakeFiles/libnetwork-test.dir/test/ipv6-address-test-suite.cc.o"
+  "CMakeFiles/libnetwork-test.dir/test/ipv6-address-test-suite.cc.o.d"
+  "CMakeFiles/libnetwork-test.dir/test/lollipop-counter-test.cc.o"
+  "CMakeFiles/libnetwork-test.dir/test/lollipop-counter-test.cc.o.d"
+  "CMakeFiles/libnetwork-test.dir/test/packet-metadata-test.cc.o"
+  "CMakeFiles/libnetwork-test.dir/test/packet-metadata-test.cc.o.d"
+  "CMakeFiles/libnetwork-test.dir/test/packet-socket-apps-test-suite.cc.o"
+  "CMakeFiles/libnetwork-test.dir/test/packet-socket-apps-test-suite.cc.o.d"
+  "CMakeFiles/libnetwork-test.dir/test/packet-test-suite.cc.o"
+  "CMakeFiles/libnetwork-test.dir/test/packet-test-suite.cc.o.d"
+  "CMakeFiles/libnetwork-test.dir/test/packetbb-test-suite.cc.o"
+  "CMakeFiles/libnetwork-test.dir/test/packetbb-test-suite.cc.o.d"
+  "CMakeFiles/libnetwork-test.dir/test/pcap-file-test-suite.cc.o"
+  "CMakeFiles/libnetwork-test.dir/test/pcap-file-test-suite.cc.o.d"
+  "CMakeFiles/libnetwork-test.dir/test/sequence-number-test-suite.cc.o"
+  "CMakeFiles/libnetwork-test.dir/test/sequence-number-test-suite.cc.o.d"
+  "CMakeFiles/libnetwork-test.dir/test/test-data-rate.cc.o"
+  "CMakeFiles/libnetwork-test.dir/test/test-data-rate.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libnetwork-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
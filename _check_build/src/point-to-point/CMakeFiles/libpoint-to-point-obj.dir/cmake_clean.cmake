@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libpoint-to-point-obj.dir/helper/point-to-point-helper.cc.o"
+  "CMakeFiles/libpoint-to-point-obj.dir/helper/point-to-point-helper.cc.o.d"
+  "CMakeFiles/libpoint-to-point-obj.dir/model/point-to-point-channel.cc.o"
+  "CMakeFiles/libpoint-to-point-obj.dir/model/point-to-point-channel.cc.o.d"
+  "CMakeFiles/libpoint-to-point-obj.dir/model/point-to-point-net-device.cc.o"
+  "CMakeFiles/libpoint-to-point-obj.dir/model/point-to-point-net-device.cc.o.d"
+  "CMakeFiles/libpoint-to-point-obj.dir/model/ppp-header.cc.o"
+  "CMakeFiles/libpoint-to-point-obj.dir/model/ppp-header.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libpoint-to-point-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
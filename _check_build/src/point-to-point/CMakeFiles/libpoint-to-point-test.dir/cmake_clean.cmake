@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/lib/libns3-dev-point-to-point-test-debug.pdb"
+  "/root/repo/build/lib/libns3-dev-point-to-point-test-debug.so"
+  "CMakeFiles/libpoint-to-point-test.dir/test/point-to-point-test.cc.o"
+  "CMakeFiles/libpoint-to-point-test.dir/test/point-to-point-test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libpoint-to-point-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
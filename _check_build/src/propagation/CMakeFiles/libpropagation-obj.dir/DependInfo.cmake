@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/propagation/model/channel-condition-model.cc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/channel-condition-model.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/channel-condition-model.cc.o.d"
+  "/root/repo/src/propagation/model/cost231-propagation-loss-model.cc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/cost231-propagation-loss-model.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/cost231-propagation-loss-model.cc.o.d"
+  "/root/repo/src/propagation/model/itu-r-1411-los-propagation-loss-model.cc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/itu-r-1411-los-propagation-loss-model.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/itu-r-1411-los-propagation-loss-model.cc.o.d"
+  "/root/repo/src/propagation/model/itu-r-1411-nlos-over-rooftop-propagation-loss-model.cc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/itu-r-1411-nlos-over-rooftop-propagation-loss-model.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/itu-r-1411-nlos-over-rooftop-propagation-loss-model.cc.o.d"
+  "/root/repo/src/propagation/model/jakes-process.cc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/jakes-process.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/jakes-process.cc.o.d"
+  "/root/repo/src/propagation/model/jakes-propagation-loss-model.cc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/jakes-propagation-loss-model.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/jakes-propagation-loss-model.cc.o.d"
+  "/root/repo/src/propagation/model/kun-2600-mhz-propagation-loss-model.cc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/kun-2600-mhz-propagation-loss-model.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/kun-2600-mhz-propagation-loss-model.cc.o.d"
+  "/root/repo/src/propagation/model/okumura-hata-propagation-loss-model.cc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/okumura-hata-propagation-loss-model.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/okumura-hata-propagation-loss-model.cc.o.d"
+  "/root/repo/src/propagation/model/probabilistic-v2v-channel-condition-model.cc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/probabilistic-v2v-channel-condition-model.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/probabilistic-v2v-channel-condition-model.cc.o.d"
+  "/root/repo/src/propagation/model/propagation-delay-model.cc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/propagation-delay-model.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/propagation-delay-model.cc.o.d"
+  "/root/repo/src/propagation/model/propagation-loss-model.cc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/propagation-loss-model.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/propagation-loss-model.cc.o.d"
+  "/root/repo/src/propagation/model/three-gpp-propagation-loss-model.cc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/three-gpp-propagation-loss-model.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/three-gpp-propagation-loss-model.cc.o.d"
+  "/root/repo/src/propagation/model/three-gpp-v2v-propagation-loss-model.cc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/three-gpp-v2v-propagation-loss-model.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-obj.dir/model/three-gpp-v2v-propagation-loss-model.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,83 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libspectrum-obj.dir/helper/adhoc-aloha-noack-ideal-phy-helper.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/helper/adhoc-aloha-noack-ideal-phy-helper.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/helper/spectrum-analyzer-helper.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/helper/spectrum-analyzer-helper.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/helper/spectrum-helper.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/helper/spectrum-helper.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/helper/tv-spectrum-transmitter-helper.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/helper/tv-spectrum-transmitter-helper.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/helper/waveform-generator-helper.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/helper/waveform-generator-helper.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/aloha-noack-mac-header.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/aloha-noack-mac-header.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/aloha-noack-net-device.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/aloha-noack-net-device.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/constant-spectrum-propagation-loss.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/constant-spectrum-propagation-loss.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/friis-spectrum-propagation-loss.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/friis-spectrum-propagation-loss.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/half-duplex-ideal-phy-signal-parameters.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/half-duplex-ideal-phy-signal-parameters.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/half-duplex-ideal-phy.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/half-duplex-ideal-phy.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/ism-spectrum-value-helper.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/ism-spectrum-value-helper.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/matrix-based-channel-model.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/matrix-based-channel-model.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/microwave-oven-spectrum-value-helper.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/microwave-oven-spectrum-value-helper.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/multi-model-spectrum-channel.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/multi-model-spectrum-channel.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/non-communicating-net-device.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/non-communicating-net-device.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/phased-array-spectrum-propagation-loss-model.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/phased-array-spectrum-propagation-loss-model.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/single-model-spectrum-channel.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/single-model-spectrum-channel.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-analyzer.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-analyzer.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-channel.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-channel.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-converter.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-converter.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-error-model.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-error-model.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-interference.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-interference.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-model-300kHz-300GHz-log.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-model-300kHz-300GHz-log.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-model-ism2400MHz-res1MHz.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-model-ism2400MHz-res1MHz.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-model.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-model.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-phy.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-phy.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-propagation-loss-model.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-propagation-loss-model.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-signal-parameters.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-signal-parameters.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-transmit-filter.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-transmit-filter.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-value.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/spectrum-value.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/three-gpp-channel-model.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/three-gpp-channel-model.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/three-gpp-spectrum-propagation-loss-model.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/three-gpp-spectrum-propagation-loss-model.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/trace-fading-loss-model.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/trace-fading-loss-model.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/tv-spectrum-transmitter.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/tv-spectrum-transmitter.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/two-ray-spectrum-propagation-loss-model.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/two-ray-spectrum-propagation-loss-model.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/waveform-generator.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/waveform-generator.cc.o.d"
+  "CMakeFiles/libspectrum-obj.dir/model/wifi-spectrum-value-helper.cc.o"
+  "CMakeFiles/libspectrum-obj.dir/model/wifi-spectrum-value-helper.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libspectrum-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/lib/libns3-dev-spectrum-test-debug.pdb"
+  "/root/repo/build/lib/libns3-dev-spectrum-test-debug.so"
+  "CMakeFiles/libspectrum-test.dir/test/spectrum-ideal-phy-test.cc.o"
+  "CMakeFiles/libspectrum-test.dir/test/spectrum-ideal-phy-test.cc.o.d"
+  "CMakeFiles/libspectrum-test.dir/test/spectrum-interference-test.cc.o"
+  "CMakeFiles/libspectrum-test.dir/test/spectrum-interference-test.cc.o.d"
+  "CMakeFiles/libspectrum-test.dir/test/spectrum-value-test.cc.o"
+  "CMakeFiles/libspectrum-test.dir/test/spectrum-value-test.cc.o.d"
+  "CMakeFiles/libspectrum-test.dir/test/spectrum-waveform-generator-test.cc.o"
+  "CMakeFiles/libspectrum-test.dir/test/spectrum-waveform-generator-test.cc.o.d"
+  "CMakeFiles/libspectrum-test.dir/test/three-gpp-channel-test-suite.cc.o"
+  "CMakeFiles/libspectrum-test.dir/test/three-gpp-channel-test-suite.cc.o.d"
+  "CMakeFiles/libspectrum-test.dir/test/tv-helper-distribution-test.cc.o"
+  "CMakeFiles/libspectrum-test.dir/test/tv-helper-distribution-test.cc.o.d"
+  "CMakeFiles/libspectrum-test.dir/test/tv-spectrum-transmitter-test.cc.o"
+  "CMakeFiles/libspectrum-test.dir/test/tv-spectrum-transmitter-test.cc.o.d"
+  "CMakeFiles/libspectrum-test.dir/test/two-ray-splm-test-suite.cc.o"
+  "CMakeFiles/libspectrum-test.dir/test/two-ray-splm-test-suite.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libspectrum-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/lib/libns3-dev-traffic-control-test-debug.pdb"
+  "/root/repo/build/lib/libns3-dev-traffic-control-test-debug.so"
+  "CMakeFiles/libtraffic-control-test.dir/test/adaptive-red-queue-disc-test-suite.cc.o"
+  "CMakeFiles/libtraffic-control-test.dir/test/adaptive-red-queue-disc-test-suite.cc.o.d"
+  "CMakeFiles/libtraffic-control-test.dir/test/cobalt-queue-disc-test-suite.cc.o"
+  "CMakeFiles/libtraffic-control-test.dir/test/cobalt-queue-disc-test-suite.cc.o.d"
+  "CMakeFiles/libtraffic-control-test.dir/test/codel-queue-disc-test-suite.cc.o"
+  "CMakeFiles/libtraffic-control-test.dir/test/codel-queue-disc-test-suite.cc.o.d"
+  "CMakeFiles/libtraffic-control-test.dir/test/fifo-queue-disc-test-suite.cc.o"
+  "CMakeFiles/libtraffic-control-test.dir/test/fifo-queue-disc-test-suite.cc.o.d"
+  "CMakeFiles/libtraffic-control-test.dir/test/pie-queue-disc-test-suite.cc.o"
+  "CMakeFiles/libtraffic-control-test.dir/test/pie-queue-disc-test-suite.cc.o.d"
+  "CMakeFiles/libtraffic-control-test.dir/test/prio-queue-disc-test-suite.cc.o"
+  "CMakeFiles/libtraffic-control-test.dir/test/prio-queue-disc-test-suite.cc.o.d"
+  "CMakeFiles/libtraffic-control-test.dir/test/queue-disc-traces-test-suite.cc.o"
+  "CMakeFiles/libtraffic-control-test.dir/test/queue-disc-traces-test-suite.cc.o.d"
+  "CMakeFiles/libtraffic-control-test.dir/test/red-queue-disc-test-suite.cc.o"
+  "CMakeFiles/libtraffic-control-test.dir/test/red-queue-disc-test-suite.cc.o.d"
+  "CMakeFiles/libtraffic-control-test.dir/test/tbf-queue-disc-test-suite.cc.o"
+  "CMakeFiles/libtraffic-control-test.dir/test/tbf-queue-disc-test-suite.cc.o.d"
+  "CMakeFiles/libtraffic-control-test.dir/test/tc-flow-control-test-suite.cc.o"
+  "CMakeFiles/libtraffic-control-test.dir/test/tc-flow-control-test-suite.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libtraffic-control-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libvirtual-net-device-obj.dir/model/virtual-net-device.cc.o"
+  "CMakeFiles/libvirtual-net-device-obj.dir/model/virtual-net-device.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libvirtual-net-device-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
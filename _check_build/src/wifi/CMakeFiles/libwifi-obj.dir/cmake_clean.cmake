@@ -0,0 +1,307 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libwifi-obj.dir/helper/athstats-helper.cc.o"
+  "CMakeFiles/libwifi-obj.dir/helper/athstats-helper.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/helper/spectrum-wifi-helper.cc.o"
+  "CMakeFiles/libwifi-obj.dir/helper/spectrum-wifi-helper.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/helper/wifi-helper.cc.o"
+  "CMakeFiles/libwifi-obj.dir/helper/wifi-helper.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/helper/wifi-mac-helper.cc.o"
+  "CMakeFiles/libwifi-obj.dir/helper/wifi-mac-helper.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/helper/wifi-radio-energy-model-helper.cc.o"
+  "CMakeFiles/libwifi-obj.dir/helper/wifi-radio-energy-model-helper.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/helper/yans-wifi-helper.cc.o"
+  "CMakeFiles/libwifi-obj.dir/helper/yans-wifi-helper.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/addba-extension.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/addba-extension.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/adhoc-wifi-mac.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/adhoc-wifi-mac.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/ampdu-subframe-header.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/ampdu-subframe-header.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/ampdu-tag.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/ampdu-tag.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/amsdu-subframe-header.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/amsdu-subframe-header.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/ap-wifi-mac.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/ap-wifi-mac.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/block-ack-agreement.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/block-ack-agreement.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/block-ack-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/block-ack-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/block-ack-type.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/block-ack-type.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/block-ack-window.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/block-ack-window.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/capability-information.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/capability-information.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/channel-access-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/channel-access-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/ctrl-headers.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/ctrl-headers.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/edca-parameter-set.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/edca-parameter-set.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/eht/default-emlsr-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/eht/default-emlsr-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/eht/eht-capabilities.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/eht/eht-capabilities.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/eht/eht-configuration.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/eht/eht-configuration.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/eht/eht-frame-exchange-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/eht/eht-frame-exchange-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/eht/eht-operation.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/eht/eht-operation.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/eht/eht-phy.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/eht/eht-phy.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/eht/eht-ppdu.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/eht/eht-ppdu.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/eht/emlsr-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/eht/emlsr-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/eht/multi-link-element.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/eht/multi-link-element.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/eht/tid-to-link-mapping-element.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/eht/tid-to-link-mapping-element.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/error-rate-model.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/error-rate-model.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/extended-capabilities.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/extended-capabilities.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/fcfs-wifi-queue-scheduler.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/fcfs-wifi-queue-scheduler.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/frame-capture-model.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/frame-capture-model.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/frame-exchange-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/frame-exchange-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/he/constant-obss-pd-algorithm.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/he/constant-obss-pd-algorithm.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/he/he-capabilities.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/he/he-capabilities.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/he/he-configuration.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/he/he-configuration.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/he/he-frame-exchange-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/he/he-frame-exchange-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/he/he-operation.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/he/he-operation.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/he/he-phy.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/he/he-phy.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/he/he-ppdu.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/he/he-ppdu.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/he/he-ru.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/he/he-ru.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/he/mu-edca-parameter-set.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/he/mu-edca-parameter-set.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/he/mu-snr-tag.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/he/mu-snr-tag.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/he/multi-user-scheduler.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/he/multi-user-scheduler.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/he/obss-pd-algorithm.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/he/obss-pd-algorithm.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/he/rr-multi-user-scheduler.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/he/rr-multi-user-scheduler.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/ht/ht-capabilities.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/ht/ht-capabilities.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/ht/ht-configuration.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/ht/ht-configuration.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/ht/ht-frame-exchange-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/ht/ht-frame-exchange-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/ht/ht-operation.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/ht/ht-operation.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/ht/ht-phy.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/ht/ht-phy.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/ht/ht-ppdu.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/ht/ht-ppdu.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/interference-helper.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/interference-helper.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/mac-rx-middle.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/mac-rx-middle.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/mac-tx-middle.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/mac-tx-middle.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/mgt-action-headers.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/mgt-action-headers.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/mgt-headers.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/mgt-headers.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/mpdu-aggregator.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/mpdu-aggregator.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/msdu-aggregator.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/msdu-aggregator.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/nist-error-rate-model.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/nist-error-rate-model.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/non-ht/dsss-error-rate-model.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/non-ht/dsss-error-rate-model.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/non-ht/dsss-parameter-set.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/non-ht/dsss-parameter-set.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/non-ht/dsss-phy.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/non-ht/dsss-phy.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/non-ht/dsss-ppdu.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/non-ht/dsss-ppdu.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/non-ht/erp-information.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/non-ht/erp-information.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/non-ht/erp-ofdm-phy.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/non-ht/erp-ofdm-phy.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/non-ht/erp-ofdm-ppdu.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/non-ht/erp-ofdm-ppdu.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/non-ht/ofdm-phy.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/non-ht/ofdm-phy.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/non-ht/ofdm-ppdu.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/non-ht/ofdm-ppdu.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/non-inheritance.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/non-inheritance.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/originator-block-ack-agreement.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/originator-block-ack-agreement.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/phy-entity.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/phy-entity.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/preamble-detection-model.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/preamble-detection-model.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/qos-frame-exchange-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/qos-frame-exchange-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/qos-txop.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/qos-txop.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/qos-utils.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/qos-utils.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/aarf-wifi-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/aarf-wifi-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/aarfcd-wifi-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/aarfcd-wifi-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/amrr-wifi-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/amrr-wifi-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/aparf-wifi-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/aparf-wifi-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/arf-wifi-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/arf-wifi-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/cara-wifi-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/cara-wifi-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/constant-rate-wifi-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/constant-rate-wifi-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/ideal-wifi-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/ideal-wifi-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/minstrel-ht-wifi-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/minstrel-ht-wifi-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/minstrel-wifi-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/minstrel-wifi-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/onoe-wifi-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/onoe-wifi-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/parf-wifi-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/parf-wifi-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/rraa-wifi-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/rraa-wifi-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/rrpaa-wifi-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/rrpaa-wifi-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/thompson-sampling-wifi-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/rate-control/thompson-sampling-wifi-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/recipient-block-ack-agreement.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/recipient-block-ack-agreement.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/reduced-neighbor-report.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/reduced-neighbor-report.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/simple-frame-capture-model.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/simple-frame-capture-model.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/snr-tag.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/snr-tag.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/spectrum-wifi-phy.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/spectrum-wifi-phy.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/ssid.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/ssid.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/sta-wifi-mac.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/sta-wifi-mac.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/status-code.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/status-code.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/supported-rates.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/supported-rates.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/table-based-error-rate-model.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/table-based-error-rate-model.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/threshold-preamble-detection-model.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/threshold-preamble-detection-model.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/txop.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/txop.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/vht/vht-capabilities.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/vht/vht-capabilities.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/vht/vht-configuration.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/vht/vht-configuration.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/vht/vht-frame-exchange-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/vht/vht-frame-exchange-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/vht/vht-operation.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/vht/vht-operation.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/vht/vht-phy.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/vht/vht-phy.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/vht/vht-ppdu.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/vht/vht-ppdu.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-ack-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-ack-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-acknowledgment.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-acknowledgment.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-assoc-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-assoc-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-bandwidth-filter.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-bandwidth-filter.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-default-ack-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-default-ack-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-default-assoc-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-default-assoc-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-default-protection-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-default-protection-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-information-element.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-information-element.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-mac-header.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-mac-header.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-mac-queue-container.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-mac-queue-container.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-mac-queue-elem.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-mac-queue-elem.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-mac-queue-scheduler.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-mac-queue-scheduler.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-mac-queue.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-mac-queue.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-mac-trailer.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-mac-trailer.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-mac.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-mac.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-mode.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-mode.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-mpdu.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-mpdu.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-net-device.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-net-device.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-phy-common.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-phy-common.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-phy-operating-channel.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-phy-operating-channel.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-phy-state-helper.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-phy-state-helper.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-phy.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-phy.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-ppdu.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-ppdu.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-protection-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-protection-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-protection.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-protection.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-psdu.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-psdu.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-radio-energy-model.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-radio-energy-model.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-remote-station-info.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-remote-station-info.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-remote-station-manager.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-remote-station-manager.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-spectrum-phy-interface.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-spectrum-phy-interface.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-spectrum-signal-parameters.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-spectrum-signal-parameters.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-tx-current-model.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-tx-current-model.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-tx-parameters.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-tx-parameters.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-tx-timer.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-tx-timer.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-tx-vector.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-tx-vector.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-utils.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/wifi-utils.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/yans-error-rate-model.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/yans-error-rate-model.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/yans-wifi-channel.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/yans-wifi-channel.cc.o.d"
+  "CMakeFiles/libwifi-obj.dir/model/yans-wifi-phy.cc.o"
+  "CMakeFiles/libwifi-obj.dir/model/yans-wifi-phy.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libwifi-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
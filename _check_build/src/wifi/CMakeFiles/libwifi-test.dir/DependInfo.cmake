@@ -0,0 +1,54 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/wifi/test/block-ack-test-suite.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/block-ack-test-suite.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/block-ack-test-suite.cc.o.d"
+  "/root/repo/src/wifi/test/channel-access-manager-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/channel-access-manager-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/channel-access-manager-test.cc.o.d"
+  "/root/repo/src/wifi/test/inter-bss-test-suite.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/inter-bss-test-suite.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/inter-bss-test-suite.cc.o.d"
+  "/root/repo/src/wifi/test/power-rate-adaptation-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/power-rate-adaptation-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/power-rate-adaptation-test.cc.o.d"
+  "/root/repo/src/wifi/test/spectrum-wifi-phy-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/spectrum-wifi-phy-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/spectrum-wifi-phy-test.cc.o.d"
+  "/root/repo/src/wifi/test/tx-duration-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/tx-duration-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/tx-duration-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-aggregation-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-aggregation-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-aggregation-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-channel-switching-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-channel-switching-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-channel-switching-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-dynamic-bw-op-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-dynamic-bw-op-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-dynamic-bw-op-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-eht-info-elems-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-eht-info-elems-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-eht-info-elems-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-emlsr-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-emlsr-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-emlsr-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-error-rate-models-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-error-rate-models-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-error-rate-models-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-ie-fragment-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-ie-fragment-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-ie-fragment-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-mac-ofdma-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-mac-ofdma-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-mac-ofdma-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-mac-queue-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-mac-queue-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-mac-queue-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-mlo-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-mlo-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-mlo-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-non-ht-dup-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-non-ht-dup-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-non-ht-dup-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-phy-cca-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-phy-cca-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-phy-cca-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-phy-mu-mimo-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-phy-mu-mimo-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-phy-mu-mimo-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-phy-ofdma-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-phy-ofdma-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-phy-ofdma-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-phy-reception-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-phy-reception-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-phy-reception-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-phy-thresholds-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-phy-thresholds-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-phy-thresholds-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-primary-channels-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-primary-channels-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-primary-channels-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-ru-allocation-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-ru-allocation-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-ru-allocation-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-transmit-mask-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-transmit-mask-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-transmit-mask-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-txop-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-txop-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-txop-test.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_check_build/src/wifi/CMakeFiles/libwifi.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/energy/CMakeFiles/libenergy.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/spectrum/CMakeFiles/libspectrum.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/antenna/CMakeFiles/libantenna.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/propagation/CMakeFiles/libpropagation.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/mobility/CMakeFiles/libmobility.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/network/CMakeFiles/libnetwork.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/stats/CMakeFiles/libstats.dir/DependInfo.cmake"
+  "/root/repo/_check_build/src/core/CMakeFiles/libcore.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
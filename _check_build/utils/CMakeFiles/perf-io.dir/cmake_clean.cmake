@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/utils/perf/ns3-dev-perf-io-debug"
+  "/root/repo/build/utils/perf/ns3-dev-perf-io-debug.pdb"
+  "CMakeFiles/perf-io.dir/perf/perf-io.cc.o"
+  "CMakeFiles/perf-io.dir/perf/perf-io.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf-io.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -525,6 +525,22 @@ macro(process_options)
     endif()
   endif()
 
+  set(ENABLE_ZLIB False)
+  if(${NS3_ZLIB})
+    find_external_library(
+      DEPENDENCY_NAME ZLIB
+      HEADER_NAME zlib.h
+      LIBRARY_NAME z
+      OUTPUT_VARIABLE "ENABLE_ZLIB_REASON"
+    )
+
+    if(${ZLIB_FOUND})
+      set(ENABLE_ZLIB True)
+      add_definitions(-DHAVE_ZLIB)
+      include_directories(${ZLIB_INCLUDE_DIRS})
+    endif()
+  endif()
+
   set(ENABLE_EIGEN False)
   if(${NS3_EIGEN})
     disable_cmake_warnings()
@@ -823,6 +839,12 @@ macro(process_options)
     endif()
   endif()
 
+  set(ENABLE_MTP FALSE)
+  if(${NS3_MTP})
+    add_definitions(-DNS3_MTP)
+    set(ENABLE_MTP TRUE)
+  endif()
+
   mark_as_advanced(Boost_INCLUDE_DIR)
   find_package(Boost)
   if(${Boost_FOUND})
@@ -1151,6 +1173,10 @@ macro(process_options)
     list(REMOVE_ITEM libs_to_build mpi)
   endif()
 
+  if(NOT ${ENABLE_MTP})
+    list(REMOVE_ITEM libs_to_build mtp)
+  endif()
+
   if(NOT ${ENABLE_VISUALIZER})
     list(REMOVE_ITEM libs_to_build visualizer)
   endif()
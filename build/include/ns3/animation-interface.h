@@ -0,0 +1 @@
+#include "/root/repo/src/netanim/model/animation-interface.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/core/model/calendar-scheduler.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/energy/helper/generic-battery-model-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/mesh/model/dot11s/ie-dot11s-configuration.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/wimax/model/ipcs-classifier.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/lr-wpan/model/lr-wpan-phy.h"
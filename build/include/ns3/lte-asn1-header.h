@@ -0,0 +1 @@
+#include "/root/repo/src/lte/model/lte-asn1-header.h"
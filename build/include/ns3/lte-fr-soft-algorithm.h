@@ -0,0 +1 @@
+#include "/root/repo/src/lte/model/lte-fr-soft-algorithm.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/lte/helper/mac-stats-calculator.h"
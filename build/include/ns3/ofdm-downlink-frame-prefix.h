@@ -0,0 +1 @@
+#include "/root/repo/src/wimax/model/ofdm-downlink-frame-prefix.h"
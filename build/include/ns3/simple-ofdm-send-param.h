@@ -0,0 +1 @@
+#include "/root/repo/src/wimax/model/simple-ofdm-send-param.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/wimax/model/ss-service-flow-manager.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/internet/model/windowed-filter.h"
@@ -62,6 +62,8 @@
  *   to a comma-separated value (csv) file
  * - some tracing and flow monitor configuration that used to work is
  *   left commented inline in the program
+ * - optionally (printEvents option), the number of events executed, which
+ *   can be compared with and without the timer wheel (timerWheel option)
  */
 
 #include "ns3/aodv-module.h"
@@ -133,6 +135,8 @@ class RoutingExperiment
     double m_txp{7.5};                                     //!< Tx power.
     bool m_traceMobility{false};                           //!< Enable mobility tracing.
     bool m_flowMonitor{false};                             //!< Enable FlowMonitor.
+    bool m_timerWheel{false};                              //!< Enable the timer wheel.
+    bool m_printEvents{false};                             //!< Print the events executed.
 };
 
 RoutingExperiment::RoutingExperiment()
@@ -207,8 +211,12 @@ RoutingExperiment::CommandSetup(int argc, char** argv)
     cmd.AddValue("traceMobility", "Enable mobility tracing", m_traceMobility);
     cmd.AddValue("protocol", "Routing protocol (OLSR, AODV, DSDV, DSR)", m_protocolName);
     cmd.AddValue("flowMonitor", "enable FlowMonitor", m_flowMonitor);
+    cmd.AddValue("timerWheel", "schedule the protocol timers in a timer wheel", m_timerWheel);
+    cmd.AddValue("printEvents", "print the number of events executed", m_printEvents);
     cmd.Parse(argc, argv);
 
+    GlobalValue::Bind("TimerWheelEnabled", BooleanValue(m_timerWheel));
+
     std::vector<std::string> allowedProtocols{"OLSR", "AODV", "DSDV", "DSR"};
 
     if (std::find(std::begin(allowedProtocols), std::end(allowedProtocols), m_protocolName) ==
@@ -420,5 +428,10 @@ RoutingExperiment::Run()
         flowmon->SerializeToXmlFile(tr_name + ".flowmon", false, false);
     }
 
+    if (m_printEvents)
+    {
+        std::cout << "Events executed: " << Simulator::GetEventCount() << std::endl;
+    }
+
     Simulator::Destroy();
 }
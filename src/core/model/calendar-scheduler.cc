@@ -283,6 +283,20 @@ CalendarScheduler::Remove(const Event& ev)
     NS_ASSERT(false);
 }
 
+uint32_t
+CalendarScheduler::Compact()
+{
+    NS_LOG_FUNCTION(this);
+    uint32_t removed = 0;
+    for (uint32_t i = 0; i < m_nBuckets; i++)
+    {
+        removed += m_buckets[i].remove_if(&CalendarScheduler::ReleaseIfCancelled);
+    }
+    m_qSize -= removed;
+    ResizeDown();
+    return removed;
+}
+
 void
 CalendarScheduler::ResizeUp()
 {
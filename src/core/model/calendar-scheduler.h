@@ -65,6 +65,7 @@ class EventImpl;
  * IsEmpty()    | Constant        | Explicit queue size
  * PeekNext()   | ~Constant       | Search buckets
  * Remove()     | ~Constant       | Search within bucket; possible resize
+ * Compact()    | Linear          | Filter every bucket
  * RemoveNext() | ~Constant       | Search buckets; possible resize
  *
  * \par Memory Complexity
@@ -110,6 +111,7 @@ class CalendarScheduler : public Scheduler
     Scheduler::Event PeekNext() const override;
     Scheduler::Event RemoveNext() override;
     void Remove(const Scheduler::Event& ev) override;
+    uint32_t Compact() override;
 
   private:
     /** Double the number of buckets if necessary. */
@@ -20,9 +20,13 @@
 #include "default-simulator-impl.h"
 
 #include "assert.h"
+#include "double.h"
+#include "event-profiler.h"
 #include "log.h"
 #include "scheduler.h"
 #include "simulator.h"
+#include "string.h"
+#include "uinteger.h"
 
 #include <cmath>
 
@@ -45,10 +49,30 @@ NS_OBJECT_ENSURE_REGISTERED(DefaultSimulatorImpl);
 TypeId
 DefaultSimulatorImpl::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::DefaultSimulatorImpl")
-                            .SetParent<SimulatorImpl>()
-                            .SetGroupName("Core")
-                            .AddConstructor<DefaultSimulatorImpl>();
+    static TypeId tid =
+        TypeId("ns3::DefaultSimulatorImpl")
+            .SetParent<SimulatorImpl>()
+            .SetGroupName("Core")
+            .AddConstructor<DefaultSimulatorImpl>()
+            .AddAttribute("CompactionRatio",
+                          "Remove the cancelled events from the event list when they exceed "
+                          "this fraction of the pending events. 0 disables the compaction.",
+                          DoubleValue(0.5),
+                          MakeDoubleAccessor(&DefaultSimulatorImpl::m_compactionRatio),
+                          MakeDoubleChecker<double>(0))
+            .AddAttribute("CompactionThreshold",
+                          "The minimum number of cancelled events triggering a compaction "
+                          "of the event list.",
+                          UintegerValue(1024),
+                          MakeUintegerAccessor(&DefaultSimulatorImpl::m_compactionThreshold),
+                          MakeUintegerChecker<uint32_t>())
+            .AddAttribute("ProfileFile",
+                          "If not empty, measure the wall-clock time spent in each event, "
+                          "and write it by node and event type to this file, in folded "
+                          "stacks format, when the simulator is destroyed.",
+                          StringValue(""),
+                          MakeStringAccessor(&DefaultSimulatorImpl::m_profileFile),
+                          MakeStringChecker());
     return tid;
 }
 
@@ -61,6 +85,9 @@ DefaultSimulatorImpl::DefaultSimulatorImpl()
     m_currentTs = 0;
     m_currentContext = Simulator::NO_CONTEXT;
     m_unscheduledEvents = 0;
+    m_cancelledEvents = 0;
+    m_compactionRatio = 0.5;
+    m_compactionThreshold = 1024;
     m_eventCount = 0;
     m_eventsWithContextEmpty = true;
     m_mainThreadId = std::this_thread::get_id();
@@ -100,6 +127,11 @@ DefaultSimulatorImpl::Destroy()
             ev->Invoke();
         }
     }
+    if (m_profiler)
+    {
+        m_profiler->Write(m_profileFile);
+        m_profiler = nullptr;
+    }
 }
 
 void
@@ -136,12 +168,23 @@ DefaultSimulatorImpl::ProcessOneEvent()
     NS_ASSERT(next.key.m_ts >= m_currentTs);
     m_unscheduledEvents--;
     m_eventCount++;
+    if (next.impl->IsCancelled() && m_cancelledEvents > 0)
+    {
+        m_cancelledEvents--;
+    }
 
     NS_LOG_LOGIC("handle " << next.key.m_ts);
     m_currentTs = next.key.m_ts;
     m_currentContext = next.key.m_context;
     m_currentUid = next.key.m_uid;
-    next.impl->Invoke();
+    if (m_profiler)
+    {
+        m_profiler->Invoke(next.impl, next.key.m_context);
+    }
+    else
+    {
+        next.impl->Invoke();
+    }
     next.impl->Unref();
 
     ProcessEventsWithContext();
@@ -191,6 +234,10 @@ DefaultSimulatorImpl::Run()
     m_mainThreadId = std::this_thread::get_id();
     ProcessEventsWithContext();
     m_stop = false;
+    if (!m_profileFile.empty() && !m_profiler)
+    {
+        m_profiler = std::make_unique<EventProfiler>();
+    }
 
     while (!m_events->IsEmpty() && !m_stop)
     {
@@ -352,9 +399,31 @@ DefaultSimulatorImpl::Cancel(const EventId& id)
     if (!IsExpired(id))
     {
         id.PeekEventImpl()->Cancel();
+        if (id.GetUid() == EventId::UID::DESTROY)
+        {
+            return;
+        }
+        m_cancelledEvents++;
+        if (m_compactionRatio > 0 && m_cancelledEvents >= m_compactionThreshold &&
+            m_cancelledEvents > m_compactionRatio * m_unscheduledEvents)
+        {
+            Compact();
+        }
     }
 }
 
+void
+DefaultSimulatorImpl::Compact()
+{
+    NS_LOG_FUNCTION(this << m_cancelledEvents << m_unscheduledEvents);
+    // Cancelled events may still be waiting in the list of events with context.
+    ProcessEventsWithContext();
+    uint32_t removed = m_events->Compact();
+    NS_LOG_LOGIC("removed " << removed << " cancelled events");
+    m_unscheduledEvents -= removed;
+    m_cancelledEvents = 0;
+}
+
 bool
 DefaultSimulatorImpl::IsExpired(const EventId& id) const
 {
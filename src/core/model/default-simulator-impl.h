@@ -23,7 +23,9 @@
 #include "simulator-impl.h"
 
 #include <list>
+#include <memory>
 #include <mutex>
+#include <string>
 #include <thread>
 
 /**
@@ -36,6 +38,7 @@ namespace ns3
 {
 
 // Forward
+class EventProfiler;
 class Scheduler;
 
 /**
@@ -85,6 +88,8 @@ class DefaultSimulatorImpl : public SimulatorImpl
     void ProcessOneEvent();
     /** Move events from a different context into the main event queue. */
     void ProcessEventsWithContext();
+    /** Remove the cancelled events from the event queue. */
+    void Compact();
 
     /** Wrap an event with its execution context. */
     struct EventWithContext
@@ -133,6 +138,23 @@ class DefaultSimulatorImpl : public SimulatorImpl
      *  not counting the Destroy events; this is used for validation
      */
     int m_unscheduledEvents;
+    /**
+     * Number of events in the event queue which have been cancelled,
+     * and thus will be skipped when they expire.
+     */
+    uint32_t m_cancelledEvents;
+    /**
+     * Fraction of cancelled events among the pending events above which
+     * the event queue is compacted.
+     */
+    double m_compactionRatio;
+    /** Minimum number of cancelled events before compacting the event queue. */
+    uint32_t m_compactionThreshold;
+
+    /** File written by the profiler; profiling is disabled if empty. */
+    std::string m_profileFile;
+    /** The event profiler, only created when profiling is enabled. */
+    std::unique_ptr<EventProfiler> m_profiler;
 
     /** Main execution thread. */
     std::thread::id m_mainThreadId;
@@ -21,6 +21,9 @@
 
 #include "log.h"
 
+#include <algorithm>
+#include <new>
+
 /**
  * \file
  * \ingroup events
@@ -32,6 +35,133 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("EventImpl");
 
+namespace
+{
+
+/**
+ * \ingroup events
+ * The per-thread free lists of event memory, one per size class.
+ *
+ * Logging is avoided here: events are allocated while logging.
+ */
+class EventPool
+{
+  public:
+    /** Granularity of the size classes, which preserves the default alignment. */
+    static constexpr std::size_t GRANULARITY = alignof(std::max_align_t);
+    /** Number of size classes; larger events bypass the pool. */
+    static constexpr std::size_t N_CLASSES = 16;
+    /** Maximum number of bytes kept in the free list of a size class. */
+    static constexpr std::size_t MAX_FREE_BYTES = 2 * 1024 * 1024;
+
+    /** Constructor. */
+    EventPool();
+    /** Destructor; releases the free lists. */
+    ~EventPool();
+
+    /**
+     * Allocate a block.
+     * \param [in] size The size of the block.
+     * \returns The block.
+     */
+    void* Allocate(std::size_t size);
+    /**
+     * Release a block.
+     * \param [in] p The block.
+     * \param [in] size The size of the block.
+     */
+    void Deallocate(void* p, std::size_t size);
+
+    /** The pool statistics. */
+    EventImpl::PoolStatistics m_stats;
+
+  private:
+    /** A free block, linked into the free list of its size class. */
+    struct FreeBlock
+    {
+        FreeBlock* next; //!< Next free block of the same size class.
+    };
+
+    /** The free list heads, indexed by size class. */
+    FreeBlock* m_freeLists[N_CLASSES];
+    /** The number of blocks in each free list. */
+    std::size_t m_freeCounts[N_CLASSES];
+};
+
+/**
+ * The event pool of the current thread.  Events released by static
+ * destructors after it is destroyed go to the system allocator.
+ */
+thread_local EventPool t_pool;
+/** Whether t_pool has been destroyed. */
+thread_local bool t_poolDestroyed = false;
+
+EventPool::EventPool()
+    : m_stats{0, 0, 0, 0},
+      m_freeLists{},
+      m_freeCounts{}
+{
+}
+
+EventPool::~EventPool()
+{
+    for (std::size_t i = 0; i < N_CLASSES; i++)
+    {
+        while (m_freeLists[i] != nullptr)
+        {
+            FreeBlock* block = m_freeLists[i];
+            m_freeLists[i] = block->next;
+            ::operator delete(block);
+        }
+    }
+    t_poolDestroyed = true;
+}
+
+void*
+EventPool::Allocate(std::size_t size)
+{
+    m_stats.inUse++;
+    m_stats.highWaterMark = std::max(m_stats.highWaterMark, m_stats.inUse);
+    std::size_t sizeClass = (size - 1) / GRANULARITY;
+    if (sizeClass < N_CLASSES && m_freeLists[sizeClass] != nullptr)
+    {
+        m_stats.hits++;
+        FreeBlock* block = m_freeLists[sizeClass];
+        m_freeLists[sizeClass] = block->next;
+        m_freeCounts[sizeClass]--;
+        return block;
+    }
+    m_stats.misses++;
+    if (sizeClass < N_CLASSES)
+    {
+        // allocate the whole class size so that the block can be reused
+        // by any event of the same class.
+        return ::operator new((sizeClass + 1) * GRANULARITY);
+    }
+    return ::operator new(size);
+}
+
+void
+EventPool::Deallocate(void* p, std::size_t size)
+{
+    m_stats.inUse--;
+    std::size_t sizeClass = (size - 1) / GRANULARITY;
+    // events freed by another thread than the one which allocated them are
+    // kept by the freeing thread, whose free lists must not grow without bound
+    if (sizeClass < N_CLASSES &&
+        (m_freeCounts[sizeClass] + 1) * (sizeClass + 1) * GRANULARITY <= MAX_FREE_BYTES)
+    {
+        auto block = static_cast<FreeBlock*>(p);
+        block->next = m_freeLists[sizeClass];
+        m_freeLists[sizeClass] = block;
+        m_freeCounts[sizeClass]++;
+        return;
+    }
+    ::operator delete(p);
+}
+
+} // unnamed namespace
+
 EventImpl::~EventImpl()
 {
     NS_LOG_FUNCTION(this);
@@ -67,4 +197,44 @@ EventImpl::IsCancelled()
     return m_cancel;
 }
 
+const void*
+EventImpl::GetFunctionAddress() const
+{
+    return nullptr;
+}
+
+EventImpl::PoolStatistics
+EventImpl::GetPoolStatistics()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    if (t_poolDestroyed)
+    {
+        return {0, 0, 0, 0};
+    }
+    return t_pool.m_stats;
+}
+
+void*
+EventImpl::operator new(std::size_t size)
+{
+    if (t_poolDestroyed)
+    {
+        return ::operator new(size);
+    }
+    return t_pool.Allocate(size);
+}
+
+void
+EventImpl::operator delete(void* p, std::size_t size)
+{
+    if (t_poolDestroyed)
+    {
+        // blocks from the size classes were allocated with the class size,
+        // which the unsized global operator delete does not need.
+        ::operator delete(p);
+        return;
+    }
+    t_pool.Deallocate(p, size);
+}
+
 } // namespace ns3
@@ -21,6 +21,7 @@
 
 #include "simple-ref-count.h"
 
+#include <cstddef>
 #include <stdint.h>
 
 /**
@@ -41,6 +42,12 @@ namespace ns3
  * when it reaches the time associated to this event. Most subclasses
  * are usually created by one of the many Simulator::Schedule
  * methods.
+ *
+ * The memory of the events is recycled: each thread keeps a free list
+ * of event blocks per size class, so that scheduling an event does
+ * not call the system allocator once the simulation has reached a
+ * steady state.  Events larger than the largest size class are
+ * allocated with the global \c operator \c new.
  */
 class EventImpl : public SimpleRefCount<EventImpl>
 {
@@ -66,6 +73,54 @@ class EventImpl : public SimpleRefCount<EventImpl>
      * Checked by the simulation engine before calling Invoke().
      */
     bool IsCancelled();
+    /**
+     * Get the address of the function or method invoked by the event,
+     * which the EventProfiler uses to tell apart the events of the same
+     * type.  The events made by MakeEvent() from a function or a class
+     * method override it.
+     *
+     * \returns The address of the code invoked, or nullptr if unknown.
+     */
+    virtual const void* GetFunctionAddress() const;
+
+    /** Statistics of the event memory pool of a thread. */
+    struct PoolStatistics
+    {
+        /** Number of events allocated from the free lists. */
+        uint64_t hits;
+        /** Number of events allocated with the system allocator. */
+        uint64_t misses;
+        /** Number of events currently allocated by this thread. */
+        int64_t inUse;
+        /** Largest value reached by \c inUse. */
+        int64_t highWaterMark;
+    };
+
+    /**
+     * Get the statistics of the event memory pool of the calling thread.
+     *
+     * Events freed by a thread other than the one which allocated them
+     * are returned to the pool of the freeing thread, so \c inUse is only
+     * exact when events are scheduled and executed by the same thread.
+     *
+     * \returns The pool statistics.
+     */
+    static PoolStatistics GetPoolStatistics();
+
+    /**
+     * Allocate the memory of an event from the pool of the calling thread.
+     * \param [in] size The size of the event.
+     * \returns The allocated memory.
+     */
+    static void* operator new(std::size_t size);
+    /**
+     * Return the memory of an event to the pool of the calling thread.
+     * The pool keeps at most 2 MiB of free memory per size class, and
+     * returns the rest to the system allocator.
+     * \param [in] p The event memory.
+     * \param [in] size The size of the event.
+     */
+    static void operator delete(void* p, std::size_t size);
 
   protected:
     /**
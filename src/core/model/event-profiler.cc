@@ -0,0 +1,209 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "event-profiler.h"
+
+#include "abort.h"
+#include "event-impl.h"
+#include "log.h"
+#include "simulator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#if (__GNUC__ >= 3)
+#include <cstdlib>
+#include <cxxabi.h>
+#endif
+
+#ifndef __WIN32__
+#include <dlfcn.h>
+#endif
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::EventProfiler implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("EventProfiler");
+
+namespace
+{
+
+/**
+ * \ingroup simulator
+ * Demangle a C++ name.
+ *
+ * \param [in] mangled The mangled name.
+ * \returns The demangled name, or the mangled name if it cannot be demangled.
+ */
+std::string
+Demangle(const char* mangled)
+{
+    std::string name = mangled;
+#if (__GNUC__ >= 3)
+    int status;
+    char* demangled = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+    if (status == 0)
+    {
+        name = demangled;
+    }
+    std::free(demangled);
+#endif
+    return name;
+}
+
+/**
+ * \ingroup simulator
+ * Get a readable name for an event type.
+ *
+ * The events made by MakeEvent() are local classes of the MakeEvent()
+ * template, whose demangled name repeats the template arguments as the
+ * function arguments: only the template is kept.
+ *
+ * \param [in] mangled The mangled type name.
+ * \returns The demangled and shortened type name.
+ */
+std::string
+GetEventTypeName(const char* mangled)
+{
+    std::string name = Demangle(mangled);
+
+    const std::string prefix = "ns3::MakeEvent<";
+    if (name.compare(0, prefix.size(), prefix) == 0)
+    {
+        int depth = 0;
+        for (std::size_t i = prefix.size() - 1; i < name.size(); i++)
+        {
+            if (name[i] == '<')
+            {
+                depth++;
+            }
+            else if (name[i] == '>' && --depth == 0)
+            {
+                name.resize(i + 1);
+                break;
+            }
+        }
+    }
+    return name;
+}
+
+} // unnamed namespace
+
+EventProfiler::EventProfiler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+uint32_t
+EventProfiler::GetHandlerIndex(const EventImpl* event)
+{
+    Handler handler{typeid(*event), event->GetFunctionAddress()};
+    auto [it, inserted] = m_handlerIndexes.emplace(handler, m_handlers.size());
+    if (inserted)
+    {
+        m_handlers.push_back(handler);
+    }
+    return it->second;
+}
+
+std::string
+EventProfiler::GetHandlerName(const Handler& handler)
+{
+    std::string name;
+#ifndef __WIN32__
+    Dl_info info;
+    // the nearest symbol is only the function itself if it starts at its address
+    if (handler.function != nullptr && dladdr(handler.function, &info) != 0 &&
+        info.dli_sname != nullptr && info.dli_saddr == handler.function)
+    {
+        name = Demangle(info.dli_sname);
+    }
+#endif
+    if (name.empty())
+    {
+        name = GetEventTypeName(handler.type.name());
+    }
+    // ';' separates the frames of a folded stack.
+    std::replace(name.begin(), name.end(), ';', ',');
+    return name;
+}
+
+void
+EventProfiler::Invoke(EventImpl* event, uint32_t context)
+{
+    if (event->IsCancelled())
+    {
+        return;
+    }
+    // the object of the method invoked may be destroyed by the event
+    uint64_t key = (static_cast<uint64_t>(context) << 32) | GetHandlerIndex(event);
+    auto start = std::chrono::steady_clock::now();
+    event->Invoke();
+    auto end = std::chrono::steady_clock::now();
+
+    Entry& entry = m_entries[key];
+    entry.count++;
+    entry.ns += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+void
+EventProfiler::Write(const std::string& filename) const
+{
+    NS_LOG_FUNCTION(this << filename);
+    std::vector<std::string> names;
+    names.reserve(m_handlers.size());
+    for (const auto& handler : m_handlers)
+    {
+        names.push_back(GetHandlerName(handler));
+    }
+
+    // the handlers with the same name, such as a method scheduled on a raw
+    // pointer and on a Ptr, are merged
+    std::map<std::string, uint64_t> stacks;
+    for (const auto& [key, entry] : m_entries)
+    {
+        auto context = static_cast<uint32_t>(key >> 32);
+        auto handler = static_cast<uint32_t>(key & 0xffffffff);
+        std::ostringstream stack;
+        if (context == Simulator::NO_CONTEXT)
+        {
+            stack << "no context";
+        }
+        else
+        {
+            stack << "node " << context;
+        }
+        stack << ";" << names[handler];
+        stacks[stack.str()] += entry.ns;
+    }
+
+    std::ofstream os(filename);
+    NS_ABORT_MSG_UNLESS(os.is_open(), "EventProfiler: cannot open " << filename);
+    for (const auto& [stack, ns] : stacks)
+    {
+        os << stack << " " << ns << "\n";
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,146 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EVENT_PROFILER_H
+#define EVENT_PROFILER_H
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::EventProfiler declaration.
+ */
+
+#include <stdint.h>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3
+{
+
+class EventImpl;
+
+/**
+ * \ingroup simulator
+ * \brief Wall-clock profiler of the events executed by a simulator.
+ *
+ * The profiler measures the wall-clock time spent in each event it
+ * invokes, and accumulates it by handler and by context (the node id,
+ * for most events).  The handler of the events created by
+ * Simulator::Schedule is the function or method invoked, as returned by
+ * EventImpl::GetFunctionAddress(), and its name is looked up in the
+ * dynamic symbol tables when the file is written.  The handler of the
+ * other events, or of those whose symbol is not found, is named after
+ * the demangled C++ type of the EventImpl.
+ *
+ * The result is written as a "folded stacks" file, one line per
+ * (context, handler) pair:
+ * \verbatim
+   node 3;ns3::PointToPointNetDevice::TransmitComplete() 1234567 \endverbatim
+ * where the last field is the total time in nanoseconds.  The file can be
+ * rendered directly by flame graph tools, such as \c flamegraph.pl.
+ *
+ * The DefaultSimulatorImpl uses a profiler when its \c ProfileFile
+ * attribute is set, and writes the file at Simulator::Destroy():
+ * \code
+   $ ./ns3 run "my-program --ns3::DefaultSimulatorImpl::ProfileFile=my-program.folded"
+   $ flamegraph.pl --countname=ns my-program.folded > my-program.svg \endcode
+ */
+class EventProfiler
+{
+  public:
+    /** Constructor. */
+    EventProfiler();
+
+    /**
+     * Invoke an event, measuring the time it takes.
+     *
+     * \param [in] event The event to invoke.
+     * \param [in] context The context of the event.
+     */
+    void Invoke(EventImpl* event, uint32_t context);
+
+    /**
+     * Write the accumulated times in folded stacks format.
+     *
+     * \param [in] filename The name of the file to write.
+     */
+    void Write(const std::string& filename) const;
+
+  private:
+    /** The time accumulated by a (context, event type) pair. */
+    struct Entry
+    {
+        uint64_t count; //!< Number of events executed.
+        uint64_t ns;    //!< Total wall-clock time, in nanoseconds.
+    };
+
+    /** The handler of an event: the type of the event and the code it invokes. */
+    struct Handler
+    {
+        std::type_index type;  //!< The type of the event.
+        const void* function; //!< The function invoked, or nullptr if unknown.
+
+        /**
+         * \param [in] other The other handler.
+         * \returns true if the handlers are the same.
+         */
+        bool operator==(const Handler& other) const
+        {
+            return type == other.type && function == other.function;
+        }
+    };
+
+    /** Hash of a Handler. */
+    struct HandlerHash
+    {
+        /**
+         * \param [in] handler The handler.
+         * \returns The hash of the handler.
+         */
+        std::size_t operator()(const Handler& handler) const
+        {
+            return std::hash<std::type_index>()(handler.type) ^
+                   std::hash<const void*>()(handler.function);
+        }
+    };
+
+    /**
+     * Get the index of the handler of an event in #m_handlers, adding it
+     * if needed.
+     * \param [in] event The event.
+     * \returns The index of the handler of the event.
+     */
+    uint32_t GetHandlerIndex(const EventImpl* event);
+
+    /**
+     * Get the name of a handler.
+     * \param [in] handler The handler.
+     * \returns The name of the function invoked, or of the event type.
+     */
+    static std::string GetHandlerName(const Handler& handler);
+
+    /** Index in #m_handlers of each handler seen so far. */
+    std::unordered_map<Handler, uint32_t, HandlerHash> m_handlerIndexes;
+    /** The handlers seen so far. */
+    std::vector<Handler> m_handlers;
+    /** The accumulated times, indexed by context and handler index. */
+    std::unordered_map<uint64_t, Entry> m_entries;
+};
+
+} // namespace ns3
+
+#endif /* EVENT_PROFILER_H */
@@ -25,6 +25,8 @@
 #include "event-impl.h"
 #include "log.h"
 
+#include <algorithm>
+
 /**
  * \file
  * \ingroup scheduler
@@ -236,6 +238,13 @@ HeapScheduler::Remove(const Event& ev)
             NS_ASSERT(m_heap[i].impl == ev.impl);
             Exch(i, Last());
             m_heap.pop_back();
+            // The event moved into the hole may be smaller than its new
+            // parent, as well as larger than its new children.
+            while (i < m_heap.size() && !IsRoot(i) && IsLessStrictly(i, Parent(i)))
+            {
+                Exch(i, Parent(i));
+                i = Parent(i);
+            }
             TopDown(i);
             return;
         }
@@ -243,4 +252,20 @@ HeapScheduler::Remove(const Event& ev)
     NS_ASSERT(false);
 }
 
+uint32_t
+HeapScheduler::Compact()
+{
+    NS_LOG_FUNCTION(this);
+    auto end =
+        std::remove_if(m_heap.begin() + Root(), m_heap.end(), &HeapScheduler::ReleaseIfCancelled);
+    auto removed = static_cast<uint32_t>(m_heap.end() - end);
+    m_heap.erase(end, m_heap.end());
+    // Rebuild the heap, from the parent of the last event up to the root.
+    for (std::size_t i = Parent(Last()); i >= Root(); i--)
+    {
+        TopDown(i);
+    }
+    return removed;
+}
+
 } // namespace ns3
@@ -61,6 +61,7 @@ namespace ns3
  * IsEmpty()    | Constant        | Explicit queue size
  * PeekNext()   | Constant        | Heap kept sorted
  * Remove()     | Logarithmic     | Search, heapify
+ * Compact()    | Linear          | Filter, rebuild the heap
  * RemoveNext() | Logarithmic     | Heapify
  *
  * \par Memory Complexity
@@ -90,6 +91,7 @@ class HeapScheduler : public Scheduler
     Scheduler::Event PeekNext() const override;
     Scheduler::Event RemoveNext() override;
     void Remove(const Scheduler::Event& ev) override;
+    uint32_t Compact() override;
 
   private:
     /** Event list type:  vector of Events, managed as a heap. */
@@ -0,0 +1,310 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ladder-scheduler.h"
+
+#include "assert.h"
+#include "event-impl.h"
+#include "log.h"
+
+#include <algorithm>
+#include <functional>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::LadderScheduler class implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LadderScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED(LadderScheduler);
+
+TypeId
+LadderScheduler::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::LadderScheduler")
+                            .SetParent<Scheduler>()
+                            .SetGroupName("Core")
+                            .AddConstructor<LadderScheduler>();
+    return tid;
+}
+
+LadderScheduler::LadderScheduler()
+    : m_topMin(0),
+      m_topMax(0),
+      m_topStart(0),
+      m_nRungs(0),
+      m_size(0)
+{
+    NS_LOG_FUNCTION(this);
+    // The rungs are never reallocated, so that references to them,
+    // and to their buckets, remain valid while new rungs are spawned.
+    m_rungs.reserve(MAX_RUNGS);
+}
+
+LadderScheduler::~LadderScheduler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+uint64_t
+LadderScheduler::Rung::CurrentStart() const
+{
+    return start + current * width;
+}
+
+void
+LadderScheduler::Insert(const Event& ev)
+{
+    NS_LOG_FUNCTION(this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+    uint64_t ts = ev.key.m_ts;
+    m_size++;
+    if (ts >= m_topStart)
+    {
+        if (m_top.empty())
+        {
+            m_topMin = ts;
+            m_topMax = ts;
+        }
+        else
+        {
+            m_topMin = std::min(m_topMin, ts);
+            m_topMax = std::max(m_topMax, ts);
+        }
+        m_top.push_back(ev);
+        Refill();
+        return;
+    }
+    for (std::size_t i = 0; i < m_nRungs; i++)
+    {
+        Rung& rung = m_rungs[i];
+        if (ts >= rung.CurrentStart())
+        {
+            std::size_t index = (ts - rung.start) / rung.width;
+            NS_ASSERT(index < rung.nBuckets);
+            rung.buckets[index].push_back(ev);
+            rung.count++;
+            Refill();
+            return;
+        }
+    }
+    InsertBottom(ev);
+}
+
+void
+LadderScheduler::InsertBottom(const Event& ev)
+{
+    NS_LOG_FUNCTION(this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+    auto it = std::upper_bound(m_bottom.begin(), m_bottom.end(), ev, std::greater<Event>());
+    m_bottom.insert(it, ev);
+
+    // Too many events were scheduled in the near future: spread the
+    // bottom over a new rung, as long as the events do not all share
+    // the same timestamp.
+    if (m_bottom.size() > BOTTOM_THRESHOLD && m_nRungs < MAX_RUNGS &&
+        m_bottom.front().key.m_ts != m_bottom.back().key.m_ts)
+    {
+        uint64_t start = m_bottom.back().key.m_ts;
+        uint64_t end = m_nRungs > 0 ? m_rungs[m_nRungs - 1].CurrentStart() : m_topStart;
+        NS_ASSERT(end > m_bottom.front().key.m_ts);
+        SpawnRung(m_bottom, start, end - start);
+        Refill();
+    }
+}
+
+void
+LadderScheduler::SpawnRung(std::vector<Event>& events, uint64_t start, uint64_t span)
+{
+    NS_LOG_FUNCTION(this << events.size() << start << span);
+    NS_ASSERT(m_nRungs < MAX_RUNGS);
+    NS_ASSERT(!events.empty() && span > 0);
+    if (m_nRungs == m_rungs.size())
+    {
+        m_rungs.emplace_back();
+    }
+    Rung& rung = m_rungs[m_nRungs];
+    m_nRungs++;
+
+    // One bucket per event, but no bucket narrower than a time step.
+    std::size_t n = events.size();
+    rung.width = span / n + (span % n != 0 ? 1 : 0);
+    rung.nBuckets = (span + rung.width - 1) / rung.width;
+    rung.start = start;
+    rung.current = 0;
+    rung.count = n;
+    if (rung.buckets.size() < rung.nBuckets)
+    {
+        rung.buckets.resize(rung.nBuckets);
+    }
+    for (const auto& ev : events)
+    {
+        std::size_t index = (ev.key.m_ts - start) / rung.width;
+        NS_ASSERT(index < rung.nBuckets);
+        rung.buckets[index].push_back(ev);
+    }
+    events.clear();
+}
+
+void
+LadderScheduler::MoveToBottom(std::vector<Event>& events)
+{
+    NS_LOG_FUNCTION(this << events.size());
+    NS_ASSERT(m_bottom.empty());
+    std::sort(events.begin(), events.end(), std::greater<Event>());
+    // Swap rather than copy; the source inherits the empty bottom array.
+    m_bottom.swap(events);
+}
+
+void
+LadderScheduler::Refill()
+{
+    if (!m_bottom.empty() || m_size == 0)
+    {
+        return;
+    }
+    NS_LOG_FUNCTION(this);
+    while (true)
+    {
+        while (m_nRungs > 0 && m_rungs[m_nRungs - 1].count == 0)
+        {
+            m_nRungs--;
+        }
+        if (m_nRungs == 0)
+        {
+            NS_ASSERT(!m_top.empty());
+            if (m_top.size() <= THRESHOLD || m_topMin == m_topMax)
+            {
+                m_topStart = m_topMax + 1;
+                MoveToBottom(m_top);
+                return;
+            }
+            SpawnRung(m_top, m_topMin, m_topMax - m_topMin + 1);
+            const Rung& first = m_rungs[0];
+            m_topStart = first.start + first.nBuckets * first.width;
+            continue;
+        }
+
+        Rung& rung = m_rungs[m_nRungs - 1];
+        while (rung.buckets[rung.current].empty())
+        {
+            rung.current++;
+            NS_ASSERT(rung.current < rung.nBuckets);
+        }
+        Bucket& bucket = rung.buckets[rung.current];
+        uint64_t bucketStart = rung.CurrentStart();
+        rung.current++;
+        rung.count -= bucket.size();
+        if (bucket.size() > THRESHOLD && rung.width > 1 && m_nRungs < MAX_RUNGS)
+        {
+            SpawnRung(bucket, bucketStart, rung.width);
+            continue;
+        }
+        MoveToBottom(bucket);
+        return;
+    }
+}
+
+bool
+LadderScheduler::IsEmpty() const
+{
+    return m_size == 0;
+}
+
+Scheduler::Event
+LadderScheduler::PeekNext() const
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!m_bottom.empty());
+    return m_bottom.back();
+}
+
+Scheduler::Event
+LadderScheduler::RemoveNext()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!m_bottom.empty());
+    Event ev = m_bottom.back();
+    m_bottom.pop_back();
+    m_size--;
+    Refill();
+    return ev;
+}
+
+void
+LadderScheduler::Remove(const Event& ev)
+{
+    NS_LOG_FUNCTION(this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+    auto sameUid = [&ev](const Event& other) { return other.key.m_uid == ev.key.m_uid; };
+    uint64_t ts = ev.key.m_ts;
+    m_size--;
+    if (ts >= m_topStart)
+    {
+        // The bounds of the top are left as they are: they remain valid,
+        // if not tight.
+        auto it = std::find_if(m_top.begin(), m_top.end(), sameUid);
+        NS_ASSERT(it != m_top.end());
+        *it = m_top.back();
+        m_top.pop_back();
+        Refill();
+        return;
+    }
+    for (std::size_t i = 0; i < m_nRungs; i++)
+    {
+        Rung& rung = m_rungs[i];
+        if (ts >= rung.CurrentStart())
+        {
+            Bucket& bucket = rung.buckets[(ts - rung.start) / rung.width];
+            auto it = std::find_if(bucket.begin(), bucket.end(), sameUid);
+            NS_ASSERT(it != bucket.end());
+            *it = bucket.back();
+            bucket.pop_back();
+            rung.count--;
+            Refill();
+            return;
+        }
+    }
+    auto it = std::lower_bound(m_bottom.begin(), m_bottom.end(), ev, std::greater<Event>());
+    NS_ASSERT(it != m_bottom.end() && it->key.m_uid == ev.key.m_uid);
+    m_bottom.erase(it);
+    Refill();
+}
+
+uint32_t
+LadderScheduler::Compact()
+{
+    NS_LOG_FUNCTION(this);
+    std::size_t removed = std::erase_if(m_top, &LadderScheduler::ReleaseIfCancelled);
+    for (std::size_t i = 0; i < m_nRungs; i++)
+    {
+        Rung& rung = m_rungs[i];
+        for (std::size_t j = rung.current; j < rung.nBuckets; j++)
+        {
+            std::size_t n = std::erase_if(rung.buckets[j], &LadderScheduler::ReleaseIfCancelled);
+            rung.count -= n;
+            removed += n;
+        }
+    }
+    // std::erase_if preserves the order of the bottom.
+    removed += std::erase_if(m_bottom, &LadderScheduler::ReleaseIfCancelled);
+    m_size -= removed;
+    Refill();
+    return removed;
+}
+
+} // namespace ns3
@@ -0,0 +1,193 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LADDER_SCHEDULER_H
+#define LADDER_SCHEDULER_H
+
+#include "scheduler.h"
+
+#include <stdint.h>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::LadderScheduler class declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup scheduler
+ * \brief a ladder queue event scheduler
+ *
+ * This event scheduler implements the ladder queue published in
+ * ["Ladder Queue: An O(1) Priority Queue Structure for Large-Scale
+ * Discrete Event Simulation" by Wai Teng Tang, Rick Siow Mong Goh and
+ * Ian Li-Jin Thng][Tang].
+ *
+ * [Tang]: https://doi.org/10.1145/1103323.1103324 "Tang"
+ *
+ * The events are stored in three tiers:
+ *
+ * - Top: an unsorted array holding the events far in the future, that is
+ *   with a timestamp at least \c m_topStart.
+ * - Ladder: a stack of rungs; each rung is an array of buckets covering
+ *   consecutive intervals of uniform width, and each bucket an unsorted
+ *   array of events.  A rung spans the interval of a single bucket of the
+ *   rung above it.
+ * - Bottom: a small sorted array holding the earliest events, from which
+ *   events are dequeued.
+ *
+ * When the bottom runs empty, the first non-empty bucket of the lowest rung
+ * is moved to the bottom and sorted, unless it holds more than
+ * \c THRESHOLD events, in which case it is spread over a new, finer rung.
+ * When the ladder itself runs empty, the top is spread over a new first
+ * rung, with one bucket per event.  Similarly, when more than
+ * \c BOTTOM_THRESHOLD events are inserted in the bottom, it is spread over
+ * a new lowest rung.  Unlike the calendar queue, the ladder
+ * never needs to be resized: the width of the buckets of each rung is
+ * derived from the events it receives.
+ *
+ * Unlike the original algorithm, all the tiers are contiguous arrays, and
+ * the arrays of the rungs are kept after the rungs have been consumed, so
+ * that a simulation in steady state does not allocate memory.
+ *
+ * \par Time Complexity
+ *
+ * Operation    | Amortized %Time | Reason
+ * :----------- | :-------------- | :-----
+ * Insert()     | ~Constant       | Append to the top or a bucket, or sorted insert in the bottom
+ * IsEmpty()    | Constant        | Explicit queue size
+ * PeekNext()   | Constant        | Last element of the bottom
+ * Remove()     | Linear          | Search within the tier holding the event
+ * Compact()    | Linear          | Filter every tier
+ * RemoveNext() | ~Constant       | Each event is moved at most \c MAX_RUNGS + 2 times
+ *
+ * \par Memory Complexity
+ *
+ * Category  | Memory                           | Reason
+ * :-------- | :------------------------------- | :-----
+ * Overhead  | 3 x `sizeof (*)` per bucket      | `std::vector`
+ * Per Event | 0                                | Events stored in `std::vector`
+ */
+class LadderScheduler : public Scheduler
+{
+  public:
+    /**
+     *  Register this type.
+     *  \return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /** Constructor. */
+    LadderScheduler();
+    /** Destructor. */
+    ~LadderScheduler() override;
+
+    // Inherited
+    void Insert(const Scheduler::Event& ev) override;
+    bool IsEmpty() const override;
+    Scheduler::Event PeekNext() const override;
+    Scheduler::Event RemoveNext() override;
+    void Remove(const Scheduler::Event& ev) override;
+    uint32_t Compact() override;
+
+  private:
+    /** Bucket type: an unsorted array of events. */
+    typedef std::vector<Scheduler::Event> Bucket;
+
+    /** A rung of the ladder. */
+    struct Rung
+    {
+        /** Timestamp at the start of the first bucket. */
+        uint64_t start;
+        /** Duration of a bucket, in dimensionless time units. */
+        uint64_t width;
+        /** Index of the first bucket which has not been consumed. */
+        std::size_t current;
+        /** Number of events in the rung. */
+        std::size_t count;
+        /** The buckets; some may be left over from a previous use of the rung. */
+        std::vector<Bucket> buckets;
+        /** Number of buckets in use. */
+        std::size_t nBuckets;
+
+        /** \return The timestamp at the start of the current bucket. */
+        uint64_t CurrentStart() const;
+    };
+
+    /**
+     * Maximum number of events moved from a bucket to the bottom at once;
+     * larger buckets are spread over a new rung.
+     */
+    static constexpr std::size_t THRESHOLD = 50;
+    /**
+     * Maximum number of events in the bottom before it is spread over a
+     * new rung.
+     */
+    static constexpr std::size_t BOTTOM_THRESHOLD = 4 * THRESHOLD;
+    /** Maximum number of rungs in the ladder. */
+    static constexpr std::size_t MAX_RUNGS = 8;
+
+    /**
+     * Insert an event in the sorted bottom.
+     * \param [in] ev The event to insert.
+     */
+    void InsertBottom(const Scheduler::Event& ev);
+    /**
+     * Add a new rung at the bottom of the ladder, and spread events over it.
+     *
+     * \param [in] events The events to spread; the array is cleared.
+     * \param [in] start The timestamp at the start of the new rung.
+     * \param [in] span The duration covered by the new rung.
+     */
+    void SpawnRung(std::vector<Scheduler::Event>& events, uint64_t start, uint64_t span);
+    /**
+     * Move events to the empty bottom, from the lowest rung or the top.
+     * Does nothing if the bottom is not empty or the queue is empty.
+     */
+    void Refill();
+    /**
+     * Sort events in decreasing order and move them to the empty bottom.
+     * \param [in] events The events to move; the array is cleared.
+     */
+    void MoveToBottom(std::vector<Scheduler::Event>& events);
+
+    /** The events in the far future, in no particular order. */
+    std::vector<Scheduler::Event> m_top;
+    /** Smallest timestamp in the top. */
+    uint64_t m_topMin;
+    /** Largest timestamp in the top. */
+    uint64_t m_topMax;
+    /** Events with a timestamp at least this value go to the top. */
+    uint64_t m_topStart;
+    /**
+     * The rungs, first rung first.  Only the first \c m_nRungs are in use;
+     * the others are kept to reuse their memory.
+     */
+    std::vector<Rung> m_rungs;
+    /** Number of rungs in use. */
+    std::size_t m_nRungs;
+    /** The earliest events, in decreasing order: the next event is last. */
+    std::vector<Scheduler::Event> m_bottom;
+    /** Number of events in queue. */
+    std::size_t m_size;
+};
+
+} // namespace ns3
+
+#endif /* LADDER_SCHEDULER_H */
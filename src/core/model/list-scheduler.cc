@@ -112,4 +112,11 @@ ListScheduler::Remove(const Event& ev)
     NS_ASSERT(false);
 }
 
+uint32_t
+ListScheduler::Compact()
+{
+    NS_LOG_FUNCTION(this);
+    return m_events.remove_if(&ListScheduler::ReleaseIfCancelled);
+}
+
 } // namespace ns3
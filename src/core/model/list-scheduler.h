@@ -52,6 +52,7 @@ class EventImpl;
  * IsEmpty()    | Constant        | `std::list::size()`
  * PeekNext()   | Constant        | `std::list::front()`
  * Remove()     | Linear          | Linear search in `std::list`
+ * Compact()    | Linear          | `std::list::remove_if()`
  * RemoveNext() | Constant        | `std::list::pop_front()`
  *
  * \par Memory Complexity
@@ -82,6 +83,7 @@ class ListScheduler : public Scheduler
     Scheduler::Event PeekNext() const override;
     Scheduler::Event RemoveNext() override;
     void Remove(const Scheduler::Event& ev) override;
+    uint32_t Compact() override;
 
   private:
     /** Event list type: a simple list of Events. */
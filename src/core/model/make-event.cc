@@ -58,6 +58,11 @@ MakeEvent(void (*f)())
             (*m_function)();
         }
 
+        const void* GetFunctionAddress() const override
+        {
+            return reinterpret_cast<const void*>(m_function);
+        }
+
       private:
         F m_function;
     }* ev = new EventFunctionImpl0(f);
@@ -353,6 +353,10 @@ EventImpl* MakeEvent(T function);
 #include "event-impl.h"
 #include "type-traits.h"
 
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
 namespace ns3
 {
 
@@ -392,6 +396,60 @@ struct EventMemberImplObjTraits<T*>
     }
 };
 
+/**
+ * \ingroup makeeventmemptr
+ * Get the address of the code invoked by a class method on an object.
+ *
+ * The address is read from the representation of the pointers to member
+ * functions of the Itanium C++ ABI, and from the virtual table of the
+ * object for a virtual method.  It is not known with other ABIs.
+ *
+ * \tparam MEM \deduced The class method function signature.
+ * \tparam OBJ \deduced The class type holding the method.
+ * \param [in] mem_ptr Class method member function pointer.
+ * \param [in] obj Class instance.
+ * \returns The address of the code, or nullptr if unknown.
+ */
+template <typename MEM, typename OBJ>
+const void*
+GetMemberFunctionAddress(MEM mem_ptr, OBJ obj)
+{
+#if defined(__GNUC__)
+    // the address of a non-virtual method, or the offset of a virtual
+    // method in the virtual table, and the adjustment of the object pointer
+    struct Representation
+    {
+        std::uintptr_t ptr;
+        std::ptrdiff_t adj;
+    };
+
+    if constexpr (sizeof(MEM) == sizeof(Representation))
+    {
+        Representation rep;
+        std::memcpy(&rep, &mem_ptr, sizeof(rep));
+#if defined(__arm__) || defined(__aarch64__)
+        bool isVirtual = (rep.adj & 1) != 0;
+        std::ptrdiff_t adj = rep.adj >> 1;
+        std::uintptr_t offset = rep.ptr;
+#else
+        bool isVirtual = (rep.ptr & 1) != 0;
+        std::ptrdiff_t adj = rep.adj;
+        std::uintptr_t offset = rep.ptr - 1;
+#endif
+        if (!isVirtual)
+        {
+            return reinterpret_cast<const void*>(rep.ptr);
+        }
+        auto self = reinterpret_cast<const char*>(
+                        std::addressof(EventMemberImplObjTraits<OBJ>::GetReference(obj))) +
+                    adj;
+        auto vtable = *reinterpret_cast<const char* const*>(self);
+        return *reinterpret_cast<const void* const*>(vtable + offset);
+    }
+#endif
+    return nullptr;
+}
+
 template <typename MEM, typename OBJ>
 EventImpl*
 MakeEvent(MEM mem_ptr, OBJ obj)
@@ -416,6 +474,11 @@ MakeEvent(MEM mem_ptr, OBJ obj)
             (EventMemberImplObjTraits<OBJ>::GetReference(m_obj).*m_function)();
         }
 
+        const void* GetFunctionAddress() const override
+        {
+            return GetMemberFunctionAddress(m_function, m_obj);
+        }
+
         OBJ m_obj;
         MEM m_function;
     }* ev = new EventMemberImpl0(obj, mem_ptr);
@@ -449,6 +512,11 @@ MakeEvent(MEM mem_ptr, OBJ obj, T1 a1)
             (EventMemberImplObjTraits<OBJ>::GetReference(m_obj).*m_function)(m_a1);
         }
 
+        const void* GetFunctionAddress() const override
+        {
+            return GetMemberFunctionAddress(m_function, m_obj);
+        }
+
         OBJ m_obj;
         MEM m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
@@ -484,6 +552,11 @@ MakeEvent(MEM mem_ptr, OBJ obj, T1 a1, T2 a2)
             (EventMemberImplObjTraits<OBJ>::GetReference(m_obj).*m_function)(m_a1, m_a2);
         }
 
+        const void* GetFunctionAddress() const override
+        {
+            return GetMemberFunctionAddress(m_function, m_obj);
+        }
+
         OBJ m_obj;
         MEM m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
@@ -521,6 +594,11 @@ MakeEvent(MEM mem_ptr, OBJ obj, T1 a1, T2 a2, T3 a3)
             (EventMemberImplObjTraits<OBJ>::GetReference(m_obj).*m_function)(m_a1, m_a2, m_a3);
         }
 
+        const void* GetFunctionAddress() const override
+        {
+            return GetMemberFunctionAddress(m_function, m_obj);
+        }
+
         OBJ m_obj;
         MEM m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
@@ -561,6 +639,11 @@ MakeEvent(MEM mem_ptr, OBJ obj, T1 a1, T2 a2, T3 a3, T4 a4)
              m_function)(m_a1, m_a2, m_a3, m_a4);
         }
 
+        const void* GetFunctionAddress() const override
+        {
+            return GetMemberFunctionAddress(m_function, m_obj);
+        }
+
         OBJ m_obj;
         MEM m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
@@ -609,6 +692,11 @@ MakeEvent(MEM mem_ptr, OBJ obj, T1 a1, T2 a2, T3 a3, T4 a4, T5 a5)
              m_function)(m_a1, m_a2, m_a3, m_a4, m_a5);
         }
 
+        const void* GetFunctionAddress() const override
+        {
+            return GetMemberFunctionAddress(m_function, m_obj);
+        }
+
         OBJ m_obj;
         MEM m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
@@ -660,6 +748,11 @@ MakeEvent(MEM mem_ptr, OBJ obj, T1 a1, T2 a2, T3 a3, T4 a4, T5 a5, T6 a6)
              m_function)(m_a1, m_a2, m_a3, m_a4, m_a5, m_a6);
         }
 
+        const void* GetFunctionAddress() const override
+        {
+            return GetMemberFunctionAddress(m_function, m_obj);
+        }
+
         OBJ m_obj;
         MEM m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
@@ -700,6 +793,11 @@ MakeEvent(void (*f)(U1), T1 a1)
             (*m_function)(m_a1);
         }
 
+        const void* GetFunctionAddress() const override
+        {
+            return reinterpret_cast<const void*>(m_function);
+        }
+
         F m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
     }* ev = new EventFunctionImpl1(f, a1);
@@ -735,6 +833,11 @@ MakeEvent(void (*f)(U1, U2), T1 a1, T2 a2)
             (*m_function)(m_a1, m_a2);
         }
 
+        const void* GetFunctionAddress() const override
+        {
+            return reinterpret_cast<const void*>(m_function);
+        }
+
         F m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
         typename TypeTraits<T2>::ReferencedType m_a2;
@@ -772,6 +875,11 @@ MakeEvent(void (*f)(U1, U2, U3), T1 a1, T2 a2, T3 a3)
             (*m_function)(m_a1, m_a2, m_a3);
         }
 
+        const void* GetFunctionAddress() const override
+        {
+            return reinterpret_cast<const void*>(m_function);
+        }
+
         F m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
         typename TypeTraits<T2>::ReferencedType m_a2;
@@ -818,6 +926,11 @@ MakeEvent(void (*f)(U1, U2, U3, U4), T1 a1, T2 a2, T3 a3, T4 a4)
             (*m_function)(m_a1, m_a2, m_a3, m_a4);
         }
 
+        const void* GetFunctionAddress() const override
+        {
+            return reinterpret_cast<const void*>(m_function);
+        }
+
         F m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
         typename TypeTraits<T2>::ReferencedType m_a2;
@@ -868,6 +981,11 @@ MakeEvent(void (*f)(U1, U2, U3, U4, U5), T1 a1, T2 a2, T3 a3, T4 a4, T5 a5)
             (*m_function)(m_a1, m_a2, m_a3, m_a4, m_a5);
         }
 
+        const void* GetFunctionAddress() const override
+        {
+            return reinterpret_cast<const void*>(m_function);
+        }
+
         F m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
         typename TypeTraits<T2>::ReferencedType m_a2;
@@ -922,6 +1040,11 @@ MakeEvent(void (*f)(U1, U2, U3, U4, U5, U6), T1 a1, T2 a2, T3 a3, T4 a4, T5 a5,
             (*m_function)(m_a1, m_a2, m_a3, m_a4, m_a5, m_a6);
         }
 
+        const void* GetFunctionAddress() const override
+        {
+            return reinterpret_cast<const void*>(m_function);
+        }
+
         F m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
         typename TypeTraits<T2>::ReferencedType m_a2;
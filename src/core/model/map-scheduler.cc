@@ -112,4 +112,24 @@ MapScheduler::Remove(const Event& ev)
     m_list.erase(i);
 }
 
+uint32_t
+MapScheduler::Compact()
+{
+    NS_LOG_FUNCTION(this);
+    uint32_t removed = 0;
+    for (auto i = m_list.begin(); i != m_list.end();)
+    {
+        if (ReleaseIfCancelled({i->second, i->first}))
+        {
+            i = m_list.erase(i);
+            removed++;
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    return removed;
+}
+
 } // namespace ns3
@@ -50,6 +50,7 @@ namespace ns3
  * IsEmpty()    | Constant        | `std::map::empty()`
  * PeekNext()   | Constant        | `std::map::begin()`
  * Remove()     | Logarithmic     | `std::map::find()`
+ * Compact()    | Linear          | Iterate and `std::map::erase()`
  * RemoveNext() | Constant        | `std::map::begin()`
  *
  * \par Memory Complexity
@@ -80,6 +81,7 @@ class MapScheduler : public Scheduler
     Scheduler::Event PeekNext() const override;
     Scheduler::Event RemoveNext() override;
     void Remove(const Scheduler::Event& ev) override;
+    uint32_t Compact() override;
 
   private:
     /** Event list type: a Map from EventKey to EventImpl. */
@@ -113,4 +113,20 @@ PriorityQueueScheduler::Remove(const Scheduler::Event& ev)
     m_queue.remove(ev);
 }
 
+uint32_t
+PriorityQueueScheduler::EventPriorityQueue::compact()
+{
+    auto removed = static_cast<uint32_t>(
+        std::erase_if(this->c, &PriorityQueueScheduler::ReleaseIfCancelled));
+    std::make_heap(this->c.begin(), this->c.end(), this->comp);
+    return removed;
+}
+
+uint32_t
+PriorityQueueScheduler::Compact()
+{
+    NS_LOG_FUNCTION(this);
+    return m_queue.compact();
+}
+
 } // namespace ns3
@@ -52,6 +52,7 @@ namespace ns3
  * IsEmpty()    | Constant         | `std::vector::empty()`
  * PeekNext()   | Constant         | `std::vector::front()`
  * Remove()     | Linear           | `std::find()` and `std::make_heap()`
+ * Compact()    | Linear           | `std::erase_if()` and `std::make_heap()`
  * RemoveNext() | Logarithmic      | `std::pop_heap()`
  *
  * \par Memory Complexity
@@ -82,6 +83,7 @@ class PriorityQueueScheduler : public Scheduler
     Scheduler::Event PeekNext() const override;
     Scheduler::Event RemoveNext() override;
     void Remove(const Scheduler::Event& ev) override;
+    uint32_t Compact() override;
 
   private:
     /**
@@ -99,6 +101,11 @@ class PriorityQueueScheduler : public Scheduler
          */
         bool remove(const Scheduler::Event& ev);
 
+        /**
+         * \copydoc PriorityQueueScheduler::Compact()
+         */
+        uint32_t compact();
+
     }; // class EventPriorityQueue
 
     /** The event queue. */
@@ -20,8 +20,11 @@
 #include "scheduler.h"
 
 #include "assert.h"
+#include "event-impl.h"
 #include "log.h"
 
+#include <vector>
+
 /**
  * \file
  * \ingroup scheduler
@@ -47,4 +50,40 @@ Scheduler::GetTypeId()
     return tid;
 }
 
+uint32_t
+Scheduler::Compact()
+{
+    NS_LOG_FUNCTION(this);
+    std::vector<Event> live;
+    uint32_t removed = 0;
+    while (!IsEmpty())
+    {
+        Event ev = RemoveNext();
+        if (ReleaseIfCancelled(ev))
+        {
+            removed++;
+        }
+        else
+        {
+            live.push_back(ev);
+        }
+    }
+    for (const auto& ev : live)
+    {
+        Insert(ev);
+    }
+    return removed;
+}
+
+bool
+Scheduler::ReleaseIfCancelled(const Event& ev)
+{
+    if (ev.impl->IsCancelled())
+    {
+        ev.impl->Unref();
+        return true;
+    }
+    return false;
+}
+
 } // namespace ns3
@@ -71,6 +71,9 @@ class EventImpl;
  * rely heavily on Scheduler::Cancel, however, and these might benefit
  * from using Scheduler::Remove instead, to reduce the size of the event
  * list, at the time cost of actually removing events from the list.
+ * Alternatively, the DefaultSimulatorImpl counts the cancelled events
+ * and removes them all at once with Scheduler::Compact when they make up
+ * too large a fraction of the event list.
  *
  * A summary of the main characteristics
  * of each SchedulerImpl is provided below.  See the individual
@@ -226,6 +229,27 @@ class Scheduler : public Object
      * \param [in] ev The event to remove
      */
     virtual void Remove(const Event& ev) = 0;
+    /**
+     * Remove all the cancelled events from the event list, and release
+     * the reference the event list holds on each of them.
+     *
+     * The default implementation removes all the events with RemoveNext()
+     * and inserts back those which are not cancelled; subclasses should
+     * override it with an implementation filtering their own storage.
+     *
+     * \return The number of events removed.
+     */
+    virtual uint32_t Compact();
+
+  protected:
+    /**
+     * Release an event if it has been cancelled.  This is the predicate
+     * used by the implementations of Compact().
+     *
+     * \param [in] ev The event to check.
+     * \return \c true if the event was cancelled, and thus released.
+     */
+    static bool ReleaseIfCancelled(const Event& ev);
 };
 
 /**
@@ -27,6 +27,10 @@
 #include <limits>
 #include <stdint.h>
 
+#ifdef NS3_MTP
+#include <atomic>
+#endif
+
 /**
  * \file
  * \ingroup ptr
@@ -125,8 +129,14 @@ class SimpleRefCount : public PARENT
      */
     inline void Unref() const
     {
+#ifdef NS3_MTP
+        // The thread that drops the last reference is the only one that
+        // may observe zero, so it is the one that deletes the object.
+        if (m_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+#else
         m_count--;
         if (m_count == 0)
+#endif
         {
             DELETER::Delete(static_cast<T*>(const_cast<SimpleRefCount*>(this)));
         }
@@ -149,9 +159,14 @@ class SimpleRefCount : public PARENT
      *
      * \internal
      * Note we make this mutable so that the const methods can still
-     * change it.
+     * change it.  In multithreaded builds (NS3_MTP) the count is atomic
+     * since objects may be shared between logical processes.
      */
+#ifdef NS3_MTP
+    mutable std::atomic<uint32_t> m_count;
+#else
     mutable uint32_t m_count;
+#endif
 };
 
 } // namespace ns3
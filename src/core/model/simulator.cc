@@ -326,6 +326,12 @@ Simulator::GetEventCount()
     return GetImpl()->GetEventCount();
 }
 
+EventImpl::PoolStatistics
+Simulator::GetEventPoolStatistics()
+{
+    return EventImpl::GetPoolStatistics();
+}
+
 uint32_t
 Simulator::GetSystemId()
 {
@@ -216,6 +216,13 @@ class Simulator
      */
     static uint64_t GetEventCount();
 
+    /**
+     * Get the statistics of the memory pool of the events allocated
+     * by the calling thread, see EventImpl::GetPoolStatistics().
+     * \returns The event pool hits, misses and high-water mark.
+     */
+    static EventImpl::PoolStatistics GetEventPoolStatistics();
+
     /**
      * @name Schedule events (in the same context) to run at a future time.
      */
@@ -126,6 +126,12 @@ class TimerImpl
      * \returns The scheduled EventId.
      */
     virtual EventId Schedule(const Time& delay) = 0;
+    /**
+     * Create an event invoking the callback with the current arguments.
+     *
+     * \returns The event, holding one reference.
+     */
+    virtual EventImpl* MakeEvent() = 0;
     /** Invoke the expire function. */
     virtual void Invoke() = 0;
 };
@@ -277,6 +283,11 @@ MakeTimerImpl(IntToType<0>, FN fn)
             return Simulator::Schedule(delay, m_fn);
         }
 
+        EventImpl* MakeEvent() override
+        {
+            return ns3::MakeEvent(m_fn);
+        }
+
         void Invoke() override
         {
             m_fn();
@@ -317,6 +328,11 @@ MakeTimerImpl(IntToType<1>, FN fn)
             return Simulator::Schedule(delay, m_fn, m_a1);
         }
 
+        EventImpl* MakeEvent() override
+        {
+            return ns3::MakeEvent(m_fn, m_a1);
+        }
+
         void Invoke() override
         {
             m_fn(m_a1);
@@ -362,6 +378,11 @@ MakeTimerImpl(IntToType<2>, FN fn)
             return Simulator::Schedule(delay, m_fn, m_a1, m_a2);
         }
 
+        EventImpl* MakeEvent() override
+        {
+            return ns3::MakeEvent(m_fn, m_a1, m_a2);
+        }
+
         void Invoke() override
         {
             m_fn(m_a1, m_a2);
@@ -412,6 +433,11 @@ MakeTimerImpl(IntToType<3>, FN fn)
             return Simulator::Schedule(delay, m_fn, m_a1, m_a2, m_a3);
         }
 
+        EventImpl* MakeEvent() override
+        {
+            return ns3::MakeEvent(m_fn, m_a1, m_a2, m_a3);
+        }
+
         void Invoke() override
         {
             m_fn(m_a1, m_a2, m_a3);
@@ -468,6 +494,11 @@ MakeTimerImpl(IntToType<4>, FN fn)
             return Simulator::Schedule(delay, m_fn, m_a1, m_a2, m_a3, m_a4);
         }
 
+        EventImpl* MakeEvent() override
+        {
+            return ns3::MakeEvent(m_fn, m_a1, m_a2, m_a3, m_a4);
+        }
+
         void Invoke() override
         {
             m_fn(m_a1, m_a2, m_a3, m_a4);
@@ -533,6 +564,11 @@ MakeTimerImpl(IntToType<5>, FN fn)
             return Simulator::Schedule(delay, m_fn, m_a1, m_a2, m_a3, m_a4, m_a5);
         }
 
+        EventImpl* MakeEvent() override
+        {
+            return ns3::MakeEvent(m_fn, m_a1, m_a2, m_a3, m_a4, m_a5);
+        }
+
         void Invoke() override
         {
             m_fn(m_a1, m_a2, m_a3, m_a4, m_a5);
@@ -608,6 +644,11 @@ MakeTimerImpl(IntToType<6>, FN fn)
             return Simulator::Schedule(delay, m_fn, m_a1, m_a2, m_a3, m_a4, m_a5, m_a6);
         }
 
+        virtual EventImpl* MakeEvent()
+        {
+            return ns3::MakeEvent(m_fn, m_a1, m_a2, m_a3, m_a4, m_a5, m_a6);
+        }
+
         virtual void Invoke()
         {
             m_fn(m_a1, m_a2, m_a3, m_a4, m_a5, m_a6);
@@ -702,6 +743,11 @@ MakeTimerImpl(IntToType<0>, MEM_PTR memPtr, OBJ_PTR objPtr)
             return Simulator::Schedule(delay, m_memPtr, m_objPtr);
         }
 
+        EventImpl* MakeEvent() override
+        {
+            return ns3::MakeEvent(m_memPtr, m_objPtr);
+        }
+
         void Invoke() override
         {
             (TimerImplMemberTraits<OBJ_PTR>::GetReference(m_objPtr).*m_memPtr)();
@@ -744,6 +790,11 @@ MakeTimerImpl(IntToType<1>, MEM_PTR memPtr, OBJ_PTR objPtr)
             return Simulator::Schedule(delay, m_memPtr, m_objPtr, m_a1);
         }
 
+        EventImpl* MakeEvent() override
+        {
+            return ns3::MakeEvent(m_memPtr, m_objPtr, m_a1);
+        }
+
         void Invoke() override
         {
             (TimerImplMemberTraits<OBJ_PTR>::GetReference(m_objPtr).*m_memPtr)(m_a1);
@@ -791,6 +842,11 @@ MakeTimerImpl(IntToType<2>, MEM_PTR memPtr, OBJ_PTR objPtr)
             return Simulator::Schedule(delay, m_memPtr, m_objPtr, m_a1, m_a2);
         }
 
+        EventImpl* MakeEvent() override
+        {
+            return ns3::MakeEvent(m_memPtr, m_objPtr, m_a1, m_a2);
+        }
+
         void Invoke() override
         {
             (TimerImplMemberTraits<OBJ_PTR>::GetReference(m_objPtr).*m_memPtr)(m_a1, m_a2);
@@ -843,6 +899,11 @@ MakeTimerImpl(IntToType<3>, MEM_PTR memPtr, OBJ_PTR objPtr)
             return Simulator::Schedule(delay, m_memPtr, m_objPtr, m_a1, m_a2, m_a3);
         }
 
+        EventImpl* MakeEvent() override
+        {
+            return ns3::MakeEvent(m_memPtr, m_objPtr, m_a1, m_a2, m_a3);
+        }
+
         void Invoke() override
         {
             (TimerImplMemberTraits<OBJ_PTR>::GetReference(m_objPtr).*m_memPtr)(m_a1, m_a2, m_a3);
@@ -901,6 +962,11 @@ MakeTimerImpl(IntToType<4>, MEM_PTR memPtr, OBJ_PTR objPtr)
             return Simulator::Schedule(delay, m_memPtr, m_objPtr, m_a1, m_a2, m_a3, m_a4);
         }
 
+        EventImpl* MakeEvent() override
+        {
+            return ns3::MakeEvent(m_memPtr, m_objPtr, m_a1, m_a2, m_a3, m_a4);
+        }
+
         void Invoke() override
         {
             (TimerImplMemberTraits<OBJ_PTR>::GetReference(m_objPtr).*
@@ -969,6 +1035,11 @@ MakeTimerImpl(IntToType<5>, MEM_PTR memPtr, OBJ_PTR objPtr)
             return Simulator::Schedule(delay, m_memPtr, m_objPtr, m_a1, m_a2, m_a3, m_a4, m_a5);
         }
 
+        EventImpl* MakeEvent() override
+        {
+            return ns3::MakeEvent(m_memPtr, m_objPtr, m_a1, m_a2, m_a3, m_a4, m_a5);
+        }
+
         void Invoke() override
         {
             (TimerImplMemberTraits<OBJ_PTR>::GetReference(m_objPtr).*
@@ -1055,6 +1126,11 @@ MakeTimerImpl(IntToType<6>, MEM_PTR memPtr, OBJ_PTR objPtr)
                                        m_a6);
         }
 
+        virtual EventImpl* MakeEvent()
+        {
+            return ns3::MakeEvent(m_memPtr, m_objPtr, m_a1, m_a2, m_a3, m_a4, m_a5, m_a6);
+        }
+
         virtual void Invoke()
         {
             (TimerImplMemberTraits<OBJ_PTR>::GetReference(m_objPtr).*
@@ -0,0 +1,524 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "timer-wheel.h"
+
+#include "assert.h"
+#include "event-impl.h"
+#include "log.h"
+#include "simulator.h"
+
+#include <algorithm>
+#include <bit>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * \file
+ * \ingroup timer
+ * ns3::TimerWheel class implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("TimerWheel");
+
+/** A timer inserted in the wheel. */
+struct TimerWheel::Entry
+{
+    Time expiration;   //!< Expiration time
+    uint64_t order;    //!< Order in which the timers were scheduled
+    EventImpl* event;  //!< The event to invoke
+    Entry** handle;    //!< The handle of the timer
+    TimerWheel* wheel; //!< The wheel holding the entry
+    Entry* prev;       //!< Previous entry of the slot
+    Entry* next;       //!< Next entry of the slot
+    uint32_t level;    //!< Level of the slot, LEVEL_OVERFLOW or LEVEL_DUE
+    uint32_t slot;     //!< Index of the slot in the level
+};
+
+/**
+ * \ingroup timer
+ * The wheels of the contexts.
+ */
+struct TimerWheelRegistry
+{
+    std::mutex mutex;                                  //!< Protects the map
+    std::unordered_map<uint32_t, TimerWheel*> wheels;  //!< The wheels, by context
+    bool destroyScheduled{false};                      //!< Whether Destroy is scheduled
+};
+
+/**
+ * \ingroup timer
+ * \returns The wheels of the contexts.
+ */
+static TimerWheelRegistry&
+GetTimerWheelRegistry()
+{
+    static TimerWheelRegistry registry;
+    return registry;
+}
+
+/**
+ * \ingroup timer
+ * Delete the wheels, from Simulator::Destroy.
+ */
+static void
+DestroyTimerWheels()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    TimerWheelRegistry& registry = GetTimerWheelRegistry();
+    std::lock_guard lock(registry.mutex);
+    for (auto& [context, wheel] : registry.wheels)
+    {
+        delete wheel;
+    }
+    registry.wheels.clear();
+    registry.destroyScheduled = false;
+}
+
+TimerWheel*
+TimerWheel::Get()
+{
+    uint32_t context = Simulator::GetContext();
+    TimerWheelRegistry& registry = GetTimerWheelRegistry();
+    std::lock_guard lock(registry.mutex);
+    TimerWheel*& wheel = registry.wheels[context];
+    if (wheel == nullptr)
+    {
+        wheel = new TimerWheel();
+        if (!registry.destroyScheduled)
+        {
+            Simulator::ScheduleDestroy(&DestroyTimerWheels);
+            registry.destroyScheduled = true;
+        }
+    }
+    return wheel;
+}
+
+TimerWheel::TimerWheel()
+    : m_overflow(nullptr),
+      m_due(nullptr),
+      m_dueTail(nullptr),
+      m_tick(0),
+      m_tickSteps(std::max<int64_t>(MilliSeconds(1).GetTimeStep(), 1)),
+      m_order(0),
+      m_size(0),
+      m_event(),
+      m_eventTime(Time::Max()),
+      m_expiring(false)
+{
+    NS_LOG_FUNCTION(this);
+    m_tick = GetTick(Simulator::Now());
+}
+
+TimerWheel::~TimerWheel()
+{
+    NS_LOG_FUNCTION(this);
+    m_event.Cancel();
+    for (auto& level : m_levels)
+    {
+        for (Entry* list : level.slots)
+        {
+            while (list != nullptr)
+            {
+                Entry* entry = list;
+                list = entry->next;
+                Release(entry);
+            }
+        }
+    }
+    for (Entry* list : {m_overflow, m_due})
+    {
+        while (list != nullptr)
+        {
+            Entry* entry = list;
+            list = entry->next;
+            Release(entry);
+        }
+    }
+    for (Entry* entry : m_free)
+    {
+        delete entry;
+    }
+}
+
+uint64_t
+TimerWheel::GetTick(const Time& time) const
+{
+    return time.GetTimeStep() / m_tickSteps;
+}
+
+Time
+TimerWheel::GetTickTime(uint64_t tick) const
+{
+    return TimeStep(tick * m_tickSteps);
+}
+
+TimerWheel::Entry*&
+TimerWheel::GetList(const Entry* entry)
+{
+    if (entry->level == LEVEL_OVERFLOW)
+    {
+        return m_overflow;
+    }
+    if (entry->level == LEVEL_DUE)
+    {
+        return m_due;
+    }
+    return m_levels[entry->level].slots[entry->slot];
+}
+
+void
+TimerWheel::Insert(Entry* entry)
+{
+    uint64_t tick = GetTick(entry->expiration);
+    NS_ASSERT(tick >= m_tick);
+    uint64_t delta = tick - m_tick;
+    entry->level = LEVEL_OVERFLOW;
+    for (uint32_t level = 0; level < LEVELS; level++)
+    {
+        if (delta < (uint64_t(1) << (SLOT_BITS * (level + 1))))
+        {
+            entry->level = level;
+            entry->slot = (tick >> (SLOT_BITS * level)) & (SLOTS - 1);
+            m_levels[level].nonEmpty[entry->slot / 64] |= uint64_t(1) << (entry->slot % 64);
+            break;
+        }
+    }
+    Entry*& list = GetList(entry);
+    entry->prev = nullptr;
+    entry->next = list;
+    if (list != nullptr)
+    {
+        list->prev = entry;
+    }
+    list = entry;
+}
+
+void
+TimerWheel::InsertDue(Entry* entry)
+{
+    NS_ASSERT(GetTick(entry->expiration) == m_tick);
+    // the entry was scheduled last, so it goes after the entries which do
+    // not expire later, usually at the end of the list
+    Entry* prev = m_dueTail;
+    while (prev != nullptr && prev->expiration > entry->expiration)
+    {
+        prev = prev->prev;
+    }
+    entry->level = LEVEL_DUE;
+    entry->prev = prev;
+    entry->next = (prev != nullptr) ? prev->next : m_due;
+    if (entry->next != nullptr)
+    {
+        entry->next->prev = entry;
+    }
+    else
+    {
+        m_dueTail = entry;
+    }
+    if (prev != nullptr)
+    {
+        prev->next = entry;
+    }
+    else
+    {
+        m_due = entry;
+    }
+}
+
+void
+TimerWheel::Unlink(Entry* entry)
+{
+    if (entry == m_dueTail)
+    {
+        m_dueTail = entry->prev;
+    }
+    Entry*& list = GetList(entry);
+    if (entry->prev != nullptr)
+    {
+        entry->prev->next = entry->next;
+    }
+    else
+    {
+        list = entry->next;
+    }
+    if (entry->next != nullptr)
+    {
+        entry->next->prev = entry->prev;
+    }
+    if (list == nullptr && entry->level < LEVELS)
+    {
+        m_levels[entry->level].nonEmpty[entry->slot / 64] &= ~(uint64_t(1) << (entry->slot % 64));
+    }
+}
+
+void
+TimerWheel::Release(Entry* entry)
+{
+    *entry->handle = nullptr;
+    if (entry->event != nullptr)
+    {
+        entry->event->Unref();
+        entry->event = nullptr;
+    }
+    m_size--;
+    m_free.push_back(entry);
+}
+
+void
+TimerWheel::Schedule(const Time& delay, EventImpl* event, Entry** handle)
+{
+    NS_LOG_FUNCTION(this << delay << event << handle);
+    NS_ASSERT_MSG(delay.IsPositive(), "Timer scheduled with a negative delay");
+    Entry* entry;
+    if (m_free.empty())
+    {
+        entry = new Entry;
+    }
+    else
+    {
+        entry = m_free.back();
+        m_free.pop_back();
+    }
+    entry->expiration = Simulator::Now() + delay;
+    entry->order = m_order++;
+    entry->event = event;
+    entry->handle = handle;
+    entry->wheel = this;
+    if (GetTick(entry->expiration) == m_tick)
+    {
+        InsertDue(entry);
+    }
+    else
+    {
+        Insert(entry);
+    }
+    *handle = entry;
+    m_size++;
+
+    // the timers scheduled by the expired ones are handled by Expire
+    if (!m_expiring && entry->expiration < m_eventTime)
+    {
+        m_event.Cancel();
+        m_event = Simulator::Schedule(delay, &TimerWheel::Expire, this);
+        m_eventTime = entry->expiration;
+    }
+}
+
+void
+TimerWheel::Cancel(Entry** handle)
+{
+    Entry* entry = *handle;
+    if (entry == nullptr)
+    {
+        return;
+    }
+    if (entry->handle != handle)
+    {
+        // a copy of the Timer owning the entry
+        *handle = nullptr;
+        return;
+    }
+    // the wheel event is left as is, and finds the next timer when it runs
+    TimerWheel* wheel = entry->wheel;
+    wheel->Unlink(entry);
+    wheel->Release(entry);
+}
+
+Time
+TimerWheel::GetExpiration(const Entry* entry)
+{
+    return entry->expiration;
+}
+
+uint32_t
+TimerWheel::GetSize() const
+{
+    return m_size;
+}
+
+void
+TimerWheel::Advance(uint64_t tick)
+{
+    NS_LOG_FUNCTION(this << tick);
+    NS_ASSERT_MSG(m_due == nullptr, "The entries of the current tick have not expired");
+    uint64_t previous = m_tick;
+    m_tick = tick;
+    // The slots between the previous tick and the new one are empty, as no
+    // entry precedes the new tick: only the slots reached by the new tick
+    // are moved down, from the highest level
+    if ((previous >> (SLOT_BITS * LEVELS)) != (tick >> (SLOT_BITS * LEVELS)))
+    {
+        Entry* list = m_overflow;
+        m_overflow = nullptr;
+        while (list != nullptr)
+        {
+            Entry* entry = list;
+            list = entry->next;
+            Insert(entry);
+        }
+    }
+    for (uint32_t level = LEVELS - 1; level > 0; level--)
+    {
+        uint32_t shift = SLOT_BITS * level;
+        if ((previous >> shift) == (tick >> shift))
+        {
+            continue;
+        }
+        uint32_t slot = (tick >> shift) & (SLOTS - 1);
+        Entry* list = m_levels[level].slots[slot];
+        m_levels[level].slots[slot] = nullptr;
+        m_levels[level].nonEmpty[slot / 64] &= ~(uint64_t(1) << (slot % 64));
+        while (list != nullptr)
+        {
+            Entry* entry = list;
+            list = entry->next;
+            Insert(entry);
+        }
+    }
+    // the entries of the new tick are sorted once, and then taken in order
+    uint32_t slot = tick & (SLOTS - 1);
+    std::vector<Entry*>& due = m_sortBuffer;
+    for (Entry* entry = m_levels[0].slots[slot]; entry != nullptr; entry = entry->next)
+    {
+        due.push_back(entry);
+    }
+    m_levels[0].slots[slot] = nullptr;
+    m_levels[0].nonEmpty[slot / 64] &= ~(uint64_t(1) << (slot % 64));
+    std::sort(due.begin(), due.end(), [](const Entry* a, const Entry* b) {
+        return a->expiration < b->expiration ||
+               (a->expiration == b->expiration && a->order < b->order);
+    });
+    for (Entry* entry : due)
+    {
+        entry->level = LEVEL_DUE;
+        entry->prev = m_dueTail;
+        entry->next = nullptr;
+        if (m_dueTail != nullptr)
+        {
+            m_dueTail->next = entry;
+        }
+        else
+        {
+            m_due = entry;
+        }
+        m_dueTail = entry;
+    }
+    due.clear();
+}
+
+uint32_t
+TimerWheel::FindSlot(const Level& level, uint32_t start) const
+{
+    uint32_t word = start / 64;
+    uint64_t bits = level.nonEmpty[word] & (~uint64_t(0) << (start % 64));
+    // the word of the start slot is checked again last, for the slots before it
+    for (uint32_t i = 0; i <= WORDS; i++)
+    {
+        if (bits != 0)
+        {
+            return word * 64 + std::countr_zero(bits);
+        }
+        word = (word + 1) % WORDS;
+        bits = level.nonEmpty[word];
+    }
+    return SLOTS;
+}
+
+Time
+TimerWheel::GetNextTime() const
+{
+    // the entries of the current tick are sorted, and expire first
+    if (m_due != nullptr)
+    {
+        return m_due->expiration;
+    }
+    Time next = Time::Max();
+    // the first non-empty slot of level 0 after the current tick holds the
+    // entries of a single tick
+    uint32_t slot = FindSlot(m_levels[0], (m_tick + 1) & (SLOTS - 1));
+    if (slot < SLOTS)
+    {
+        for (Entry* entry = m_levels[0].slots[slot]; entry != nullptr; entry = entry->next)
+        {
+            next = std::min(next, entry->expiration);
+        }
+    }
+    // the slots of the upper levels are moved down when their first tick is
+    // reached, and the wheel event is scheduled then if no entry expires before
+    for (uint32_t level = 1; level < LEVELS; level++)
+    {
+        uint32_t shift = SLOT_BITS * level;
+        uint64_t current = m_tick >> shift;
+        slot = FindSlot(m_levels[level], (current + 1) & (SLOTS - 1));
+        if (slot < SLOTS)
+        {
+            // the slot of the current span holds the entries of the next turn
+            uint64_t ahead = (slot - current) & (SLOTS - 1);
+            ahead = (ahead == 0) ? SLOTS : ahead;
+            next = std::min(next, GetTickTime((current + ahead) << shift));
+        }
+    }
+    if (m_overflow != nullptr)
+    {
+        uint32_t shift = SLOT_BITS * LEVELS;
+        next = std::min(next, GetTickTime(((m_tick >> shift) + 1) << shift));
+    }
+    return next;
+}
+
+void
+TimerWheel::Arm()
+{
+    Time next = GetNextTime();
+    if (next < m_eventTime)
+    {
+        m_event.Cancel();
+        m_event = Simulator::Schedule(next - Simulator::Now(), &TimerWheel::Expire, this);
+        m_eventTime = next;
+    }
+}
+
+void
+TimerWheel::Expire()
+{
+    NS_LOG_FUNCTION(this);
+    Time now = Simulator::Now();
+    m_eventTime = Time::Max();
+    uint64_t tick = GetTick(now);
+    if (tick != m_tick)
+    {
+        Advance(tick);
+    }
+    m_expiring = true;
+    // the timers scheduled now for now are inserted in order in the list
+    while (m_due != nullptr && m_due->expiration == now)
+    {
+        Entry* entry = m_due;
+        Unlink(entry);
+        EventImpl* event = entry->event;
+        entry->event = nullptr;
+        Release(entry);
+        event->Invoke();
+        event->Unref();
+    }
+    m_expiring = false;
+    Arm();
+}
+
+} // namespace ns3
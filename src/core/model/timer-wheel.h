@@ -0,0 +1,222 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include "event-id.h"
+#include "nstime.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup timer
+ * ns3::TimerWheel class declaration.
+ */
+
+namespace ns3
+{
+
+class EventImpl;
+
+/**
+ * \ingroup timer
+ * \brief A hierarchical timing wheel holding the Timer instances of a context.
+ *
+ * When the "TimerWheelEnabled" global value is set, the Timer instances
+ * are not scheduled as simulator events, but inserted in the wheel of
+ * the context (usually the node) which schedules them.  Each wheel keeps
+ * a single simulator event, scheduled at the earliest expiration time
+ * of its timers, so cancelling or rescheduling a timer only moves an
+ * entry of the wheel, and leaves no cancelled event in the event list.
+ *
+ * The timers expire at their exact expiration time: the slots of the
+ * wheel group the timers by ticks of one millisecond, and the timers of
+ * the current tick are kept sorted by expiration time, then by the
+ * order in which they were scheduled, so the timers expiring at the
+ * same time are invoked in the order in which they were scheduled.
+ * Relative to the other events of the same timestamp, the timers run
+ * when the wheel event runs.
+ *
+ * The wheel has four levels of 256 slots.  The slots of level \c k
+ * span \c 256^k ticks, and a timer is inserted at the lowest level
+ * whose span covers its expiration time.  The slots of a level are
+ * moved down to the lower levels as the time of the wheel reaches them:
+ * the wheel event is scheduled at the earliest expiration time of the
+ * timers of the next non-empty tick, or at the first tick of the next
+ * non-empty slot of an upper level if it comes first.
+ */
+class TimerWheel
+{
+  public:
+    /** A timer inserted in the wheel. */
+    struct Entry;
+
+    /**
+     * Get the wheel of the current context, creating it if needed.
+     *
+     * The wheels are deleted by Simulator::Destroy; the timers still
+     * running then are expired without being invoked.
+     *
+     * \returns The wheel of the current context.
+     */
+    static TimerWheel* Get();
+
+    /** Constructor. */
+    TimerWheel();
+    /** Destructor.  The timers still running are expired. */
+    ~TimerWheel();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    /**
+     * Insert a timer in the wheel.
+     *
+     * \param [in] delay The delay until the timer expires.
+     * \param [in] event The event to invoke when the timer expires.
+     *             The wheel takes a reference to it.
+     * \param [in,out] handle The location of the handle of the timer,
+     *             which is set to the new entry, and reset to \c nullptr
+     *             when the timer expires or is cancelled.
+     */
+    void Schedule(const Time& delay, EventImpl* event, Entry** handle);
+
+    /**
+     * Remove a timer from its wheel, without invoking it.
+     *
+     * \param [in,out] handle The location of the handle of the timer.
+     *             Nothing is done if the handle is \c nullptr.
+     */
+    static void Cancel(Entry** handle);
+
+    /**
+     * \param [in] entry The timer.
+     * \returns The expiration time of the timer.
+     */
+    static Time GetExpiration(const Entry* entry);
+
+    /**
+     * \returns The number of timers in the wheel.
+     */
+    uint32_t GetSize() const;
+
+  private:
+    /** Number of levels of the wheel. */
+    static constexpr uint32_t LEVELS = 4;
+    /** Number of bits of the slot index in a level. */
+    static constexpr uint32_t SLOT_BITS = 8;
+    /** Number of slots of a level. */
+    static constexpr uint32_t SLOTS = 1 << SLOT_BITS;
+    /** Number of 64-bit words of the bitmap of non-empty slots of a level. */
+    static constexpr uint32_t WORDS = SLOTS / 64;
+    /** Level of the entries beyond the span of the wheel. */
+    static constexpr uint32_t LEVEL_OVERFLOW = LEVELS;
+    /** Level of the entries of the current tick. */
+    static constexpr uint32_t LEVEL_DUE = LEVELS + 1;
+
+    /** A level of the wheel. */
+    struct Level
+    {
+        std::array<Entry*, SLOTS> slots{};      //!< Lists of entries by slot
+        std::array<uint64_t, WORDS> nonEmpty{}; //!< Bitmap of the non-empty slots
+    };
+
+    /**
+     * \param [in] time A time.
+     * \returns The tick containing the time.
+     */
+    uint64_t GetTick(const Time& time) const;
+    /**
+     * \param [in] tick A tick.
+     * \returns The start time of the tick.
+     */
+    Time GetTickTime(uint64_t tick) const;
+    /**
+     * \param [in] entry An entry.
+     * \returns The list of the slot holding the entry.
+     */
+    Entry*& GetList(const Entry* entry);
+    /**
+     * Insert an entry in the slot of its expiration time.
+     * \param [in] entry The entry.
+     */
+    void Insert(Entry* entry);
+    /**
+     * Insert an entry of the current tick in the sorted list of the
+     * entries of the tick, after the entries which do not expire later.
+     * \param [in] entry The entry.
+     */
+    void InsertDue(Entry* entry);
+    /**
+     * Remove an entry from its slot.
+     * \param [in] entry The entry.
+     */
+    void Unlink(Entry* entry);
+    /**
+     * Reset the handle of an entry removed from its slot, and keep the
+     * entry for reuse.
+     * \param [in] entry The entry.
+     */
+    void Release(Entry* entry);
+    /**
+     * Move the time of the wheel to a tick, moving down the slots reached,
+     * and sort the entries of the new tick.
+     * \param [in] tick The new tick, which no entry precedes.
+     */
+    void Advance(uint64_t tick);
+    /**
+     * \returns The time when the wheel event is needed next: the earliest
+     * expiration time of the entries of the next non-empty tick, or the
+     * first tick of the next non-empty slot of an upper level, or
+     * Time::Max() if the wheel is empty.
+     */
+    Time GetNextTime() const;
+    /**
+     * Find the first non-empty slot of a level, from a slot index.
+     * \param [in] level The level.
+     * \param [in] start The first slot index to check, wrapping around.
+     * \returns The index of the slot, or SLOTS if the level is empty.
+     */
+    uint32_t FindSlot(const Level& level, uint32_t start) const;
+    /**
+     * Schedule the wheel event at the time returned by GetNextTime(),
+     * unless an event is already scheduled before it.
+     */
+    void Arm();
+    /** Invoke the timers expiring now, and schedule the next wheel event. */
+    void Expire();
+
+    std::array<Level, LEVELS> m_levels; //!< The levels of the wheel
+    Entry* m_overflow;                  //!< Entries beyond the span of the wheel
+    Entry* m_due;                       //!< Sorted entries of the current tick
+    Entry* m_dueTail;                   //!< Last of the sorted entries of the current tick
+    uint64_t m_tick;                    //!< Current tick of the wheel
+    int64_t m_tickSteps;                //!< Duration of a tick, in time steps
+    uint64_t m_order;                   //!< Order of the next entry scheduled
+    uint32_t m_size;                    //!< Number of entries
+    EventId m_event;                    //!< The wheel event
+    Time m_eventTime;                   //!< Time of the wheel event, if scheduled
+    bool m_expiring;                    //!< Whether the timers are being invoked
+    std::vector<Entry*> m_free;         //!< Entries available for reuse
+    std::vector<Entry*> m_sortBuffer;   //!< Buffer to sort the entries of a tick
+};
+
+} // namespace ns3
+
+#endif /* TIMER_WHEEL_H */
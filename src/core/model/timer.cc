@@ -18,6 +18,8 @@
  */
 #include "timer.h"
 
+#include "boolean.h"
+#include "global-value.h"
 #include "log.h"
 #include "simulation-singleton.h"
 #include "simulator.h"
@@ -33,19 +35,44 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("Timer");
 
+/**
+ * \ingroup timer
+ * \anchor GlobalValueTimerWheelEnabled
+ * Whether the timers created are scheduled in the TimerWheel of their context.
+ */
+static GlobalValue g_timerWheelEnabled =
+    GlobalValue("TimerWheelEnabled",
+                "Whether the Timer instances created are scheduled in a TimerWheel",
+                BooleanValue(false),
+                MakeBooleanChecker());
+
+/**
+ * \ingroup timer
+ * \returns Whether the timers created are scheduled in a TimerWheel.
+ */
+static bool
+IsTimerWheelEnabled()
+{
+    BooleanValue enabled;
+    g_timerWheelEnabled.GetValue(enabled);
+    return enabled.Get();
+}
+
 Timer::Timer()
-    : m_flags(CHECK_ON_DESTROY),
+    : m_flags(CHECK_ON_DESTROY | (IsTimerWheelEnabled() ? TIMER_WHEEL : 0)),
       m_delay(FemtoSeconds(0)),
       m_event(),
+      m_entry(nullptr),
       m_impl(nullptr)
 {
     NS_LOG_FUNCTION(this);
 }
 
 Timer::Timer(DestroyPolicy destroyPolicy)
-    : m_flags(destroyPolicy),
+    : m_flags(destroyPolicy | (IsTimerWheelEnabled() ? TIMER_WHEEL : 0)),
       m_delay(FemtoSeconds(0)),
       m_event(),
+      m_entry(nullptr),
       m_impl(nullptr)
 {
     NS_LOG_FUNCTION(this << destroyPolicy);
@@ -56,7 +83,7 @@ Timer::~Timer()
     NS_LOG_FUNCTION(this);
     if (m_flags & CHECK_ON_DESTROY)
     {
-        if (m_event.IsRunning())
+        if (m_event.IsRunning() || m_entry != nullptr)
         {
             NS_FATAL_ERROR("Event is still running while destroying.");
         }
@@ -69,6 +96,7 @@ Timer::~Timer()
     {
         m_event.Remove();
     }
+    TimerWheel::Cancel(&m_entry);
     delete m_impl;
 }
 
@@ -93,6 +121,10 @@ Timer::GetDelayLeft() const
     switch (GetState())
     {
     case Timer::RUNNING:
+        if (m_entry != nullptr)
+        {
+            return TimerWheel::GetExpiration(m_entry) - Simulator::Now();
+        }
         return Simulator::GetDelayLeft(m_event);
     case Timer::EXPIRED:
         return TimeStep(0);
@@ -109,6 +141,7 @@ Timer::Cancel()
 {
     NS_LOG_FUNCTION(this);
     m_event.Cancel();
+    TimerWheel::Cancel(&m_entry);
 }
 
 void
@@ -116,20 +149,21 @@ Timer::Remove()
 {
     NS_LOG_FUNCTION(this);
     m_event.Remove();
+    TimerWheel::Cancel(&m_entry);
 }
 
 bool
 Timer::IsExpired() const
 {
     NS_LOG_FUNCTION(this);
-    return !IsSuspended() && m_event.IsExpired();
+    return !IsSuspended() && m_entry == nullptr && m_event.IsExpired();
 }
 
 bool
 Timer::IsRunning() const
 {
     NS_LOG_FUNCTION(this);
-    return !IsSuspended() && m_event.IsRunning();
+    return !IsSuspended() && (m_entry != nullptr || m_event.IsRunning());
 }
 
 bool
@@ -170,11 +204,24 @@ Timer::Schedule(Time delay)
 {
     NS_LOG_FUNCTION(this << delay);
     NS_ASSERT(m_impl != nullptr);
-    if (m_event.IsRunning())
+    if (m_event.IsRunning() || m_entry != nullptr)
     {
         NS_FATAL_ERROR("Event is still running while re-scheduling.");
     }
-    m_event = m_impl->Schedule(delay);
+    DoSchedule(delay);
+}
+
+void
+Timer::DoSchedule(const Time& delay)
+{
+    if (m_flags & TIMER_WHEEL)
+    {
+        TimerWheel::Get()->Schedule(delay, m_impl->MakeEvent(), &m_entry);
+    }
+    else
+    {
+        m_event = m_impl->Schedule(delay);
+    }
 }
 
 void
@@ -182,7 +229,8 @@ Timer::Suspend()
 {
     NS_LOG_FUNCTION(this);
     NS_ASSERT(IsRunning());
-    m_delayLeft = Simulator::GetDelayLeft(m_event);
+    m_delayLeft = GetDelayLeft();
+    TimerWheel::Cancel(&m_entry);
     if (m_flags & CANCEL_ON_DESTROY)
     {
         m_event.Cancel();
@@ -199,7 +247,7 @@ Timer::Resume()
 {
     NS_LOG_FUNCTION(this);
     NS_ASSERT(m_flags & TIMER_SUSPENDED);
-    m_event = m_impl->Schedule(m_delayLeft);
+    DoSchedule(m_delayLeft);
     m_flags &= ~TIMER_SUSPENDED;
 }
 
@@ -23,6 +23,7 @@
 #include "fatal-error.h"
 #include "int-to-type.h"
 #include "nstime.h"
+#include "timer-wheel.h"
 
 /**
  * \file
@@ -68,6 +69,11 @@ class TimerImpl;
  * management policies. These policies are specified at construction time
  * and cannot be changed after.
  *
+ * When the "TimerWheelEnabled" global value is set at construction time,
+ * the timer is scheduled in the TimerWheel of the current context rather
+ * than as a simulator event, which makes frequent cancellations and
+ * reschedulings cheaper.  The timer expires at the same time either way.
+ *
  * \see Watchdog for a simpler interface for a watchdog timer.
  */
 class Timer
@@ -233,14 +239,22 @@ class Timer
     void Resume();
 
   private:
+    /** Internal bit marking the timers scheduled in a TimerWheel */
+    static constexpr auto TIMER_WHEEL{1 << 6};
     /** Internal bit marking the suspended timer state */
     static constexpr auto TIMER_SUSPENDED{1 << 7};
 
     /**
-     * Bitfield for Timer State, DestroyPolicy and InternalSuspended.
+     * Schedule the function in the simulator or in the timer wheel.
+     * \param [in] delay The delay until the timer expires.
+     */
+    void DoSchedule(const Time& delay);
+
+    /**
+     * Bitfield for Timer State, DestroyPolicy, InternalWheel and InternalSuspended.
      *
      * \internal
-     * The DestroyPolicy, State and InternalSuspended state are stored
+     * The DestroyPolicy, State, InternalWheel and InternalSuspended state are stored
      * in this single bitfield.  The State uses the low-order bits,
      * so the other users of the bitfield have to be careful in defining
      * their bits to avoid the State.
@@ -250,6 +264,8 @@ class Timer
     Time m_delay;
     /** The future event scheduled to expire the timer. */
     EventId m_event;
+    /** The entry of the timer in the timer wheel, if scheduled there. */
+    TimerWheel::Entry* m_entry;
     /**
      * The timer implementation, which contains the bound callback
      * function and arguments.
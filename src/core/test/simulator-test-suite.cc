@@ -18,12 +18,22 @@
  */
 #include "ns3/calendar-scheduler.h"
 #include "ns3/heap-scheduler.h"
+#include "ns3/ladder-scheduler.h"
 #include "ns3/list-scheduler.h"
+#include "ns3/make-event.h"
 #include "ns3/map-scheduler.h"
 #include "ns3/priority-queue-scheduler.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/simulator-impl.h"
 #include "ns3/simulator.h"
+#include "ns3/string.h"
 #include "ns3/test.h"
 
+#include <fstream>
+#include <set>
+#include <thread>
+#include <vector>
+
 using namespace ns3;
 
 /**
@@ -707,6 +717,458 @@ SimulatorTemplateTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup simulator-tests
+ *
+ * \brief Check that a scheduler returns the events in order under a
+ * large, irregular load, with removals.
+ */
+class SchedulerOrderTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor.
+     *
+     * \param schedulerFactory Scheduler factory.
+     */
+    SchedulerOrderTestCase(ObjectFactory schedulerFactory);
+
+  private:
+    void DoRun() override;
+
+    ObjectFactory m_schedulerFactory; //!< Scheduler factory.
+};
+
+SchedulerOrderTestCase::SchedulerOrderTestCase(ObjectFactory schedulerFactory)
+    : TestCase("Check the event order of " + schedulerFactory.GetTypeId().GetName() +
+               " under load"),
+      m_schedulerFactory(schedulerFactory)
+{
+}
+
+void
+SchedulerOrderTestCase::DoRun()
+{
+    Ptr<Scheduler> scheduler = m_schedulerFactory.Create<Scheduler>();
+    Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable>();
+    random->SetStream(1);
+
+    // The reference ordering of the pending events.
+    std::set<Scheduler::Event> pending;
+    uint64_t now = 0;
+    uint32_t uid = 0;
+    bool ordered = true;
+    for (uint32_t i = 0; i < 50000 && ordered; i++)
+    {
+        // Build a population first, then keep it roughly stable.
+        double insertProbability = i < 20000 ? 0.8 : 0.45;
+        double removeProbability = 0.05;
+        double dice = random->GetValue();
+        if (pending.empty() || dice < insertProbability)
+        {
+            // Mix far-future events, near-future bursts and simultaneous events.
+            uint64_t delay;
+            double kind = random->GetValue();
+            if (kind < 0.1)
+            {
+                delay = 0;
+            }
+            else if (kind < 0.4)
+            {
+                delay = random->GetInteger(0, 100);
+            }
+            else
+            {
+                delay = random->GetInteger(0, 10000000);
+            }
+            Scheduler::Event ev = {nullptr, {now + delay, uid++, 0}};
+            scheduler->Insert(ev);
+            pending.insert(ev);
+        }
+        else if (dice < insertProbability + removeProbability)
+        {
+            // Remove a random pending event.
+            auto it = pending.lower_bound(
+                Scheduler::Event{nullptr, {now + random->GetInteger(0, 10000000), 0, 0}});
+            if (it == pending.end())
+            {
+                it = pending.begin();
+            }
+            scheduler->Remove(*it);
+            pending.erase(it);
+        }
+        else
+        {
+            Scheduler::Event next = scheduler->RemoveNext();
+            ordered = next.key == pending.begin()->key;
+            now = next.key.m_ts;
+            pending.erase(pending.begin());
+        }
+        ordered = ordered && scheduler->IsEmpty() == pending.empty();
+    }
+    NS_TEST_ASSERT_MSG_EQ(ordered, true, "Events out of order");
+
+    while (!pending.empty())
+    {
+        Scheduler::Event next = scheduler->RemoveNext();
+        NS_TEST_ASSERT_MSG_EQ(next.key.m_uid, pending.begin()->key.m_uid, "Events out of order");
+        pending.erase(pending.begin());
+    }
+    NS_TEST_EXPECT_MSG_EQ(scheduler->IsEmpty(), true, "Scheduler not empty");
+}
+
+/**
+ * \ingroup simulator-tests
+ *
+ * \brief Check that a scheduler removes the cancelled events when compacted.
+ */
+class SchedulerCompactTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor.
+     *
+     * \param schedulerFactory Scheduler factory.
+     */
+    SchedulerCompactTestCase(ObjectFactory schedulerFactory);
+
+  private:
+    void DoRun() override;
+    /** Test event. */
+    static void Event();
+
+    ObjectFactory m_schedulerFactory; //!< Scheduler factory.
+};
+
+SchedulerCompactTestCase::SchedulerCompactTestCase(ObjectFactory schedulerFactory)
+    : TestCase("Check the compaction of " + schedulerFactory.GetTypeId().GetName()),
+      m_schedulerFactory(schedulerFactory)
+{
+}
+
+void
+SchedulerCompactTestCase::Event()
+{
+}
+
+void
+SchedulerCompactTestCase::DoRun()
+{
+    Ptr<Scheduler> scheduler = m_schedulerFactory.Create<Scheduler>();
+    Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable>();
+    random->SetStream(2);
+
+    std::set<Scheduler::Event> live;
+    uint32_t cancelled = 0;
+    for (uint32_t uid = 0; uid < 5000; uid++)
+    {
+        EventImpl* impl = MakeEvent(&SchedulerCompactTestCase::Event);
+        Scheduler::Event ev = {impl, {random->GetInteger(0, 100000), uid, 0}};
+        scheduler->Insert(ev);
+        if (random->GetValue() < 0.7)
+        {
+            impl->Cancel();
+            cancelled++;
+        }
+        else
+        {
+            live.insert(ev);
+        }
+    }
+    // Consume some events, so that a part of them are sorted.
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        Scheduler::Event next = scheduler->RemoveNext();
+        if (next.impl->IsCancelled())
+        {
+            cancelled--;
+        }
+        else
+        {
+            NS_TEST_ASSERT_MSG_EQ(next.key.m_uid, live.begin()->key.m_uid, "Events out of order");
+            live.erase(live.begin());
+        }
+        next.impl->Unref();
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(scheduler->Compact(), cancelled, "Wrong number of events removed");
+    NS_TEST_ASSERT_MSG_EQ(scheduler->Compact(), 0U, "Cancelled events left after compaction");
+    while (!live.empty())
+    {
+        Scheduler::Event next = scheduler->RemoveNext();
+        NS_TEST_ASSERT_MSG_EQ(next.key.m_uid, live.begin()->key.m_uid, "Events out of order");
+        live.erase(live.begin());
+        next.impl->Unref();
+    }
+    NS_TEST_EXPECT_MSG_EQ(scheduler->IsEmpty(), true, "Scheduler not empty");
+}
+
+/**
+ * \ingroup simulator-tests
+ *
+ * \brief Check that the simulator compacts the event list when many events are cancelled.
+ */
+class SimulatorCompactTestCase : public TestCase
+{
+  public:
+    SimulatorCompactTestCase();
+
+  private:
+    void DoRun() override;
+    /** Test event. */
+    void Event();
+
+    uint32_t m_count; //!< Number of events executed.
+};
+
+SimulatorCompactTestCase::SimulatorCompactTestCase()
+    : TestCase("Check the compaction of the cancelled events"),
+      m_count(0)
+{
+}
+
+void
+SimulatorCompactTestCase::Event()
+{
+    m_count++;
+}
+
+void
+SimulatorCompactTestCase::DoRun()
+{
+    const uint32_t nEvents = 10000;
+    std::vector<EventId> ids;
+    for (uint32_t i = 0; i < nEvents; i++)
+    {
+        ids.push_back(Simulator::Schedule(MicroSeconds(i), &SimulatorCompactTestCase::Event, this));
+    }
+    // Cancel 9 events out of 10.
+    for (uint32_t i = 0; i < nEvents; i++)
+    {
+        if (i % 10 != 0)
+        {
+            ids[i].Cancel();
+        }
+    }
+    Simulator::Run();
+    NS_TEST_EXPECT_MSG_EQ(m_count, nEvents / 10, "Wrong number of events executed");
+    // Without compaction, the cancelled events would have been dequeued too.
+    NS_TEST_EXPECT_MSG_LT(Simulator::GetEventCount(), nEvents / 2, "Event list not compacted");
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup simulator-tests
+ *
+ * \brief Check that the memory of executed events is reused.
+ */
+class EventPoolTestCase : public TestCase
+{
+  public:
+    EventPoolTestCase();
+
+  private:
+    void DoRun() override;
+    /**
+     * Test event.
+     * \param value An argument, to make the event larger.
+     */
+    void Event(uint64_t value);
+
+    uint64_t m_sum; //!< Sum of the event arguments.
+};
+
+EventPoolTestCase::EventPoolTestCase()
+    : TestCase("Check the reuse of event memory"),
+      m_sum(0)
+{
+}
+
+void
+EventPoolTestCase::Event(uint64_t value)
+{
+    m_sum += value;
+}
+
+void
+EventPoolTestCase::DoRun()
+{
+    const uint64_t nEvents = 1000;
+    for (uint64_t i = 0; i < nEvents; i++)
+    {
+        Simulator::Schedule(MicroSeconds(i), &EventPoolTestCase::Event, this, i);
+    }
+    Simulator::Run();
+    EventImpl::PoolStatistics before = Simulator::GetEventPoolStatistics();
+    NS_TEST_ASSERT_MSG_GT_OR_EQ(before.highWaterMark,
+                                static_cast<int64_t>(nEvents),
+                                "All the events should have been pending at once");
+
+    // The same events again: all of them fit in the memory just released.
+    for (uint64_t i = 0; i < nEvents; i++)
+    {
+        Simulator::Schedule(MicroSeconds(i), &EventPoolTestCase::Event, this, i);
+    }
+    Simulator::Run();
+    EventImpl::PoolStatistics after = Simulator::GetEventPoolStatistics();
+    NS_TEST_EXPECT_MSG_EQ(after.misses, before.misses, "Events were not allocated from the pool");
+    NS_TEST_EXPECT_MSG_GT_OR_EQ(after.hits - before.hits, nEvents, "Too few pool hits");
+    NS_TEST_EXPECT_MSG_EQ(after.highWaterMark,
+                          before.highWaterMark,
+                          "The high-water mark should not have grown");
+    NS_TEST_EXPECT_MSG_EQ(m_sum, nEvents * (nEvents - 1), "Events not executed");
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup simulator-tests
+ *
+ * \brief Check that the free lists of a thread releasing the events
+ * of another thread do not grow without bound.
+ */
+class EventPoolTrimTestCase : public TestCase
+{
+  public:
+    EventPoolTrimTestCase();
+
+  private:
+    void DoRun() override;
+    /**
+     * Test event.
+     * \param value An argument, to make the event larger.
+     */
+    void Event(uint64_t value);
+};
+
+EventPoolTrimTestCase::EventPoolTrimTestCase()
+    : TestCase("Check the trimming of the event free lists")
+{
+}
+
+void
+EventPoolTrimTestCase::Event(uint64_t /* value */)
+{
+}
+
+void
+EventPoolTrimTestCase::DoRun()
+{
+    // more events than the 2 MiB kept by a size class
+    const uint64_t nEvents = 100000;
+    std::vector<EventImpl*> events;
+    events.reserve(nEvents);
+    for (uint64_t i = 0; i < nEvents; i++)
+    {
+        events.push_back(MakeEvent(&EventPoolTrimTestCase::Event, this, i));
+    }
+
+    EventImpl::PoolStatistics freed;
+    EventImpl::PoolStatistics reused;
+    std::thread thread([&]() {
+        for (auto event : events)
+        {
+            event->Unref();
+        }
+        freed = EventImpl::GetPoolStatistics();
+        for (auto& event : events)
+        {
+            event = MakeEvent(&EventPoolTrimTestCase::Event, this, 0);
+        }
+        reused = EventImpl::GetPoolStatistics();
+        for (auto event : events)
+        {
+            event->Unref();
+        }
+    });
+    thread.join();
+
+    NS_TEST_EXPECT_MSG_LT(reused.hits - freed.hits,
+                          nEvents,
+                          "All the events freed by the thread were kept");
+    NS_TEST_EXPECT_MSG_GT(reused.misses - freed.misses, 0, "No event was returned to the system");
+}
+
+/**
+ * \ingroup simulator-tests
+ *
+ * \brief Check the profile written by the DefaultSimulatorImpl.
+ */
+class SimulatorProfileTestCase : public TestCase
+{
+  public:
+    SimulatorProfileTestCase();
+
+  private:
+    void DoRun() override;
+    /** Test event. */
+    void Event();
+    /** Another test event, with the same signature. */
+    void OtherEvent();
+    /** A virtual test event. */
+    virtual void VirtualEvent();
+};
+
+SimulatorProfileTestCase::SimulatorProfileTestCase()
+    : TestCase("Check the event profiler")
+{
+}
+
+void
+SimulatorProfileTestCase::Event()
+{
+}
+
+void
+SimulatorProfileTestCase::OtherEvent()
+{
+}
+
+void
+SimulatorProfileTestCase::VirtualEvent()
+{
+}
+
+void
+SimulatorProfileTestCase::DoRun()
+{
+    std::string filename = CreateTempDirFilename("simulator-profile.folded");
+    ObjectFactory factory("ns3::DefaultSimulatorImpl");
+    factory.Set("ProfileFile", StringValue(filename));
+    Simulator::SetImplementation(factory.Create<SimulatorImpl>());
+
+    Simulator::Schedule(Seconds(1), &SimulatorProfileTestCase::Event, this);
+    Simulator::ScheduleWithContext(3, Seconds(1), &SimulatorProfileTestCase::Event, this);
+    Simulator::ScheduleWithContext(3, Seconds(2), &SimulatorProfileTestCase::Event, this);
+    Simulator::ScheduleWithContext(3, Seconds(2), &SimulatorProfileTestCase::OtherEvent, this);
+    Simulator::ScheduleWithContext(3, Seconds(3), &SimulatorProfileTestCase::VirtualEvent, this);
+    Simulator::ScheduleNow([]() {});
+    Simulator::Run();
+    Simulator::Destroy();
+
+    std::ifstream is(filename);
+    NS_TEST_ASSERT_MSG_EQ(is.is_open(), true, "Profile not written");
+    std::vector<std::string> stacks;
+    std::string line;
+    while (std::getline(is, line))
+    {
+        stacks.push_back(line.substr(0, line.rfind(' ')));
+    }
+    NS_TEST_ASSERT_MSG_EQ(stacks.size(), 5, "Expected one line per context and handler");
+    NS_TEST_EXPECT_MSG_EQ(stacks[0],
+                          "no context;SimulatorProfileTestCase::Event()",
+                          "Wrong stack");
+    NS_TEST_EXPECT_MSG_EQ(stacks[1].rfind("no context;ns3::MakeEvent<", 0),
+                          0,
+                          "A lambda should be named after the event type");
+    NS_TEST_EXPECT_MSG_EQ(stacks[2], "node 3;SimulatorProfileTestCase::Event()", "Wrong stack");
+    NS_TEST_EXPECT_MSG_EQ(stacks[3],
+                          "node 3;SimulatorProfileTestCase::OtherEvent()",
+                          "Methods with the same signature should not be merged");
+    NS_TEST_EXPECT_MSG_EQ(stacks[4],
+                          "node 3;SimulatorProfileTestCase::VirtualEvent()",
+                          "Virtual method not resolved");
+}
+
 /**
  * \ingroup simulator-tests
  *
@@ -730,6 +1192,23 @@ class SimulatorTestSuite : public TestSuite
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::QUICK);
         factory.SetTypeId(PriorityQueueScheduler::GetTypeId());
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::QUICK);
+        factory.SetTypeId(LadderScheduler::GetTypeId());
+        AddTestCase(new SimulatorEventsTestCase(factory), TestCase::QUICK);
+
+        for (const auto& schedulerType : {MapScheduler::GetTypeId(),
+                                          HeapScheduler::GetTypeId(),
+                                          CalendarScheduler::GetTypeId(),
+                                          PriorityQueueScheduler::GetTypeId(),
+                                          LadderScheduler::GetTypeId()})
+        {
+            factory.SetTypeId(schedulerType);
+            AddTestCase(new SchedulerOrderTestCase(factory), TestCase::QUICK);
+            AddTestCase(new SchedulerCompactTestCase(factory), TestCase::QUICK);
+        }
+        AddTestCase(new EventPoolTestCase, TestCase::QUICK);
+        AddTestCase(new EventPoolTrimTestCase, TestCase::QUICK);
+        AddTestCase(new SimulatorCompactTestCase, TestCase::QUICK);
+        AddTestCase(new SimulatorProfileTestCase, TestCase::QUICK);
     }
 };
 
@@ -16,11 +16,18 @@
  *
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
+#include "ns3/boolean.h"
+#include "ns3/global-value.h"
 #include "ns3/nstime.h"
 #include "ns3/simulator.h"
 #include "ns3/test.h"
 #include "ns3/timer.h"
 
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
 /**
  * \file
  * \ingroup timer-tests
@@ -220,6 +227,215 @@ TimerTemplateTestCase::DoTeardown()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup timer-tests
+ *
+ * \brief Check that the timers scheduled in a TimerWheel expire at their
+ * exact time, in the order in which they were scheduled.
+ */
+class TimerWheelTestCase : public TestCase
+{
+  public:
+    TimerWheelTestCase();
+    void DoRun() override;
+
+    /**
+     * Record the expiration of a timer.
+     * \param [in] index The index of the timer.
+     */
+    void Expire(uint32_t index);
+
+    /// The timers which expired, with their expiration time
+    std::vector<std::pair<uint32_t, Time>> m_expired;
+    /// The timers
+    std::vector<std::unique_ptr<Timer>> m_timers;
+};
+
+TimerWheelTestCase::TimerWheelTestCase()
+    : TestCase("Check the timers scheduled in a timer wheel")
+{
+}
+
+void
+TimerWheelTestCase::Expire(uint32_t index)
+{
+    m_expired.emplace_back(index, Simulator::Now());
+    Timer& timer = *m_timers[index];
+    NS_TEST_EXPECT_MSG_EQ(timer.IsExpired(), true, "The timer is still running");
+    // the timers 0 and 1 are periodic
+    if (index < 2 && Simulator::Now() < Seconds(1))
+    {
+        timer.Schedule();
+    }
+}
+
+void
+TimerWheelTestCase::DoRun()
+{
+    GlobalValue::Bind("TimerWheelEnabled", BooleanValue(true));
+    // delays in each level of the wheel, and beyond it, some of them equal
+    std::vector<Time> delays = {MilliSeconds(10),
+                                MilliSeconds(10),
+                                Seconds(0),
+                                MicroSeconds(1500),
+                                MilliSeconds(255),
+                                MilliSeconds(256),
+                                Seconds(70),
+                                Seconds(70),
+                                Seconds(3600 * 5),
+                                Seconds(3600 * 24 * 60),
+                                MicroSeconds(1500)};
+    for (uint32_t i = 0; i < delays.size(); i++)
+    {
+        m_timers.push_back(std::make_unique<Timer>(Timer::CANCEL_ON_DESTROY));
+        m_timers[i]->SetFunction(&TimerWheelTestCase::Expire, this);
+        m_timers[i]->SetArguments(i);
+        m_timers[i]->SetDelay(delays[i]);
+        m_timers[i]->Schedule();
+    }
+    Time left = m_timers[6]->GetDelayLeft();
+    NS_TEST_EXPECT_MSG_EQ(left, Seconds(70), "Unexpected delay left");
+
+    // a timer cancelled, and one rescheduled later, before their expiration
+    Simulator::Schedule(MilliSeconds(100), &Timer::Cancel, m_timers[5].get());
+    Simulator::Schedule(MilliSeconds(100), [this]() {
+        m_timers[4]->Cancel();
+        m_timers[4]->Schedule(MilliSeconds(300));
+    });
+    // a timer suspended and resumed
+    Simulator::Schedule(Seconds(10), &Timer::Suspend, m_timers[7].get());
+    Simulator::Schedule(Seconds(20), &Timer::Resume, m_timers[7].get());
+    Simulator::Run();
+
+    std::vector<std::pair<uint32_t, Time>> expected = {{2, Seconds(0)}, {3, MicroSeconds(1500)},
+                                                       {10, MicroSeconds(1500)}};
+    for (uint32_t i = 1; i <= 100; i++)
+    {
+        // the timer rescheduled first expires first
+        if (i == 40)
+        {
+            expected.emplace_back(4, MilliSeconds(400));
+        }
+        expected.emplace_back(0, MilliSeconds(10 * i));
+        expected.emplace_back(1, MilliSeconds(10 * i));
+    }
+    expected.emplace_back(6, Seconds(70));
+    expected.emplace_back(7, Seconds(80));
+    expected.emplace_back(8, Seconds(3600 * 5));
+    expected.emplace_back(9, Seconds(3600 * 24 * 60));
+    NS_TEST_ASSERT_MSG_EQ(m_expired.size(), expected.size(), "Unexpected number of expirations");
+    for (uint32_t i = 0; i < expected.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_expired[i].first, expected[i].first, "Unexpected timer");
+        NS_TEST_EXPECT_MSG_EQ(m_expired[i].second, expected[i].second, "Unexpected time");
+    }
+
+    // the timers still running are expired by Simulator::Destroy
+    m_timers[0]->Schedule(Seconds(1));
+    Simulator::Destroy();
+    NS_TEST_EXPECT_MSG_EQ(m_timers[0]->IsExpired(), true, "The timer was not expired");
+    m_timers.clear();
+    GlobalValue::Bind("TimerWheelEnabled", BooleanValue(false));
+}
+
+/**
+ * \ingroup timer-tests
+ *
+ * \brief Check that many timers expiring in the same tick of a TimerWheel
+ * expire in the order of their expiration time, then in the order in which
+ * they were scheduled.
+ */
+class TimerWheelOrderTestCase : public TestCase
+{
+  public:
+    TimerWheelOrderTestCase();
+    void DoRun() override;
+
+    /**
+     * Schedule a timer, and record its expected expiration.
+     * \param [in] index The index of the timer.
+     * \param [in] delay The delay of the timer.
+     */
+    void Schedule(uint32_t index, const Time& delay);
+    /**
+     * Record the expiration of a timer.
+     * \param [in] index The index of the timer.
+     */
+    void Expire(uint32_t index);
+
+    /// The timers which expired, with their expiration time
+    std::vector<std::pair<uint32_t, Time>> m_expired;
+    /// The timers in the order in which they were scheduled, with their expiration time
+    std::vector<std::pair<uint32_t, Time>> m_scheduled;
+    /// The timers
+    std::vector<std::unique_ptr<Timer>> m_timers;
+};
+
+TimerWheelOrderTestCase::TimerWheelOrderTestCase()
+    : TestCase("Check the order of the timers expiring in the same tick of a timer wheel")
+{
+}
+
+void
+TimerWheelOrderTestCase::Schedule(uint32_t index, const Time& delay)
+{
+    m_timers[index]->Schedule(delay);
+    m_scheduled.emplace_back(index, Simulator::Now() + delay);
+}
+
+void
+TimerWheelOrderTestCase::Expire(uint32_t index)
+{
+    m_expired.emplace_back(index, Simulator::Now());
+    // a timer scheduled without delay expires after the timers of the same time
+    if (index == 0)
+    {
+        Schedule(m_timers.size() - 1, Seconds(0));
+    }
+}
+
+void
+TimerWheelOrderTestCase::DoRun()
+{
+    GlobalValue::Bind("TimerWheelEnabled", BooleanValue(true));
+    const uint32_t nTimers = 601;
+    for (uint32_t i = 0; i < nTimers; i++)
+    {
+        m_timers.push_back(std::make_unique<Timer>(Timer::CANCEL_ON_DESTROY));
+        m_timers[i]->SetFunction(&TimerWheelOrderTestCase::Expire, this);
+        m_timers[i]->SetArguments(i);
+    }
+    // timers in the tick at 300 ms, moved down from the second level of the
+    // wheel, with ten distinct expiration times in unsorted order
+    for (uint32_t i = 0; i < 500; i++)
+    {
+        Schedule(i, MilliSeconds(300) + MicroSeconds(100 * ((i * 37) % 10)));
+    }
+    // timers scheduled in the same tick once its first timers have expired
+    Simulator::Schedule(MicroSeconds(300150), [this]() {
+        for (uint32_t i = 500; i < 600; i++)
+        {
+            Schedule(i, MicroSeconds(50 + 100 * ((i * 13) % 5)));
+        }
+    });
+    Simulator::Run();
+
+    std::vector<std::pair<uint32_t, Time>> expected = m_scheduled;
+    std::stable_sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) {
+        return a.second < b.second;
+    });
+    NS_TEST_ASSERT_MSG_EQ(m_expired.size(), expected.size(), "Unexpected number of expirations");
+    for (uint32_t i = 0; i < expected.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_expired[i].first, expected[i].first, "Unexpected timer");
+        NS_TEST_EXPECT_MSG_EQ(m_expired[i].second, expected[i].second, "Unexpected time");
+    }
+
+    Simulator::Destroy();
+    m_timers.clear();
+    GlobalValue::Bind("TimerWheelEnabled", BooleanValue(false));
+}
+
 /**
  * \ingroup timer-tests
  *
@@ -233,6 +449,8 @@ class TimerTestSuite : public TestSuite
     {
         AddTestCase(new TimerStateTestCase(), TestCase::QUICK);
         AddTestCase(new TimerTemplateTestCase(), TestCase::QUICK);
+        AddTestCase(new TimerWheelTestCase(), TestCase::QUICK);
+        AddTestCase(new TimerWheelOrderTestCase(), TestCase::QUICK);
     }
 };
 
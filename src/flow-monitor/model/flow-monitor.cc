@@ -22,12 +22,17 @@
 #include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
+#include "ns3/uinteger.h"
 
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 
 #define PERIODIC_CHECK_INTERVAL (Seconds(1))
 
+/// Number of stale entries of the expiry queue tolerated before it is compacted
+#define EXPIRY_QUEUE_MIN_STALE_ENTRIES 1024
+
 namespace ns3
 {
 
@@ -50,6 +55,12 @@ FlowMonitor::GetTypeId()
                 TimeValue(Seconds(10.0)),
                 MakeTimeAccessor(&FlowMonitor::m_maxPerHopDelay),
                 MakeTimeChecker())
+            .AddAttribute("PacketSamplingInterval",
+                          "Monitor only one packet in this many of each flow.  The statistics "
+                          "then cover the sampled packets only.",
+                          UintegerValue(1),
+                          MakeUintegerAccessor(&FlowMonitor::m_packetSamplingInterval),
+                          MakeUintegerChecker<uint32_t>(1))
             .AddAttribute("StartTime",
                           ("The time when the monitoring starts."),
                           TimeValue(Seconds(0.0)),
@@ -111,6 +122,8 @@ FlowMonitor::DoDispose()
         m_flowProbes[i]->Dispose();
         m_flowProbes[i] = nullptr;
     }
+    m_trackedPackets.clear();
+    m_expiryQueue.clear();
     Object::DoDispose();
 }
 
@@ -143,6 +156,12 @@ FlowMonitor::GetStatsForFlow(FlowId flowId)
     }
 }
 
+inline bool
+FlowMonitor::IsSampled(FlowPacketId packetId) const
+{
+    return packetId % m_packetSamplingInterval == 0;
+}
+
 void
 FlowMonitor::ReportFirstTx(Ptr<FlowProbe> probe,
                            uint32_t flowId,
@@ -155,11 +174,17 @@ FlowMonitor::ReportFirstTx(Ptr<FlowProbe> probe,
         NS_LOG_DEBUG("FlowMonitor not enabled; returning");
         return;
     }
+    if (!IsSampled(packetId))
+    {
+        return;
+    }
     Time now = Simulator::Now();
-    TrackedPacket& tracked = m_trackedPackets[std::make_pair(flowId, packetId)];
+    TrackedPacketKey key(flowId, packetId);
+    TrackedPacket& tracked = m_trackedPackets[key];
     tracked.firstSeenTime = now;
     tracked.lastSeenTime = tracked.firstSeenTime;
     tracked.timesForwarded = 0;
+    m_expiryQueue.push_back({now, key});
     NS_LOG_DEBUG("ReportFirstTx: adding tracked packet (flowId=" << flowId << ", packetId="
                                                                  << packetId << ").");
 
@@ -187,7 +212,11 @@ FlowMonitor::ReportForwarding(Ptr<FlowProbe> probe,
         NS_LOG_DEBUG("FlowMonitor not enabled; returning");
         return;
     }
-    std::pair<FlowId, FlowPacketId> key(flowId, packetId);
+    if (!IsSampled(packetId))
+    {
+        return;
+    }
+    TrackedPacketKey key(flowId, packetId);
     auto tracked = m_trackedPackets.find(key);
     if (tracked == m_trackedPackets.end())
     {
@@ -198,6 +227,7 @@ FlowMonitor::ReportForwarding(Ptr<FlowProbe> probe,
 
     tracked->second.timesForwarded++;
     tracked->second.lastSeenTime = Simulator::Now();
+    m_expiryQueue.push_back({tracked->second.lastSeenTime, key});
 
     Time delay = (Simulator::Now() - tracked->second.firstSeenTime);
     probe->AddPacketStats(flowId, packetSize, delay);
@@ -215,7 +245,11 @@ FlowMonitor::ReportLastRx(Ptr<FlowProbe> probe,
         NS_LOG_DEBUG("FlowMonitor not enabled; returning");
         return;
     }
-    auto tracked = m_trackedPackets.find(std::make_pair(flowId, packetId));
+    if (!IsSampled(packetId))
+    {
+        return;
+    }
+    auto tracked = m_trackedPackets.find(TrackedPacketKey(flowId, packetId));
     if (tracked == m_trackedPackets.end())
     {
         NS_LOG_WARN("Received packet last-tx report (flowId="
@@ -284,6 +318,10 @@ FlowMonitor::ReportDrop(Ptr<FlowProbe> probe,
         NS_LOG_DEBUG("FlowMonitor not enabled; returning");
         return;
     }
+    if (!IsSampled(packetId))
+    {
+        return;
+    }
 
     probe->AddPacketDropStats(flowId, packetSize, reasonCode);
 
@@ -299,7 +337,7 @@ FlowMonitor::ReportDrop(Ptr<FlowProbe> probe,
     NS_LOG_DEBUG("++stats.packetsDropped["
                  << reasonCode << "]; // becomes: " << stats.packetsDropped[reasonCode]);
 
-    auto tracked = m_trackedPackets.find(std::make_pair(flowId, packetId));
+    auto tracked = m_trackedPackets.find(TrackedPacketKey(flowId, packetId));
     if (tracked != m_trackedPackets.end())
     {
         // we don't need to track this packet anymore
@@ -322,9 +360,13 @@ FlowMonitor::CheckForLostPackets(Time maxDelay)
     NS_LOG_FUNCTION(this << maxDelay.As(Time::S));
     Time now = Simulator::Now();
 
-    for (auto iter = m_trackedPackets.begin(); iter != m_trackedPackets.end();)
+    // the packets not seen for maxDelay are at the front of the queue
+    while (!m_expiryQueue.empty() && now - m_expiryQueue.front().lastSeenTime >= maxDelay)
     {
-        if (now - iter->second.lastSeenTime >= maxDelay)
+        const ExpiryEntry& entry = m_expiryQueue.front();
+        auto iter = m_trackedPackets.find(entry.key);
+        // skip the packets received, dropped, or seen again since
+        if (iter != m_trackedPackets.end() && iter->second.lastSeenTime == entry.lastSeenTime)
         {
             // packet is considered lost, add it to the loss statistics
             auto flow = m_flowStats.find(iter->first.first);
@@ -332,15 +374,25 @@ FlowMonitor::CheckForLostPackets(Time maxDelay)
             flow->second.lostPackets++;
 
             // we won't track it anymore
-            m_trackedPackets.erase(iter++);
-        }
-        else
-        {
-            iter++;
+            m_trackedPackets.erase(iter);
         }
+        m_expiryQueue.pop_front();
     }
 }
 
+void
+FlowMonitor::CompactExpiryQueue()
+{
+    NS_LOG_FUNCTION(this << m_expiryQueue.size() << m_trackedPackets.size());
+    // the remaining entries keep their order, so the queue stays sorted
+    auto isStale = [this](const ExpiryEntry& entry) {
+        auto iter = m_trackedPackets.find(entry.key);
+        return iter == m_trackedPackets.end() || iter->second.lastSeenTime != entry.lastSeenTime;
+    };
+    m_expiryQueue.erase(std::remove_if(m_expiryQueue.begin(), m_expiryQueue.end(), isStale),
+                        m_expiryQueue.end());
+}
+
 void
 FlowMonitor::CheckForLostPackets()
 {
@@ -351,6 +403,11 @@ void
 FlowMonitor::PeriodicCheckForLostPackets()
 {
     CheckForLostPackets();
+    // the received packets leave stale entries until they would have expired
+    if (m_expiryQueue.size() > 2 * m_trackedPackets.size() + EXPIRY_QUEUE_MIN_STALE_ENTRIES)
+    {
+        CompactExpiryQueue();
+    }
     Simulator::Schedule(PERIODIC_CHECK_INTERVAL, &FlowMonitor::PeriodicCheckForLostPackets, this);
 }
 
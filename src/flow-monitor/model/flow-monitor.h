@@ -29,7 +29,9 @@
 #include "ns3/object.h"
 #include "ns3/ptr.h"
 
+#include <deque>
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 namespace ns3
@@ -47,6 +49,12 @@ namespace ns3
  * The FlowMonitor class is responsible for coordinating efforts
  * regarding probes, and collects end-to-end flow statistics.
  *
+ * The packets in flight are kept in a hash table, and in a queue ordered
+ * by the time they were last seen, so that the periodic check for lost
+ * packets only visits the packets not seen for MaxPerHopDelay.  When the
+ * PacketSamplingInterval attribute is larger than 1, only one packet in
+ * that many of each flow is monitored, and all the statistics, including
+ * the packet and byte counts, cover the sampled packets only.
  */
 class FlowMonitor : public Object
 {
@@ -290,13 +298,39 @@ class FlowMonitor : public Object
         uint32_t timesForwarded; //!< number of times the packet was reportedly forwarded
     };
 
+    /// Identifies a tracked packet
+    typedef std::pair<FlowId, FlowPacketId> TrackedPacketKey;
+
+    /// Hash function of a tracked packet key
+    struct TrackedPacketKeyHash
+    {
+        /// \param key the key of a tracked packet
+        /// \return the hash of the key
+        std::size_t operator()(const TrackedPacketKey& key) const
+        {
+            return std::hash<uint64_t>()((static_cast<uint64_t>(key.first) << 32) | key.second);
+        }
+    };
+
+    /// A packet seen at a given time, in the expiry queue
+    struct ExpiryEntry
+    {
+        Time lastSeenTime;    //!< time when the packet was seen
+        TrackedPacketKey key; //!< the packet
+    };
+
     /// FlowId --> FlowStats
     FlowStatsContainer m_flowStats;
 
     /// (FlowId,PacketId) --> TrackedPacket
-    typedef std::map<std::pair<FlowId, FlowPacketId>, TrackedPacket> TrackedPacketMap;
+    typedef std::unordered_map<TrackedPacketKey, TrackedPacket, TrackedPacketKeyHash>
+        TrackedPacketMap;
     TrackedPacketMap m_trackedPackets; //!< Tracked packets
+    /// Times when the tracked packets were seen, in increasing order.  An
+    /// entry is stale when its packet is no longer tracked, or was seen again.
+    std::deque<ExpiryEntry> m_expiryQueue;
     Time m_maxPerHopDelay;             //!< Minimum per-hop delay
+    uint32_t m_packetSamplingInterval; //!< Monitor one packet in this many of each flow
     FlowProbeContainer m_flowProbes;   //!< all the FlowProbes
 
     // note: this is needed only for serialization
@@ -316,6 +350,14 @@ class FlowMonitor : public Object
     /// \returns the stats of the flow
     FlowStats& GetStatsForFlow(FlowId flowId);
 
+    /// Check whether a packet is monitored
+    /// \param packetId Packet ID
+    /// \returns true if the packet is part of the sample
+    bool IsSampled(FlowPacketId packetId) const;
+
+    /// Remove the stale entries from the expiry queue
+    void CompactExpiryQueue();
+
     /// Periodic function to check for lost packets and prune statistics
     void PeriodicCheckForLostPackets();
 };
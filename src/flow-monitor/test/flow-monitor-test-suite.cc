@@ -0,0 +1,255 @@
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation;
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "ns3/flow-monitor.h"
+#include "ns3/flow-probe.h"
+#include "ns3/nstime.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup flow-monitor
+ * \defgroup flow-monitor-test FlowMonitor module tests
+ */
+
+/**
+ * \ingroup flow-monitor-test
+ *
+ * \brief A probe whose packet reports are made by the test.
+ */
+class FlowMonitorTestProbe : public FlowProbe
+{
+  public:
+    /**
+     * \brief Constructor
+     * \param monitor the FlowMonitor to report to
+     */
+    FlowMonitorTestProbe(Ptr<FlowMonitor> monitor)
+        : FlowProbe(monitor)
+    {
+    }
+};
+
+/**
+ * \ingroup flow-monitor-test
+ *
+ * \brief Test the times when the FlowMonitor declares the packets in flight
+ * lost, including after the expiry queue is compacted.
+ */
+class FlowMonitorExpiryTestCase : public TestCase
+{
+  public:
+    FlowMonitorExpiryTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Check the statistics of a flow.
+     * \param flowId the flow
+     * \param txPackets the expected number of packets sent
+     * \param rxPackets the expected number of packets received
+     * \param lostPackets the expected number of packets lost
+     */
+    void CheckStats(FlowId flowId, uint32_t txPackets, uint32_t rxPackets, uint32_t lostPackets);
+
+    Ptr<FlowMonitor> m_monitor; //!< the FlowMonitor under test
+};
+
+FlowMonitorExpiryTestCase::FlowMonitorExpiryTestCase()
+    : TestCase("Check the packets declared lost by the FlowMonitor")
+{
+}
+
+void
+FlowMonitorExpiryTestCase::CheckStats(FlowId flowId,
+                                      uint32_t txPackets,
+                                      uint32_t rxPackets,
+                                      uint32_t lostPackets)
+{
+    const FlowMonitor::FlowStats& stats = m_monitor->GetFlowStats().at(flowId);
+    NS_TEST_EXPECT_MSG_EQ(stats.txPackets,
+                          txPackets,
+                          "Wrong packets sent in flow " << flowId << " at " << Simulator::Now());
+    NS_TEST_EXPECT_MSG_EQ(stats.rxPackets,
+                          rxPackets,
+                          "Wrong packets received in flow " << flowId << " at "
+                                                            << Simulator::Now());
+    NS_TEST_EXPECT_MSG_EQ(stats.lostPackets,
+                          lostPackets,
+                          "Wrong packets lost in flow " << flowId << " at " << Simulator::Now());
+}
+
+void
+FlowMonitorExpiryTestCase::DoRun()
+{
+    // the periodic checks for lost packets run every second
+    m_monitor = CreateObjectWithAttributes<FlowMonitor>("MaxPerHopDelay",
+                                                        TimeValue(Seconds(2.5)));
+    Ptr<FlowProbe> probe = CreateObject<FlowMonitorTestProbe>(m_monitor);
+    m_monitor->Start(Seconds(0));
+
+    // flow 1: packet 0 is received, packet 1 is forwarded at 1.5 s, and
+    // packet 2 is never seen again
+    Simulator::Schedule(Seconds(0.1), [this, probe]() {
+        for (uint32_t packetId = 0; packetId < 3; ++packetId)
+        {
+            m_monitor->ReportFirstTx(probe, 1, packetId, 100);
+        }
+    });
+    Simulator::Schedule(Seconds(0.2), &FlowMonitor::ReportLastRx, m_monitor, probe, 1, 0, 100);
+    Simulator::Schedule(Seconds(1.5), &FlowMonitor::ReportForwarding, m_monitor, probe, 1, 1, 100);
+
+    // flow 2: enough packets received to compact the expiry queue in the
+    // periodic check at 1 s, while the packets of flow 1 are in flight
+    const uint32_t nReceived = 5000;
+    Simulator::Schedule(Seconds(0.1), [this, probe]() {
+        for (uint32_t packetId = 0; packetId < nReceived; ++packetId)
+        {
+            m_monitor->ReportFirstTx(probe, 2, packetId, 100);
+        }
+    });
+    Simulator::Schedule(Seconds(0.2), [this, probe]() {
+        for (uint32_t packetId = 0; packetId < nReceived; ++packetId)
+        {
+            m_monitor->ReportLastRx(probe, 2, packetId, 100);
+        }
+    });
+
+    // packet 2 is lost at the first periodic check 2.5 s after 0.1 s
+    Simulator::Schedule(Seconds(2.55), [this]() {
+        m_monitor->CheckForLostPackets();
+        CheckStats(1, 3, 1, 0);
+    });
+    Simulator::Schedule(Seconds(3.5), &FlowMonitorExpiryTestCase::CheckStats, this, 1, 3, 1, 1);
+    // packet 1 is lost 2.5 s after it was forwarded
+    Simulator::Schedule(Seconds(3.9), [this]() {
+        m_monitor->CheckForLostPackets();
+        CheckStats(1, 3, 1, 1);
+    });
+    Simulator::Schedule(Seconds(4), [this]() {
+        m_monitor->CheckForLostPackets();
+        CheckStats(1, 3, 1, 2);
+    });
+    Simulator::Stop(Seconds(5));
+    Simulator::Run();
+
+    // the received packets are never lost
+    m_monitor->CheckForLostPackets(Seconds(0));
+    CheckStats(1, 3, 1, 2);
+    CheckStats(2, nReceived, nReceived, 0);
+
+    m_monitor->Dispose();
+    m_monitor = nullptr;
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup flow-monitor-test
+ *
+ * \brief Test the statistics of the FlowMonitor when only one packet in
+ * PacketSamplingInterval is monitored.
+ */
+class FlowMonitorSamplingTestCase : public TestCase
+{
+  public:
+    FlowMonitorSamplingTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+FlowMonitorSamplingTestCase::FlowMonitorSamplingTestCase()
+    : TestCase("Check the statistics of the packets sampled by the FlowMonitor")
+{
+}
+
+void
+FlowMonitorSamplingTestCase::DoRun()
+{
+    Ptr<FlowMonitor> monitor =
+        CreateObjectWithAttributes<FlowMonitor>("PacketSamplingInterval", UintegerValue(4));
+    Ptr<FlowProbe> probe = CreateObject<FlowMonitorTestProbe>(monitor);
+    monitor->Start(Seconds(0));
+
+    // packets 0 to 19 are sent, packets 0 to 13 are forwarded once and
+    // received, and packets 15 and 16 are dropped
+    Simulator::Schedule(Seconds(0.1), [monitor, probe]() {
+        for (uint32_t packetId = 0; packetId < 20; ++packetId)
+        {
+            monitor->ReportFirstTx(probe, 1, packetId, 100);
+        }
+    });
+    Simulator::Schedule(Seconds(0.15), [monitor, probe]() {
+        for (uint32_t packetId = 0; packetId < 14; ++packetId)
+        {
+            monitor->ReportForwarding(probe, 1, packetId, 100);
+        }
+        monitor->ReportDrop(probe, 1, 15, 100, 0);
+        monitor->ReportDrop(probe, 1, 16, 100, 0);
+    });
+    Simulator::Schedule(Seconds(0.2), [monitor, probe]() {
+        for (uint32_t packetId = 0; packetId < 14; ++packetId)
+        {
+            monitor->ReportLastRx(probe, 1, packetId, 100);
+        }
+    });
+    Simulator::Stop(Seconds(0.5));
+    Simulator::Run();
+
+    // packets 0, 4, 8, 12 and 16 are sampled
+    const FlowMonitor::FlowStats& stats = monitor->GetFlowStats().at(1);
+    NS_TEST_EXPECT_MSG_EQ(stats.txPackets, 5, "Wrong number of sampled packets sent");
+    NS_TEST_EXPECT_MSG_EQ(stats.txBytes, 500, "Wrong number of sampled bytes sent");
+    NS_TEST_EXPECT_MSG_EQ(stats.rxPackets, 4, "Wrong number of sampled packets received");
+    NS_TEST_EXPECT_MSG_EQ(stats.rxBytes, 400, "Wrong number of sampled bytes received");
+    NS_TEST_EXPECT_MSG_EQ(stats.timesForwarded, 4, "Wrong number of sampled forwards");
+    NS_TEST_EXPECT_MSG_EQ(stats.lostPackets, 1, "Wrong number of sampled packets dropped");
+    NS_TEST_ASSERT_MSG_EQ(stats.packetsDropped.size(), 1, "Wrong drop reasons");
+    NS_TEST_EXPECT_MSG_EQ(stats.packetsDropped[0], 1, "Wrong number of sampled packets dropped");
+    NS_TEST_EXPECT_MSG_EQ(stats.delaySum, Seconds(0.4), "Wrong delay of the sampled packets");
+
+    // the dropped packet is no longer in flight
+    monitor->CheckForLostPackets(Seconds(0));
+    NS_TEST_EXPECT_MSG_EQ(monitor->GetFlowStats().at(1).lostPackets,
+                          1,
+                          "The dropped packet is lost again");
+
+    monitor->Dispose();
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup flow-monitor-test
+ *
+ * \brief FlowMonitor TestSuite
+ */
+class FlowMonitorTestSuite : public TestSuite
+{
+  public:
+    FlowMonitorTestSuite();
+};
+
+FlowMonitorTestSuite::FlowMonitorTestSuite()
+    : TestSuite("flow-monitor", UNIT)
+{
+    AddTestCase(new FlowMonitorExpiryTestCase, TestCase::QUICK);
+    AddTestCase(new FlowMonitorSamplingTestCase, TestCase::QUICK);
+}
+
+static FlowMonitorTestSuite g_flowMonitorTestSuite; //!< Static variable for test initialization
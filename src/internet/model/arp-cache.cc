@@ -30,6 +30,8 @@
 #include "ns3/trace-source-accessor.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -199,9 +201,12 @@ ArpCache::HandleWaitReplyTimeout()
     NS_LOG_FUNCTION(this);
     ArpCache::Entry* entry;
     bool restartWaitReplyTimer = false;
-    for (auto i = m_arpCache.begin(); i != m_arpCache.end(); i++)
+    // The entries which are marked dead leave the set of the WaitReply entries.
+    std::vector<Ipv4Address> waitReply(m_waitReplyEntries.begin(), m_waitReplyEntries.end());
+    for (auto i = waitReply.begin(); i != waitReply.end(); i++)
     {
-        entry = (*i).second;
+        auto it = m_arpCache.find(*i);
+        entry = it != m_arpCache.end() ? it->second : nullptr;
         if (entry != nullptr && entry->IsWaitReply())
         {
             if (entry->GetRetries() < m_maxRetries)
@@ -250,6 +255,8 @@ ArpCache::Flush()
         delete (*i).second;
     }
     m_arpCache.erase(m_arpCache.begin(), m_arpCache.end());
+    m_macEntries.clear();
+    m_waitReplyEntries.clear();
     if (m_waitReplyTimer.IsRunning())
     {
         NS_LOG_LOGIC("Stopping WaitReplyTimer at " << Simulator::Now().GetSeconds()
@@ -264,7 +271,13 @@ ArpCache::PrintArpCache(Ptr<OutputStreamWrapper> stream)
     NS_LOG_FUNCTION(this << stream);
     std::ostream* os = stream->GetStream();
 
-    for (auto i = m_arpCache.begin(); i != m_arpCache.end(); i++)
+    // print the entries in the order of their addresses
+    std::vector<std::pair<Ipv4Address, ArpCache::Entry*>> entries(m_arpCache.begin(),
+                                                                   m_arpCache.end());
+    std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+    for (auto i = entries.begin(); i != entries.end(); i++)
     {
         *os << i->first << " dev ";
         std::string found = Names::FindName(m_device);
@@ -311,6 +324,7 @@ ArpCache::RemoveAutoGeneratedEntries()
         if (i->second->IsAutoGenerated())
         {
             i->second->ClearPendingPacket(); // clear the pending packets for entry's ipaddress
+            EraseMacEntry(i->second);
             delete i->second;
             m_arpCache.erase(i++);
             continue;
@@ -325,13 +339,13 @@ ArpCache::LookupInverse(Address to)
     NS_LOG_FUNCTION(this << to);
 
     std::list<ArpCache::Entry*> entryList;
-    for (auto i = m_arpCache.begin(); i != m_arpCache.end(); i++)
+    auto entries = m_macEntries.find(to);
+    if (entries != m_macEntries.end())
     {
-        ArpCache::Entry* entry = (*i).second;
-        if (entry->GetMacAddress() == to)
-        {
-            entryList.push_back(entry);
-        }
+        entryList.assign(entries->second.begin(), entries->second.end());
+        entryList.sort([](ArpCache::Entry* a, ArpCache::Entry* b) {
+            return a->GetIpv4Address() < b->GetIpv4Address();
+        });
     }
     return entryList;
 }
@@ -357,6 +371,7 @@ ArpCache::Add(Ipv4Address to)
     auto entry = new ArpCache::Entry(this);
     m_arpCache[to] = entry;
     entry->SetIpv4Address(to);
+    InsertMacEntry(entry);
     return entry;
 }
 
@@ -365,17 +380,37 @@ ArpCache::Remove(ArpCache::Entry* entry)
 {
     NS_LOG_FUNCTION(this << entry);
 
-    for (auto i = m_arpCache.begin(); i != m_arpCache.end(); i++)
+    auto i = m_arpCache.find(entry->GetIpv4Address());
+    if (i != m_arpCache.end() && (*i).second == entry)
+    {
+        m_arpCache.erase(i);
+        EraseMacEntry(entry);
+        m_waitReplyEntries.erase(entry->GetIpv4Address());
+        entry->ClearPendingPacket(); // clear the pending packets for entry's ipaddress
+        delete entry;
+        return;
+    }
+    NS_LOG_WARN("Entry not found in this ARP Cache");
+}
+
+void
+ArpCache::InsertMacEntry(ArpCache::Entry* entry)
+{
+    m_macEntries[entry->GetMacAddress()].push_back(entry);
+}
+
+void
+ArpCache::EraseMacEntry(ArpCache::Entry* entry)
+{
+    auto entries = m_macEntries.find(entry->GetMacAddress());
+    if (entries != m_macEntries.end())
     {
-        if ((*i).second == entry)
+        std::erase(entries->second, entry);
+        if (entries->second.empty())
         {
-            m_arpCache.erase(i);
-            entry->ClearPendingPacket(); // clear the pending packets for entry's ipaddress
-            delete entry;
-            return;
+            m_macEntries.erase(entries);
         }
     }
-    NS_LOG_WARN("Entry not found in this ARP Cache");
 }
 
 ArpCache::Entry::Entry(ArpCache* arp)
@@ -426,6 +461,7 @@ ArpCache::Entry::MarkDead()
 {
     NS_LOG_FUNCTION(this);
     NS_ASSERT(m_state == ALIVE || m_state == WAIT_REPLY || m_state == DEAD);
+    m_arp->m_waitReplyEntries.erase(m_ipv4Address);
     m_state = DEAD;
     ClearRetries();
     UpdateSeen();
@@ -436,7 +472,8 @@ ArpCache::Entry::MarkAlive(Address macAddress)
 {
     NS_LOG_FUNCTION(this << macAddress);
     NS_ASSERT(m_state == WAIT_REPLY);
-    m_macAddress = macAddress;
+    SetMacAddress(macAddress);
+    m_arp->m_waitReplyEntries.erase(m_ipv4Address);
     m_state = ALIVE;
     ClearRetries();
     UpdateSeen();
@@ -448,6 +485,7 @@ ArpCache::Entry::MarkPermanent()
     NS_LOG_FUNCTION(this << m_macAddress);
     NS_ASSERT(!m_macAddress.IsInvalid());
 
+    m_arp->m_waitReplyEntries.erase(m_ipv4Address);
     m_state = PERMANENT;
     ClearRetries();
     UpdateSeen();
@@ -459,6 +497,7 @@ ArpCache::Entry::MarkAutoGenerated()
     NS_LOG_FUNCTION(this << m_macAddress);
     NS_ASSERT(!m_macAddress.IsInvalid());
 
+    m_arp->m_waitReplyEntries.erase(m_ipv4Address);
     m_state = STATIC_AUTOGENERATED;
     ClearRetries();
     UpdateSeen();
@@ -490,6 +529,7 @@ ArpCache::Entry::MarkWaitReply(Ipv4PayloadHeaderPair waiting)
     NS_ASSERT_MSG(waiting.first, "Can not add a null packet to the ARP queue");
 
     m_state = WAIT_REPLY;
+    m_arp->m_waitReplyEntries.insert(m_ipv4Address);
     m_pending.push_back(waiting);
     UpdateSeen();
     m_arp->StartWaitReplyTimer();
@@ -506,7 +546,9 @@ void
 ArpCache::Entry::SetMacAddress(Address macAddress)
 {
     NS_LOG_FUNCTION(this);
+    m_arp->EraseMacEntry(this);
     m_macAddress = macAddress;
+    m_arp->InsertMacEntry(this);
 }
 
 Ipv4Address
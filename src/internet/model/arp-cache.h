@@ -33,7 +33,10 @@
 
 #include <list>
 #include <map>
+#include <set>
 #include <stdint.h>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -321,14 +324,25 @@ class ArpCache : public Object
     /**
      * \brief ARP Cache container
      */
-    typedef std::map<Ipv4Address, ArpCache::Entry*> Cache;
+    typedef std::unordered_map<Ipv4Address, ArpCache::Entry*, Ipv4AddressHash> Cache;
     /**
      * \brief ARP Cache container iterator
      */
-    typedef std::map<Ipv4Address, ArpCache::Entry*>::iterator CacheI;
+    typedef Cache::iterator CacheI;
 
     void DoDispose() override;
 
+    /**
+     * \brief Add an entry to the index of the entries by MAC address
+     * \param entry the entry
+     */
+    void InsertMacEntry(ArpCache::Entry* entry);
+    /**
+     * \brief Remove an entry from the index of the entries by MAC address
+     * \param entry the entry
+     */
+    void EraseMacEntry(ArpCache::Entry* entry);
+
     Ptr<NetDevice> m_device;        //!< NetDevice associated with the cache
     Ptr<Ipv4Interface> m_interface; //!< Ipv4Interface associated with the cache
     Time m_aliveTimeout;            //!< cache alive state timeout
@@ -347,6 +361,9 @@ class ArpCache : public Object
     void HandleWaitReplyTimeout();
     uint32_t m_pendingQueueSize; //!< number of packets waiting for a resolution
     Cache m_arpCache;            //!< the ARP cache
+    std::map<Address, std::vector<ArpCache::Entry*>>
+        m_macEntries;                         //!< the entries of the cache, by MAC address
+    std::set<Ipv4Address> m_waitReplyEntries; //!< the addresses of the entries in WaitReply state
     TracedCallback<Ptr<const Packet>>
         m_dropTrace; //!< trace for packets dropped by the ARP cache queue
 };
@@ -58,20 +58,30 @@ operator<<(std::ostream& os, const SPFVertex::VertexType& t)
 std::ostream&
 operator<<(std::ostream& os, const CandidateQueue& q)
 {
-    const CandidateQueue::CandidateList_t& list = q.m_candidates;
+    // print the candidates in the order in which they are popped
+    std::vector<std::size_t> positions(q.m_candidates.size());
+    for (std::size_t i = 0; i < positions.size(); i++)
+    {
+        positions[i] = i;
+    }
+    std::sort(positions.begin(), positions.end(), [&q](std::size_t i, std::size_t j) {
+        return q.IsBefore(i, j);
+    });
 
     os << "*** CandidateQueue Begin (<id, distance, LSA-type>) ***" << std::endl;
-    for (auto iter = list.begin(); iter != list.end(); iter++)
+    for (std::size_t i : positions)
     {
-        os << "<" << (*iter)->GetVertexId() << ", " << (*iter)->GetDistanceFromRoot() << ", "
-           << (*iter)->GetVertexType() << ">" << std::endl;
+        const SPFVertex* v = q.m_candidates[i].vertex;
+        os << "<" << v->GetVertexId() << ", " << v->GetDistanceFromRoot() << ", "
+           << v->GetVertexType() << ">" << std::endl;
     }
     os << "*** CandidateQueue End ***";
     return os;
 }
 
 CandidateQueue::CandidateQueue()
-    : m_candidates()
+    : m_candidates(),
+      m_order(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -86,12 +96,12 @@ void
 CandidateQueue::Clear()
 {
     NS_LOG_FUNCTION(this);
-    while (!m_candidates.empty())
+    for (auto& candidate : m_candidates)
     {
-        SPFVertex* p = Pop();
-        delete p;
-        p = nullptr;
+        delete candidate.vertex;
     }
+    m_candidates.clear();
+    m_positions.clear();
 }
 
 void
@@ -99,11 +109,9 @@ CandidateQueue::Push(SPFVertex* vNew)
 {
     NS_LOG_FUNCTION(this << vNew);
 
-    auto i = std::upper_bound(m_candidates.begin(),
-                              m_candidates.end(),
-                              vNew,
-                              &CandidateQueue::CompareSPFVertex);
-    m_candidates.insert(i, vNew);
+    m_candidates.push_back({vNew, m_order++});
+    m_positions[vNew->GetVertexId()] = m_candidates.size() - 1;
+    SiftUp(m_candidates.size() - 1);
 }
 
 SPFVertex*
@@ -115,8 +123,11 @@ CandidateQueue::Pop()
         return nullptr;
     }
 
-    SPFVertex* v = m_candidates.front();
-    m_candidates.pop_front();
+    SPFVertex* v = m_candidates.front().vertex;
+    Swap(0, m_candidates.size() - 1);
+    m_candidates.pop_back();
+    m_positions.erase(v->GetVertexId());
+    SiftDown(0);
     return v;
 }
 
@@ -129,7 +140,7 @@ CandidateQueue::Top() const
         return nullptr;
     }
 
-    return m_candidates.front();
+    return m_candidates.front().vertex;
 }
 
 bool
@@ -150,18 +161,12 @@ SPFVertex*
 CandidateQueue::Find(const Ipv4Address addr) const
 {
     NS_LOG_FUNCTION(this);
-    auto i = m_candidates.begin();
-
-    for (; i != m_candidates.end(); i++)
+    auto i = m_positions.find(addr);
+    if (i == m_positions.end())
     {
-        SPFVertex* v = *i;
-        if (v->GetVertexId() == addr)
-        {
-            return v;
-        }
+        return nullptr;
     }
-
-    return nullptr;
+    return m_candidates[i->second].vertex;
 }
 
 void
@@ -169,11 +174,86 @@ CandidateQueue::Reorder()
 {
     NS_LOG_FUNCTION(this);
 
-    m_candidates.sort(&CandidateQueue::CompareSPFVertex);
+    for (std::size_t i = m_candidates.size() / 2; i > 0; i--)
+    {
+        SiftDown(i - 1);
+    }
+    NS_LOG_LOGIC("After reordering the CandidateQueue");
+    NS_LOG_LOGIC(*this);
+}
+
+void
+CandidateQueue::Reorder(SPFVertex* v)
+{
+    NS_LOG_FUNCTION(this << v);
+
+    auto i = m_positions.find(v->GetVertexId());
+    NS_ASSERT_MSG(i != m_positions.end() && m_candidates[i->second].vertex == v,
+                  "The vertex " << v->GetVertexId() << " is not in the queue");
+    m_candidates[i->second].order = m_order++;
+    SiftDown(SiftUp(i->second));
     NS_LOG_LOGIC("After reordering the CandidateQueue");
     NS_LOG_LOGIC(*this);
 }
 
+bool
+CandidateQueue::IsBefore(std::size_t i, std::size_t j) const
+{
+    const Candidate& ci = m_candidates[i];
+    const Candidate& cj = m_candidates[j];
+    if (CompareSPFVertex(ci.vertex, cj.vertex))
+    {
+        return true;
+    }
+    if (CompareSPFVertex(cj.vertex, ci.vertex))
+    {
+        return false;
+    }
+    return ci.order < cj.order;
+}
+
+void
+CandidateQueue::Swap(std::size_t i, std::size_t j)
+{
+    std::swap(m_candidates[i], m_candidates[j]);
+    m_positions[m_candidates[i].vertex->GetVertexId()] = i;
+    m_positions[m_candidates[j].vertex->GetVertexId()] = j;
+}
+
+std::size_t
+CandidateQueue::SiftUp(std::size_t i)
+{
+    while (i > 0 && IsBefore(i, (i - 1) / 2))
+    {
+        Swap(i, (i - 1) / 2);
+        i = (i - 1) / 2;
+    }
+    return i;
+}
+
+void
+CandidateQueue::SiftDown(std::size_t i)
+{
+    for (;;)
+    {
+        std::size_t first = i;
+        for (std::size_t child = 2 * i + 1; child <= 2 * i + 2 && child < m_candidates.size();
+             child++)
+        {
+            if (IsBefore(child, first))
+            {
+                first = child;
+            }
+        }
+        if (first == i)
+        {
+            return;
+        }
+        Swap(i, first);
+        i = first;
+    }
+}
+
 /*
  * In this implementation, SPFVertex follows the ordering where
  * a vertex is ranked first if its GetDistanceFromRoot () is smaller;
@@ -22,8 +22,9 @@
 
 #include "ns3/ipv4-address.h"
 
-#include <list>
 #include <stdint.h>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -47,7 +48,10 @@ class SPFVertex;
  * Although a STL priority_queue almost does what we want, the requirement
  * for a Find () operation, the dynamic nature of the data and the derived
  * requirement for a Reorder () operation led us to implement this simple
- * enhanced priority queue.
+ * enhanced priority queue.  It is a binary heap, with an index of the
+ * positions of the vertices for Find () and for reordering a single vertex.
+ * The vertices with the same priority are popped in the order in which they
+ * were pushed.
  */
 class CandidateQueue
 {
@@ -159,6 +163,18 @@ class CandidateQueue
      */
     void Reorder();
 
+    /**
+     * @brief Reorders the Candidate Queue after the m_distanceFromRoot of a
+     * vertex in the queue decreased.
+     *
+     * The vertex is then ordered after the other vertices with the same
+     * priority, as if it was pushed again.
+     *
+     * @see SPFVertex
+     * @param v The Shortest Path First Vertex whose distance changed.
+     */
+    void Reorder(SPFVertex* v);
+
   private:
     /**
      * \brief return true if v1 < v2
@@ -173,8 +189,47 @@ class CandidateQueue
      */
     static bool CompareSPFVertex(const SPFVertex* v1, const SPFVertex* v2);
 
-    typedef std::list<SPFVertex*> CandidateList_t; //!< container of SPFVertex pointers
-    CandidateList_t m_candidates;                  //!< SPFVertex candidates
+    /// A vertex in the queue
+    struct Candidate
+    {
+        SPFVertex* vertex; //!< The vertex
+        uint64_t order;    //!< The order of the vertices with the same priority
+    };
+
+    /**
+     * \brief return true if the candidate at position i should be popped
+     * before the candidate at position j
+     * \param i first position
+     * \param j second position
+     * \return True if the candidate i should be popped first
+     */
+    bool IsBefore(std::size_t i, std::size_t j) const;
+
+    /**
+     * \brief Exchange two candidates, and update their positions.
+     * \param i first position
+     * \param j second position
+     */
+    void Swap(std::size_t i, std::size_t j);
+
+    /**
+     * \brief Move a candidate up the heap, until its parent is popped before it.
+     * \param i the position of the candidate
+     * \return the new position of the candidate
+     */
+    std::size_t SiftUp(std::size_t i);
+
+    /**
+     * \brief Move a candidate down the heap, until it is popped before its children.
+     * \param i the position of the candidate
+     */
+    void SiftDown(std::size_t i);
+
+    typedef std::vector<Candidate> CandidateList_t; //!< container of SPFVertex pointers
+    CandidateList_t m_candidates;                   //!< SPFVertex candidates, as a binary heap
+    /// The positions of the candidates in the heap, by vertex ID
+    std::unordered_map<Ipv4Address, std::size_t, Ipv4AddressHash> m_positions;
+    uint64_t m_order; //!< The order of the next vertex pushed
 
     /**
      * \brief Stream insertion operator.
@@ -30,13 +30,17 @@
 
 #include "ns3/assert.h"
 #include "ns3/fatal-error.h"
+#include "ns3/global-value.h"
 #include "ns3/log.h"
 #include "ns3/node-list.h"
 #include "ns3/simulator.h"
+#include "ns3/uinteger.h"
 
 #include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <queue>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -45,6 +49,18 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("GlobalRouteManagerImpl");
 
+/**
+ * \ingroup globalrouting
+ * \anchor GlobalValueGlobalRoutingSpfThreads
+ * The number of threads running the SPF calculations of the routers.
+ */
+static GlobalValue g_spfThreads =
+    GlobalValue("GlobalRoutingSpfThreads",
+                "The number of threads computing the SPF trees of the routers concurrently "
+                "(only used in builds with NS3_MTP)",
+                UintegerValue(1),
+                MakeUintegerChecker<uint32_t>(1));
+
 /**
  * \brief Stream insertion operator.
  *
@@ -471,7 +487,25 @@ GlobalRouteManagerLSDB::Insert(Ipv4Address addr, GlobalRoutingLSA* lsa)
     }
     else
     {
-        m_database.insert(LSDBPair_t(addr, lsa));
+        auto inserted = m_database.insert(LSDBPair_t(addr, lsa));
+        if (!inserted.second)
+        {
+            return;
+        }
+        // GetLSAByLinkData () returns the first LSA of the database with the link data
+        for (uint32_t j = 0; j < lsa->GetNLinkRecords(); j++)
+        {
+            GlobalRoutingLinkRecord* lr = lsa->GetLinkRecord(j);
+            if (lr->GetLinkType() != GlobalRoutingLinkRecord::TransitNetwork)
+            {
+                continue;
+            }
+            auto linkData = m_linkData.emplace(lr->GetLinkData(), inserted.first);
+            if (!linkData.second && addr < linkData.first->second->first)
+            {
+                linkData.first->second = inserted.first;
+            }
+        }
     }
 }
 
@@ -496,12 +530,10 @@ GlobalRouteManagerLSDB::GetLSA(Ipv4Address addr) const
     //
     // Look up an LSA by its address.
     //
-    for (auto i = m_database.begin(); i != m_database.end(); i++)
+    auto i = m_database.find(addr);
+    if (i != m_database.end())
     {
-        if (i->first == addr)
-        {
-            return i->second;
-        }
+        return i->second;
     }
     return nullptr;
 }
@@ -511,21 +543,12 @@ GlobalRouteManagerLSDB::GetLSAByLinkData(Ipv4Address addr) const
 {
     NS_LOG_FUNCTION(this << addr);
     //
-    // Look up an LSA by its address.
+    // Look up an LSA by the link data of its TransitNetwork link records.
     //
-    for (auto i = m_database.begin(); i != m_database.end(); i++)
+    auto i = m_linkData.find(addr);
+    if (i != m_linkData.end())
     {
-        GlobalRoutingLSA* temp = i->second;
-        // Iterate among temp's Link Records
-        for (uint32_t j = 0; j < temp->GetNLinkRecords(); j++)
-        {
-            GlobalRoutingLinkRecord* lr = temp->GetLinkRecord(j);
-            if (lr->GetLinkType() == GlobalRoutingLinkRecord::TransitNetwork &&
-                lr->GetLinkData() == addr)
-            {
-                return temp;
-            }
-        }
+        return i->second->second;
     }
     return nullptr;
 }
@@ -537,7 +560,6 @@ GlobalRouteManagerLSDB::GetLSAByLinkData(Ipv4Address addr) const
 // ---------------------------------------------------------------------------
 
 GlobalRouteManagerImpl::GlobalRouteManagerImpl()
-    : m_spfroot(nullptr)
 {
     NS_LOG_FUNCTION(this);
     m_lsdb = new GlobalRouteManagerLSDB();
@@ -696,6 +718,7 @@ GlobalRouteManagerImpl::InitializeRoutes()
     // Walk the list of nodes in the system.
     //
     NS_LOG_INFO("About to start SPF calculation");
+    std::vector<std::pair<Ipv4Address, Ptr<Node>>> roots;
     for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
     {
         Ptr<Node> node = *i;
@@ -718,8 +741,45 @@ GlobalRouteManagerImpl::InitializeRoutes()
         //
         if (rtr && rtr->GetNumLSAs())
         {
-            SPFCalculate(rtr->GetRouterId());
+            roots.emplace_back(rtr->GetRouterId(), node);
+        }
+    }
+    //
+    // The calculations only read the LSDB and each one writes the routes of
+    // its own root, so they can be spread over several threads.  The Ptr
+    // reference counts are only atomic with NS3_MTP, and the logs of the
+    // calculations would be interleaved.
+    //
+    UintegerValue threads;
+    g_spfThreads.GetValue(threads);
+    std::size_t nThreads = std::min<std::size_t>(threads.Get(), roots.size());
+#ifndef NS3_MTP
+    if (nThreads > 1)
+    {
+        NS_LOG_WARN("GlobalRoutingSpfThreads is ignored in builds without NS3_MTP");
+        nThreads = 1;
+    }
+#endif
+    if (!g_log.IsNoneEnabled())
+    {
+        nThreads = 1;
+    }
+    std::atomic<std::size_t> next{0};
+    auto calculate = [this, &roots, &next]() {
+        for (std::size_t i = next++; i < roots.size(); i = next++)
+        {
+            SPFCalculate(roots[i].first, roots[i].second);
         }
+    };
+    std::vector<std::thread> workers;
+    for (std::size_t i = 1; i < nThreads; ++i)
+    {
+        workers.emplace_back(calculate);
+    }
+    calculate();
+    for (auto& worker : workers)
+    {
+        worker.join();
     }
     NS_LOG_INFO("Finished SPF calculation");
 }
@@ -738,7 +798,7 @@ GlobalRouteManagerImpl::InitializeRoutes()
 // vertex already on the candidate list, store the new (lower) cost.
 //
 void
-GlobalRouteManagerImpl::SPFNext(SPFVertex* v, CandidateQueue& candidate)
+GlobalRouteManagerImpl::SPFNext(SPFCalculation& calc, SPFVertex* v, CandidateQueue& candidate)
 {
     NS_LOG_FUNCTION(this << v << &candidate);
 
@@ -827,7 +887,8 @@ GlobalRouteManagerImpl::SPFNext(SPFVertex* v, CandidateQueue& candidate)
         // If the link is to a router that is already in the shortest path first tree
         // then we have it covered -- ignore it.
         //
-        if (w_lsa->GetStatus() == GlobalRoutingLSA::LSA_SPF_IN_SPFTREE)
+        GlobalRoutingLSA::SPFStatus w_status = calc.GetStatus(w_lsa);
+        if (w_status == GlobalRoutingLSA::LSA_SPF_IN_SPFTREE)
         {
             NS_LOG_LOGIC("Skipping ->  LSA " << w_lsa->GetLinkStateId() << " already in SPF tree");
             continue;
@@ -851,7 +912,7 @@ GlobalRouteManagerImpl::SPFNext(SPFVertex* v, CandidateQueue& candidate)
         NS_LOG_LOGIC("Considering w_lsa " << w_lsa->GetLinkStateId());
 
         // Is there already vertex w in candidate list?
-        if (w_lsa->GetStatus() == GlobalRoutingLSA::LSA_SPF_NOT_EXPLORED)
+        if (w_status == GlobalRoutingLSA::LSA_SPF_NOT_EXPLORED)
         {
             // Calculate nexthop to w
             // We need to figure out how to actually get to the new router represented
@@ -861,9 +922,9 @@ GlobalRouteManagerImpl::SPFNext(SPFVertex* v, CandidateQueue& candidate)
 
             // prepare vertex w
             w = new SPFVertex(w_lsa);
-            if (SPFNexthopCalculation(v, w, l, distance))
+            if (SPFNexthopCalculation(calc, v, w, l, distance))
             {
-                w_lsa->SetStatus(GlobalRoutingLSA::LSA_SPF_CANDIDATE);
+                calc.status[w_lsa] = GlobalRoutingLSA::LSA_SPF_CANDIDATE;
                 //
                 // Push this new vertex onto the priority queue (ordered by distance from the
                 // root node).
@@ -880,7 +941,7 @@ GlobalRouteManagerImpl::SPFNext(SPFVertex* v, CandidateQueue& candidate)
                                   << "return false, but it does now!");
             }
         }
-        else if (w_lsa->GetStatus() == GlobalRoutingLSA::LSA_SPF_CANDIDATE)
+        else if (w_status == GlobalRoutingLSA::LSA_SPF_CANDIDATE)
         {
             //
             // We have already considered the link represented by <w>.  What wse have to
@@ -927,7 +988,7 @@ GlobalRouteManagerImpl::SPFNext(SPFVertex* v, CandidateQueue& candidate)
 
                 // prepare vertex w
                 w = new SPFVertex(w_lsa);
-                SPFNexthopCalculation(v, w, l, distance);
+                SPFNexthopCalculation(calc, v, w, l, distance);
                 cw->MergeRootExitDirections(w);
                 cw->MergeParent(w);
                 // SPFVertexAddParent (w) is necessary as the destructor of
@@ -946,13 +1007,13 @@ GlobalRouteManagerImpl::SPFNext(SPFVertex* v, CandidateQueue& candidate)
                 // N.B. the nexthop_calculation is conditional, if it finds a valid nexthop
                 // it will call spf_add_parents, which will flush the old parents
                 //
-                if (SPFNexthopCalculation(v, cw, l, distance))
+                if (SPFNexthopCalculation(calc, v, cw, l, distance))
                 {
                     //
                     // If we've changed the cost to get to the vertex represented by <w>, we
                     // must reorder the priority queue keyed to that cost.
                     //
-                    candidate.Reorder();
+                    candidate.Reorder(cw);
                 }
             } // new lower cost path found
         }     // end W is already on the candidate list
@@ -970,7 +1031,8 @@ GlobalRouteManagerImpl::SPFNext(SPFVertex* v, CandidateQueue& candidate)
 // For now, this is greatly simplified from the quagga code
 //
 int
-GlobalRouteManagerImpl::SPFNexthopCalculation(SPFVertex* v,
+GlobalRouteManagerImpl::SPFNexthopCalculation(const SPFCalculation& calc,
+                                              SPFVertex* v,
                                               SPFVertex* w,
                                               GlobalRoutingLinkRecord* l,
                                               uint32_t distance)
@@ -986,7 +1048,7 @@ GlobalRouteManagerImpl::SPFNexthopCalculation(SPFVertex* v,
     */
 
     //
-    // The vertex m_spfroot is a distinguished vertex representing the node at
+    // The vertex calc.root is a distinguished vertex representing the node at
     // the root of the calculations.  That is, it is the node for which we are
     // calculating the routes.
     //
@@ -1008,7 +1070,7 @@ GlobalRouteManagerImpl::SPFNexthopCalculation(SPFVertex* v,
     // The point-to-point link information is only useful in this calculation when
     // we are examining the root node.
     //
-    if (v == m_spfroot)
+    if (v == calc.root)
     {
         //
         // In this case <v> is the root node, which means it is the starting point
@@ -1053,7 +1115,7 @@ GlobalRouteManagerImpl::SPFNexthopCalculation(SPFVertex* v,
             // from the perspective of <v> -- remember that <l> is the link "from"
             // <v> "to" <w>.
             //
-            uint32_t outIf = FindOutgoingInterfaceId(l->GetLinkData());
+            uint32_t outIf = FindOutgoingInterfaceId(calc, l->GetLinkData());
 
             w->SetRootExitDirection(nextHop, outIf);
             w->SetDistanceFromRoot(distance);
@@ -1070,8 +1132,9 @@ GlobalRouteManagerImpl::SPFNexthopCalculation(SPFVertex* v,
             GlobalRoutingLSA* w_lsa = w->GetLSA();
             NS_ASSERT(w_lsa->GetLSType() == GlobalRoutingLSA::NetworkLSA);
             // Find outgoing interface ID for this network
-            uint32_t outIf =
-                FindOutgoingInterfaceId(w_lsa->GetLinkStateId(), w_lsa->GetNetworkLSANetworkMask());
+            uint32_t outIf = FindOutgoingInterfaceId(calc,
+                                                     w_lsa->GetLinkStateId(),
+                                                     w_lsa->GetNetworkLSANetworkMask());
             // Set the next hop to 0.0.0.0 meaning "not exist"
             Ipv4Address nextHop = Ipv4Address::GetZero();
             w->SetRootExitDirection(nextHop, outIf);
@@ -1086,7 +1149,7 @@ GlobalRouteManagerImpl::SPFNexthopCalculation(SPFVertex* v,
     else if (v->GetVertexType() == SPFVertex::VertexNetwork)
     {
         // See if any of v's parents are the root
-        if (v->GetParent() == m_spfroot)
+        if (v->GetParent() == calc.root)
         {
             // 16.1.1 para 5. ...the parent vertex is a network that
             // directly connects the calculating router to the destination
@@ -1234,7 +1297,7 @@ void
 GlobalRouteManagerImpl::DebugSPFCalculate(Ipv4Address root)
 {
     NS_LOG_FUNCTION(this << root);
-    SPFCalculate(root);
+    SPFCalculate(root, FindRouterNode(root));
 }
 
 //
@@ -1244,10 +1307,11 @@ GlobalRouteManagerImpl::DebugSPFCalculate(Ipv4Address root)
 // to be run
 //
 bool
-GlobalRouteManagerImpl::CheckForStubNode(Ipv4Address root)
+GlobalRouteManagerImpl::CheckForStubNode(const SPFCalculation& calc)
 {
-    NS_LOG_FUNCTION(this << root);
-    GlobalRoutingLSA* rlsa = m_lsdb->GetLSA(root);
+    NS_LOG_FUNCTION(this);
+    Ipv4Address root = calc.root->GetVertexId();
+    GlobalRoutingLSA* rlsa = calc.root->GetLSA();
     Ipv4Address myRouterId = rlsa->GetLinkStateId();
     int transits = 0;
     GlobalRoutingLinkRecord* transitLink = nullptr;
@@ -1314,11 +1378,11 @@ GlobalRouteManagerImpl::CheckForStubNode(Ipv4Address root)
                     gr->AddNetworkRouteTo(Ipv4Address("0.0.0.0"),
                                           Ipv4Mask("0.0.0.0"),
                                           lr->GetLinkData(),
-                                          FindOutgoingInterfaceId(transitLink->GetLinkData()));
+                                          FindOutgoingInterfaceId(calc, transitLink->GetLinkData()));
                     NS_LOG_LOGIC("Inserting default route for node "
                                  << myRouterId << " to next hop " << lr->GetLinkData()
                                  << " via interface "
-                                 << FindOutgoingInterfaceId(transitLink->GetLinkData()));
+                                 << FindOutgoingInterfaceId(calc, transitLink->GetLinkData()));
                     return true;
                 }
             }
@@ -1329,15 +1393,17 @@ GlobalRouteManagerImpl::CheckForStubNode(Ipv4Address root)
 
 // quagga ospf_spf_calculate
 void
-GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
+GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root, Ptr<Node> node)
 {
-    NS_LOG_FUNCTION(this << root);
+    NS_LOG_FUNCTION(this << root << node);
 
     SPFVertex* v;
     //
-    // Initialize the Link State Database.
+    // The SPF status of the LSAs is kept by the calculation, as the other
+    // roots may be calculated at the same time: the LSAs which are not
+    // in it have not been explored yet.
     //
-    m_lsdb->Initialize();
+    SPFCalculation calc;
     //
     // The candidate queue is a priority queue of SPFVertex objects, with the top
     // of the queue being the closest vertex in terms of distance from the root
@@ -1355,9 +1421,10 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
     // This vertex is the root of the SPF tree and it is distance 0 from the root.
     // We also mark this vertex as being in the SPF tree.
     //
-    m_spfroot = v;
+    calc.root = v;
+    calc.rootNode = node;
     v->SetDistanceFromRoot(0);
-    v->GetLSA()->SetStatus(GlobalRoutingLSA::LSA_SPF_IN_SPFTREE);
+    calc.status[v->GetLSA()] = GlobalRoutingLSA::LSA_SPF_IN_SPFTREE;
     NS_LOG_LOGIC("Starting SPFCalculate for node " << root);
 
     //
@@ -1367,10 +1434,10 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
     // reached.  Instead, short-circuit this computation and just install
     // a default route in the CheckForStubNode() method.
     //
-    if (NodeList::GetNNodes() > 0 && CheckForStubNode(root))
+    if (NodeList::GetNNodes() > 0 && CheckForStubNode(calc))
     {
         NS_LOG_LOGIC("SPFCalculate truncated for stub node " << root);
-        delete m_spfroot;
+        delete calc.root;
         return;
     }
 
@@ -1390,7 +1457,7 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
         // shortest path).  If the new vertices represent shorter paths, we use them
         // and update the path cost.
         //
-        SPFNext(v, candidate);
+        SPFNext(calc, v, candidate);
         //
         // RFC2328 16.1. (3).
         //
@@ -1418,7 +1485,7 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
         // Update the status field of the vertex to indicate that it is in the SPF
         // tree.
         //
-        v->GetLSA()->SetStatus(GlobalRoutingLSA::LSA_SPF_IN_SPFTREE);
+        calc.status[v->GetLSA()] = GlobalRoutingLSA::LSA_SPF_IN_SPFTREE;
         //
         // The current vertex has a parent pointer.  By calling this rather oddly
         // named method (blame quagga) we add the current vertex to the list of
@@ -1457,11 +1524,11 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
         //
         if (v->GetVertexType() == SPFVertex::VertexRouter)
         {
-            SPFIntraAddRouter(v);
+            SPFIntraAddRouter(calc, v);
         }
         else if (v->GetVertexType() == SPFVertex::VertexNetwork)
         {
-            SPFIntraAddTransit(v);
+            SPFIntraAddTransit(calc, v);
         }
         else
         {
@@ -1476,13 +1543,13 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
     } // end for loop
 
     // Second stage of SPF calculation procedure
-    SPFProcessStubs(m_spfroot);
+    SPFProcessStubs(calc, calc.root);
     for (uint32_t i = 0; i < m_lsdb->GetNumExtLSAs(); i++)
     {
-        m_spfroot->ClearVertexProcessed();
+        calc.root->ClearVertexProcessed();
         GlobalRoutingLSA* extlsa = m_lsdb->GetExtLSA(i);
         NS_LOG_LOGIC("Processing External LSA with id " << extlsa->GetLinkStateId());
-        ProcessASExternals(m_spfroot, extlsa);
+        ProcessASExternals(calc, calc.root, extlsa);
     }
 
     //
@@ -1490,12 +1557,52 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
     // the SPF tree.  Delete all of the vertices and corresponding resources.  Go
     // possibly do it again for the next router.
     //
-    delete m_spfroot;
-    m_spfroot = nullptr;
+    delete calc.root;
+}
+
+GlobalRoutingLSA::SPFStatus
+GlobalRouteManagerImpl::SPFCalculation::GetStatus(const GlobalRoutingLSA* lsa) const
+{
+    auto it = status.find(lsa);
+    return it == status.end() ? GlobalRoutingLSA::LSA_SPF_NOT_EXPLORED : it->second;
+}
+
+Ptr<Node>
+GlobalRouteManagerImpl::FindRouterNode(Ipv4Address routerId) const
+{
+    NS_LOG_FUNCTION(this << routerId);
+    //
+    // The router LSA records the node which originated it.
+    //
+    GlobalRoutingLSA* lsa = m_lsdb->GetLSA(routerId);
+    if (lsa && NodeList::GetNNodes() > 0)
+    {
+        Ptr<Node> node = lsa->GetNode();
+        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
+        if (rtr && rtr->GetRouterId() == routerId)
+        {
+            return node;
+        }
+    }
+    //
+    // Otherwise, walk the list of nodes looking for the one that has the router ID.
+    //
+    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
+    {
+        Ptr<GlobalRouter> rtr = (*i)->GetObject<GlobalRouter>();
+        if (rtr && rtr->GetRouterId() == routerId)
+        {
+            return *i;
+        }
+    }
+    NS_LOG_LOGIC("Can't find the node of router " << routerId);
+    return nullptr;
 }
 
 void
-GlobalRouteManagerImpl::ProcessASExternals(SPFVertex* v, GlobalRoutingLSA* extlsa)
+GlobalRouteManagerImpl::ProcessASExternals(const SPFCalculation& calc,
+                                           SPFVertex* v,
+                                           GlobalRoutingLSA* extlsa)
 {
     NS_LOG_FUNCTION(this << v << extlsa);
     NS_LOG_LOGIC("Processing external for destination "
@@ -1508,7 +1615,7 @@ GlobalRouteManagerImpl::ProcessASExternals(SPFVertex* v, GlobalRoutingLSA* extls
         if ((rlsa->GetLinkStateId()) == (extlsa->GetAdvertisingRouter()))
         {
             NS_LOG_LOGIC("Found advertising router to destination");
-            SPFAddASExternal(extlsa, v);
+            SPFAddASExternal(calc, extlsa, v);
         }
     }
     for (uint32_t i = 0; i < v->GetNChildren(); i++)
@@ -1516,7 +1623,7 @@ GlobalRouteManagerImpl::ProcessASExternals(SPFVertex* v, GlobalRoutingLSA* extls
         if (!v->GetChild(i)->IsVertexProcessed())
         {
             NS_LOG_LOGIC("Vertex's child " << i << " not yet processed, processing...");
-            ProcessASExternals(v->GetChild(i), extlsa);
+            ProcessASExternals(calc, v->GetChild(i), extlsa);
             v->GetChild(i)->SetVertexProcessed(true);
         }
     }
@@ -1528,15 +1635,17 @@ GlobalRouteManagerImpl::ProcessASExternals(SPFVertex* v, GlobalRoutingLSA* extls
 //
 
 void
-GlobalRouteManagerImpl::SPFAddASExternal(GlobalRoutingLSA* extlsa, SPFVertex* v)
+GlobalRouteManagerImpl::SPFAddASExternal(const SPFCalculation& calc,
+                                         GlobalRoutingLSA* extlsa,
+                                         SPFVertex* v)
 {
     NS_LOG_FUNCTION(this << extlsa << v);
 
-    NS_ASSERT_MSG(m_spfroot, "GlobalRouteManagerImpl::SPFAddASExternal (): Root pointer not set");
+    NS_ASSERT_MSG(calc.root, "GlobalRouteManagerImpl::SPFAddASExternal (): Root pointer not set");
     // Two cases to consider: We are advertising the external ourselves
     // => No need to add anything
     // OR find best path to the advertising router
-    if (v->GetVertexId() == m_spfroot->GetVertexId())
+    if (v->GetVertexId() == calc.root->GetVertexId())
     {
         NS_LOG_LOGIC("External is on local host: " << v->GetVertexId() << "; returning");
         return;
@@ -1544,114 +1653,93 @@ GlobalRouteManagerImpl::SPFAddASExternal(GlobalRoutingLSA* extlsa, SPFVertex* v)
     NS_LOG_LOGIC("External is on remote host: " << extlsa->GetAdvertisingRouter()
                                                 << "; installing");
 
-    Ipv4Address routerId = m_spfroot->GetVertexId();
+    Ipv4Address routerId = calc.root->GetVertexId();
 
     NS_LOG_LOGIC("Vertex ID = " << routerId);
     //
-    // We need to walk the list of nodes looking for the one that has the router
-    // ID corresponding to the root vertex.  This is the one we're going to write
-    // the routing information to.
+    // The node of the root router is the one we're going to write the routing
+    // information to.
     //
-    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
+    Ptr<Node> node = calc.rootNode;
+    if (!node)
     {
-        Ptr<Node> node = *i;
-        //
-        // The router ID is accessible through the GlobalRouter interface, so we need
-        // to QI for that interface.  If there's no GlobalRouter interface, the node
-        // in question cannot be the router we want, so we continue.
-        //
-        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
+        NS_LOG_LOGIC("Can't find root node " << routerId);
+        return;
+    }
+    NS_LOG_LOGIC("Setting routes for node " << node->GetId());
+    //
+    // Routing information is updated using the Ipv4 interface.  We need to QI
+    // for that interface.  If the node is acting as an IP version 4 router, it
+    // should absolutely have an Ipv4 interface.
+    //
+    Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+    NS_ASSERT_MSG(ipv4,
+                  "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
+                  "QI for <Ipv4> interface failed");
+    //
+    // Get the Global Router Link State Advertisement from the vertex we're
+    // adding the routes to.  The LSA will have a number of attached Global Router
+    // Link Records corresponding to links off of that vertex / node.  We're going
+    // to be interested in the records corresponding to point-to-point links.
+    //
+    NS_ASSERT_MSG(v->GetLSA(),
+                  "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
+                  "Expected valid LSA in SPFVertex* v");
+    Ipv4Mask tempmask = extlsa->GetNetworkLSANetworkMask();
+    Ipv4Address tempip = extlsa->GetLinkStateId();
+    tempip = tempip.CombineMask(tempmask);
 
-        if (!rtr)
+    //
+    // Here's why we did all of that work.  We're going to add a host route to the
+    // host address found in the m_linkData field of the point-to-point link
+    // record.  In the case of a point-to-point link, this is the local IP address
+    // of the node connected to the link.  Each of these point-to-point links
+    // will correspond to a local interface that has an IP address to which
+    // the node at the root of the SPF tree can send packets.  The vertex <v>
+    // (corresponding to the node that has these links and interfaces) has
+    // an m_nextHop address precalculated for us that is the address to which the
+    // root node should send packets to be forwarded to these IP addresses.
+    // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
+    // which the packets should be send for forwarding.
+    //
+    Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
+    if (!router)
+    {
+        return;
+    }
+    Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
+    NS_ASSERT(gr);
+    // walk through all next-hop-IPs and out-going-interfaces for reaching
+    // the stub network gateway 'v' from the root node
+    for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
+    {
+        SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
+        Ipv4Address nextHop = exit.first;
+        int32_t outIf = exit.second;
+        if (outIf >= 0)
         {
-            NS_LOG_LOGIC("No GlobalRouter interface on node " << node->GetId());
-            continue;
+            gr->AddASExternalRouteTo(tempip, tempmask, nextHop, outIf);
+            NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                   << " add external network route to " << tempip
+                                   << " using next hop " << nextHop << " via interface "
+                                   << outIf);
         }
-        //
-        // If the router ID of the current node is equal to the router ID of the
-        // root of the SPF tree, then this node is the one for which we need to
-        // write the routing tables.
-        //
-        NS_LOG_LOGIC("Considering router " << rtr->GetRouterId());
-
-        if (rtr->GetRouterId() == routerId)
+        else
         {
-            NS_LOG_LOGIC("Setting routes for node " << node->GetId());
-            //
-            // Routing information is updated using the Ipv4 interface.  We need to QI
-            // for that interface.  If the node is acting as an IP version 4 router, it
-            // should absolutely have an Ipv4 interface.
-            //
-            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
-            NS_ASSERT_MSG(ipv4,
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "QI for <Ipv4> interface failed");
-            //
-            // Get the Global Router Link State Advertisement from the vertex we're
-            // adding the routes to.  The LSA will have a number of attached Global Router
-            // Link Records corresponding to links off of that vertex / node.  We're going
-            // to be interested in the records corresponding to point-to-point links.
-            //
-            NS_ASSERT_MSG(v->GetLSA(),
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "Expected valid LSA in SPFVertex* v");
-            Ipv4Mask tempmask = extlsa->GetNetworkLSANetworkMask();
-            Ipv4Address tempip = extlsa->GetLinkStateId();
-            tempip = tempip.CombineMask(tempmask);
-
-            //
-            // Here's why we did all of that work.  We're going to add a host route to the
-            // host address found in the m_linkData field of the point-to-point link
-            // record.  In the case of a point-to-point link, this is the local IP address
-            // of the node connected to the link.  Each of these point-to-point links
-            // will correspond to a local interface that has an IP address to which
-            // the node at the root of the SPF tree can send packets.  The vertex <v>
-            // (corresponding to the node that has these links and interfaces) has
-            // an m_nextHop address precalculated for us that is the address to which the
-            // root node should send packets to be forwarded to these IP addresses.
-            // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
-            // which the packets should be send for forwarding.
-            //
-            Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
-            if (!router)
-            {
-                continue;
-            }
-            Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
-            NS_ASSERT(gr);
-            // walk through all next-hop-IPs and out-going-interfaces for reaching
-            // the stub network gateway 'v' from the root node
-            for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
-            {
-                SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
-                Ipv4Address nextHop = exit.first;
-                int32_t outIf = exit.second;
-                if (outIf >= 0)
-                {
-                    gr->AddASExternalRouteTo(tempip, tempmask, nextHop, outIf);
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " add external network route to " << tempip
-                                           << " using next hop " << nextHop << " via interface "
-                                           << outIf);
-                }
-                else
-                {
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " NOT able to add network route to " << tempip
-                                           << " using next hop " << nextHop
-                                           << " since outgoing interface id is negative");
-                }
-            }
-            return;
-        } // if
-    }     // for
+            NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                   << " NOT able to add network route to " << tempip
+                                   << " using next hop " << nextHop
+                                   << " since outgoing interface id is negative");
+        }
+    }
+    return;
 }
 
 // Processing logic from RFC 2328, page 166 and quagga ospf_spf_process_stubs ()
 // stub link records will exist for point-to-point interfaces and for
 // broadcast interfaces for which no neighboring router can be found
 void
-GlobalRouteManagerImpl::SPFProcessStubs(SPFVertex* v)
+GlobalRouteManagerImpl::SPFProcessStubs(const SPFCalculation& calc, SPFVertex* v)
 {
     NS_LOG_FUNCTION(this << v);
     NS_LOG_LOGIC("Processing stubs for " << v->GetVertexId());
@@ -1667,7 +1755,7 @@ GlobalRouteManagerImpl::SPFProcessStubs(SPFVertex* v)
             if (l->GetLinkType() == GlobalRoutingLinkRecord::StubNetwork)
             {
                 NS_LOG_LOGIC("Found a Stub record to " << l->GetLinkId());
-                SPFIntraAddStub(l, v);
+                SPFIntraAddStub(calc, l, v);
                 continue;
             }
         }
@@ -1676,7 +1764,7 @@ GlobalRouteManagerImpl::SPFProcessStubs(SPFVertex* v)
     {
         if (!v->GetChild(i)->IsVertexProcessed())
         {
-            SPFProcessStubs(v->GetChild(i));
+            SPFProcessStubs(calc, v->GetChild(i));
             v->GetChild(i)->SetVertexProcessed(true);
         }
     }
@@ -1684,18 +1772,20 @@ GlobalRouteManagerImpl::SPFProcessStubs(SPFVertex* v)
 
 // RFC2328 16.1. second stage.
 void
-GlobalRouteManagerImpl::SPFIntraAddStub(GlobalRoutingLinkRecord* l, SPFVertex* v)
+GlobalRouteManagerImpl::SPFIntraAddStub(const SPFCalculation& calc,
+                                        GlobalRoutingLinkRecord* l,
+                                        SPFVertex* v)
 {
     NS_LOG_FUNCTION(this << l << v);
 
-    NS_ASSERT_MSG(m_spfroot, "GlobalRouteManagerImpl::SPFIntraAddStub (): Root pointer not set");
+    NS_ASSERT_MSG(calc.root, "GlobalRouteManagerImpl::SPFIntraAddStub (): Root pointer not set");
 
     // XXX simplified logic for the moment.  There are two cases to consider:
     // 1) the stub network is on this router; do nothing for now
     //    (already handled above)
     // 2) the stub network is on a remote router, so I should use the
     // same next hop that I use to get to vertex v
-    if (v->GetVertexId() == m_spfroot->GetVertexId())
+    if (v->GetVertexId() == calc.root->GetVertexId())
     {
         NS_LOG_LOGIC("Stub is on local host: " << v->GetVertexId() << "; returning");
         return;
@@ -1708,107 +1798,86 @@ GlobalRouteManagerImpl::SPFIntraAddStub(GlobalRoutingLinkRecord* l, SPFVertex* v
     // going to use this ID to discover which node it is that we're actually going
     // to update.
     //
-    Ipv4Address routerId = m_spfroot->GetVertexId();
+    Ipv4Address routerId = calc.root->GetVertexId();
 
     NS_LOG_LOGIC("Vertex ID = " << routerId);
     //
-    // We need to walk the list of nodes looking for the one that has the router
-    // ID corresponding to the root vertex.  This is the one we're going to write
-    // the routing information to.
+    // The node of the root router is the one we're going to write the routing
+    // information to.
     //
-    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
+    Ptr<Node> node = calc.rootNode;
+    if (!node)
     {
-        Ptr<Node> node = *i;
-        //
-        // The router ID is accessible through the GlobalRouter interface, so we need
-        // to QI for that interface.  If there's no GlobalRouter interface, the node
-        // in question cannot be the router we want, so we continue.
-        //
-        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
+        NS_LOG_LOGIC("Can't find root node " << routerId);
+        return;
+    }
+    NS_LOG_LOGIC("Setting routes for node " << node->GetId());
+    //
+    // Routing information is updated using the Ipv4 interface.  We need to QI
+    // for that interface.  If the node is acting as an IP version 4 router, it
+    // should absolutely have an Ipv4 interface.
+    //
+    Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+    NS_ASSERT_MSG(ipv4,
+                  "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
+                  "QI for <Ipv4> interface failed");
+    //
+    // Get the Global Router Link State Advertisement from the vertex we're
+    // adding the routes to.  The LSA will have a number of attached Global Router
+    // Link Records corresponding to links off of that vertex / node.  We're going
+    // to be interested in the records corresponding to point-to-point links.
+    //
+    NS_ASSERT_MSG(v->GetLSA(),
+                  "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
+                  "Expected valid LSA in SPFVertex* v");
+    Ipv4Mask tempmask(l->GetLinkData().Get());
+    Ipv4Address tempip = l->GetLinkId();
+    tempip = tempip.CombineMask(tempmask);
+    //
+    // Here's why we did all of that work.  We're going to add a host route to the
+    // host address found in the m_linkData field of the point-to-point link
+    // record.  In the case of a point-to-point link, this is the local IP address
+    // of the node connected to the link.  Each of these point-to-point links
+    // will correspond to a local interface that has an IP address to which
+    // the node at the root of the SPF tree can send packets.  The vertex <v>
+    // (corresponding to the node that has these links and interfaces) has
+    // an m_nextHop address precalculated for us that is the address to which the
+    // root node should send packets to be forwarded to these IP addresses.
+    // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
+    // which the packets should be send for forwarding.
+    //
 
-        if (!rtr)
+    Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
+    if (!router)
+    {
+        return;
+    }
+    Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
+    NS_ASSERT(gr);
+    // walk through all next-hop-IPs and out-going-interfaces for reaching
+    // the stub network gateway 'v' from the root node
+    for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
+    {
+        SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
+        Ipv4Address nextHop = exit.first;
+        int32_t outIf = exit.second;
+        if (outIf >= 0)
         {
-            NS_LOG_LOGIC("No GlobalRouter interface on node " << node->GetId());
-            continue;
+            gr->AddNetworkRouteTo(tempip, tempmask, nextHop, outIf);
+            NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                   << " add network route to " << tempip
+                                   << " using next hop " << nextHop << " via interface "
+                                   << outIf);
         }
-        //
-        // If the router ID of the current node is equal to the router ID of the
-        // root of the SPF tree, then this node is the one for which we need to
-        // write the routing tables.
-        //
-        NS_LOG_LOGIC("Considering router " << rtr->GetRouterId());
-
-        if (rtr->GetRouterId() == routerId)
+        else
         {
-            NS_LOG_LOGIC("Setting routes for node " << node->GetId());
-            //
-            // Routing information is updated using the Ipv4 interface.  We need to QI
-            // for that interface.  If the node is acting as an IP version 4 router, it
-            // should absolutely have an Ipv4 interface.
-            //
-            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
-            NS_ASSERT_MSG(ipv4,
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "QI for <Ipv4> interface failed");
-            //
-            // Get the Global Router Link State Advertisement from the vertex we're
-            // adding the routes to.  The LSA will have a number of attached Global Router
-            // Link Records corresponding to links off of that vertex / node.  We're going
-            // to be interested in the records corresponding to point-to-point links.
-            //
-            NS_ASSERT_MSG(v->GetLSA(),
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "Expected valid LSA in SPFVertex* v");
-            Ipv4Mask tempmask(l->GetLinkData().Get());
-            Ipv4Address tempip = l->GetLinkId();
-            tempip = tempip.CombineMask(tempmask);
-            //
-            // Here's why we did all of that work.  We're going to add a host route to the
-            // host address found in the m_linkData field of the point-to-point link
-            // record.  In the case of a point-to-point link, this is the local IP address
-            // of the node connected to the link.  Each of these point-to-point links
-            // will correspond to a local interface that has an IP address to which
-            // the node at the root of the SPF tree can send packets.  The vertex <v>
-            // (corresponding to the node that has these links and interfaces) has
-            // an m_nextHop address precalculated for us that is the address to which the
-            // root node should send packets to be forwarded to these IP addresses.
-            // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
-            // which the packets should be send for forwarding.
-            //
-
-            Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
-            if (!router)
-            {
-                continue;
-            }
-            Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
-            NS_ASSERT(gr);
-            // walk through all next-hop-IPs and out-going-interfaces for reaching
-            // the stub network gateway 'v' from the root node
-            for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
-            {
-                SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
-                Ipv4Address nextHop = exit.first;
-                int32_t outIf = exit.second;
-                if (outIf >= 0)
-                {
-                    gr->AddNetworkRouteTo(tempip, tempmask, nextHop, outIf);
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " add network route to " << tempip
-                                           << " using next hop " << nextHop << " via interface "
-                                           << outIf);
-                }
-                else
-                {
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " NOT able to add network route to " << tempip
-                                           << " using next hop " << nextHop
-                                           << " since outgoing interface id is negative");
-                }
-            }
-            return;
-        } // if
-    }     // for
+            NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                   << " NOT able to add network route to " << tempip
+                                   << " using next hop " << nextHop
+                                   << " since outgoing interface id is negative");
+        }
+    }
+    return;
 }
 
 //
@@ -1819,7 +1888,9 @@ GlobalRouteManagerImpl::SPFIntraAddStub(GlobalRoutingLinkRecord* l, SPFVertex* v
 // for routing assumes -1 to be a legal return value)
 //
 int32_t
-GlobalRouteManagerImpl::FindOutgoingInterfaceId(Ipv4Address a, Ipv4Mask amask)
+GlobalRouteManagerImpl::FindOutgoingInterfaceId(const SPFCalculation& calc,
+                                                Ipv4Address a,
+                                                Ipv4Mask amask)
 {
     NS_LOG_FUNCTION(this << a << amask);
     //
@@ -1830,60 +1901,38 @@ GlobalRouteManagerImpl::FindOutgoingInterfaceId(Ipv4Address a, Ipv4Mask amask)
     // node in order to iterate the interfaces and find the one corresponding to
     // the address in question.
     //
-    Ipv4Address routerId = m_spfroot->GetVertexId();
+    Ipv4Address routerId = calc.root->GetVertexId();
+    Ptr<Node> node = calc.rootNode;
+    if (!node)
+    {
+        NS_LOG_LOGIC("FindOutgoingInterfaceId():Can't find root node " << routerId);
+        return -1;
+    }
     //
-    // Walk the list of nodes in the system looking for the one corresponding to
-    // the node at the root of the SPF tree.  This is the node for which we are
-    // building the routing table.
+    // This is the node we're building the routing table for.  We're going to need
+    // the Ipv4 interface to look for the ipv4 interface index.  Since this node
+    // is participating in routing IP version 4 packets, it certainly must have
+    // an Ipv4 interface.
     //
-    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
-    {
-        Ptr<Node> node = *i;
-
-        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
-        //
-        // If the node doesn't have a GlobalRouter interface it can't be the one
-        // we're interested in.
-        //
-        if (!rtr)
-        {
-            continue;
-        }
-
-        if (rtr->GetRouterId() == routerId)
-        {
-            //
-            // This is the node we're building the routing table for.  We're going to need
-            // the Ipv4 interface to look for the ipv4 interface index.  Since this node
-            // is participating in routing IP version 4 packets, it certainly must have
-            // an Ipv4 interface.
-            //
-            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
-            NS_ASSERT_MSG(ipv4,
-                          "GlobalRouteManagerImpl::FindOutgoingInterfaceId (): "
-                          "GetObject for <Ipv4> interface failed");
-            //
-            // Look through the interfaces on this node for one that has the IP address
-            // we're looking for.  If we find one, return the corresponding interface
-            // index, or -1 if not found.
-            //
-            int32_t interface = ipv4->GetInterfaceForPrefix(a, amask);
+    Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+    NS_ASSERT_MSG(ipv4,
+                  "GlobalRouteManagerImpl::FindOutgoingInterfaceId (): "
+                  "GetObject for <Ipv4> interface failed");
+    //
+    // Look through the interfaces on this node for one that has the IP address
+    // we're looking for.  If we find one, return the corresponding interface
+    // index, or -1 if not found.
+    //
+    int32_t interface = ipv4->GetInterfaceForPrefix(a, amask);
 
 #if 0
-          if (interface < 0)
-            {
-              NS_FATAL_ERROR ("GlobalRouteManagerImpl::FindOutgoingInterfaceId(): "
-                              "Expected an interface associated with address a:" << a);
-            }
-#endif
-            return interface;
-        }
+  if (interface < 0)
+    {
+      NS_FATAL_ERROR ("GlobalRouteManagerImpl::FindOutgoingInterfaceId(): "
+                      "Expected an interface associated with address a:" << a);
     }
-    //
-    // Couldn't find it.
-    //
-    NS_LOG_LOGIC("FindOutgoingInterfaceId():Can't find root node " << routerId);
-    return -1;
+#endif
+    return interface;
 }
 
 //
@@ -1903,11 +1952,11 @@ GlobalRouteManagerImpl::FindOutgoingInterfaceId(Ipv4Address a, Ipv4Mask amask)
 // route.
 //
 void
-GlobalRouteManagerImpl::SPFIntraAddRouter(SPFVertex* v)
+GlobalRouteManagerImpl::SPFIntraAddRouter(const SPFCalculation& calc, SPFVertex* v)
 {
     NS_LOG_FUNCTION(this << v);
 
-    NS_ASSERT_MSG(m_spfroot, "GlobalRouteManagerImpl::SPFIntraAddRouter (): Root pointer not set");
+    NS_ASSERT_MSG(calc.root, "GlobalRouteManagerImpl::SPFIntraAddRouter (): Root pointer not set");
     //
     // The root of the Shortest Path First tree is the router to which we are
     // going to write the actual routing table entries.  The vertex corresponding
@@ -1915,141 +1964,120 @@ GlobalRouteManagerImpl::SPFIntraAddRouter(SPFVertex* v)
     // going to use this ID to discover which node it is that we're actually going
     // to update.
     //
-    Ipv4Address routerId = m_spfroot->GetVertexId();
+    Ipv4Address routerId = calc.root->GetVertexId();
 
     NS_LOG_LOGIC("Vertex ID = " << routerId);
     //
-    // We need to walk the list of nodes looking for the one that has the router
-    // ID corresponding to the root vertex.  This is the one we're going to write
-    // the routing information to.
+    // The node of the root router is the one we're going to write the routing
+    // information to.
     //
-    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
+    Ptr<Node> node = calc.rootNode;
+    if (!node)
+    {
+        NS_LOG_LOGIC("Can't find root node " << routerId);
+        return;
+    }
+    NS_LOG_LOGIC("Setting routes for node " << node->GetId());
+    //
+    // Routing information is updated using the Ipv4 interface.  We need to
+    // GetObject for that interface.  If the node is acting as an IP version 4
+    // router, it should absolutely have an Ipv4 interface.
+    //
+    Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+    NS_ASSERT_MSG(ipv4,
+                  "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
+                  "GetObject for <Ipv4> interface failed");
+    //
+    // Get the Global Router Link State Advertisement from the vertex we're
+    // adding the routes to.  The LSA will have a number of attached Global Router
+    // Link Records corresponding to links off of that vertex / node.  We're going
+    // to be interested in the records corresponding to point-to-point links.
+    //
+    GlobalRoutingLSA* lsa = v->GetLSA();
+    NS_ASSERT_MSG(lsa,
+                  "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
+                  "Expected valid LSA in SPFVertex* v");
+
+    uint32_t nLinkRecords = lsa->GetNLinkRecords();
+    //
+    // Iterate through the link records on the vertex to which we're going to add
+    // routes.  To make sure we're being clear, we're going to add routing table
+    // entries to the tables on the node corresping to the root of the SPF tree.
+    // These entries will have routes to the IP addresses we find from looking at
+    // the local side of the point-to-point links found on the node described by
+    // the vertex <v>.
+    //
+    NS_LOG_LOGIC(" Node " << node->GetId() << " found " << nLinkRecords
+                          << " link records in LSA " << lsa << "with LinkStateId "
+                          << lsa->GetLinkStateId());
+    for (uint32_t j = 0; j < nLinkRecords; ++j)
     {
-        Ptr<Node> node = *i;
         //
-        // The router ID is accessible through the GlobalRouter interface, so we need
-        // to GetObject for that interface.  If there's no GlobalRouter interface,
-        // the node in question cannot be the router we want, so we continue.
+        // We are only concerned about point-to-point links
         //
-        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
-
-        if (!rtr)
+        GlobalRoutingLinkRecord* lr = lsa->GetLinkRecord(j);
+        if (lr->GetLinkType() != GlobalRoutingLinkRecord::PointToPoint)
         {
-            NS_LOG_LOGIC("No GlobalRouter interface on node " << node->GetId());
             continue;
         }
         //
-        // If the router ID of the current node is equal to the router ID of the
-        // root of the SPF tree, then this node is the one for which we need to
-        // write the routing tables.
+        // Here's why we did all of that work.  We're going to add a host route to the
+        // host address found in the m_linkData field of the point-to-point link
+        // record.  In the case of a point-to-point link, this is the local IP address
+        // of the node connected to the link.  Each of these point-to-point links
+        // will correspond to a local interface that has an IP address to which
+        // the node at the root of the SPF tree can send packets.  The vertex <v>
+        // (corresponding to the node that has these links and interfaces) has
+        // an m_nextHop address precalculated for us that is the address to which the
+        // root node should send packets to be forwarded to these IP addresses.
+        // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
+        // which the packets should be send for forwarding.
         //
-        NS_LOG_LOGIC("Considering router " << rtr->GetRouterId());
-
-        if (rtr->GetRouterId() == routerId)
+        Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
+        if (!router)
         {
-            NS_LOG_LOGIC("Setting routes for node " << node->GetId());
-            //
-            // Routing information is updated using the Ipv4 interface.  We need to
-            // GetObject for that interface.  If the node is acting as an IP version 4
-            // router, it should absolutely have an Ipv4 interface.
-            //
-            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
-            NS_ASSERT_MSG(ipv4,
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "GetObject for <Ipv4> interface failed");
-            //
-            // Get the Global Router Link State Advertisement from the vertex we're
-            // adding the routes to.  The LSA will have a number of attached Global Router
-            // Link Records corresponding to links off of that vertex / node.  We're going
-            // to be interested in the records corresponding to point-to-point links.
-            //
-            GlobalRoutingLSA* lsa = v->GetLSA();
-            NS_ASSERT_MSG(lsa,
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "Expected valid LSA in SPFVertex* v");
-
-            uint32_t nLinkRecords = lsa->GetNLinkRecords();
-            //
-            // Iterate through the link records on the vertex to which we're going to add
-            // routes.  To make sure we're being clear, we're going to add routing table
-            // entries to the tables on the node corresping to the root of the SPF tree.
-            // These entries will have routes to the IP addresses we find from looking at
-            // the local side of the point-to-point links found on the node described by
-            // the vertex <v>.
-            //
-            NS_LOG_LOGIC(" Node " << node->GetId() << " found " << nLinkRecords
-                                  << " link records in LSA " << lsa << "with LinkStateId "
-                                  << lsa->GetLinkStateId());
-            for (uint32_t j = 0; j < nLinkRecords; ++j)
+            continue;
+        }
+        Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
+        NS_ASSERT(gr);
+        // walk through all available exit directions due to ECMP,
+        // and add host route for each of the exit direction toward
+        // the vertex 'v'
+        for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
+        {
+            SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
+            Ipv4Address nextHop = exit.first;
+            int32_t outIf = exit.second;
+            if (outIf >= 0)
             {
-                //
-                // We are only concerned about point-to-point links
-                //
-                GlobalRoutingLinkRecord* lr = lsa->GetLinkRecord(j);
-                if (lr->GetLinkType() != GlobalRoutingLinkRecord::PointToPoint)
-                {
-                    continue;
-                }
-                //
-                // Here's why we did all of that work.  We're going to add a host route to the
-                // host address found in the m_linkData field of the point-to-point link
-                // record.  In the case of a point-to-point link, this is the local IP address
-                // of the node connected to the link.  Each of these point-to-point links
-                // will correspond to a local interface that has an IP address to which
-                // the node at the root of the SPF tree can send packets.  The vertex <v>
-                // (corresponding to the node that has these links and interfaces) has
-                // an m_nextHop address precalculated for us that is the address to which the
-                // root node should send packets to be forwarded to these IP addresses.
-                // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
-                // which the packets should be send for forwarding.
-                //
-                Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
-                if (!router)
-                {
-                    continue;
-                }
-                Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
-                NS_ASSERT(gr);
-                // walk through all available exit directions due to ECMP,
-                // and add host route for each of the exit direction toward
-                // the vertex 'v'
-                for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
-                {
-                    SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
-                    Ipv4Address nextHop = exit.first;
-                    int32_t outIf = exit.second;
-                    if (outIf >= 0)
-                    {
-                        gr->AddHostRouteTo(lr->GetLinkData(), nextHop, outIf);
-                        NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                               << " adding host route to " << lr->GetLinkData()
-                                               << " using next hop " << nextHop
-                                               << " and outgoing interface " << outIf);
-                    }
-                    else
-                    {
-                        NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                               << " NOT able to add host route to "
-                                               << lr->GetLinkData() << " using next hop " << nextHop
-                                               << " since outgoing interface id is negative "
-                                               << outIf);
-                    }
-                } // for all routes from the root the vertex 'v'
+                gr->AddHostRouteTo(lr->GetLinkData(), nextHop, outIf);
+                NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                       << " adding host route to " << lr->GetLinkData()
+                                       << " using next hop " << nextHop
+                                       << " and outgoing interface " << outIf);
             }
-            //
-            // Done adding the routes for the selected node.
-            //
-            return;
-        }
+            else
+            {
+                NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                       << " NOT able to add host route to "
+                                       << lr->GetLinkData() << " using next hop " << nextHop
+                                       << " since outgoing interface id is negative "
+                                       << outIf);
+            }
+        } // for all routes from the root the vertex 'v'
     }
+    //
+    // Done adding the routes for the selected node.
+    //
+    return;
 }
 
 void
-GlobalRouteManagerImpl::SPFIntraAddTransit(SPFVertex* v)
+GlobalRouteManagerImpl::SPFIntraAddTransit(const SPFCalculation& calc, SPFVertex* v)
 {
     NS_LOG_FUNCTION(this << v);
 
-    NS_ASSERT_MSG(m_spfroot, "GlobalRouteManagerImpl::SPFIntraAddTransit (): Root pointer not set");
+    NS_ASSERT_MSG(calc.root, "GlobalRouteManagerImpl::SPFIntraAddTransit (): Root pointer not set");
     //
     // The root of the Shortest Path First tree is the router to which we are
     // going to write the actual routing table entries.  The vertex corresponding
@@ -2057,93 +2085,72 @@ GlobalRouteManagerImpl::SPFIntraAddTransit(SPFVertex* v)
     // going to use this ID to discover which node it is that we're actually going
     // to update.
     //
-    Ipv4Address routerId = m_spfroot->GetVertexId();
+    Ipv4Address routerId = calc.root->GetVertexId();
 
     NS_LOG_LOGIC("Vertex ID = " << routerId);
     //
-    // We need to walk the list of nodes looking for the one that has the router
-    // ID corresponding to the root vertex.  This is the one we're going to write
-    // the routing information to.
+    // The node of the root router is the one we're going to write the routing
+    // information to.
     //
-    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
+    Ptr<Node> node = calc.rootNode;
+    if (!node)
     {
-        Ptr<Node> node = *i;
-        //
-        // The router ID is accessible through the GlobalRouter interface, so we need
-        // to GetObject for that interface.  If there's no GlobalRouter interface,
-        // the node in question cannot be the router we want, so we continue.
-        //
-        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
+        NS_LOG_LOGIC("Can't find root node " << routerId);
+        return;
+    }
+    NS_LOG_LOGIC("setting routes for node " << node->GetId());
+    //
+    // Routing information is updated using the Ipv4 interface.  We need to
+    // GetObject for that interface.  If the node is acting as an IP version 4
+    // router, it should absolutely have an Ipv4 interface.
+    //
+    Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+    NS_ASSERT_MSG(ipv4,
+                  "GlobalRouteManagerImpl::SPFIntraAddTransit (): "
+                  "GetObject for <Ipv4> interface failed");
+    //
+    // Get the Global Router Link State Advertisement from the vertex we're
+    // adding the routes to.  The LSA will have a number of attached Global Router
+    // Link Records corresponding to links off of that vertex / node.  We're going
+    // to be interested in the records corresponding to point-to-point links.
+    //
+    GlobalRoutingLSA* lsa = v->GetLSA();
+    NS_ASSERT_MSG(lsa,
+                  "GlobalRouteManagerImpl::SPFIntraAddTransit (): "
+                  "Expected valid LSA in SPFVertex* v");
+    Ipv4Mask tempmask = lsa->GetNetworkLSANetworkMask();
+    Ipv4Address tempip = lsa->GetLinkStateId();
+    tempip = tempip.CombineMask(tempmask);
+    Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
+    if (!router)
+    {
+        return;
+    }
+    Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
+    NS_ASSERT(gr);
+    // walk through all available exit directions due to ECMP,
+    // and add host route for each of the exit direction toward
+    // the vertex 'v'
+    for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
+    {
+        SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
+        Ipv4Address nextHop = exit.first;
+        int32_t outIf = exit.second;
 
-        if (!rtr)
+        if (outIf >= 0)
         {
-            NS_LOG_LOGIC("No GlobalRouter interface on node " << node->GetId());
-            continue;
+            gr->AddNetworkRouteTo(tempip, tempmask, nextHop, outIf);
+            NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                   << " add network route to " << tempip
+                                   << " using next hop " << nextHop << " via interface "
+                                   << outIf);
         }
-        //
-        // If the router ID of the current node is equal to the router ID of the
-        // root of the SPF tree, then this node is the one for which we need to
-        // write the routing tables.
-        //
-        NS_LOG_LOGIC("Considering router " << rtr->GetRouterId());
-
-        if (rtr->GetRouterId() == routerId)
+        else
         {
-            NS_LOG_LOGIC("setting routes for node " << node->GetId());
-            //
-            // Routing information is updated using the Ipv4 interface.  We need to
-            // GetObject for that interface.  If the node is acting as an IP version 4
-            // router, it should absolutely have an Ipv4 interface.
-            //
-            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
-            NS_ASSERT_MSG(ipv4,
-                          "GlobalRouteManagerImpl::SPFIntraAddTransit (): "
-                          "GetObject for <Ipv4> interface failed");
-            //
-            // Get the Global Router Link State Advertisement from the vertex we're
-            // adding the routes to.  The LSA will have a number of attached Global Router
-            // Link Records corresponding to links off of that vertex / node.  We're going
-            // to be interested in the records corresponding to point-to-point links.
-            //
-            GlobalRoutingLSA* lsa = v->GetLSA();
-            NS_ASSERT_MSG(lsa,
-                          "GlobalRouteManagerImpl::SPFIntraAddTransit (): "
-                          "Expected valid LSA in SPFVertex* v");
-            Ipv4Mask tempmask = lsa->GetNetworkLSANetworkMask();
-            Ipv4Address tempip = lsa->GetLinkStateId();
-            tempip = tempip.CombineMask(tempmask);
-            Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
-            if (!router)
-            {
-                continue;
-            }
-            Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
-            NS_ASSERT(gr);
-            // walk through all available exit directions due to ECMP,
-            // and add host route for each of the exit direction toward
-            // the vertex 'v'
-            for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
-            {
-                SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
-                Ipv4Address nextHop = exit.first;
-                int32_t outIf = exit.second;
-
-                if (outIf >= 0)
-                {
-                    gr->AddNetworkRouteTo(tempip, tempmask, nextHop, outIf);
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " add network route to " << tempip
-                                           << " using next hop " << nextHop << " via interface "
-                                           << outIf);
-                }
-                else
-                {
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " NOT able to add network route to " << tempip
-                                           << " using next hop " << nextHop
-                                           << " since outgoing interface id is negative " << outIf);
-                }
-            }
+            NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                   << " NOT able to add network route to " << tempip
+                                   << " using next hop " << nextHop
+                                   << " since outgoing interface id is negative " << outIf);
         }
     }
 }
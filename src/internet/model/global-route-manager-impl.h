@@ -31,6 +31,7 @@
 #include <map>
 #include <queue>
 #include <stdint.h>
+#include <unordered_map>
 #include <vector>
 
 namespace ns3
@@ -643,9 +644,9 @@ class GlobalRouteManagerLSDB
      * @brief Set all LSA flags to an initialized state, for SPF computation
      *
      * This function walks the database and resets the status flags of all of the
-     * contained Link State Advertisements to LSA_SPF_NOT_EXPLORED.  This is done
-     * prior to each SPF calculation to reset the state of the SPFVertex structures
-     * that will reference the LSAs during the calculation.
+     * contained Link State Advertisements to LSA_SPF_NOT_EXPLORED.  The SPF
+     * calculations of GlobalRouteManagerImpl do not use these flags: each one
+     * keeps the status of the LSAs it explores.
      *
      * @see GlobalRoutingLSA
      * @see SPFVertex
@@ -679,6 +680,8 @@ class GlobalRouteManagerLSDB
         LSDBPair_t; //!< pair of IPv4 addresses / Link State Advertisements
 
     LSDBMap_t m_database; //!< database of IPv4 addresses / Link State Advertisements
+    /// The first entry of the database with a TransitNetwork link record, by link data
+    std::unordered_map<Ipv4Address, LSDBMap_t::const_iterator, Ipv4AddressHash> m_linkData;
     std::vector<GlobalRoutingLSA*>
         m_extdatabase; //!< database of External Link State Advertisements
 };
@@ -722,6 +725,9 @@ class GlobalRouteManagerImpl
     /**
      * @brief Compute routes using a Dijkstra SPF computation and populate
      * per-node forwarding tables
+     *
+     * The calculations of the routers are spread over the number of threads
+     * given by the GlobalRoutingSpfThreads global value in builds with NS3_MTP.
      */
     virtual void InitializeRoutes();
 
@@ -738,9 +744,40 @@ class GlobalRouteManagerImpl
     void DebugSPFCalculate(Ipv4Address root);
 
   private:
-    SPFVertex* m_spfroot;           //!< the root node
+    /**
+     * \brief The state of the SPF calculation of one root.
+     *
+     * The LSDB is only read during a calculation: the tree and the SPF status
+     * of the LSAs belong to the calculation, so that the calculations of
+     * several roots can run at the same time.
+     */
+    struct SPFCalculation
+    {
+        SPFVertex* root{nullptr}; //!< the root vertex
+        Ptr<Node> rootNode;       //!< the node of the root router, if any
+        /// The SPF status of the LSAs explored so far
+        std::unordered_map<const GlobalRoutingLSA*, GlobalRoutingLSA::SPFStatus> status;
+
+        /**
+         * \param lsa the LSA
+         * \returns the SPF status of the LSA in this calculation
+         */
+        GlobalRoutingLSA::SPFStatus GetStatus(const GlobalRoutingLSA* lsa) const;
+    };
+
     GlobalRouteManagerLSDB* m_lsdb; //!< the Link State DataBase (LSDB) of the Global Route Manager
 
+    /**
+     * \brief Find the node of a router.
+     *
+     * The node which originated the router LSA is checked first, and
+     * the list of nodes is walked otherwise.
+     *
+     * \param routerId the router ID
+     * \returns the node whose GlobalRouter has this router ID, or nullptr
+     */
+    Ptr<Node> FindRouterNode(Ipv4Address routerId) const;
+
     /**
      * \brief Test if a node is a stub, from an OSPF sense.
      *
@@ -748,18 +785,19 @@ class GlobalRouteManagerImpl
      * can safely be added to the next-hop router and SPF does not need
      * to be run
      *
-     * \param root the root node
+     * \param calc the calculation of the root node
      * \returns true if the node is a stub
      */
-    bool CheckForStubNode(Ipv4Address root);
+    bool CheckForStubNode(const SPFCalculation& calc);
 
     /**
      * \brief Calculate the shortest path first (SPF) tree
      *
      * Equivalent to quagga ospf_spf_calculate
      * \param root the root node
+     * \param node the node of the root router, if any
      */
-    void SPFCalculate(Ipv4Address root);
+    void SPFCalculate(Ipv4Address root, Ptr<Node> node);
 
     /**
      * \brief Process Stub nodes
@@ -768,17 +806,19 @@ class GlobalRouteManagerImpl
      * stub link records will exist for point-to-point interfaces and for
      * broadcast interfaces for which no neighboring router can be found
      *
+     * \param calc the calculation
      * \param v vertex to be processed
      */
-    void SPFProcessStubs(SPFVertex* v);
+    void SPFProcessStubs(const SPFCalculation& calc, SPFVertex* v);
 
     /**
      * \brief Process Autonomous Systems (AS) External LSA
      *
+     * \param calc the calculation
      * \param v vertex to be processed
      * \param extlsa external LSA
      */
-    void ProcessASExternals(SPFVertex* v, GlobalRoutingLSA* extlsa);
+    void ProcessASExternals(const SPFCalculation& calc, SPFVertex* v, GlobalRoutingLSA* extlsa);
 
     /**
      * \brief Examine the links in v's LSA and update the list of candidates with any
@@ -798,10 +838,11 @@ class GlobalRouteManagerImpl
      * vertices not already on the list.  If a lower-cost path is found to a
      * vertex already on the candidate list, store the new (lower) cost.
      *
+     * \param calc the calculation
      * \param v the vertex
      * \param candidate the SPF candidate queue
      */
-    void SPFNext(SPFVertex* v, CandidateQueue& candidate);
+    void SPFNext(SPFCalculation& calc, SPFVertex* v, CandidateQueue& candidate);
 
     /**
      * \brief Calculate nexthop from root through V (parent) to vertex W (destination)
@@ -810,13 +851,15 @@ class GlobalRouteManagerImpl
      * This method is derived from quagga ospf_nexthop_calculation() 16.1.1.
      * For now, this is greatly simplified from the quagga code
      *
+     * \param calc the calculation
      * \param v the parent
      * \param w the destination
      * \param l the link record
      * \param distance the target distance
      * \returns 1 on success
      */
-    int SPFNexthopCalculation(SPFVertex* v,
+    int SPFNexthopCalculation(const SPFCalculation& calc,
+                              SPFVertex* v,
                               SPFVertex* w,
                               GlobalRoutingLinkRecord* l,
                               uint32_t distance);
@@ -879,33 +922,37 @@ class GlobalRouteManagerImpl
      * a destination IP address, reachable from the root, to which we add a host
      * route.
      *
+     * \param calc the calculation
      * \param v the vertex
      *
      */
-    void SPFIntraAddRouter(SPFVertex* v);
+    void SPFIntraAddRouter(const SPFCalculation& calc, SPFVertex* v);
 
     /**
      * \brief Add a transit to the routing tables
      *
+     * \param calc the calculation
      * \param v the vertex
      */
-    void SPFIntraAddTransit(SPFVertex* v);
+    void SPFIntraAddTransit(const SPFCalculation& calc, SPFVertex* v);
 
     /**
      * \brief Add a stub to the routing tables
      *
+     * \param calc the calculation
      * \param l the global routing link record
      * \param v the vertex
      */
-    void SPFIntraAddStub(GlobalRoutingLinkRecord* l, SPFVertex* v);
+    void SPFIntraAddStub(const SPFCalculation& calc, GlobalRoutingLinkRecord* l, SPFVertex* v);
 
     /**
      * \brief Add an external route to the routing tables
      *
+     * \param calc the calculation
      * \param extlsa the external LSA
      * \param v the vertex
      */
-    void SPFAddASExternal(GlobalRoutingLSA* extlsa, SPFVertex* v);
+    void SPFAddASExternal(const SPFCalculation& calc, GlobalRoutingLSA* extlsa, SPFVertex* v);
 
     /**
      * \brief Return the interface number corresponding to a given IP address and mask
@@ -915,11 +962,14 @@ class GlobalRouteManagerImpl
      * If no such interface is found, return -1 (note:  unit test framework
      * for routing assumes -1 to be a legal return value)
      *
+     * \param calc the calculation of the root
      * \param a the target IP address
      * \param amask the target subnet mask
      * \return the outgoing interface number
      */
-    int32_t FindOutgoingInterfaceId(Ipv4Address a, Ipv4Mask amask = Ipv4Mask("255.255.255.255"));
+    int32_t FindOutgoingInterfaceId(const SPFCalculation& calc,
+                                    Ipv4Address a,
+                                    Ipv4Mask amask = Ipv4Mask("255.255.255.255"));
 };
 
 } // namespace ns3
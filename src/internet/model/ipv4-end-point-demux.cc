@@ -24,6 +24,8 @@
 
 #include "ns3/log.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -32,7 +34,8 @@ NS_LOG_COMPONENT_DEFINE("Ipv4EndPointDemux");
 Ipv4EndPointDemux::Ipv4EndPointDemux()
     : m_ephemeral(49152),
       m_portLast(65535),
-      m_portFirst(49152)
+      m_portFirst(49152),
+      m_order(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -46,26 +49,27 @@ Ipv4EndPointDemux::~Ipv4EndPointDemux()
         delete endPoint;
     }
     m_endPoints.clear();
+    m_entries.clear();
+    m_peerEndPoints.clear();
+    m_portEndPoints.clear();
+    m_portCount.clear();
 }
 
 bool
 Ipv4EndPointDemux::LookupPortLocal(uint16_t port)
 {
     NS_LOG_FUNCTION(this << port);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
-    {
-        if ((*i)->GetLocalPort() == port)
-        {
-            return true;
-        }
-    }
-    return false;
+    return m_portCount.find(port) != m_portCount.end();
 }
 
 bool
 Ipv4EndPointDemux::LookupLocal(Ptr<NetDevice> boundNetDevice, Ipv4Address addr, uint16_t port)
 {
     NS_LOG_FUNCTION(this << addr << port);
+    if (!LookupPortLocal(port))
+    {
+        return false;
+    }
     for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
     {
         if ((*i)->GetLocalPort() == port && (*i)->GetLocalAddress() == addr &&
@@ -88,7 +92,7 @@ Ipv4EndPointDemux::Allocate()
         return nullptr;
     }
     auto endPoint = new Ipv4EndPoint(Ipv4Address::GetAny(), port);
-    m_endPoints.push_back(endPoint);
+    Insert(endPoint);
     NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
     return endPoint;
 }
@@ -104,7 +108,7 @@ Ipv4EndPointDemux::Allocate(Ipv4Address address)
         return nullptr;
     }
     auto endPoint = new Ipv4EndPoint(address, port);
-    m_endPoints.push_back(endPoint);
+    Insert(endPoint);
     NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
     return endPoint;
 }
@@ -127,7 +131,7 @@ Ipv4EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice, Ipv4Address address,
         return nullptr;
     }
     auto endPoint = new Ipv4EndPoint(address, port);
-    m_endPoints.push_back(endPoint);
+    Insert(endPoint);
     NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
     return endPoint;
 }
@@ -140,7 +144,9 @@ Ipv4EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice,
                             uint16_t peerPort)
 {
     NS_LOG_FUNCTION(this << localAddress << localPort << peerAddress << peerPort << boundNetDevice);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    std::vector<Ipv4EndPoint*> candidates;
+    GetCandidates(localPort, peerAddress, peerPort, candidates);
+    for (auto i = candidates.begin(); i != candidates.end(); i++)
     {
         if ((*i)->GetLocalPort() == localPort && (*i)->GetLocalAddress() == localAddress &&
             (*i)->GetPeerPort() == peerPort && (*i)->GetPeerAddress() == peerAddress &&
@@ -152,7 +158,7 @@ Ipv4EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice,
     }
     auto endPoint = new Ipv4EndPoint(localAddress, localPort);
     endPoint->SetPeer(peerAddress, peerPort);
-    m_endPoints.push_back(endPoint);
+    Insert(endPoint);
 
     NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
 
@@ -163,15 +169,20 @@ void
 Ipv4EndPointDemux::DeAllocate(Ipv4EndPoint* endPoint)
 {
     NS_LOG_FUNCTION(this << endPoint);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    auto entry = m_entries.find(endPoint);
+    if (entry == m_entries.end())
     {
-        if (*i == endPoint)
-        {
-            delete endPoint;
-            m_endPoints.erase(i);
-            break;
-        }
+        return;
+    }
+    Unindex(endPoint, entry->second);
+    m_endPoints.erase(entry->second.position);
+    m_entries.erase(entry);
+    auto count = m_portCount.find(endPoint->GetLocalPort());
+    if (--count->second == 0)
+    {
+        m_portCount.erase(count);
     }
+    delete endPoint;
 }
 
 /*
@@ -211,10 +222,10 @@ Ipv4EndPointDemux::Lookup(Ipv4Address daddr,
     EndPoints retval4; // Exact match on all 4
 
     NS_LOG_DEBUG("Looking up endpoint for destination address " << daddr << ":" << dport);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    std::vector<Ipv4EndPoint*> candidates;
+    GetCandidates(dport, saddr, sport, candidates);
+    for (Ipv4EndPoint* endP : candidates)
     {
-        Ipv4EndPoint* endP = *i;
-
         NS_LOG_DEBUG("Looking at endpoint dport="
                      << endP->GetLocalPort() << " daddr=" << endP->GetLocalAddress()
                      << " sport=" << endP->GetPeerPort() << " saddr=" << endP->GetPeerAddress());
@@ -372,6 +383,25 @@ Ipv4EndPointDemux::SimpleLookup(Ipv4Address daddr,
 {
     NS_LOG_FUNCTION(this << daddr << dport << saddr << sport);
 
+    // The endpoints which match exactly are found in the index.  The first
+    // one allocated is returned, as when walking the list of endpoints.
+    std::vector<Ipv4EndPoint*> candidates;
+    GetCandidates(dport, saddr, sport, candidates);
+    Ipv4EndPoint* exact = nullptr;
+    for (Ipv4EndPoint* endPoint : candidates)
+    {
+        if (endPoint->GetLocalAddress() == daddr && endPoint->GetPeerPort() == sport &&
+            endPoint->GetPeerAddress() == saddr &&
+            (exact == nullptr || m_entries.at(endPoint).order < m_entries.at(exact).order))
+        {
+            exact = endPoint;
+        }
+    }
+    if (exact != nullptr || !LookupPortLocal(dport))
+    {
+        return exact;
+    }
+
     // this code is a copy/paste version of an old BSD ip stack lookup
     // function.
     uint32_t genericity = 3;
@@ -382,12 +412,6 @@ Ipv4EndPointDemux::SimpleLookup(Ipv4Address daddr,
         {
             continue;
         }
-        if ((*i)->GetLocalAddress() == daddr && (*i)->GetPeerPort() == sport &&
-            (*i)->GetPeerAddress() == saddr)
-        {
-            /* this is an exact match. */
-            return *i;
-        }
         uint32_t tmp = 0;
         if ((*i)->GetLocalAddress() == Ipv4Address::GetAny())
         {
@@ -429,4 +453,106 @@ Ipv4EndPointDemux::AllocateEphemeralPort()
     return port;
 }
 
+bool
+Ipv4EndPointDemux::PeerKey::operator==(const PeerKey& other) const
+{
+    return localPort == other.localPort && peerAddress == other.peerAddress &&
+           peerPort == other.peerPort;
+}
+
+std::size_t
+Ipv4EndPointDemux::PeerKeyHash::operator()(const PeerKey& key) const
+{
+    return Ipv4AddressHash()(key.peerAddress) ^
+           std::hash<uint32_t>()((static_cast<uint32_t>(key.localPort) << 16) | key.peerPort);
+}
+
+void
+Ipv4EndPointDemux::Insert(Ipv4EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    m_endPoints.push_back(endPoint);
+    EndPointEntry& entry = m_entries[endPoint];
+    entry.position = std::prev(m_endPoints.end());
+    entry.order = m_order++;
+    Index(endPoint, entry);
+    m_portCount[endPoint->GetLocalPort()]++;
+    endPoint->m_demux = this;
+}
+
+void
+Ipv4EndPointDemux::Index(Ipv4EndPoint* endPoint, EndPointEntry& entry)
+{
+    entry.hasPeer =
+        endPoint->GetPeerAddress() != Ipv4Address::GetAny() && endPoint->GetPeerPort() != 0;
+    if (entry.hasPeer)
+    {
+        entry.key = {endPoint->GetLocalPort(),
+                     endPoint->GetPeerAddress(),
+                     endPoint->GetPeerPort()};
+        m_peerEndPoints[entry.key].push_back(endPoint);
+    }
+    else
+    {
+        m_portEndPoints[endPoint->GetLocalPort()].push_back(endPoint);
+    }
+}
+
+void
+Ipv4EndPointDemux::Unindex(Ipv4EndPoint* endPoint, const EndPointEntry& entry)
+{
+    if (entry.hasPeer)
+    {
+        auto endPoints = m_peerEndPoints.find(entry.key);
+        NS_ASSERT(endPoints != m_peerEndPoints.end());
+        std::erase(endPoints->second, endPoint);
+        if (endPoints->second.empty())
+        {
+            m_peerEndPoints.erase(endPoints);
+        }
+    }
+    else
+    {
+        auto endPoints = m_portEndPoints.find(endPoint->GetLocalPort());
+        NS_ASSERT(endPoints != m_portEndPoints.end());
+        std::erase(endPoints->second, endPoint);
+        if (endPoints->second.empty())
+        {
+            m_portEndPoints.erase(endPoints);
+        }
+    }
+}
+
+void
+Ipv4EndPointDemux::NotifyPeerChange(Ipv4EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    auto entry = m_entries.find(endPoint);
+    NS_ASSERT(entry != m_entries.end());
+    Unindex(endPoint, entry->second);
+    Index(endPoint, entry->second);
+}
+
+void
+Ipv4EndPointDemux::GetCandidates(uint16_t localPort,
+                                 Ipv4Address peerAddress,
+                                 uint16_t peerPort,
+                                 std::vector<Ipv4EndPoint*>& candidates) const
+{
+    candidates.clear();
+    // An endpoint bound to a peer only matches the packets of this peer.
+    auto peerEndPoints = m_peerEndPoints.find({localPort, peerAddress, peerPort});
+    if (peerEndPoints != m_peerEndPoints.end())
+    {
+        candidates = peerEndPoints->second;
+    }
+    auto portEndPoints = m_portEndPoints.find(localPort);
+    if (portEndPoints != m_portEndPoints.end())
+    {
+        candidates.insert(candidates.end(),
+                          portEndPoints->second.begin(),
+                          portEndPoints->second.end());
+    }
+}
+
 } // namespace ns3
@@ -26,6 +26,8 @@
 
 #include <list>
 #include <stdint.h>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -42,6 +44,10 @@ class Ipv4EndPoint;
  * of endpoints, and has APIs to add and find endpoints in this demux.  This
  * code is shared in common to TCP and UDP protocols in ns3.  This demux
  * sits between ns3's layer four and the socket layer
+ *
+ * The endpoints are also indexed by local port and peer, so that a lookup
+ * only looks at the endpoints of the peer and at the endpoints of the local
+ * port which are not bound to a peer.
  */
 
 class Ipv4EndPointDemux
@@ -171,6 +177,91 @@ class Ipv4EndPointDemux
     void DeAllocate(Ipv4EndPoint* endPoint);
 
   private:
+    friend class Ipv4EndPoint;
+
+    /**
+     * \brief The key of the endpoints whose peer is set.
+     */
+    struct PeerKey
+    {
+        uint16_t localPort;      //!< The local port
+        Ipv4Address peerAddress; //!< The peer address
+        uint16_t peerPort;       //!< The peer port
+
+        /**
+         * \brief Equality operator.
+         * \param other the key to compare with
+         * \return true if the keys are equal
+         */
+        bool operator==(const PeerKey& other) const;
+    };
+
+    /**
+     * \brief Hash function of the PeerKey.
+     */
+    struct PeerKeyHash
+    {
+        /**
+         * \brief Hash a PeerKey.
+         * \param key the key
+         * \return the hash
+         */
+        std::size_t operator()(const PeerKey& key) const;
+    };
+
+    /**
+     * \brief The position of an endpoint in the demux.
+     */
+    struct EndPointEntry
+    {
+        EndPointsI position; //!< The position in the list of endpoints
+        uint64_t order;      //!< The order of allocation of the endpoint
+        bool hasPeer;        //!< True if the endpoint is indexed by its peer
+        PeerKey key;         //!< The key of the endpoint, if indexed by its peer
+    };
+
+    /**
+     * \brief Add an endpoint to the list and to the index.
+     * \param endPoint the endpoint
+     */
+    void Insert(Ipv4EndPoint* endPoint);
+
+    /**
+     * \brief Add an endpoint to the index, under its current peer.
+     * \param endPoint the endpoint
+     * \param entry the entry of the endpoint
+     */
+    void Index(Ipv4EndPoint* endPoint, EndPointEntry& entry);
+
+    /**
+     * \brief Remove an endpoint from the index.
+     * \param endPoint the endpoint
+     * \param entry the entry of the endpoint
+     */
+    void Unindex(Ipv4EndPoint* endPoint, const EndPointEntry& entry);
+
+    /**
+     * \brief Move an endpoint in the index, after its peer was changed.
+     * \param endPoint the endpoint
+     */
+    void NotifyPeerChange(Ipv4EndPoint* endPoint);
+
+    /**
+     * \brief Get the endpoints which can match the packets of a peer.
+     *
+     * These are the endpoints bound to the peer, and the endpoints of the
+     * local port which are not bound to a peer.
+     *
+     * \param localPort the local port
+     * \param peerAddress the peer address
+     * \param peerPort the peer port
+     * \param candidates the endpoints found
+     */
+    void GetCandidates(uint16_t localPort,
+                       Ipv4Address peerAddress,
+                       uint16_t peerPort,
+                       std::vector<Ipv4EndPoint*>& candidates) const;
+
     /**
      * \brief Allocate an ephemeral port.
      * \returns the ephemeral port
@@ -196,6 +287,31 @@ class Ipv4EndPointDemux
      * \brief A list of IPv4 end points.
      */
     EndPoints m_endPoints;
+
+    /**
+     * \brief The entries of the endpoints.
+     */
+    std::unordered_map<Ipv4EndPoint*, EndPointEntry> m_entries;
+
+    /**
+     * \brief The endpoints whose peer address and port are set, by local port and peer.
+     */
+    std::unordered_map<PeerKey, std::vector<Ipv4EndPoint*>, PeerKeyHash> m_peerEndPoints;
+
+    /**
+     * \brief The other endpoints, by local port.
+     */
+    std::unordered_map<uint16_t, std::vector<Ipv4EndPoint*>> m_portEndPoints;
+
+    /**
+     * \brief The number of endpoints, by local port.
+     */
+    std::unordered_map<uint16_t, uint32_t> m_portCount;
+
+    /**
+     * \brief The order of allocation of the next endpoint.
+     */
+    uint64_t m_order;
 };
 
 } // namespace ns3
@@ -30,6 +30,7 @@
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
 
+#include <algorithm>
 #include <iomanip>
 #include <vector>
 
@@ -64,7 +65,8 @@ Ipv4GlobalRouting::GetTypeId()
 
 Ipv4GlobalRouting::Ipv4GlobalRouting()
     : m_randomEcmpRouting(false),
-      m_respondToInterfaceEvents(false)
+      m_respondToInterfaceEvents(false),
+      m_indexValid(false)
 {
     NS_LOG_FUNCTION(this);
 
@@ -83,6 +85,7 @@ Ipv4GlobalRouting::AddHostRouteTo(Ipv4Address dest, Ipv4Address nextHop, uint32_
     auto route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateHostRouteTo(dest, nextHop, interface);
     m_hostRoutes.push_back(route);
+    m_indexValid = false;
 }
 
 void
@@ -92,6 +95,7 @@ Ipv4GlobalRouting::AddHostRouteTo(Ipv4Address dest, uint32_t interface)
     auto route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateHostRouteTo(dest, interface);
     m_hostRoutes.push_back(route);
+    m_indexValid = false;
 }
 
 void
@@ -104,6 +108,7 @@ Ipv4GlobalRouting::AddNetworkRouteTo(Ipv4Address network,
     auto route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, nextHop, interface);
     m_networkRoutes.push_back(route);
+    m_indexValid = false;
 }
 
 void
@@ -113,6 +118,7 @@ Ipv4GlobalRouting::AddNetworkRouteTo(Ipv4Address network, Ipv4Mask networkMask,
     auto route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, interface);
     m_networkRoutes.push_back(route);
+    m_indexValid = false;
 }
 
 void
@@ -125,6 +131,7 @@ Ipv4GlobalRouting::AddASExternalRouteTo(Ipv4Address network,
     auto route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, nextHop, interface);
     m_ASexternalRoutes.push_back(route);
+    m_indexValid = false;
 }
 
 Ptr<Ipv4Route>
@@ -137,66 +144,42 @@ Ipv4GlobalRouting::LookupGlobal(Ipv4Address dest, Ptr<NetDevice> oif)
     typedef std::vector<Ipv4RoutingTableEntry*> RouteVec_t;
     RouteVec_t allRoutes;
 
-    NS_LOG_LOGIC("Number of m_hostRoutes = " << m_hostRoutes.size());
-    for (auto i = m_hostRoutes.begin(); i != m_hostRoutes.end(); i++)
+    if (!m_indexValid)
     {
-        NS_ASSERT((*i)->IsHost());
-        if ((*i)->GetDest() == dest)
+        NS_LOG_LOGIC("Indexing the routes");
+        m_hostIndex.Build(m_hostRoutes);
+        m_networkIndex.Build(m_networkRoutes);
+        m_ASexternalIndex.Build(m_ASexternalRoutes);
+        m_indexValid = true;
+    }
+    auto notOnInterface = [this, oif](Ipv4RoutingTableEntry* route) {
+        if (oif && oif != m_ipv4->GetNetDevice(route->GetInterface()))
         {
-            if (oif)
-            {
-                if (oif != m_ipv4->GetNetDevice((*i)->GetInterface()))
-                {
-                    NS_LOG_LOGIC("Not on requested interface, skipping");
-                    continue;
-                }
-            }
-            allRoutes.push_back(*i);
-            NS_LOG_LOGIC(allRoutes.size() << "Found global host route" << *i);
+            NS_LOG_LOGIC("Not on requested interface, skipping");
+            return true;
         }
-    }
+        return false;
+    };
+
+    NS_LOG_LOGIC("Number of m_hostRoutes = " << m_hostRoutes.size());
+    m_hostIndex.Lookup(dest, allRoutes);
+    std::erase_if(allRoutes, notOnInterface);
+    NS_LOG_LOGIC("Found " << allRoutes.size() << " global host routes");
     if (allRoutes.empty()) // if no host route is found
     {
         NS_LOG_LOGIC("Number of m_networkRoutes" << m_networkRoutes.size());
-        for (auto j = m_networkRoutes.begin(); j != m_networkRoutes.end(); j++)
-        {
-            Ipv4Mask mask = (*j)->GetDestNetworkMask();
-            Ipv4Address entry = (*j)->GetDestNetwork();
-            if (mask.IsMatch(dest, entry))
-            {
-                if (oif)
-                {
-                    if (oif != m_ipv4->GetNetDevice((*j)->GetInterface()))
-                    {
-                        NS_LOG_LOGIC("Not on requested interface, skipping");
-                        continue;
-                    }
-                }
-                allRoutes.push_back(*j);
-                NS_LOG_LOGIC(allRoutes.size() << "Found global network route" << *j);
-            }
-        }
+        m_networkIndex.Lookup(dest, allRoutes);
+        std::erase_if(allRoutes, notOnInterface);
+        NS_LOG_LOGIC("Found " << allRoutes.size() << " global network routes");
     }
     if (allRoutes.empty()) // consider external if no host/network found
     {
-        for (auto k = m_ASexternalRoutes.begin(); k != m_ASexternalRoutes.end(); k++)
+        m_ASexternalIndex.Lookup(dest, allRoutes);
+        std::erase_if(allRoutes, notOnInterface);
+        if (!allRoutes.empty())
         {
-            Ipv4Mask mask = (*k)->GetDestNetworkMask();
-            Ipv4Address entry = (*k)->GetDestNetwork();
-            if (mask.IsMatch(dest, entry))
-            {
-                NS_LOG_LOGIC("Found external route" << *k);
-                if (oif)
-                {
-                    if (oif != m_ipv4->GetNetDevice((*k)->GetInterface()))
-                    {
-                        NS_LOG_LOGIC("Not on requested interface, skipping");
-                        continue;
-                    }
-                }
-                allRoutes.push_back(*k);
-                break;
-            }
+            NS_LOG_LOGIC("Found external route" << allRoutes.front());
+            allRoutes.resize(1);
         }
     }
     if (!allRoutes.empty()) // if route(s) is found
@@ -230,6 +213,65 @@ Ipv4GlobalRouting::LookupGlobal(Ipv4Address dest, Ptr<NetDevice> oif)
     }
 }
 
+void
+Ipv4GlobalRouting::RouteIndex::Build(const std::list<Ipv4RoutingTableEntry*>& routes)
+{
+    m_groups.clear();
+    m_routes.assign(routes.begin(), routes.end());
+    for (uint32_t i = 0; i < m_routes.size(); i++)
+    {
+        uint32_t mask = m_routes[i]->GetDestNetworkMask().Get();
+        auto group = std::find_if(m_groups.begin(), m_groups.end(), [mask](const MaskGroup& g) {
+            return g.mask == mask;
+        });
+        if (group == m_groups.end())
+        {
+            group = m_groups.insert(m_groups.end(), {mask, {}});
+        }
+        group->positions[m_routes[i]->GetDestNetwork().Get() & mask].push_back(i);
+    }
+}
+
+void
+Ipv4GlobalRouting::RouteIndex::Lookup(Ipv4Address dest,
+                                      std::vector<Ipv4RoutingTableEntry*>& routes) const
+{
+    // the routes matching in several groups are merged back in list order
+    const std::vector<uint32_t>* found = nullptr;
+    std::vector<uint32_t> merged;
+    for (const auto& group : m_groups)
+    {
+        auto it = group.positions.find(dest.Get() & group.mask);
+        if (it == group.positions.end())
+        {
+            continue;
+        }
+        if (!found)
+        {
+            found = &it->second;
+            continue;
+        }
+        if (found != &merged)
+        {
+            merged = *found;
+            found = &merged;
+        }
+        merged.insert(merged.end(), it->second.begin(), it->second.end());
+    }
+    if (!found)
+    {
+        return;
+    }
+    if (found == &merged)
+    {
+        std::sort(merged.begin(), merged.end());
+    }
+    for (uint32_t position : *found)
+    {
+        routes.push_back(m_routes[position]);
+    }
+}
+
 uint32_t
 Ipv4GlobalRouting::GetNRoutes() const
 {
@@ -289,6 +331,7 @@ void
 Ipv4GlobalRouting::RemoveRoute(uint32_t index)
 {
     NS_LOG_FUNCTION(this << index);
+    m_indexValid = false;
     if (index < m_hostRoutes.size())
     {
         uint32_t tmp = 0;
@@ -364,6 +407,7 @@ Ipv4GlobalRouting::DoDispose()
     {
         delete (*l);
     }
+    m_indexValid = false;
 
     Ipv4RoutingProtocol::DoDispose();
 }
@@ -29,6 +29,8 @@
 
 #include <list>
 #include <stdint.h>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -66,6 +68,12 @@ class Node;
  *
  * This class deals with Ipv4 unicast routes only.
  *
+ * The route lists are indexed by destination the first time a route is
+ * looked up after they change, so that the cost of a lookup does not grow
+ * with the number of routes.  As before, a packet is routed on one of all
+ * the matching host routes or, if there is none, on one of all the
+ * matching network routes, or else on the first matching external route.
+ *
  * \see Ipv4RoutingProtocol
  * \see GlobalRouteManager
  */
@@ -266,6 +274,42 @@ class Ipv4GlobalRouting : public Ipv4RoutingProtocol
     /// iterator of container of Ipv4RoutingTableEntry (routes to external AS)
     typedef std::list<Ipv4RoutingTableEntry*>::iterator ASExternalRoutesI;
 
+    /**
+     * \brief An index of a list of routes, by destination.
+     *
+     * The routes are grouped by network mask, and hashed by their masked
+     * destination within each group, so that a lookup costs one hash table
+     * lookup per distinct mask.
+     */
+    class RouteIndex
+    {
+      public:
+        /**
+         * \brief Index a list of routes, replacing the previous ones.
+         * \param routes the routes
+         */
+        void Build(const std::list<Ipv4RoutingTableEntry*>& routes);
+        /**
+         * \brief Find the routes matching a destination.
+         * \param dest the destination address
+         * \param [out] routes the routes to which the matching ones are
+         * appended, in the order of the indexed list
+         */
+        void Lookup(Ipv4Address dest, std::vector<Ipv4RoutingTableEntry*>& routes) const;
+
+      private:
+        /// The routes with the same network mask
+        struct MaskGroup
+        {
+            uint32_t mask; //!< The network mask
+            /// The positions of the routes, by masked destination
+            std::unordered_map<uint32_t, std::vector<uint32_t>> positions;
+        };
+
+        std::vector<MaskGroup> m_groups;              //!< The routes, by mask
+        std::vector<Ipv4RoutingTableEntry*> m_routes; //!< The routes, in list order
+    };
+
     /**
      * \brief Lookup in the forwarding table for destination.
      * \param dest destination address
@@ -278,6 +322,11 @@ class Ipv4GlobalRouting : public Ipv4RoutingProtocol
     NetworkRoutes m_networkRoutes;       //!< Routes to networks
     ASExternalRoutes m_ASexternalRoutes; //!< External routes imported
 
+    bool m_indexValid;            //!< True if the route indexes match the route lists
+    RouteIndex m_hostIndex;       //!< Index of the routes to hosts
+    RouteIndex m_networkIndex;    //!< Index of the routes to networks
+    RouteIndex m_ASexternalIndex; //!< Index of the external routes
+
     Ptr<Ipv4> m_ipv4; //!< associated IPv4 instance
 };
 
@@ -23,6 +23,8 @@
 
 #include "ns3/log.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -31,7 +33,8 @@ NS_LOG_COMPONENT_DEFINE("Ipv6EndPointDemux");
 Ipv6EndPointDemux::Ipv6EndPointDemux()
     : m_ephemeral(49152),
       m_portFirst(49152),
-      m_portLast(65535)
+      m_portLast(65535),
+      m_order(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -45,26 +48,27 @@ Ipv6EndPointDemux::~Ipv6EndPointDemux()
         delete endPoint;
     }
     m_endPoints.clear();
+    m_entries.clear();
+    m_peerEndPoints.clear();
+    m_portEndPoints.clear();
+    m_portCount.clear();
 }
 
 bool
 Ipv6EndPointDemux::LookupPortLocal(uint16_t port)
 {
     NS_LOG_FUNCTION(this << port);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
-    {
-        if ((*i)->GetLocalPort() == port)
-        {
-            return true;
-        }
-    }
-    return false;
+    return m_portCount.find(port) != m_portCount.end();
 }
 
 bool
 Ipv6EndPointDemux::LookupLocal(Ptr<NetDevice> boundNetDevice, Ipv6Address addr, uint16_t port)
 {
     NS_LOG_FUNCTION(this << addr << port);
+    if (!LookupPortLocal(port))
+    {
+        return false;
+    }
     for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
     {
         if ((*i)->GetLocalPort() == port && (*i)->GetLocalAddress() == addr &&
@@ -87,7 +91,7 @@ Ipv6EndPointDemux::Allocate()
         return nullptr;
     }
     auto endPoint = new Ipv6EndPoint(Ipv6Address::GetAny(), port);
-    m_endPoints.push_back(endPoint);
+    Insert(endPoint);
     NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
     return endPoint;
 }
@@ -103,7 +107,7 @@ Ipv6EndPointDemux::Allocate(Ipv6Address address)
         return nullptr;
     }
     auto endPoint = new Ipv6EndPoint(address, port);
-    m_endPoints.push_back(endPoint);
+    Insert(endPoint);
     NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
     return endPoint;
 }
@@ -126,7 +130,7 @@ Ipv6EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice, Ipv6Address address,
         return nullptr;
     }
     auto endPoint = new Ipv6EndPoint(address, port);
-    m_endPoints.push_back(endPoint);
+    Insert(endPoint);
     NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
     return endPoint;
 }
@@ -139,7 +143,9 @@ Ipv6EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice,
                             uint16_t peerPort)
 {
     NS_LOG_FUNCTION(this << boundNetDevice << localAddress << localPort << peerAddress << peerPort);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    std::vector<Ipv6EndPoint*> candidates;
+    GetCandidates(localPort, peerAddress, peerPort, candidates);
+    for (auto i = candidates.begin(); i != candidates.end(); i++)
     {
         if ((*i)->GetLocalPort() == localPort && (*i)->GetLocalAddress() == localAddress &&
             (*i)->GetPeerPort() == peerPort && (*i)->GetPeerAddress() == peerAddress &&
@@ -151,7 +157,7 @@ Ipv6EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice,
     }
     auto endPoint = new Ipv6EndPoint(localAddress, localPort);
     endPoint->SetPeer(peerAddress, peerPort);
-    m_endPoints.push_back(endPoint);
+    Insert(endPoint);
 
     NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
 
@@ -162,15 +168,20 @@ void
 Ipv6EndPointDemux::DeAllocate(Ipv6EndPoint* endPoint)
 {
     NS_LOG_FUNCTION(this);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    auto entry = m_entries.find(endPoint);
+    if (entry == m_entries.end())
     {
-        if (*i == endPoint)
-        {
-            delete endPoint;
-            m_endPoints.erase(i);
-            break;
-        }
+        return;
+    }
+    Unindex(endPoint, entry->second);
+    m_endPoints.erase(entry->second.position);
+    m_entries.erase(entry);
+    auto count = m_portCount.find(endPoint->GetLocalPort());
+    if (--count->second == 0)
+    {
+        m_portCount.erase(count);
     }
+    delete endPoint;
 }
 
 /*
@@ -193,10 +204,10 @@ Ipv6EndPointDemux::Lookup(Ipv6Address daddr,
     EndPoints retval4; /* Exact match on all 4 */
 
     NS_LOG_DEBUG("Looking up endpoint for destination address " << daddr);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    std::vector<Ipv6EndPoint*> candidates;
+    GetCandidates(dport, saddr, sport, candidates);
+    for (Ipv6EndPoint* endP : candidates)
     {
-        Ipv6EndPoint* endP = *i;
-
         NS_LOG_DEBUG("Looking at endpoint dport="
                      << endP->GetLocalPort() << " daddr=" << endP->GetLocalAddress()
                      << " sport=" << endP->GetPeerPort() << " saddr=" << endP->GetPeerAddress());
@@ -310,6 +321,25 @@ Ipv6EndPointDemux::Lookup(Ipv6Address daddr,
 Ipv6EndPoint*
 Ipv6EndPointDemux::SimpleLookup(Ipv6Address dst, uint16_t dport, Ipv6Address src, uint16_t sport)
 {
+    // The endpoints which match exactly are found in the index.  The first
+    // one allocated is returned, as when walking the list of endpoints.
+    std::vector<Ipv6EndPoint*> candidates;
+    GetCandidates(dport, src, sport, candidates);
+    Ipv6EndPoint* exact = nullptr;
+    for (Ipv6EndPoint* endPoint : candidates)
+    {
+        if (endPoint->GetLocalAddress() == dst && endPoint->GetPeerPort() == sport &&
+            endPoint->GetPeerAddress() == src &&
+            (exact == nullptr || m_entries.at(endPoint).order < m_entries.at(exact).order))
+        {
+            exact = endPoint;
+        }
+    }
+    if (exact != nullptr || !LookupPortLocal(dport))
+    {
+        return exact;
+    }
+
     uint32_t genericity = 3;
     Ipv6EndPoint* generic = nullptr;
 
@@ -322,13 +352,6 @@ Ipv6EndPointDemux::SimpleLookup(Ipv6Address dst, uint16_t dport, Ipv6Address src
             continue;
         }
 
-        if ((*i)->GetLocalAddress() == dst && (*i)->GetPeerPort() == sport &&
-            (*i)->GetPeerAddress() == src)
-        {
-            /* this is an exact match. */
-            return *i;
-        }
-
         if ((*i)->GetLocalAddress() == Ipv6Address::GetAny())
         {
             tmp++;
@@ -370,6 +393,108 @@ Ipv6EndPointDemux::AllocateEphemeralPort()
     return port;
 }
 
+bool
+Ipv6EndPointDemux::PeerKey::operator==(const PeerKey& other) const
+{
+    return localPort == other.localPort && peerAddress == other.peerAddress &&
+           peerPort == other.peerPort;
+}
+
+std::size_t
+Ipv6EndPointDemux::PeerKeyHash::operator()(const PeerKey& key) const
+{
+    return Ipv6AddressHash()(key.peerAddress) ^
+           std::hash<uint32_t>()((static_cast<uint32_t>(key.localPort) << 16) | key.peerPort);
+}
+
+void
+Ipv6EndPointDemux::Insert(Ipv6EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    m_endPoints.push_back(endPoint);
+    EndPointEntry& entry = m_entries[endPoint];
+    entry.position = std::prev(m_endPoints.end());
+    entry.order = m_order++;
+    Index(endPoint, entry);
+    m_portCount[endPoint->GetLocalPort()]++;
+    endPoint->m_demux = this;
+}
+
+void
+Ipv6EndPointDemux::Index(Ipv6EndPoint* endPoint, EndPointEntry& entry)
+{
+    entry.hasPeer =
+        endPoint->GetPeerAddress() != Ipv6Address::GetAny() && endPoint->GetPeerPort() != 0;
+    if (entry.hasPeer)
+    {
+        entry.key = {endPoint->GetLocalPort(),
+                     endPoint->GetPeerAddress(),
+                     endPoint->GetPeerPort()};
+        m_peerEndPoints[entry.key].push_back(endPoint);
+    }
+    else
+    {
+        m_portEndPoints[endPoint->GetLocalPort()].push_back(endPoint);
+    }
+}
+
+void
+Ipv6EndPointDemux::Unindex(Ipv6EndPoint* endPoint, const EndPointEntry& entry)
+{
+    if (entry.hasPeer)
+    {
+        auto endPoints = m_peerEndPoints.find(entry.key);
+        NS_ASSERT(endPoints != m_peerEndPoints.end());
+        std::erase(endPoints->second, endPoint);
+        if (endPoints->second.empty())
+        {
+            m_peerEndPoints.erase(endPoints);
+        }
+    }
+    else
+    {
+        auto endPoints = m_portEndPoints.find(endPoint->GetLocalPort());
+        NS_ASSERT(endPoints != m_portEndPoints.end());
+        std::erase(endPoints->second, endPoint);
+        if (endPoints->second.empty())
+        {
+            m_portEndPoints.erase(endPoints);
+        }
+    }
+}
+
+void
+Ipv6EndPointDemux::NotifyPeerChange(Ipv6EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    auto entry = m_entries.find(endPoint);
+    NS_ASSERT(entry != m_entries.end());
+    Unindex(endPoint, entry->second);
+    Index(endPoint, entry->second);
+}
+
+void
+Ipv6EndPointDemux::GetCandidates(uint16_t localPort,
+                                 Ipv6Address peerAddress,
+                                 uint16_t peerPort,
+                                 std::vector<Ipv6EndPoint*>& candidates) const
+{
+    candidates.clear();
+    // An endpoint bound to a peer only matches the packets of this peer.
+    auto peerEndPoints = m_peerEndPoints.find({localPort, peerAddress, peerPort});
+    if (peerEndPoints != m_peerEndPoints.end())
+    {
+        candidates = peerEndPoints->second;
+    }
+    auto portEndPoints = m_portEndPoints.find(localPort);
+    if (portEndPoints != m_portEndPoints.end())
+    {
+        candidates.insert(candidates.end(),
+                          portEndPoints->second.begin(),
+                          portEndPoints->second.end());
+    }
+}
+
 Ipv6EndPointDemux::EndPoints
 Ipv6EndPointDemux::GetEndPoints() const
 {
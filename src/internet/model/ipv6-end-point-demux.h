@@ -26,6 +26,8 @@
 
 #include <list>
 #include <stdint.h>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -36,6 +38,10 @@ class Ipv6EndPoint;
  * \ingroup ipv6
  *
  * \brief Demultiplexer for end points.
+ *
+ * The endpoints are indexed by local port and peer, so that a lookup
+ * only looks at the endpoints of the peer and at the endpoints of the local
+ * port which are not bound to a peer.
  */
 class Ipv6EndPointDemux
 {
@@ -161,6 +167,91 @@ class Ipv6EndPointDemux
     EndPoints GetEndPoints() const;
 
   private:
+    friend class Ipv6EndPoint;
+
+    /**
+     * \brief The key of the endpoints whose peer is set.
+     */
+    struct PeerKey
+    {
+        uint16_t localPort;      //!< The local port
+        Ipv6Address peerAddress; //!< The peer address
+        uint16_t peerPort;       //!< The peer port
+
+        /**
+         * \brief Equality operator.
+         * \param other the key to compare with
+         * \return true if the keys are equal
+         */
+        bool operator==(const PeerKey& other) const;
+    };
+
+    /**
+     * \brief Hash function of the PeerKey.
+     */
+    struct PeerKeyHash
+    {
+        /**
+         * \brief Hash a PeerKey.
+         * \param key the key
+         * \return the hash
+         */
+        std::size_t operator()(const PeerKey& key) const;
+    };
+
+    /**
+     * \brief The position of an endpoint in the demux.
+     */
+    struct EndPointEntry
+    {
+        EndPointsI position; //!< The position in the list of endpoints
+        uint64_t order;      //!< The order of allocation of the endpoint
+        bool hasPeer;        //!< True if the endpoint is indexed by its peer
+        PeerKey key;         //!< The key of the endpoint, if indexed by its peer
+    };
+
+    /**
+     * \brief Add an endpoint to the list and to the index.
+     * \param endPoint the endpoint
+     */
+    void Insert(Ipv6EndPoint* endPoint);
+
+    /**
+     * \brief Add an endpoint to the index, under its current peer.
+     * \param endPoint the endpoint
+     * \param entry the entry of the endpoint
+     */
+    void Index(Ipv6EndPoint* endPoint, EndPointEntry& entry);
+
+    /**
+     * \brief Remove an endpoint from the index.
+     * \param endPoint the endpoint
+     * \param entry the entry of the endpoint
+     */
+    void Unindex(Ipv6EndPoint* endPoint, const EndPointEntry& entry);
+
+    /**
+     * \brief Move an endpoint in the index, after its peer was changed.
+     * \param endPoint the endpoint
+     */
+    void NotifyPeerChange(Ipv6EndPoint* endPoint);
+
+    /**
+     * \brief Get the endpoints which can match the packets of a peer.
+     *
+     * These are the endpoints bound to the peer, and the endpoints of the
+     * local port which are not bound to a peer.
+     *
+     * \param localPort the local port
+     * \param peerAddress the peer address
+     * \param peerPort the peer port
+     * \param candidates the endpoints found
+     */
+    void GetCandidates(uint16_t localPort,
+                       Ipv6Address peerAddress,
+                       uint16_t peerPort,
+                       std::vector<Ipv6EndPoint*>& candidates) const;
+
     /**
      * \brief Allocate a ephemeral port.
      * \return a port
@@ -186,6 +277,31 @@ class Ipv6EndPointDemux
      * \brief A list of IPv6 end points.
      */
     EndPoints m_endPoints;
+
+    /**
+     * \brief The entries of the endpoints.
+     */
+    std::unordered_map<Ipv6EndPoint*, EndPointEntry> m_entries;
+
+    /**
+     * \brief The endpoints whose peer address and port are set, by local port and peer.
+     */
+    std::unordered_map<PeerKey, std::vector<Ipv6EndPoint*>, PeerKeyHash> m_peerEndPoints;
+
+    /**
+     * \brief The other endpoints, by local port.
+     */
+    std::unordered_map<uint16_t, std::vector<Ipv6EndPoint*>> m_portEndPoints;
+
+    /**
+     * \brief The number of endpoints, by local port.
+     */
+    std::unordered_map<uint16_t, uint32_t> m_portCount;
+
+    /**
+     * \brief The order of allocation of the next endpoint.
+     */
+    uint64_t m_order;
 };
 
 } /* namespace ns3 */
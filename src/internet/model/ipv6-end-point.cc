@@ -19,6 +19,8 @@
 
 #include "ipv6-end-point.h"
 
+#include "ipv6-end-point-demux.h"
+
 #include "ns3/log.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
@@ -33,7 +35,8 @@ Ipv6EndPoint::Ipv6EndPoint(Ipv6Address addr, uint16_t port)
       m_localPort(port),
       m_peerAddr(Ipv6Address::GetAny()),
       m_peerPort(0),
-      m_rxEnabled(true)
+      m_rxEnabled(true),
+      m_demux(nullptr)
 {
 }
 
@@ -101,6 +104,10 @@ Ipv6EndPoint::SetPeer(Ipv6Address addr, uint16_t port)
 {
     m_peerAddr = addr;
     m_peerPort = port;
+    if (m_demux != nullptr)
+    {
+        m_demux->NotifyPeerChange(this);
+    }
 }
 
 void
@@ -28,6 +28,8 @@
 #include "ns3/node.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -101,9 +103,10 @@ NdiscCache::Lookup(Ipv6Address dst)
 {
     NS_LOG_FUNCTION(this << dst);
 
-    if (m_ndCache.find(dst) != m_ndCache.end())
+    auto it = m_ndCache.find(dst);
+    if (it != m_ndCache.end())
     {
-        NdiscCache::Entry* entry = m_ndCache[dst];
+        NdiscCache::Entry* entry = it->second;
         NS_LOG_LOGIC("Found an entry: " << *entry);
 
         return entry;
@@ -118,13 +121,16 @@ NdiscCache::LookupInverse(Address dst)
     NS_LOG_FUNCTION(this << dst);
 
     std::list<NdiscCache::Entry*> entryList;
-    for (auto i = m_ndCache.begin(); i != m_ndCache.end(); i++)
+    auto entries = m_macEntries.find(dst);
+    if (entries != m_macEntries.end())
     {
-        NdiscCache::Entry* entry = (*i).second;
-        if (entry->GetMacAddress() == dst)
+        entryList.assign(entries->second.begin(), entries->second.end());
+        entryList.sort([](NdiscCache::Entry* a, NdiscCache::Entry* b) {
+            return a->GetIpv6Address() < b->GetIpv6Address();
+        });
+        for (auto entry : entryList)
         {
             NS_LOG_LOGIC("Found an entry:" << (*entry));
-            entryList.push_back(entry);
         }
     }
     return entryList;
@@ -139,6 +145,7 @@ NdiscCache::Add(Ipv6Address to)
     auto entry = new NdiscCache::Entry(this);
     entry->SetIpv6Address(to);
     m_ndCache[to] = entry;
+    InsertMacEntry(entry);
     return entry;
 }
 
@@ -147,14 +154,32 @@ NdiscCache::Remove(NdiscCache::Entry* entry)
 {
     NS_LOG_FUNCTION(this << entry);
 
-    for (auto i = m_ndCache.begin(); i != m_ndCache.end(); i++)
+    auto i = m_ndCache.find(entry->GetIpv6Address());
+    if (i != m_ndCache.end() && (*i).second == entry)
     {
-        if ((*i).second == entry)
+        m_ndCache.erase(i);
+        EraseMacEntry(entry);
+        entry->ClearWaitingPacket();
+        delete entry;
+    }
+}
+
+void
+NdiscCache::InsertMacEntry(NdiscCache::Entry* entry)
+{
+    m_macEntries[entry->GetMacAddress()].push_back(entry);
+}
+
+void
+NdiscCache::EraseMacEntry(NdiscCache::Entry* entry)
+{
+    auto entries = m_macEntries.find(entry->GetMacAddress());
+    if (entries != m_macEntries.end())
+    {
+        std::erase(entries->second, entry);
+        if (entries->second.empty())
         {
-            m_ndCache.erase(i);
-            entry->ClearWaitingPacket();
-            delete entry;
-            return;
+            m_macEntries.erase(entries);
         }
     }
 }
@@ -170,6 +195,7 @@ NdiscCache::Flush()
     }
 
     m_ndCache.erase(m_ndCache.begin(), m_ndCache.end());
+    m_macEntries.clear();
 }
 
 void
@@ -192,7 +218,13 @@ NdiscCache::PrintNdiscCache(Ptr<OutputStreamWrapper> stream)
     NS_LOG_FUNCTION(this << stream);
     std::ostream* os = stream->GetStream();
 
-    for (auto i = m_ndCache.begin(); i != m_ndCache.end(); i++)
+    // print the entries in the order of their addresses
+    std::vector<std::pair<Ipv6Address, NdiscCache::Entry*>> entries(m_ndCache.begin(),
+                                                                     m_ndCache.end());
+    std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+    for (auto i = entries.begin(); i != entries.end(); i++)
     {
         *os << i->first << " dev ";
         std::string found = Names::FindName(m_device);
@@ -249,6 +281,7 @@ NdiscCache::Entry::Entry(NdiscCache* nd)
       m_router(false),
       m_nudTimer(Timer::CANCEL_ON_DESTROY),
       m_lastReachabilityConfirmation(Seconds(0.0)),
+      m_reachableTimerSet(false),
       m_nsRetransmit(0)
 {
     NS_LOG_FUNCTION(this);
@@ -294,6 +327,13 @@ void
 NdiscCache::Entry::FunctionReachableTimeout()
 {
     NS_LOG_FUNCTION(this);
+    Time left = m_lastReachabilityConfirmation + m_nudTimer.GetDelay() - Simulator::Now();
+    if (left.IsStrictlyPositive())
+    {
+        // the reachability was confirmed since the timer was started
+        m_nudTimer.Schedule(left);
+        return;
+    }
     this->MarkStale();
 }
 
@@ -475,6 +515,7 @@ NdiscCache::Entry::StartReachableTimer()
     }
 
     m_lastReachabilityConfirmation = Simulator::Now();
+    m_reachableTimerSet = true;
     m_nudTimer.SetFunction(&NdiscCache::Entry::FunctionReachableTimeout, this);
     m_nudTimer.SetDelay(m_ndCache->m_icmpv6->GetReachableTime());
     m_nudTimer.Schedule();
@@ -488,6 +529,11 @@ NdiscCache::Entry::UpdateReachableTimer()
     if (m_state == REACHABLE)
     {
         m_lastReachabilityConfirmation = Simulator::Now();
+        if (m_reachableTimerSet && m_nudTimer.IsRunning())
+        {
+            // the timer is extended when it expires
+            return;
+        }
         if (m_nudTimer.IsRunning())
         {
             m_nudTimer.Cancel();
@@ -505,6 +551,7 @@ NdiscCache::Entry::StartProbeTimer()
         m_nudTimer.Cancel();
     }
 
+    m_reachableTimerSet = false;
     m_nudTimer.SetFunction(&NdiscCache::Entry::FunctionProbeTimeout, this);
     m_nudTimer.SetDelay(m_ndCache->m_icmpv6->GetRetransmissionTime());
     m_nudTimer.Schedule();
@@ -519,6 +566,7 @@ NdiscCache::Entry::StartDelayTimer()
         m_nudTimer.Cancel();
     }
 
+    m_reachableTimerSet = false;
     m_nudTimer.SetFunction(&NdiscCache::Entry::FunctionDelayTimeout, this);
     m_nudTimer.SetDelay(m_ndCache->m_icmpv6->GetDelayFirstProbe());
     m_nudTimer.Schedule();
@@ -533,6 +581,7 @@ NdiscCache::Entry::StartRetransmitTimer()
         m_nudTimer.Cancel();
     }
 
+    m_reachableTimerSet = false;
     m_nudTimer.SetFunction(&NdiscCache::Entry::FunctionRetransmitTimeout, this);
     m_nudTimer.SetDelay(m_ndCache->m_icmpv6->GetRetransmissionTime());
     m_nudTimer.Schedule();
@@ -563,7 +612,7 @@ NdiscCache::Entry::MarkReachable(Address mac)
 {
     NS_LOG_FUNCTION(this << mac);
     m_state = REACHABLE;
-    m_macAddress = mac;
+    SetMacAddress(mac);
     return m_waiting;
 }
 
@@ -593,7 +642,7 @@ NdiscCache::Entry::MarkStale(Address mac)
 {
     NS_LOG_FUNCTION(this << mac);
     m_state = STALE;
-    m_macAddress = mac;
+    SetMacAddress(mac);
     return m_waiting;
 }
 
@@ -680,7 +729,9 @@ void
 NdiscCache::Entry::SetMacAddress(Address mac)
 {
     NS_LOG_FUNCTION(this << mac << int(m_state));
+    m_ndCache->EraseMacEntry(this);
     m_macAddress = mac;
+    m_ndCache->InsertMacEntry(this);
 }
 
 void
@@ -31,6 +31,8 @@
 #include <list>
 #include <map>
 #include <stdint.h>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -442,6 +444,15 @@ class NdiscCache : public Object
          */
         Time m_lastReachabilityConfirmation;
 
+        /**
+         * \brief True if the NUD timer runs the reachable timeout.
+         *
+         * The reachable timeout is not rescheduled for each reachability
+         * confirmation: it is rescheduled when it expires, if the reachability
+         * has been confirmed since it was started.
+         */
+        bool m_reachableTimerSet;
+
         /**
          * \brief Number of NS retransmission.
          */
@@ -457,11 +468,11 @@ class NdiscCache : public Object
     /**
      * \brief Neighbor Discovery Cache container
      */
-    typedef std::map<Ipv6Address, NdiscCache::Entry*> Cache;
+    typedef std::unordered_map<Ipv6Address, NdiscCache::Entry*, Ipv6AddressHash> Cache;
     /**
      * \brief Neighbor Discovery Cache container iterator
      */
-    typedef std::map<Ipv6Address, NdiscCache::Entry*>::iterator CacheI;
+    typedef Cache::iterator CacheI;
 
     /**
      * \brief A list of Entry.
@@ -469,6 +480,23 @@ class NdiscCache : public Object
     Cache m_ndCache;
 
   private:
+    /**
+     * \brief Add an entry to the index of the entries by MAC address.
+     * \param entry the entry
+     */
+    void InsertMacEntry(NdiscCache::Entry* entry);
+
+    /**
+     * \brief Remove an entry from the index of the entries by MAC address.
+     * \param entry the entry
+     */
+    void EraseMacEntry(NdiscCache::Entry* entry);
+
+    /**
+     * \brief The entries of the cache, by MAC address.
+     */
+    std::map<Address, std::vector<NdiscCache::Entry*>> m_macEntries;
+
     /**
      * \brief The NetDevice.
      */
@@ -295,7 +295,7 @@ TcpTxBuffer::GetNewSegment(uint32_t numBytes)
     NS_ASSERT(it != m_appList.end());
 
     m_appList.erase(it);
-    m_sentList.insert(m_sentList.end(), item);
+    IndexItem(m_sentList.insert(m_sentList.end(), item));
     m_sentSize += item->m_packet->GetSize();
 
     return item;
@@ -309,37 +309,34 @@ TcpTxBuffer::GetTransmittedSegment(uint32_t numBytes, const SequenceNumber32& se
     NS_ASSERT(numBytes <= m_sentSize);
     NS_ASSERT(!m_sentList.empty());
 
-    auto it = m_sentList.begin();
     bool listEdited = false;
     uint32_t s = numBytes;
 
     // Avoid to merge different packet for this retransmission if flags are
     // different.
-    for (; it != m_sentList.end(); ++it)
+    auto found = m_sentIndex.find(seq);
+    if (found != m_sentIndex.end())
     {
-        if ((*it)->m_startSeq == seq)
+        auto it = found->second;
+        auto next = it;
+        next++;
+        if (next != m_sentList.end())
         {
-            auto next = it;
-            next++;
-            if (next != m_sentList.end())
+            // Next is not sacked and have the same value for m_lost ... there is the
+            // possibility to merge
+            if ((!(*next)->m_sacked) && ((*it)->m_lost == (*next)->m_lost))
             {
-                // Next is not sacked and have the same value for m_lost ... there is the
-                // possibility to merge
-                if ((!(*next)->m_sacked) && ((*it)->m_lost == (*next)->m_lost))
-                {
-                    s = std::min(s, (*it)->m_packet->GetSize() + (*next)->m_packet->GetSize());
-                }
-                else
-                {
-                    // Next is sacked... better to retransmit only the first segment
-                    s = std::min(s, (*it)->m_packet->GetSize());
-                }
+                s = std::min(s, (*it)->m_packet->GetSize() + (*next)->m_packet->GetSize());
             }
             else
             {
+                // Next is sacked... better to retransmit only the first segment
                 s = std::min(s, (*it)->m_packet->GetSize());
             }
-            break;
+        }
+        else
+        {
+            s = std::min(s, (*it)->m_packet->GetSize());
         }
     }
 
@@ -349,6 +346,7 @@ TcpTxBuffer::GetTransmittedSegment(uint32_t numBytes, const SequenceNumber32& se
     {
         m_retrans += item->m_packet->GetSize();
         item->m_retrans = true;
+        ReindexItem(item);
     }
 
     return item;
@@ -401,7 +399,7 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
                                const SequenceNumber32& listStartFrom,
                                uint32_t numBytes,
                                const SequenceNumber32& seq,
-                               bool* listEdited) const
+                               bool* listEdited)
 {
     NS_LOG_FUNCTION(this << numBytes << seq);
 
@@ -437,6 +435,19 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
     TcpTxItem* outItem = nullptr;
     auto it = list.begin();
     SequenceNumber32 beginOfCurrentPacket = listStartFrom;
+    bool indexed = (&list == &m_sentList);
+
+    if (indexed)
+    {
+        // Start from the sent item which contains seq, instead of walking the list
+        auto found = m_sentIndex.upper_bound(seq);
+        if (found != m_sentIndex.begin())
+        {
+            --found;
+            it = found->second;
+            beginOfCurrentPacket = found->first;
+        }
+    }
 
     while (it != list.end())
     {
@@ -468,10 +479,19 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
                                          << " and now we recurse because packet ends at "
                                          << beginOfCurrentPacket + currentPacket->GetSize());
                 auto firstPart = new TcpTxItem();
+                if (indexed)
+                {
+                    UnindexItem(currentItem);
+                }
                 SplitItems(firstPart, currentItem, seq - beginOfCurrentPacket);
 
                 // insert firstPart before currentItem
-                list.insert(it, firstPart);
+                auto firstPartIt = list.insert(it, firstPart);
+                if (indexed)
+                {
+                    IndexItem(firstPartIt);
+                    IndexItem(it);
+                }
                 if (listEdited)
                 {
                     *listEdited = true;
@@ -517,6 +537,11 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
                     NS_ASSERT(it != list.begin());
                     TcpTxItem* previous = *(--it);
 
+                    if (indexed)
+                    {
+                        UnindexItem(previous);
+                        UnindexItem(currentItem);
+                    }
                     list.erase(it);
 
                     MergeItems(previous, currentItem);
@@ -534,10 +559,19 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
                 // the end is inside the current packet, but it isn't exactly
                 // the packet end. Just fragment, fix the list, and return.
                 auto firstPart = new TcpTxItem();
+                if (indexed)
+                {
+                    UnindexItem(currentItem);
+                }
                 SplitItems(firstPart, currentItem, numBytes);
 
                 // insert firstPart before currentItem
-                list.insert(it, firstPart);
+                auto firstPartIt = list.insert(it, firstPart);
+                if (indexed)
+                {
+                    IndexItem(firstPartIt);
+                    IndexItem(it);
+                }
                 if (listEdited)
                 {
                     *listEdited = true;
@@ -565,8 +599,17 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
             TcpTxItem* next = (*it); // Please remember we have incremented it
                                      // in the previous if
 
+            if (indexed)
+            {
+                UnindexItem(currentItem);
+                UnindexItem(next);
+            }
             MergeItems(currentItem, next);
-            list.erase(it);
+            it = list.erase(it);
+            if (indexed)
+            {
+                IndexItem(--it);
+            }
 
             delete next;
 
@@ -650,16 +693,16 @@ bool
 TcpTxBuffer::IsRetransmittedDataAcked(const SequenceNumber32& ack) const
 {
     NS_LOG_FUNCTION(this);
-    for (const auto& it : m_sentList)
+    // The only item which can end at ack is the last one starting before it
+    auto found = m_sentIndex.lower_bound(ack);
+    if (found == m_sentIndex.begin())
     {
-        TcpTxItem* item = it;
-        Ptr<Packet> p = item->m_packet;
-        if (item->m_startSeq + p->GetSize() == ack && !item->m_sacked && item->m_retrans)
-        {
-            return true;
-        }
+        return false;
     }
-    return false;
+    --found;
+    TcpTxItem* item = *found->second;
+    Ptr<Packet> p = item->m_packet;
+    return item->m_startSeq + p->GetSize() == ack && !item->m_sacked && item->m_retrans;
 }
 
 void
@@ -707,6 +750,7 @@ TcpTxBuffer::DiscardUpTo(const SequenceNumber32& seq, const Callback<void, TcpTx
 
             RemoveFromCounts(item, pktSize);
 
+            UnindexItem(item);
             i = m_sentList.erase(i);
             NS_LOG_INFO("Removed " << *item << " lost: " << m_lostOut << " retrans: " << m_retrans
                                    << " sacked: " << m_sackedOut << ". Remaining data " << m_size);
@@ -723,9 +767,11 @@ TcpTxBuffer::DiscardUpTo(const SequenceNumber32& seq, const Callback<void, TcpTx
         { // Part of the packet is behind the seqnum. Fragment
             pktSize -= offset;
             NS_LOG_INFO(*item);
+            UnindexItem(item);
             // PacketTags are preserved when fragmenting
             item->m_packet = item->m_packet->CreateFragment(offset, pktSize);
             item->m_startSeq += offset;
+            IndexItem(i);
             m_size -= offset;
             m_sentSize -= offset;
             m_firstByteSeq += offset;
@@ -755,6 +801,7 @@ TcpTxBuffer::DiscardUpTo(const SequenceNumber32& seq, const Callback<void, TcpTx
             // when adding Reno dupacks in the count.
             head->m_sacked = false;
             m_sackedOut -= head->m_packet->GetSize();
+            ReindexItem(head);
             NS_LOG_INFO("Moving the SACK flag from the HEAD to another segment");
             AddRenoSack();
             MarkHeadAsLost();
@@ -788,17 +835,19 @@ TcpTxBuffer::Update(const TcpOptionSack::SackList& list, const Callback<void, Tc
 
     for (auto option_it = list.begin(); option_it != list.end(); ++option_it)
     {
-        auto item_it = m_sentList.begin();
-        SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq;
-
         if (m_firstByteSeq + m_sentSize < (*option_it).first)
         {
             NS_LOG_INFO("Not updating scoreboard, the option block is outside the sent list");
             return bytesSacked;
         }
 
-        while (item_it != m_sentList.end())
+        // The items starting before the block can not be covered by it
+        for (auto index_it = m_sentIndex.lower_bound((*option_it).first);
+             index_it != m_sentIndex.end();
+             ++index_it)
         {
+            auto item_it = index_it->second;
+            SequenceNumber32 beginOfCurrentPacket = index_it->first;
             uint32_t pktSize = (*item_it)->m_packet->GetSize();
 
             // Check the boundary of this packet ... only mark as sacked if
@@ -827,6 +876,7 @@ TcpTxBuffer::Update(const TcpOptionSack::SackList& list, const Callback<void, Tc
                     (*item_it)->m_sacked = true;
                     m_sackedOut += (*item_it)->m_packet->GetSize();
                     bytesSacked += (*item_it)->m_packet->GetSize();
+                    ReindexItem(*item_it);
 
                     if (m_highestSack.first == m_sentList.end() ||
                         m_highestSack.second <= beginOfCurrentPacket + pktSize)
@@ -852,9 +902,6 @@ TcpTxBuffer::Update(const TcpOptionSack::SackList& list, const Callback<void, Tc
                                                << *(*item_it) << "], not found, breaking loop");
                 break;
             }
-
-            beginOfCurrentPacket += pktSize;
-            ++item_it;
         }
     }
 
@@ -876,8 +923,6 @@ void
 TcpTxBuffer::UpdateLostCount()
 {
     NS_LOG_FUNCTION(this);
-    uint32_t sacked = 0;
-    SequenceNumber32 beginOfCurrentPacket = m_highestSack.second;
     if (m_highestSack.first == m_sentList.end())
     {
         NS_LOG_INFO("Status before the update: " << *this
@@ -889,32 +934,43 @@ TcpTxBuffer::UpdateLostCount()
                                                  << *(*m_highestSack.first));
     }
 
-    for (auto it = m_highestSack.first; it != m_sentList.begin(); --it)
-    {
-        TcpTxItem* item = *it;
-        if (item->m_sacked)
-        {
-            sacked++;
-        }
+    NS_ASSERT(m_highestSack.first != m_sentList.end());
 
-        if (sacked >= m_dupAckThresh)
+    // Walk down the SACKed items from the highest one (the head excluded),
+    // up to the one which makes the items below it lost
+    TcpTxItem* head = m_sentList.front();
+    SequenceNumber32 lostBelow = (*m_highestSack.first)->m_startSeq + 1;
+    uint32_t sacked = 0;
+    auto sacked_it = m_sackedIndex.lower_bound(lostBelow);
+    while (sacked < m_dupAckThresh && sacked_it != m_sackedIndex.begin())
+    {
+        --sacked_it;
+        if (*sacked_it <= head->m_startSeq)
         {
-            if (!item->m_sacked && !item->m_lost)
-            {
-                item->m_lost = true;
-                m_lostOut += item->m_packet->GetSize();
-            }
+            break;
         }
-        beginOfCurrentPacket -= item->m_packet->GetSize();
+        lostBelow = *sacked_it;
+        sacked++;
     }
 
     if (sacked >= m_dupAckThresh)
     {
-        TcpTxItem* item = *m_sentList.begin();
-        if (!item->m_lost)
+        // Mark as lost the items below which are neither SACKed nor lost yet
+        auto it = m_unmarkedIndex.upper_bound(head->m_startSeq);
+        while (it != m_unmarkedIndex.end() && *it < lostBelow)
         {
+            TcpTxItem* item = *m_sentIndex.at(*it);
+            ++it;
             item->m_lost = true;
             m_lostOut += item->m_packet->GetSize();
+            ReindexItem(item);
+        }
+
+        if (!head->m_lost)
+        {
+            head->m_lost = true;
+            m_lostOut += head->m_packet->GetSize();
+            ReindexItem(head);
         }
     }
     NS_LOG_INFO("Status after the update: " << *this);
@@ -926,34 +982,25 @@ TcpTxBuffer::IsLost(const SequenceNumber32& seq) const
 {
     NS_LOG_FUNCTION(this << seq);
 
-    SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq;
-
     if (seq >= m_highestSack.second)
     {
         return false;
     }
 
-    // In theory, using a map and hints when inserting elements can improve
-    // performance
-    for (auto it = m_sentList.begin(); it != m_sentList.end(); ++it)
+    for (auto it = m_sentIndex.lower_bound(seq); it != m_sentIndex.end(); ++it)
     {
-        // Search for the right iterator before calling IsLost()
-        if (beginOfCurrentPacket >= seq)
+        const TcpTxItem* item = *it->second;
+        if (item->m_lost)
         {
-            if ((*it)->m_lost)
-            {
-                NS_LOG_INFO("seq=" << seq << " is lost because of lost flag");
-                return true;
-            }
-
-            if ((*it)->m_sacked)
-            {
-                NS_LOG_INFO("seq=" << seq << " is not lost because of sacked flag");
-                return false;
-            }
+            NS_LOG_INFO("seq=" << seq << " is lost because of lost flag");
+            return true;
         }
 
-        beginOfCurrentPacket += (*it)->m_packet->GetSize();
+        if (item->m_sacked)
+        {
+            NS_LOG_INFO("seq=" << seq << " is not lost because of sacked flag");
+            return false;
+        }
     }
 
     return false;
@@ -977,35 +1024,22 @@ TcpTxBuffer::NextSeg(SequenceNumber32* seq, SequenceNumber32* seqHigh, bool isRe
      *
      *     (1.c) IsLost (S2) returns true.
      */
-    TcpTxItem* item;
+    // Condition 1.a , 1.b , and 1.c
+    if (!m_lostIndex.empty())
+    {
+        NS_LOG_INFO("IsLost, returning" << *m_lostIndex.begin());
+        *seq = *m_lostIndex.begin();
+        *seqHigh = *seq + m_segmentSize;
+        return true;
+    }
+
     SequenceNumber32 seqPerRule3;
     bool isSeqPerRule3Valid = false;
-    SequenceNumber32 beginOfCurrentPkt = m_firstByteSeq;
-
-    for (auto it = m_sentList.begin(); it != m_sentList.end(); ++it)
+    if (isRecovery && !m_unsackedIndex.empty())
     {
-        item = *it;
-
-        // Condition 1.a , 1.b , and 1.c
-        if (!item->m_retrans && !item->m_sacked)
-        {
-            if (item->m_lost)
-            {
-                NS_LOG_INFO("IsLost, returning" << beginOfCurrentPkt);
-                *seq = beginOfCurrentPkt;
-                *seqHigh = *seq + m_segmentSize;
-                return true;
-            }
-            else if (seqPerRule3.GetValue() == 0 && isRecovery)
-            {
-                NS_LOG_INFO("Saving for rule 3 the seq " << beginOfCurrentPkt);
-                isSeqPerRule3Valid = true;
-                seqPerRule3 = beginOfCurrentPkt;
-            }
-        }
-
-        // Nothing found, iterate
-        beginOfCurrentPkt += item->m_packet->GetSize();
+        NS_LOG_INFO("Saving for rule 3 the seq " << *m_unsackedIndex.begin());
+        isSeqPerRule3Valid = true;
+        seqPerRule3 = *m_unsackedIndex.begin();
     }
 
     /* (2) If no sequence number 'S2' per rule (1) exists but there
@@ -1218,6 +1252,7 @@ TcpTxBuffer::ResetRenoSack()
     for (auto it = m_sentList.begin(); it != m_sentList.end(); ++it)
     {
         (*it)->m_sacked = false;
+        ReindexItem(*it);
     }
 
     m_highestSack = std::make_pair(m_sentList.end(), SequenceNumber32(0));
@@ -1245,6 +1280,12 @@ TcpTxBuffer::ResetSentList()
         m_sentList.pop_back();
     }
 
+    m_sentIndex.clear();
+    m_sackedIndex.clear();
+    m_lostIndex.clear();
+    m_unsackedIndex.clear();
+    m_unmarkedIndex.clear();
+
     m_sentSize = 0;
     m_lostOut = 0;
     m_retrans = 0;
@@ -1260,6 +1301,7 @@ TcpTxBuffer::ResetLastSegmentSent()
     {
         TcpTxItem* item = m_sentList.back();
 
+        UnindexItem(item);
         m_sentList.pop_back();
         m_sentSize -= item->m_packet->GetSize();
         if (item->m_retrans)
@@ -1311,6 +1353,7 @@ TcpTxBuffer::SetSentListLost(bool resetSack)
         }
 
         (*it)->m_retrans = false;
+        ReindexItem(*it);
     }
 
     NS_LOG_INFO("Set sent list lost, status: " << *this);
@@ -1345,6 +1388,7 @@ TcpTxBuffer::DeleteRetransmittedFlagFromHead()
     {
         m_sentList.front()->m_retrans = false;
         m_retrans -= m_sentList.front()->m_packet->GetSize();
+        ReindexItem(m_sentList.front());
     }
     ConsistencyCheck();
 }
@@ -1374,6 +1418,7 @@ TcpTxBuffer::MarkHeadAsLost()
             m_sentList.front()->m_lost = true;
             m_lostOut += m_sentList.front()->m_packet->GetSize();
         }
+        ReindexItem(m_sentList.front());
     }
     ConsistencyCheck();
 }
@@ -1408,6 +1453,7 @@ TcpTxBuffer::AddRenoSack()
     {
         (*it)->m_sacked = true;
         m_sackedOut += (*it)->m_packet->GetSize();
+        ReindexItem(*it);
         m_highestSack = std::make_pair(it, (*it)->m_startSeq);
         NS_LOG_INFO("Added a Reno SACK, status: " << *this);
     }
@@ -1420,6 +1466,65 @@ TcpTxBuffer::AddRenoSack()
     ConsistencyCheck();
 }
 
+void
+TcpTxBuffer::IndexItem(PacketList::iterator it)
+{
+    const TcpTxItem* item = *it;
+    // The new segments are sent at the end of the list
+    m_sentIndex.emplace_hint(m_sentIndex.end(), item->m_startSeq, it);
+    IndexFlags(item);
+}
+
+void
+TcpTxBuffer::UnindexItem(const TcpTxItem* item)
+{
+    SequenceNumber32 seq = item->m_startSeq;
+
+    m_sentIndex.erase(seq);
+    m_sackedIndex.erase(seq);
+    m_lostIndex.erase(seq);
+    m_unsackedIndex.erase(seq);
+    m_unmarkedIndex.erase(seq);
+}
+
+void
+TcpTxBuffer::ReindexItem(const TcpTxItem* item)
+{
+    SequenceNumber32 seq = item->m_startSeq;
+    NS_ASSERT_MSG(m_sentIndex.count(seq) == 1 && *m_sentIndex.at(seq) == item,
+                  "Item " << *item << " is not indexed");
+
+    m_sackedIndex.erase(seq);
+    m_lostIndex.erase(seq);
+    m_unsackedIndex.erase(seq);
+    m_unmarkedIndex.erase(seq);
+    IndexFlags(item);
+}
+
+void
+TcpTxBuffer::IndexFlags(const TcpTxItem* item)
+{
+    SequenceNumber32 seq = item->m_startSeq;
+
+    if (item->m_sacked)
+    {
+        m_sackedIndex.insert(m_sackedIndex.end(), seq);
+        return;
+    }
+    if (!item->m_lost)
+    {
+        m_unmarkedIndex.insert(m_unmarkedIndex.end(), seq);
+    }
+    if (!item->m_retrans)
+    {
+        m_unsackedIndex.insert(m_unsackedIndex.end(), seq);
+        if (item->m_lost)
+        {
+            m_lostIndex.insert(m_lostIndex.end(), seq);
+        }
+    }
+}
+
 void
 TcpTxBuffer::ConsistencyCheck() const
 {
@@ -1434,8 +1539,21 @@ TcpTxBuffer::ConsistencyCheck() const
     uint32_t lost = 0;
     uint32_t retrans = 0;
 
+    NS_ASSERT_MSG(m_sentIndex.size() == m_sentList.size(),
+                  "Indexed items: " << m_sentIndex.size() << " sent items: " << m_sentList.size());
     for (auto it = m_sentList.begin(); it != m_sentList.end(); ++it)
     {
+        const TcpTxItem* item = *it;
+        SequenceNumber32 seq = item->m_startSeq;
+        auto found = m_sentIndex.find(seq);
+        NS_ASSERT_MSG(found != m_sentIndex.end() && found->second == it,
+                      "Item " << *item << " is not indexed");
+        NS_ASSERT(m_sackedIndex.count(seq) == (item->m_sacked ? 1 : 0));
+        NS_ASSERT(m_lostIndex.count(seq) ==
+                  (item->m_lost && !item->m_retrans && !item->m_sacked ? 1 : 0));
+        NS_ASSERT(m_unsackedIndex.count(seq) == (!item->m_retrans && !item->m_sacked ? 1 : 0));
+        NS_ASSERT(m_unmarkedIndex.count(seq) == (!item->m_sacked && !item->m_lost ? 1 : 0));
+
         if ((*it)->m_sacked)
         {
             sacked += (*it)->m_packet->GetSize();
@@ -28,6 +28,9 @@
 #include "ns3/sequence-number.h"
 #include "ns3/traced-value.h"
 
+#include <map>
+#include <set>
+
 namespace ns3
 {
 class Packet;
@@ -428,8 +431,9 @@ class TcpTxBuffer : public Object
      * The {New}Reno cases, for now, are managed in TcpSocketBase through the
      * call to MarkHeadAsLost.
      * This function is, therefore, called after a SACK option has been received,
-     * and updates the lost count. It can be probably optimized by not walking
-     * the entire list, but a subset.
+     * and updates the lost count. Only the SACKed segments above the point
+     * where the segments start to be lost, and the segments which become lost,
+     * are visited.
      *
      */
     void UpdateLostCount();
@@ -564,7 +568,7 @@ class TcpTxBuffer : public Object
                                  const SequenceNumber32& startingSeq,
                                  uint32_t numBytes,
                                  const SequenceNumber32& requestedSeq,
-                                 bool* listEdited = nullptr) const;
+                                 bool* listEdited = nullptr);
 
     /**
      * \brief Merge two TcpTxItem
@@ -591,8 +595,39 @@ class TcpTxBuffer : public Object
     void SplitItems(TcpTxItem* t1, TcpTxItem* t2, uint32_t size) const;
 
     /**
-     * \brief Check if the values of sacked, lost, retrans, are in sync
-     * with the sent list.
+     * \brief Add an item of the sent list to the scoreboard indexes
+     * \param it the position of the item in the sent list
+     */
+    void IndexItem(PacketList::iterator it);
+
+    /**
+     * \brief Remove an item of the sent list from the scoreboard indexes
+     *
+     * This must be called before the starting sequence of the item changes.
+     *
+     * \param item the item
+     */
+    void UnindexItem(const TcpTxItem* item);
+
+    /**
+     * \brief Update the scoreboard indexes after a change of the flags of an
+     * item of the sent list
+     *
+     * The position of the item in the index of the sent list is unchanged.
+     *
+     * \param item the item
+     */
+    void ReindexItem(const TcpTxItem* item);
+
+    /**
+     * \brief Add an item of the sent list to the scoreboard indexes of its flags
+     * \param item the item
+     */
+    void IndexFlags(const TcpTxItem* item);
+
+    /**
+     * \brief Check if the values of sacked, lost, retrans, and the scoreboard
+     * indexes are in sync with the sent list.
      */
     void ConsistencyCheck() const;
 
@@ -613,6 +648,13 @@ class TcpTxBuffer : public Object
         m_firstByteSeq; //!< Sequence number of the first byte in data (SND.UNA)
     std::pair<PacketList::const_iterator, SequenceNumber32> m_highestSack; //!< Highest SACK byte
 
+    /// The items of the sent list, indexed by their starting sequence
+    std::map<SequenceNumber32, PacketList::iterator> m_sentIndex;
+    std::set<SequenceNumber32> m_sackedIndex;   //!< Starting sequences of the SACKed items
+    std::set<SequenceNumber32> m_lostIndex;     //!< Lost items not retransmitted (NextSeg rule 1)
+    std::set<SequenceNumber32> m_unsackedIndex; //!< Items neither SACKed nor retransmitted
+    std::set<SequenceNumber32> m_unmarkedIndex; //!< Items neither SACKed nor lost
+
     uint32_t m_lostOut{0};   //!< Number of lost bytes
     uint32_t m_sackedOut{0}; //!< Number of sacked bytes
     uint32_t m_retrans{0};   //!< Number of retransmitted bytes
@@ -0,0 +1,241 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/ipv4-end-point-demux.h"
+#include "ns3/ipv4-end-point.h"
+#include "ns3/ipv4-interface.h"
+#include "ns3/ipv6-end-point-demux.h"
+#include "ns3/ipv6-end-point.h"
+#include "ns3/ipv6-interface.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief Check the lookups of the Ipv4EndPointDemux, as the endpoints
+ * are allocated, connected and deallocated.
+ */
+class Ipv4EndPointDemuxTestCase : public TestCase
+{
+  public:
+    Ipv4EndPointDemuxTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Look up the endpoint receiving a packet.
+     * \param demux the demux
+     * \param dport the destination port
+     * \param saddr the source address
+     * \param sport the source port
+     * \return the endpoint, or nullptr if none matches
+     */
+    Ipv4EndPoint* Lookup(Ipv4EndPointDemux& demux,
+                         uint16_t dport,
+                         Ipv4Address saddr,
+                         uint16_t sport);
+
+    Ptr<Ipv4Interface> m_interface; //!< The incoming interface
+};
+
+Ipv4EndPointDemuxTestCase::Ipv4EndPointDemuxTestCase()
+    : TestCase("Check the lookups of the Ipv4EndPointDemux")
+{
+}
+
+Ipv4EndPoint*
+Ipv4EndPointDemuxTestCase::Lookup(Ipv4EndPointDemux& demux,
+                                  uint16_t dport,
+                                  Ipv4Address saddr,
+                                  uint16_t sport)
+{
+    Ipv4EndPointDemux::EndPoints endPoints =
+        demux.Lookup(Ipv4Address("10.0.0.1"), dport, saddr, sport, m_interface);
+    return endPoints.empty() ? nullptr : endPoints.front();
+}
+
+void
+Ipv4EndPointDemuxTestCase::DoRun()
+{
+    m_interface = CreateObject<Ipv4Interface>();
+    Ipv4EndPointDemux demux;
+    Ipv4Address local("10.0.0.1");
+    Ipv4Address peer("10.0.0.2");
+
+    Ipv4EndPoint* listener = demux.Allocate(nullptr, 80);
+    Ipv4EndPoint* first = demux.Allocate(nullptr, local, 80, peer, 1000);
+    Ipv4EndPoint* second = demux.Allocate(nullptr, local, 80, peer, 1001);
+    Ipv4EndPoint* duplicate = demux.Allocate(nullptr, local, 80, peer, 1000);
+    NS_TEST_ASSERT_MSG_EQ(duplicate, nullptr, "A duplicated endpoint was allocated");
+
+    Ipv4EndPoint* found = Lookup(demux, 80, peer, 1000);
+    NS_TEST_EXPECT_MSG_EQ(found, first, "The connected endpoint was not found");
+    found = Lookup(demux, 80, peer, 1001);
+    NS_TEST_EXPECT_MSG_EQ(found, second, "The connected endpoint was not found");
+    found = Lookup(demux, 80, peer, 1002);
+    NS_TEST_EXPECT_MSG_EQ(found, listener, "The listening endpoint was not found");
+    found = Lookup(demux, 81, peer, 1000);
+    NS_TEST_EXPECT_MSG_EQ(found, nullptr, "An endpoint of another port was found");
+
+    // an endpoint connected after its allocation
+    Ipv4EndPoint* client = demux.Allocate();
+    uint16_t clientPort = client->GetLocalPort();
+    NS_TEST_EXPECT_MSG_EQ(demux.LookupPortLocal(clientPort), true, "The port is not allocated");
+    found = Lookup(demux, clientPort, peer, 8080);
+    NS_TEST_EXPECT_MSG_EQ(found, client, "The unconnected endpoint was not found");
+    client->SetPeer(peer, 80);
+    found = Lookup(demux, clientPort, peer, 80);
+    NS_TEST_EXPECT_MSG_EQ(found, client, "The connected endpoint was not found");
+    found = Lookup(demux, clientPort, peer, 8080);
+    NS_TEST_EXPECT_MSG_EQ(found, nullptr, "The endpoint was found for another peer");
+    Ipv4EndPoint* other = demux.Allocate();
+    NS_TEST_EXPECT_MSG_NE(other->GetLocalPort(), clientPort, "An allocated port was reused");
+
+    found = demux.SimpleLookup(local, 80, peer, 1001);
+    NS_TEST_EXPECT_MSG_EQ(found, second, "The exact match was not found");
+    found = demux.SimpleLookup(local, 80, Ipv4Address("10.0.0.3"), 1000);
+    NS_TEST_EXPECT_MSG_EQ(found, first, "The least generic endpoint was not found");
+
+    demux.DeAllocate(first);
+    found = Lookup(demux, 80, peer, 1000);
+    NS_TEST_EXPECT_MSG_EQ(found, listener, "The listening endpoint was not found");
+    demux.DeAllocate(client);
+    NS_TEST_EXPECT_MSG_EQ(demux.LookupPortLocal(clientPort), false, "The port is still used");
+    NS_TEST_EXPECT_MSG_EQ(demux.GetAllEndPoints().size(), 3, "Unexpected number of endpoints");
+
+    m_interface = nullptr;
+}
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief Check the lookups of the Ipv6EndPointDemux, as the endpoints
+ * are allocated, connected and deallocated.
+ */
+class Ipv6EndPointDemuxTestCase : public TestCase
+{
+  public:
+    Ipv6EndPointDemuxTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Look up the endpoint receiving a packet.
+     * \param demux the demux
+     * \param dport the destination port
+     * \param saddr the source address
+     * \param sport the source port
+     * \return the endpoint, or nullptr if none matches
+     */
+    Ipv6EndPoint* Lookup(Ipv6EndPointDemux& demux,
+                         uint16_t dport,
+                         Ipv6Address saddr,
+                         uint16_t sport);
+
+    Ptr<Ipv6Interface> m_interface; //!< The incoming interface
+};
+
+Ipv6EndPointDemuxTestCase::Ipv6EndPointDemuxTestCase()
+    : TestCase("Check the lookups of the Ipv6EndPointDemux")
+{
+}
+
+Ipv6EndPoint*
+Ipv6EndPointDemuxTestCase::Lookup(Ipv6EndPointDemux& demux,
+                                  uint16_t dport,
+                                  Ipv6Address saddr,
+                                  uint16_t sport)
+{
+    Ipv6EndPointDemux::EndPoints endPoints =
+        demux.Lookup(Ipv6Address("2001:db8::1"), dport, saddr, sport, m_interface);
+    return endPoints.empty() ? nullptr : endPoints.front();
+}
+
+void
+Ipv6EndPointDemuxTestCase::DoRun()
+{
+    m_interface = CreateObject<Ipv6Interface>();
+    Ipv6EndPointDemux demux;
+    Ipv6Address local("2001:db8::1");
+    Ipv6Address peer("2001:db8::2");
+
+    Ipv6EndPoint* listener = demux.Allocate(nullptr, 80);
+    Ipv6EndPoint* first = demux.Allocate(nullptr, local, 80, peer, 1000);
+    Ipv6EndPoint* second = demux.Allocate(nullptr, local, 80, peer, 1001);
+    Ipv6EndPoint* duplicate = demux.Allocate(nullptr, local, 80, peer, 1000);
+    NS_TEST_ASSERT_MSG_EQ(duplicate, nullptr, "A duplicated endpoint was allocated");
+
+    Ipv6EndPoint* found = Lookup(demux, 80, peer, 1000);
+    NS_TEST_EXPECT_MSG_EQ(found, first, "The connected endpoint was not found");
+    found = Lookup(demux, 80, peer, 1001);
+    NS_TEST_EXPECT_MSG_EQ(found, second, "The connected endpoint was not found");
+    found = Lookup(demux, 80, peer, 1002);
+    NS_TEST_EXPECT_MSG_EQ(found, listener, "The listening endpoint was not found");
+    found = Lookup(demux, 81, peer, 1000);
+    NS_TEST_EXPECT_MSG_EQ(found, nullptr, "An endpoint of another port was found");
+
+    // an endpoint connected after its allocation
+    Ipv6EndPoint* client = demux.Allocate();
+    uint16_t clientPort = client->GetLocalPort();
+    NS_TEST_EXPECT_MSG_EQ(demux.LookupPortLocal(clientPort), true, "The port is not allocated");
+    found = Lookup(demux, clientPort, peer, 8080);
+    NS_TEST_EXPECT_MSG_EQ(found, client, "The unconnected endpoint was not found");
+    client->SetPeer(peer, 80);
+    found = Lookup(demux, clientPort, peer, 80);
+    NS_TEST_EXPECT_MSG_EQ(found, client, "The connected endpoint was not found");
+    found = Lookup(demux, clientPort, peer, 8080);
+    NS_TEST_EXPECT_MSG_EQ(found, nullptr, "The endpoint was found for another peer");
+    Ipv6EndPoint* other = demux.Allocate();
+    NS_TEST_EXPECT_MSG_NE(other->GetLocalPort(), clientPort, "An allocated port was reused");
+
+    found = demux.SimpleLookup(local, 80, peer, 1001);
+    NS_TEST_EXPECT_MSG_EQ(found, second, "The exact match was not found");
+    found = demux.SimpleLookup(local, 80, Ipv6Address("2001:db8::3"), 1000);
+    NS_TEST_EXPECT_MSG_EQ(found, first, "The least generic endpoint was not found");
+
+    demux.DeAllocate(first);
+    found = Lookup(demux, 80, peer, 1000);
+    NS_TEST_EXPECT_MSG_EQ(found, listener, "The listening endpoint was not found");
+    demux.DeAllocate(client);
+    NS_TEST_EXPECT_MSG_EQ(demux.LookupPortLocal(clientPort), false, "The port is still used");
+    NS_TEST_EXPECT_MSG_EQ(demux.GetEndPoints().size(), 3, "Unexpected number of endpoints");
+
+    m_interface = nullptr;
+}
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief End point demux TestSuite
+ */
+class EndPointDemuxTestSuite : public TestSuite
+{
+  public:
+    EndPointDemuxTestSuite();
+};
+
+EndPointDemuxTestSuite::EndPointDemuxTestSuite()
+    : TestSuite("end-point-demux", UNIT)
+{
+    AddTestCase(new Ipv4EndPointDemuxTestCase, TestCase::QUICK);
+    AddTestCase(new Ipv6EndPointDemuxTestCase, TestCase::QUICK);
+}
+
+/// Static variable for test initialization
+static EndPointDemuxTestSuite g_endPointDemuxTestSuite;
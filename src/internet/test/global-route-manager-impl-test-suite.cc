@@ -27,6 +27,7 @@
 #include "ns3/test.h"
 
 #include <cstdlib> // for rand()
+#include <vector>
 
 using namespace ns3;
 
@@ -72,6 +73,33 @@ GlobalRouteManagerImplTestCase::DoRun()
         v = nullptr;
     }
 
+    // Vertices with the same priority are popped in the order in which they
+    // were pushed, or reordered.
+    std::vector<SPFVertex*> vertices;
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        auto v = new SPFVertex;
+        v->SetVertexId(Ipv4Address(i + 1));
+        v->SetDistanceFromRoot(i == 3 ? 20 : 10);
+        candidate.Push(v);
+        vertices.push_back(v);
+    }
+    SPFVertex* found = candidate.Find(Ipv4Address(4));
+    NS_TEST_ASSERT_MSG_EQ(found, vertices[3], "Did not find the pushed vertex");
+    found = candidate.Find(Ipv4Address(5));
+    NS_TEST_ASSERT_MSG_EQ(found, nullptr, "Found a vertex which was not pushed");
+    vertices[3]->SetDistanceFromRoot(10);
+    candidate.Reorder(vertices[3]);
+    vertices[1]->SetDistanceFromRoot(5);
+    candidate.Reorder(vertices[1]);
+    for (uint32_t i : {1, 0, 2, 3})
+    {
+        SPFVertex* v = candidate.Pop();
+        NS_TEST_ASSERT_MSG_EQ(v, vertices[i], "Unexpected order of the candidates");
+        delete v;
+    }
+    NS_TEST_ASSERT_MSG_EQ(candidate.Empty(), true, "The candidate queue is not empty");
+
     // Build fake link state database; four routers (0-3), 3 point-to-point
     // links
     //
@@ -23,6 +23,7 @@
 #include "ns3/ipv4-global-routing.h"
 #include "ns3/ipv4-l3-protocol.h"
 #include "ns3/ipv4-packet-info-tag.h"
+#include "ns3/ipv4-route.h"
 #include "ns3/ipv4-routing-protocol.h"
 #include "ns3/ipv4-routing-table-entry.h"
 #include "ns3/ipv4-static-routing-helper.h"
@@ -41,6 +42,7 @@
 #include "ns3/udp-socket-factory.h"
 #include "ns3/uinteger.h"
 
+#include <sstream>
 #include <vector>
 
 using namespace ns3;
@@ -1311,6 +1313,209 @@ Ipv4GlobalRoutingSlash32TestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup internet-test
+ *
+ * \brief IPv4 GlobalRouting lookup test, with overlapping routes which are
+ * added and removed.
+ */
+class Ipv4GlobalRoutingLookupTestCase : public TestCase
+{
+  public:
+    Ipv4GlobalRoutingLookupTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Look up the gateway of the route to a destination.
+     * \param dest The destination address.
+     * \param oif The output device, if any.
+     * \return The gateway, or the any address if there is no route.
+     */
+    Ipv4Address Lookup(std::string dest, Ptr<NetDevice> oif = nullptr);
+
+    Ptr<Ipv4GlobalRouting> m_routing; //!< The routing protocol under test.
+};
+
+Ipv4GlobalRoutingLookupTestCase::Ipv4GlobalRoutingLookupTestCase()
+    : TestCase("Global routing lookup of overlapping routes")
+{
+}
+
+Ipv4Address
+Ipv4GlobalRoutingLookupTestCase::Lookup(std::string dest, Ptr<NetDevice> oif)
+{
+    Ipv4Header header;
+    header.SetDestination(Ipv4Address(dest.c_str()));
+    Socket::SocketErrno sockerr;
+    Ptr<Ipv4Route> route = m_routing->RouteOutput(nullptr, header, oif, sockerr);
+    return route ? route->GetGateway() : Ipv4Address::GetAny();
+}
+
+void
+Ipv4GlobalRoutingLookupTestCase::DoRun()
+{
+    Ptr<Node> node = CreateObject<Node>();
+    InternetStackHelper internet;
+    internet.Install(node);
+    Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+    std::vector<Ptr<NetDevice>> devices;
+    for (const char* address : {"10.0.1.1", "10.0.2.1"})
+    {
+        Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice>();
+        device->SetAddress(Mac48Address::Allocate());
+        node->AddDevice(device);
+        int32_t ifIndex = ipv4->AddInterface(device);
+        ipv4->AddAddress(ifIndex, Ipv4InterfaceAddress(Ipv4Address(address), Ipv4Mask("/24")));
+        ipv4->SetUp(ifIndex);
+        devices.emplace_back(device);
+    }
+    m_routing = CreateObject<Ipv4GlobalRouting>();
+    m_routing->SetIpv4(ipv4);
+
+    Ipv4Address gw1("10.0.1.2");
+    Ipv4Address gw2("10.0.2.2");
+    m_routing->AddNetworkRouteTo(Ipv4Address("10.2.0.0"), Ipv4Mask("/16"), gw1, 1);
+    m_routing->AddNetworkRouteTo(Ipv4Address("10.2.3.0"), Ipv4Mask("/24"), gw2, 2);
+    m_routing->AddASExternalRouteTo(Ipv4Address("0.0.0.0"), Ipv4Mask("/0"), gw2, 2);
+
+    // all the matching network routes are candidates, the first one is used
+    NS_TEST_EXPECT_MSG_EQ(Lookup("10.2.3.4"), gw1, "Wrong route to an overlapping network");
+    NS_TEST_EXPECT_MSG_EQ(Lookup("10.2.4.4"), gw1, "Wrong network route");
+    NS_TEST_EXPECT_MSG_EQ(Lookup("10.2.3.4", devices[1]), gw2, "Wrong route on an interface");
+    NS_TEST_EXPECT_MSG_EQ(Lookup("10.2.4.4", devices[1]), gw2, "Wrong external route");
+    NS_TEST_EXPECT_MSG_EQ(Lookup("10.3.0.1"), gw2, "Wrong external route");
+
+    // the host routes come first, including the ones added after a lookup
+    m_routing->AddHostRouteTo(Ipv4Address("10.2.4.4"), gw2, 2);
+    NS_TEST_EXPECT_MSG_EQ(Lookup("10.2.4.4"), gw2, "Wrong host route");
+    NS_TEST_EXPECT_MSG_EQ(Lookup("10.2.4.5"), gw1, "Wrong network route");
+    NS_TEST_EXPECT_MSG_EQ(m_routing->GetNRoutes(), 4, "Wrong number of routes");
+
+    // remove the host route, then the /16 network route
+    m_routing->RemoveRoute(0);
+    NS_TEST_EXPECT_MSG_EQ(Lookup("10.2.4.4"), gw1, "The removed host route is used");
+    m_routing->RemoveRoute(0);
+    NS_TEST_EXPECT_MSG_EQ(Lookup("10.2.3.4"), gw2, "Wrong remaining network route");
+    NS_TEST_EXPECT_MSG_EQ(Lookup("10.2.4.4"), gw2, "Wrong external route");
+    m_routing->RemoveRoute(1);
+    NS_TEST_EXPECT_MSG_EQ(Lookup("10.2.4.4"),
+                          Ipv4Address::GetAny(),
+                          "The removed external route is used");
+
+    m_routing->Dispose();
+    m_routing = nullptr;
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief IPv4 GlobalRouting test of the SPF calculations spread over
+ * several threads, which must compute the same routes as a single one.
+ */
+class Ipv4GlobalRoutingThreadsTestCase : public TestCase
+{
+  public:
+    Ipv4GlobalRoutingThreadsTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Get the global routes of the nodes.
+     * \param nodes The nodes.
+     * \return The routes of each node, one per line.
+     */
+    std::vector<std::string> GetRoutes(const NodeContainer& nodes) const;
+};
+
+Ipv4GlobalRoutingThreadsTestCase::Ipv4GlobalRoutingThreadsTestCase()
+    : TestCase("Global routing SPF calculations in several threads")
+{
+}
+
+std::vector<std::string>
+Ipv4GlobalRoutingThreadsTestCase::GetRoutes(const NodeContainer& nodes) const
+{
+    std::vector<std::string> routes;
+    for (auto i = nodes.Begin(); i != nodes.End(); ++i)
+    {
+        Ptr<Ipv4GlobalRouting> routing =
+            (*i)->GetObject<Ipv4L3Protocol>()->GetRoutingProtocol()->GetObject<Ipv4GlobalRouting>();
+        std::ostringstream oss;
+        for (uint32_t j = 0; j < routing->GetNRoutes(); ++j)
+        {
+            oss << *routing->GetRoute(j) << "\n";
+        }
+        routes.push_back(oss.str());
+    }
+    return routes;
+}
+
+void
+Ipv4GlobalRoutingThreadsTestCase::DoRun()
+{
+    // a grid of routers with point-to-point links, whose first row also
+    // shares a LAN, so that there are equal cost paths and network LSAs
+    const uint32_t side = 6;
+    NodeContainer nodes;
+    nodes.Create(side * side);
+    InternetStackHelper internet;
+    Ipv4GlobalRoutingHelper ipv4RoutingHelper;
+    internet.SetRoutingHelper(ipv4RoutingHelper);
+    internet.Install(nodes);
+
+    SimpleNetDeviceHelper simpleHelper;
+    simpleHelper.SetNetDevicePointToPointMode(true);
+    Ipv4AddressHelper ipv4;
+    ipv4.SetBase("10.1.0.0", "255.255.255.252");
+    for (uint32_t row = 0; row < side; ++row)
+    {
+        for (uint32_t col = 0; col < side; ++col)
+        {
+            uint32_t n = row * side + col;
+            for (uint32_t peer : {col + 1 < side ? n + 1 : n, row + 1 < side ? n + side : n})
+            {
+                if (peer == n)
+                {
+                    continue;
+                }
+                NetDeviceContainer link =
+                    simpleHelper.Install(NodeContainer(nodes.Get(n), nodes.Get(peer)),
+                                         CreateObject<SimpleChannel>());
+                ipv4.Assign(link);
+                ipv4.NewNetwork();
+            }
+        }
+    }
+    NodeContainer lanNodes;
+    for (uint32_t col = 0; col < side; ++col)
+    {
+        lanNodes.Add(nodes.Get(col));
+    }
+    simpleHelper.SetNetDevicePointToPointMode(false);
+    NetDeviceContainer lan = simpleHelper.Install(lanNodes, CreateObject<SimpleChannel>());
+    ipv4.SetBase("10.2.0.0", "255.255.255.0");
+    ipv4.Assign(lan);
+
+    Ipv4GlobalRoutingHelper::PopulateRoutingTables();
+    std::vector<std::string> expected = GetRoutes(nodes);
+    NS_TEST_ASSERT_MSG_NE(expected[side + 1], "", "No route computed");
+
+    Config::SetGlobal("GlobalRoutingSpfThreads", UintegerValue(4));
+    Ipv4GlobalRoutingHelper::RecomputeRoutingTables();
+    std::vector<std::string> routes = GetRoutes(nodes);
+    Config::SetGlobal("GlobalRoutingSpfThreads", UintegerValue(1));
+    for (uint32_t i = 0; i < nodes.GetN(); ++i)
+    {
+        NS_TEST_EXPECT_MSG_EQ(routes[i], expected[i], "Different routes on node " << i);
+    }
+
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup internet-test
  *
@@ -1333,6 +1538,8 @@ Ipv4GlobalRoutingTestSuite::Ipv4GlobalRoutingTestSuite()
     AddTestCase(new TwoBridgeTest, TestCase::QUICK);
     AddTestCase(new Ipv4DynamicGlobalRoutingTestCase, TestCase::QUICK);
     AddTestCase(new Ipv4GlobalRoutingSlash32TestCase, TestCase::QUICK);
+    AddTestCase(new Ipv4GlobalRoutingLookupTestCase, TestCase::QUICK);
+    AddTestCase(new Ipv4GlobalRoutingThreadsTestCase, TestCase::QUICK);
 }
 
 static Ipv4GlobalRoutingTestSuite
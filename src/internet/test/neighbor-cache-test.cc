@@ -17,15 +17,20 @@
  * Author: Zhiheng Dong <dzh2077@gmail.com>
  */
 
+#include "ns3/arp-cache.h"
 #include "ns3/icmpv4-l4-protocol.h"
 #include "ns3/icmpv6-l4-protocol.h"
 #include "ns3/internet-stack-helper.h"
 #include "ns3/ipv4-address-helper.h"
+#include "ns3/ipv4-interface.h"
 #include "ns3/ipv4-l3-protocol.h"
 #include "ns3/ipv4-routing-helper.h"
 #include "ns3/ipv6-address-helper.h"
+#include "ns3/ipv6-interface.h"
 #include "ns3/ipv6-l3-protocol.h"
 #include "ns3/ipv6-routing-helper.h"
+#include "ns3/mac48-address.h"
+#include "ns3/ndisc-cache.h"
 #include "ns3/neighbor-cache-helper.h"
 #include "ns3/simple-channel.h"
 #include "ns3/simple-net-device-helper.h"
@@ -1221,6 +1226,300 @@ DynamicPartialTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup internet-test
+ *
+ * \brief ARP Cache Test
+ */
+class ArpCacheTest : public TestCase
+{
+  public:
+    void DoRun() override;
+    ArpCacheTest();
+
+  private:
+    /**
+     * \brief Record an ARP request of the cache.
+     * \param arpCache The cache.
+     * \param to The address requested.
+     */
+    void RecordRequest(Ptr<const ArpCache> arpCache, Ipv4Address to);
+
+    /**
+     * \brief Record a packet dropped by the cache.
+     * \param packet The packet.
+     */
+    void RecordDrop(Ptr<const Packet> packet);
+
+    /**
+     * \brief Check the entries found by LookupInverse().
+     * \param mac The MAC address looked up.
+     * \param expected The addresses of the entries expected, in order.
+     */
+    void CheckLookupInverse(Address mac, std::vector<Ipv4Address> expected);
+
+    NodeContainer m_nodes;                                  //!< Nodes used in the test.
+    Ptr<ArpCache> m_arpCache;                               //!< The cache tested.
+    std::vector<std::pair<Ipv4Address, Time>> m_requests;  //!< ARP requests sent.
+    std::vector<Time> m_drops;                              //!< Times of the packets dropped.
+};
+
+ArpCacheTest::ArpCacheTest()
+    : TestCase("The ArpCacheTest checks the entries found from a MAC address after their "
+               "removal, and the retransmissions of the ARP requests.")
+{
+}
+
+void
+ArpCacheTest::RecordRequest(Ptr<const ArpCache> arpCache, Ipv4Address to)
+{
+    m_requests.emplace_back(to, Simulator::Now());
+}
+
+void
+ArpCacheTest::RecordDrop(Ptr<const Packet> packet)
+{
+    m_drops.push_back(Simulator::Now());
+}
+
+void
+ArpCacheTest::CheckLookupInverse(Address mac, std::vector<Ipv4Address> expected)
+{
+    std::list<ArpCache::Entry*> entries = m_arpCache->LookupInverse(mac);
+    NS_TEST_ASSERT_MSG_EQ(entries.size(), expected.size(), "Wrong number of entries for " << mac);
+    auto address = expected.begin();
+    for (ArpCache::Entry* entry : entries)
+    {
+        NS_TEST_EXPECT_MSG_EQ(entry->GetIpv4Address(), *address, "Wrong entry for " << mac);
+        NS_TEST_EXPECT_MSG_EQ(entry->GetMacAddress(), mac, "Wrong MAC address");
+        address++;
+    }
+}
+
+void
+ArpCacheTest::DoRun()
+{
+    m_nodes.Create(2);
+
+    Ptr<SimpleChannel> channel = CreateObject<SimpleChannel>();
+    SimpleNetDeviceHelper simpleHelper;
+    NetDeviceContainer net = simpleHelper.Install(m_nodes, channel);
+
+    InternetStackHelper internet;
+    internet.SetIpv6StackInstall(false);
+    internet.Install(m_nodes);
+
+    Ipv4AddressHelper ipv4;
+    ipv4.SetBase("10.1.1.0", "255.255.255.0");
+    Ipv4InterfaceContainer i = ipv4.Assign(net);
+
+    std::pair<Ptr<Ipv4>, uint32_t> returnValue = i.Get(0);
+    Ptr<Ipv4Interface> iface =
+        DynamicCast<Ipv4L3Protocol>(returnValue.first)->GetInterface(returnValue.second);
+    m_arpCache = iface->GetArpCache();
+    m_arpCache->SetArpRequestCallback(MakeCallback(&ArpCacheTest::RecordRequest, this));
+    m_arpCache->TraceConnectWithoutContext("Drop", MakeCallback(&ArpCacheTest::RecordDrop, this));
+    m_arpCache->SetWaitReplyTimeout(Seconds(1));
+
+    // entries found from their MAC address, after their removal
+    Mac48Address mac1("00:00:00:00:aa:01");
+    Mac48Address mac2("00:00:00:00:aa:02");
+    Ipv4Address a1("10.1.1.11");
+    Ipv4Address a2("10.1.1.10");
+    Ipv4Address a3("10.1.1.12");
+    ArpCache::Entry* entry1 = m_arpCache->Add(a1);
+    entry1->SetMacAddress(mac1);
+    entry1->MarkPermanent();
+    ArpCache::Entry* entry2 = m_arpCache->Add(a2);
+    entry2->SetMacAddress(mac1);
+    entry2->MarkPermanent();
+    CheckLookupInverse(mac1, {a2, a1});
+    entry1->SetMacAddress(mac2);
+    CheckLookupInverse(mac1, {a2});
+    CheckLookupInverse(mac2, {a1});
+    m_arpCache->Remove(entry2);
+    CheckLookupInverse(mac1, {});
+    CheckLookupInverse(mac2, {a1});
+    ArpCache::Entry* entry3 = m_arpCache->Add(a3);
+    entry3->SetMacAddress(mac1);
+    entry3->MarkPermanent();
+    m_arpCache->Flush();
+    CheckLookupInverse(mac1, {});
+    CheckLookupInverse(mac2, {});
+    NS_TEST_EXPECT_MSG_EQ(m_arpCache->Lookup(a3), nullptr, "Entry left after a Flush");
+    entry3 = m_arpCache->Add(a3);
+    entry3->SetMacAddress(mac1);
+    entry3->MarkPermanent();
+    CheckLookupInverse(mac1, {a3});
+
+    // an address which never replies, and one which replies after a retry
+    Ipv4Address unanswered("10.1.1.20");
+    Ipv4Address answered("10.1.1.21");
+    Simulator::Schedule(Seconds(0.1), [this, unanswered]() {
+        m_arpCache->Add(unanswered)->MarkWaitReply(
+            ArpCache::Ipv4PayloadHeaderPair(Create<Packet>(100), Ipv4Header()));
+    });
+    Simulator::Schedule(Seconds(0.5), [this, answered]() {
+        m_arpCache->Add(answered)->MarkWaitReply(
+            ArpCache::Ipv4PayloadHeaderPair(Create<Packet>(100), Ipv4Header()));
+    });
+    Simulator::Schedule(Seconds(1.5), [this, answered, mac2]() {
+        m_arpCache->Lookup(answered)->MarkAlive(mac2);
+    });
+    Simulator::Stop(Seconds(10));
+    Simulator::Run();
+
+    // the WaitReply timer runs from the first request, the entries are visited
+    // in address order, and the requests are retransmitted MaxRetries (3)
+    // times before the pending packet is dropped
+    std::vector<std::pair<Ipv4Address, Time>> requests = {{unanswered, Seconds(1.1)},
+                                                          {answered, Seconds(1.1)},
+                                                          {unanswered, Seconds(2.1)},
+                                                          {unanswered, Seconds(3.1)}};
+    NS_TEST_ASSERT_MSG_EQ(m_requests.size(), requests.size(), "Wrong number of ARP requests");
+    for (std::size_t n = 0; n < requests.size(); n++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_requests[n].first, requests[n].first, "Wrong ARP request");
+        NS_TEST_EXPECT_MSG_EQ(m_requests[n].second, requests[n].second, "Wrong ARP request time");
+    }
+    NS_TEST_ASSERT_MSG_EQ(m_drops.size(), 1, "Wrong number of packets dropped");
+    NS_TEST_EXPECT_MSG_EQ(m_drops[0], Seconds(4.1), "Wrong drop time");
+    NS_TEST_EXPECT_MSG_EQ(m_arpCache->Lookup(unanswered)->IsDead(), true, "Entry not dead");
+    NS_TEST_EXPECT_MSG_EQ(m_arpCache->Lookup(answered)->IsAlive(), true, "Entry not alive");
+    CheckLookupInverse(mac2, {answered});
+
+    m_arpCache = nullptr;
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief NDISC Cache Test
+ */
+class NdiscCacheTest : public TestCase
+{
+  public:
+    void DoRun() override;
+    NdiscCacheTest();
+
+  private:
+    /**
+     * \brief Check the state of an entry.
+     * \param address The address of the entry.
+     * \param reachable Whether the entry is expected to be REACHABLE, or else STALE.
+     */
+    void CheckState(Ipv6Address address, bool reachable);
+
+    NodeContainer m_nodes;       //!< Nodes used in the test.
+    Ptr<NdiscCache> m_ndiscCache; //!< The cache tested.
+};
+
+NdiscCacheTest::NdiscCacheTest()
+    : TestCase("The NdiscCacheTest checks the times when the REACHABLE entries become STALE, "
+               "and the entries found from a MAC address after their removal.")
+{
+}
+
+void
+NdiscCacheTest::CheckState(Ipv6Address address, bool reachable)
+{
+    NdiscCache::Entry* entry = m_ndiscCache->Lookup(address);
+    NS_TEST_ASSERT_MSG_NE(entry, nullptr, "Entry " << address << " not found");
+    NS_TEST_EXPECT_MSG_EQ(entry->IsReachable(),
+                          reachable,
+                          "Wrong state of " << address << " at " << Simulator::Now());
+    NS_TEST_EXPECT_MSG_EQ(entry->IsStale(),
+                          !reachable,
+                          "Wrong state of " << address << " at " << Simulator::Now());
+}
+
+void
+NdiscCacheTest::DoRun()
+{
+    m_nodes.Create(2);
+
+    Ptr<SimpleChannel> channel = CreateObject<SimpleChannel>();
+    SimpleNetDeviceHelper simpleHelper;
+    NetDeviceContainer net = simpleHelper.Install(m_nodes, channel);
+
+    InternetStackHelper internet;
+    internet.SetIpv4StackInstall(false);
+    internet.Install(m_nodes);
+
+    Ipv6AddressHelper ipv6;
+    ipv6.SetBase(Ipv6Address("2001:0::"), Ipv6Prefix(64));
+    Ipv6InterfaceContainer i = ipv6.Assign(net);
+
+    std::pair<Ptr<Ipv6>, uint32_t> returnValue = i.Get(0);
+    Ptr<Ipv6Interface> iface =
+        DynamicCast<Ipv6L3Protocol>(returnValue.first)->GetInterface(returnValue.second);
+    m_ndiscCache = iface->GetNdiscCache();
+
+    // the reachable time is 30 s, from the last reachability confirmation; the
+    // addresses are not those of the nodes, so that no traffic confirms them
+    Mac48Address mac1("00:00:00:00:aa:01");
+    Mac48Address mac2("00:00:00:00:aa:02");
+    Ipv6Address confirmed("2001::10");
+    Ipv6Address unconfirmed("2001::11");
+    Simulator::Schedule(Seconds(1), [this, confirmed, unconfirmed, mac1, mac2]() {
+        NdiscCache::Entry* entry = m_ndiscCache->Add(confirmed);
+        entry->MarkReachable(mac1);
+        entry->StartReachableTimer();
+        entry = m_ndiscCache->Add(unconfirmed);
+        entry->MarkReachable(mac2);
+        entry->StartReachableTimer();
+    });
+    for (Time confirmation : {Seconds(11), Seconds(21)})
+    {
+        Simulator::Schedule(confirmation, [this, confirmed]() {
+            m_ndiscCache->Lookup(confirmed)->UpdateReachableTimer();
+        });
+    }
+    Simulator::Schedule(Seconds(30.9), &NdiscCacheTest::CheckState, this, unconfirmed, true);
+    Simulator::Schedule(Seconds(31.1), &NdiscCacheTest::CheckState, this, unconfirmed, false);
+    Simulator::Schedule(Seconds(31.1), &NdiscCacheTest::CheckState, this, confirmed, true);
+    Simulator::Schedule(Seconds(50.9), &NdiscCacheTest::CheckState, this, confirmed, true);
+    Simulator::Schedule(Seconds(51.1), &NdiscCacheTest::CheckState, this, confirmed, false);
+    // an entry confirmed again after it became STALE
+    Simulator::Schedule(Seconds(60), [this, unconfirmed]() {
+        NdiscCache::Entry* entry = m_ndiscCache->Lookup(unconfirmed);
+        entry->MarkReachable();
+        entry->StartReachableTimer();
+    });
+    Simulator::Schedule(Seconds(70), [this, unconfirmed]() {
+        m_ndiscCache->Lookup(unconfirmed)->UpdateReachableTimer();
+    });
+    Simulator::Schedule(Seconds(99.9), &NdiscCacheTest::CheckState, this, unconfirmed, true);
+    Simulator::Schedule(Seconds(100.1), &NdiscCacheTest::CheckState, this, unconfirmed, false);
+    Simulator::Stop(Seconds(110));
+    Simulator::Run();
+
+    // entries found from their MAC address, after their removal
+    std::list<NdiscCache::Entry*> entries = m_ndiscCache->LookupInverse(mac1);
+    NS_TEST_ASSERT_MSG_EQ(entries.size(), 1, "Wrong number of entries");
+    NS_TEST_EXPECT_MSG_EQ(entries.front()->GetIpv6Address(), confirmed, "Wrong entry");
+    m_ndiscCache->Lookup(unconfirmed)->MarkStale(mac1);
+    entries = m_ndiscCache->LookupInverse(mac1);
+    NS_TEST_ASSERT_MSG_EQ(entries.size(), 2, "Wrong number of entries");
+    NS_TEST_EXPECT_MSG_EQ(entries.front()->GetIpv6Address(), confirmed, "Wrong entry");
+    NS_TEST_EXPECT_MSG_EQ(entries.back()->GetIpv6Address(), unconfirmed, "Wrong entry");
+    NS_TEST_EXPECT_MSG_EQ(m_ndiscCache->LookupInverse(mac2).size(), 0, "Entry left");
+    m_ndiscCache->Remove(m_ndiscCache->Lookup(confirmed));
+    entries = m_ndiscCache->LookupInverse(mac1);
+    NS_TEST_ASSERT_MSG_EQ(entries.size(), 1, "Wrong number of entries");
+    NS_TEST_EXPECT_MSG_EQ(entries.front()->GetIpv6Address(), unconfirmed, "Wrong entry");
+    m_ndiscCache->Flush();
+    NS_TEST_EXPECT_MSG_EQ(m_ndiscCache->LookupInverse(mac1).size(), 0, "Entry left");
+    m_ndiscCache->Add(confirmed)->MarkStale(mac1);
+    entries = m_ndiscCache->LookupInverse(mac1);
+    NS_TEST_ASSERT_MSG_EQ(entries.size(), 1, "Wrong number of entries");
+    NS_TEST_EXPECT_MSG_EQ(entries.front()->GetIpv6Address(), confirmed, "Wrong entry");
+
+    m_ndiscCache = nullptr;
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup internet-test
  *
@@ -1239,6 +1538,8 @@ class NeighborCacheTestSuite : public TestSuite
         AddTestCase(new FlushTest, TestCase::QUICK);
         AddTestCase(new DuplicateTest, TestCase::QUICK);
         AddTestCase(new DynamicPartialTest, TestCase::QUICK);
+        AddTestCase(new ArpCacheTest, TestCase::QUICK);
+        AddTestCase(new NdiscCacheTest, TestCase::QUICK);
     }
 };
 
@@ -53,6 +53,8 @@ class TcpTxBufferTestCase : public TestCase
     /** \brief Test the logic of merging items in GetTransmittedSegment()
      * which is triggered by CopyFromSequence()*/
     void TestMergeItemsWhenGetTransmittedSegment();
+    /** \brief Test the scoreboard with many segments in flight */
+    void TestScoreboard();
     /**
      * \brief Callback to provide a value of receiver window
      * \returns the receiver window size
@@ -100,6 +102,13 @@ TcpTxBufferTestCase::DoRun()
                         &TcpTxBufferTestCase::TestMergeItemsWhenGetTransmittedSegment,
                         this);
 
+    /*
+     * One segment every ten is lost, and the others are SACKed:
+     * -> the lost segments are returned in order by NextSeg, and retransmitted
+     * -> the counts follow the retransmissions, and the ACK of the lost segments
+     */
+    Simulator::Schedule(Seconds(0.0), &TcpTxBufferTestCase::TestScoreboard, this);
+
     Simulator::Run();
     Simulator::Destroy();
 }
@@ -425,6 +434,69 @@ TcpTxBufferTestCase::TestTransmittedBlock()
 {
 }
 
+void
+TcpTxBufferTestCase::TestScoreboard()
+{
+    Ptr<TcpTxBuffer> txBuf = CreateObject<TcpTxBuffer>();
+    txBuf->SetRWndCallback(MakeCallback(&TcpTxBufferTestCase::GetRWnd, this));
+    txBuf->SetHeadSequence(SequenceNumber32(1));
+    txBuf->SetMaxBufferSize(100000);
+    txBuf->SetSegmentSize(1000);
+    txBuf->SetDupAckThresh(3);
+    txBuf->Add(Create<Packet>(100000));
+
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        txBuf->CopyFromSequence(1000, SequenceNumber32(i * 1000 + 1));
+    }
+
+    // Segments 0, 10, 20, ... are lost
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        TcpOptionSack::SackList sackList;
+        sackList.emplace_back(SequenceNumber32((i * 10 + 1) * 1000 + 1),
+                              SequenceNumber32((i * 10 + 10) * 1000 + 1));
+        txBuf->Update(sackList);
+    }
+    uint32_t sacked = txBuf->GetSacked();
+    NS_TEST_ASSERT_MSG_EQ(sacked, 90000, "Wrong count of SACKed bytes");
+    uint32_t lost = txBuf->GetLost();
+    NS_TEST_ASSERT_MSG_EQ(lost, 10000, "Wrong count of lost bytes");
+    bool isLost = txBuf->IsLost(SequenceNumber32(50001));
+    NS_TEST_ASSERT_MSG_EQ(isLost, true, "Segment should be lost");
+    isLost = txBuf->IsLost(SequenceNumber32(50002));
+    NS_TEST_ASSERT_MSG_EQ(isLost, false, "Segment should not be lost");
+
+    SequenceNumber32 seq;
+    SequenceNumber32 seqHigh;
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        bool found = txBuf->NextSeg(&seq, &seqHigh, true);
+        NS_TEST_ASSERT_MSG_EQ(found, true, "No lost segment found");
+        NS_TEST_ASSERT_MSG_EQ(seq, SequenceNumber32(i * 10000 + 1), "Wrong lost segment");
+        txBuf->CopyFromSequence(1000, seq);
+    }
+    bool found = txBuf->NextSeg(&seq, &seqHigh, true);
+    NS_TEST_ASSERT_MSG_EQ(found, false, "All the lost segments are retransmitted");
+    uint32_t retrans = txBuf->GetRetransmitsCount();
+    NS_TEST_ASSERT_MSG_EQ(retrans, 10000, "Wrong count of retransmitted bytes");
+    uint32_t inFlight = txBuf->BytesInFlight();
+    NS_TEST_ASSERT_MSG_EQ(inFlight, 10000, "Wrong count of bytes in flight");
+
+    bool acked = txBuf->IsRetransmittedDataAcked(SequenceNumber32(11001));
+    NS_TEST_ASSERT_MSG_EQ(acked, true, "The retransmitted segment is ACKed");
+    acked = txBuf->IsRetransmittedDataAcked(SequenceNumber32(12001));
+    NS_TEST_ASSERT_MSG_EQ(acked, false, "The SACKed segment is not retransmitted");
+
+    txBuf->DiscardUpTo(SequenceNumber32(10001));
+    sacked = txBuf->GetSacked();
+    NS_TEST_ASSERT_MSG_EQ(sacked, 81000, "Wrong count of SACKed bytes");
+    lost = txBuf->GetLost();
+    NS_TEST_ASSERT_MSG_EQ(lost, 9000, "Wrong count of lost bytes");
+    retrans = txBuf->GetRetransmitsCount();
+    NS_TEST_ASSERT_MSG_EQ(retrans, 9000, "Wrong count of retransmitted bytes");
+}
+
 void
 TcpTxBufferTestCase::DoTeardown()
 {
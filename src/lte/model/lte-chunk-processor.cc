@@ -50,7 +50,11 @@ void
 LteChunkProcessor::Start()
 {
     NS_LOG_FUNCTION(this);
-    m_sumValues = nullptr;
+    // the sum is kept from one calculation to the next, to reuse its storage
+    if (m_sumValues)
+    {
+        (*m_sumValues) = 0.0;
+    }
     m_totDuration = MicroSeconds(0);
 }
 
@@ -58,11 +62,16 @@ void
 LteChunkProcessor::EvaluateChunk(const SpectrumValue& sinr, Time duration)
 {
     NS_LOG_FUNCTION(this << sinr << duration);
-    if (!m_sumValues)
+    if (!m_sumValues || m_sumValues->GetSpectrumModel() != sinr.GetSpectrumModel())
     {
         m_sumValues = Create<SpectrumValue>(sinr.GetSpectrumModel());
     }
-    (*m_sumValues) += sinr * duration.GetSeconds();
+    double seconds = duration.GetSeconds();
+    auto sum = m_sumValues->ValuesBegin();
+    for (auto it = sinr.ConstValuesBegin(); it != sinr.ConstValuesEnd(); ++it, ++sum)
+    {
+        *sum += *it * seconds;
+    }
     m_totDuration += duration;
 }
 
@@ -52,6 +52,9 @@ LteInterference::DoDispose()
     m_rxSignal = nullptr;
     m_allSignals = nullptr;
     m_noise = nullptr;
+    m_interf = nullptr;
+    m_sinr = nullptr;
+    m_pendingSignals.clear();
     Object::DoDispose();
 }
 
@@ -69,7 +72,14 @@ LteInterference::StartRx(Ptr<const SpectrumValue> rxPsd)
     if (!m_receiving)
     {
         NS_LOG_LOGIC("first signal");
-        m_rxSignal = rxPsd->Copy();
+        if (m_rxSignal && m_rxSignal->GetSpectrumModel() == rxPsd->GetSpectrumModel())
+        {
+            *m_rxSignal = *rxPsd;
+        }
+        else
+        {
+            m_rxSignal = rxPsd->Copy();
+        }
         m_lastChangeTime = Now();
         m_receiving = true;
         for (auto it = m_rsPowerChunkProcessorList.begin(); it != m_rsPowerChunkProcessorList.end();
@@ -142,7 +152,12 @@ LteInterference::AddSignal(Ptr<const SpectrumValue> spd, const Time duration)
         // boundary further.
         m_lastSignalIdBeforeReset += 0x10000000;
     }
-    Simulator::Schedule(duration, &LteInterference::DoSubtractSignal, this, spd, signalId);
+    auto [it, inserted] = m_pendingSignals.try_emplace(Now() + duration);
+    it->second.emplace_back(spd, signalId);
+    if (inserted)
+    {
+        Simulator::Schedule(duration, &LteInterference::DoSubtractSignals, this);
+    }
 }
 
 void
@@ -169,6 +184,24 @@ LteInterference::DoSubtractSignal(Ptr<const SpectrumValue> spd, uint32_t signalI
     }
 }
 
+void
+LteInterference::DoSubtractSignals()
+{
+    NS_LOG_FUNCTION(this);
+    auto it = m_pendingSignals.begin();
+    if (it == m_pendingSignals.end())
+    {
+        NS_LOG_INFO("ignoring signals scheduled for subtraction before disposal");
+        return;
+    }
+    NS_ASSERT(it->first == Now());
+    for (const auto& [spd, signalId] : it->second)
+    {
+        DoSubtractSignal(spd, signalId);
+    }
+    m_pendingSignals.erase(it);
+}
+
 void
 LteInterference::ConditionallyEvaluateChunk()
 {
@@ -183,18 +216,27 @@ LteInterference::ConditionallyEvaluateChunk()
         NS_LOG_LOGIC(this << " signal = " << *m_rxSignal << " allSignals = " << *m_allSignals
                           << " noise = " << *m_noise);
 
-        SpectrumValue interf = (*m_allSignals) - (*m_rxSignal) + (*m_noise);
+        NS_ASSERT(m_rxSignal->GetSpectrumModel() == m_noise->GetSpectrumModel());
+        auto allSignals = m_allSignals->ConstValuesBegin();
+        auto rxSignal = m_rxSignal->ConstValuesBegin();
+        auto noise = m_noise->ConstValuesBegin();
+        auto interf = m_interf->ValuesBegin();
+        auto sinr = m_sinr->ValuesBegin();
+        for (std::size_t i = 0; i < m_interf->GetValuesN(); i++)
+        {
+            interf[i] = allSignals[i] - rxSignal[i] + noise[i];
+            sinr[i] = rxSignal[i] / interf[i];
+        }
 
-        SpectrumValue sinr = (*m_rxSignal) / interf;
         Time duration = Now() - m_lastChangeTime;
         for (auto it = m_sinrChunkProcessorList.begin(); it != m_sinrChunkProcessorList.end(); ++it)
         {
-            (*it)->EvaluateChunk(sinr, duration);
+            (*it)->EvaluateChunk(*m_sinr, duration);
         }
         for (auto it = m_interfChunkProcessorList.begin(); it != m_interfChunkProcessorList.end();
              ++it)
         {
-            (*it)->EvaluateChunk(interf, duration);
+            (*it)->EvaluateChunk(*m_interf, duration);
         }
         for (auto it = m_rsPowerChunkProcessorList.begin(); it != m_rsPowerChunkProcessorList.end();
              ++it)
@@ -214,6 +256,8 @@ LteInterference::SetNoisePowerSpectralDensity(Ptr<const SpectrumValue> noisePsd)
     // reset m_allSignals (will reset if already set previously)
     // this is needed since this method can potentially change the SpectrumModel
     m_allSignals = Create<SpectrumValue>(noisePsd->GetSpectrumModel());
+    m_interf = Create<SpectrumValue>(noisePsd->GetSpectrumModel());
+    m_sinr = Create<SpectrumValue>(noisePsd->GetSpectrumModel());
     if (m_receiving)
     {
         // abort rx
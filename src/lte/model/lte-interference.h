@@ -26,6 +26,9 @@
 #include <ns3/spectrum-value.h>
 
 #include <list>
+#include <map>
+#include <utility>
+#include <vector>
 
 namespace ns3
 {
@@ -36,6 +39,10 @@ class LteChunkProcessor;
  * This class implements a gaussian interference model, i.e., all
  * incoming signals are added to the total interference.
  *
+ * The sum of the signals is updated in place.  The signals ending at the
+ * same time, such as the transmissions of the cells in a subframe, are
+ * subtracted by a single event, in the order they were added, and the chunk
+ * ending then is evaluated once, into buffers reused from chunk to chunk.
  */
 class LteInterference : public Object
 {
@@ -126,6 +133,10 @@ class LteInterference : public Object
      * @param signalId the signal ID
      */
     virtual void DoSubtractSignal(Ptr<const SpectrumValue> spd, uint32_t signalId);
+    /**
+     * Subtract the signals ending now
+     */
+    void DoSubtractSignals();
 
     bool m_receiving{false}; ///< are we receiving?
 
@@ -142,6 +153,9 @@ class LteInterference : public Object
 
     Ptr<const SpectrumValue> m_noise{nullptr}; ///< the noise value
 
+    Ptr<SpectrumValue> m_interf{nullptr}; ///< the interference of the last chunk evaluated
+    Ptr<SpectrumValue> m_sinr{nullptr};   ///< the SINR of the last chunk evaluated
+
     Time m_lastChangeTime{Seconds(0)}; /**< the time of the last change in
                                         * m_TotalPower
                                         */
@@ -149,6 +163,13 @@ class LteInterference : public Object
     uint32_t m_lastSignalId{0};            ///< the last signal ID
     uint32_t m_lastSignalIdBeforeReset{0}; ///< the last signal ID before reset
 
+    /// a signal to be subtracted, with its ID
+    using PendingSignal = std::pair<Ptr<const SpectrumValue>, uint32_t>;
+
+    /** the signals to be subtracted, by end time, each in the order they
+        were added */
+    std::map<Time, std::vector<PendingSignal>> m_pendingSignals;
+
     /** all the processor instances that need to be notified whenever
     a new interference chunk is calculated */
     std::list<Ptr<LteChunkProcessor>> m_rsPowerChunkProcessorList;
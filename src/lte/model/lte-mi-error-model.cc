@@ -33,6 +33,8 @@
 #include <ns3/log.h>
 #include <ns3/pointer.h>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <list>
 #include <stdint.h>
@@ -729,6 +731,39 @@ static const double MI_map_64qam_axis[MI_MAP_64QAM_SIZE] = {
     156.490000, 156.700000, 156.910000, 157.120000, 157.330000, 157.540000, 157.750000, 157.960000,
 };
 
+/// A SINR to MI map of a modulation, whose SINR axis is uniformly spaced
+struct MiMap
+{
+    const double* mi;    //!< the MI values
+    const double* axis;  //!< the SINR values (linear), uniformly spaced
+    uint16_t size;       //!< the number of values
+    double scalingCoeff; //!< the inverse of the spacing of the SINR values
+};
+
+/// MI map QPSK, with its SINR axis
+static const MiMap MiMapQpsk = {
+    MI_map_qpsk,
+    MI_map_qpsk_axis,
+    MI_MAP_QPSK_SIZE,
+    (MI_MAP_QPSK_SIZE - 1) / (MI_map_qpsk_axis[MI_MAP_QPSK_SIZE - 1] - MI_map_qpsk_axis[0]),
+};
+
+/// MI map 16QAM, with its SINR axis
+static const MiMap MiMap16qam = {
+    MI_map_16qam,
+    MI_map_16qam_axis,
+    MI_MAP_16QAM_SIZE,
+    (MI_MAP_16QAM_SIZE - 1) / (MI_map_16qam_axis[MI_MAP_16QAM_SIZE - 1] - MI_map_16qam_axis[0]),
+};
+
+/// MI map 64QAM, with its SINR axis
+static const MiMap MiMap64qam = {
+    MI_map_64qam,
+    MI_map_64qam_axis,
+    MI_MAP_64QAM_SIZE,
+    (MI_MAP_64QAM_SIZE - 1) / (MI_map_64qam_axis[MI_MAP_64QAM_SIZE - 1] - MI_map_64qam_axis[0]),
+};
+
 // clang-format off
 
 /// BECR table
@@ -903,86 +938,134 @@ static const double cEcrTable [9][38] = {
 
 // clang-format on
 
-double
-LteMiErrorModel::Mib(const SpectrumValue& sinr, const std::vector<int>& map, uint8_t mcs)
+/// The parameters of a BLER curve, see LteMiErrorModel::MappingMiBler
+struct BlerCurve
 {
-    NS_LOG_FUNCTION(sinr << &map << (uint32_t)mcs);
+    double b; //!< the mean of the curve
+    double c; //!< the standard deviation of the curve
+};
 
-    double MI;
-    double MIsum = 0.0;
+/**
+ * \param mcs the MCS
+ * \return the MI map of the modulation of the MCS
+ */
+static const MiMap&
+GetMiMap(uint8_t mcs)
+{
+    if (mcs <= MI_QPSK_MAX_ID)
+    {
+        return MiMapQpsk;
+    }
+    if (mcs <= MI_16QAM_MAX_ID)
+    {
+        return MiMap16qam;
+    }
+    return MiMap64qam;
+}
 
-    for (uint32_t i = 0; i < map.size(); i++)
+/**
+ * \param map the MI map of a modulation
+ * \param sinrLin the SINR of a RB (linear)
+ * \return the MI of the RB
+ */
+static inline double
+GetMi(const MiMap& map, double sinrLin)
+{
+    if (sinrLin > map.axis[map.size - 1])
     {
-        double sinrLin = sinr[map.at(i)];
-        if (mcs <= MI_QPSK_MAX_ID) // QPSK
-        {
-            if (sinrLin > MI_map_qpsk_axis[MI_MAP_QPSK_SIZE - 1])
-            {
-                MI = 1;
-            }
-            else
-            {
-                // since the values in MI_map_qpsk_axis are uniformly spaced, we have
-                // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
-                // the scaling coefficient is always the same, so we use a static const
-                // to speed up the calculation
-                static const double scalingCoeffQpsk =
-                    (MI_MAP_QPSK_SIZE - 1) /
-                    (MI_map_qpsk_axis[MI_MAP_QPSK_SIZE - 1] - MI_map_qpsk_axis[0]);
-                double sinrIndexDouble = (sinrLin - MI_map_qpsk_axis[0]) * scalingCoeffQpsk + 1;
-                uint32_t sinrIndex = std::max(0.0, std::floor(sinrIndexDouble));
-                NS_ASSERT_MSG(sinrIndex < MI_MAP_QPSK_SIZE, "MI map out of data");
-                MI = MI_map_qpsk[sinrIndex];
-            }
-        }
-        else
+        return 1;
+    }
+    // since the values of the SINR axis are uniformly spaced, we have
+    // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
+    double sinrIndexDouble = (sinrLin - map.axis[0]) * map.scalingCoeff + 1;
+    uint32_t sinrIndex = std::max(0.0, std::floor(sinrIndexDouble));
+    NS_ASSERT_MSG(sinrIndex < map.size, "MI map out of data");
+    return map.mi[sinrIndex];
+}
+
+/**
+ * \param cbSize the size of a CB
+ * \return the index in cbMiSizeTable of the largest CB size of the BLER curves not
+ *         larger than the CB size
+ */
+static int
+GetCbMiSizeIndex(uint16_t cbSize)
+{
+    int cbIndex = 1;
+    while ((cbIndex < 9) && (cbMiSizeTable[cbIndex] <= cbSize))
+    {
+        cbIndex++;
+    }
+    return cbIndex - 1;
+}
+
+/**
+ * \param cbIndex the index in cbMiSizeTable of the CB size of the curve
+ * \param ecrId the ECR ID of the curve
+ * \return the parameters of the BLER curve
+ */
+static const BlerCurve&
+GetBlerCurve(int cbIndex, uint8_t ecrId)
+{
+    // the curves missing for a CB size are resolved once for all at first use
+    static const auto curves = [] {
+        std::array<std::array<BlerCurve, MI_64QAM_BLER_MAX_ID + 1>, 9> curves;
+        for (int cb = 0; cb < 9; cb++)
         {
-            if (mcs > MI_QPSK_MAX_ID && mcs <= MI_16QAM_MAX_ID) // 16-QAM
+            for (int ecr = 0; ecr <= MI_64QAM_BLER_MAX_ID; ecr++)
             {
-                if (sinrLin > MI_map_16qam_axis[MI_MAP_16QAM_SIZE - 1])
+                // take the lowest CB size including this CB for removing CB size
+                // quatization errors
+                double b = bEcrTable[cb][ecr];
+                for (int i = cb; (i < 9) && (b < 0); i++)
                 {
-                    MI = 1;
+                    b = bEcrTable[i][ecr];
                 }
-                else
+                double c = cEcrTable[cb][ecr];
+                for (int i = cb; (i < 9) && (c < 0); i++)
                 {
-                    // since the values in MI_map_16QAM_axis are uniformly spaced, we have
-                    // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
-                    // the scaling coefficient is always the same, so we use a static const
-                    // to speed up the calculation
-                    static const double scalingCoeff16qam =
-                        (MI_MAP_16QAM_SIZE - 1) /
-                        (MI_map_16qam_axis[MI_MAP_16QAM_SIZE - 1] - MI_map_16qam_axis[0]);
-                    double sinrIndexDouble =
-                        (sinrLin - MI_map_16qam_axis[0]) * scalingCoeff16qam + 1;
-                    uint32_t sinrIndex = std::max(0.0, std::floor(sinrIndexDouble));
-                    NS_ASSERT_MSG(sinrIndex < MI_MAP_16QAM_SIZE, "MI map out of data");
-                    MI = MI_map_16qam[sinrIndex];
-                }
-            }
-            else // 64-QAM
-            {
-                if (sinrLin > MI_map_64qam_axis[MI_MAP_64QAM_SIZE - 1])
-                {
-                    MI = 1;
-                }
-                else
-                {
-                    // since the values in MI_map_64QAM_axis are uniformly spaced, we have
-                    // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
-                    // the scaling coefficient is always the same, so we use a static const
-                    // to speed up the calculation
-                    static const double scalingCoeff64qam =
-                        (MI_MAP_64QAM_SIZE - 1) /
-                        (MI_map_64qam_axis[MI_MAP_64QAM_SIZE - 1] - MI_map_64qam_axis[0]);
-                    double sinrIndexDouble =
-                        (sinrLin - MI_map_64qam_axis[0]) * scalingCoeff64qam + 1;
-                    uint32_t sinrIndex = std::max(0.0, std::floor(sinrIndexDouble));
-                    NS_ASSERT_MSG(sinrIndex < MI_MAP_64QAM_SIZE, "MI map out of data");
-                    MI = MI_map_64qam[sinrIndex];
+                    c = cEcrTable[i][ecr];
                 }
+                curves[cb][ecr] = {b, c};
             }
         }
-        NS_LOG_LOGIC(" RB " << map.at(i) << "Minimum SNR = " << 10 * std::log10(sinrLin) << " dB, "
+        return curves;
+    }();
+    return curves[cbIndex][ecrId];
+}
+
+/**
+ * \param mib the mean mutual information per bit of a CB
+ * \param ecrId the ECR ID
+ * \param cbIndex the index in cbMiSizeTable of the CB size of the BLER curve
+ * \return the CB error rate
+ */
+static double
+GetCbler(double mib, uint8_t ecrId, int cbIndex)
+{
+    const BlerCurve& curve = GetBlerCurve(cbIndex, ecrId);
+    // see IEEE802.16m EMD formula 55 of section 4.3.2.1
+    double bler = 0.5 * (1 - erf((mib - curve.b) / (sqrt(2) * curve.c)));
+    NS_LOG_LOGIC("MIB: " << mib << " BLER:" << bler << " b:" << curve.b << " c:" << curve.c);
+    return bler;
+}
+
+double
+LteMiErrorModel::Mib(const SpectrumValue& sinr, const std::vector<int>& map, uint8_t mcs)
+{
+    NS_LOG_FUNCTION(sinr << &map << (uint32_t)mcs);
+
+    const MiMap& miMap = GetMiMap(mcs);
+    auto sinrBegin = sinr.ConstValuesBegin();
+    double MI;
+    double MIsum = 0.0;
+
+    for (int rb : map)
+    {
+        NS_ASSERT(rb >= 0 && static_cast<std::size_t>(rb) < sinr.GetValuesN());
+        double sinrLin = sinrBegin[rb];
+        MI = GetMi(miMap, sinrLin);
+        NS_LOG_LOGIC(" RB " << rb << "Minimum SNR = " << 10 * std::log10(sinrLin) << " dB, "
                             << sinrLin << " V, MCS = " << (uint16_t)mcs << ", MI = " << MI);
         MIsum += MI;
     }
@@ -995,45 +1078,12 @@ double
 LteMiErrorModel::MappingMiBler(double mib, uint8_t ecrId, uint16_t cbSize)
 {
     NS_LOG_FUNCTION(mib << (uint32_t)ecrId << (uint32_t)cbSize);
-    double b = 0;
-    double c = 0;
 
     NS_ASSERT_MSG(ecrId <= MI_64QAM_BLER_MAX_ID, "ECR out of range [0..37]: " << (uint16_t)ecrId);
-    int cbIndex = 1;
-    while ((cbIndex < 9) && (cbMiSizeTable[cbIndex] <= cbSize))
-    {
-        cbIndex++;
-    }
-    cbIndex--;
+    int cbIndex = GetCbMiSizeIndex(cbSize);
     NS_LOG_LOGIC(" ECRid " << (uint16_t)ecrId << " ECR " << BlerCurvesEcrMap[ecrId] << " CB size "
                            << cbSize << " CB size curve " << cbMiSizeTable[cbIndex]);
-
-    b = bEcrTable[cbIndex][ecrId];
-    if (b < 0.0)
-    {
-        // take the lowest CB size including this CB for removing CB size
-        // quatization errors
-        int i = cbIndex;
-        while ((i < 9) && (b < 0))
-        {
-            b = bEcrTable[i++][ecrId];
-        }
-    }
-    c = cEcrTable[cbIndex][ecrId];
-    if (c < 0.0)
-    {
-        // take the lowest CB size including this CB for removing CB size
-        // quatization errors
-        int i = cbIndex;
-        while ((i < 9) && (c < 0))
-        {
-            c = cEcrTable[i++][ecrId];
-        }
-    }
-    // see IEEE802.16m EMD formula 55 of section 4.3.2.1
-    double bler = 0.5 * (1 - erf((mib - b) / (sqrt(2) * c)));
-    NS_LOG_LOGIC("MIB: " << mib << " BLER:" << bler << " b:" << b << " c:" << c);
-    return bler;
+    return GetCbler(mib, ecrId, cbIndex);
 }
 
 double
@@ -1047,37 +1097,14 @@ LteMiErrorModel::GetPcfichPdcchError(const SpectrumValue& sinr)
     NS_ASSERT(sinrIt != sinr.ConstValuesEnd());
     while (sinrIt != sinr.ConstValuesEnd())
     {
-        double sinrLin = *sinrIt;
-        if (sinrLin > MI_map_qpsk_axis[MI_MAP_QPSK_SIZE - 1])
-        {
-            MI = 1;
-        }
-        else
-        {
-            // since the values in MI_map_qpsk_axis are uniformly spaced, we have
-            // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
-            // the scaling coefficient is always the same, so we use a static const
-            // to speed up the calculation
-            static const double scalingCoeffQpsk =
-                (MI_MAP_QPSK_SIZE - 1) /
-                (MI_map_qpsk_axis[MI_MAP_QPSK_SIZE - 1] - MI_map_qpsk_axis[0]);
-            double sinrIndexDouble = (sinrLin - MI_map_qpsk_axis[0]) * scalingCoeffQpsk + 1;
-            uint32_t sinrIndex = std::max(0.0, std::floor(sinrIndexDouble));
-            NS_ASSERT_MSG(sinrIndex < MI_MAP_QPSK_SIZE, "MI map out of data");
-            MI = MI_map_qpsk[sinrIndex];
-        }
-        MIsum += MI;
+        MIsum += GetMi(MiMapQpsk, *sinrIt);
         sinrIt++;
         rb++;
     }
     MI = MIsum / rb;
     // return to the effective SINR value
-    int j = 0;
     double esinr = 0.0;
-    while ((j < MI_MAP_QPSK_SIZE) && (MI_map_qpsk[j] < MI))
-    {
-        j++;
-    }
+    int j = std::lower_bound(MI_map_qpsk, MI_map_qpsk + MI_MAP_QPSK_SIZE, MI) - MI_map_qpsk;
     if (MI > MI_map_qpsk[MI_MAP_QPSK_SIZE - 1])
     {
         esinr = MI_map_qpsk_axis[MI_MAP_QPSK_SIZE - 1];
@@ -1106,12 +1133,11 @@ LteMiErrorModel::GetPcfichPdcchError(const SpectrumValue& sinr)
     double esirnDb = 10 * log10(esinr);
     //   NS_LOG_DEBUG ("Effective SINR " << esirnDb << " max " << 10*log10 (MI_map_qpsk
     //   [MI_MAP_QPSK_SIZE-1]));
-    uint16_t i = 0;
     double errorRate = 0.0;
-    while ((i < PDCCH_PCFICH_CURVE_SIZE) && (PdcchPcfichBlerCurveXaxis[i] < esirnDb))
-    {
-        i++;
-    }
+    uint16_t i = std::lower_bound(PdcchPcfichBlerCurveXaxis,
+                                  PdcchPcfichBlerCurveXaxis + PDCCH_PCFICH_CURVE_SIZE,
+                                  esirnDb) -
+                 PdcchPcfichBlerCurveXaxis;
     if (esirnDb > PdcchPcfichBlerCurveXaxis[PDCCH_PCFICH_CURVE_SIZE - 1])
     {
         errorRate = 0.0;
@@ -1130,7 +1156,7 @@ LteMiErrorModel::GetTbDecodificationStats(const SpectrumValue& sinr,
                                           const std::vector<int>& map,
                                           uint16_t size,
                                           uint8_t mcs,
-                                          HarqProcessInfoList_t miHistory)
+                                          const HarqProcessInfoList_t& miHistory)
 {
     NS_LOG_FUNCTION(sinr << &map << (uint32_t)size << (uint32_t)mcs);
 
@@ -1300,9 +1326,15 @@ LteMiErrorModel::GetTbDecodificationStats(const SpectrumValue& sinr,
 
     if (C != 1)
     {
-        double cbler = MappingMiBler(MI, ecrId, Kplus);
+        int cbIndexPlus = GetCbMiSizeIndex(Kplus);
+        double cbler = GetCbler(MI, ecrId, cbIndexPlus);
         errorRate *= pow(1.0 - cbler, Cplus);
-        cbler = MappingMiBler(MI, ecrId, Kminus);
+        // K- is most often on the same BLER curve as K+
+        int cbIndexMinus = GetCbMiSizeIndex(Kminus);
+        if (cbIndexMinus != cbIndexPlus)
+        {
+            cbler = GetCbler(MI, ecrId, cbIndexMinus);
+        }
         errorRate *= pow(1.0 - cbler, Cminus);
         errorRate = 1.0 - errorRate;
     }
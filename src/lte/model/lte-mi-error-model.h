@@ -73,6 +73,12 @@ struct TbStats_t
 
 /**
  * This class provides the BLER estimation based on mutual information metrics
+ *
+ * The MI of the RBs is read from a SINR to MI map per modulation, whose
+ * uniformly spaced SINR axis gives the index of a SINR directly, and the
+ * parameters of the BLER curves, resolved for the CB sizes without a curve
+ * of their own, are tabulated at first use.  The results are the same as
+ * those of the direct evaluation of the model.
  */
 class LteMiErrorModel
 {
@@ -108,7 +114,7 @@ class LteMiErrorModel
                                               const std::vector<int>& map,
                                               uint16_t size,
                                               uint8_t mcs,
-                                              HarqProcessInfoList_t miHistory);
+                                              const HarqProcessInfoList_t& miHistory);
 
     /**
      * \brief run the error-model algorithm for the specified PCFICH+PDCCH channels
@@ -32,6 +32,7 @@
 #include <ns3/config.h>
 #include <ns3/double.h>
 #include <ns3/log.h>
+#include <ns3/node.h>
 #include <ns3/object-factory.h>
 #include <ns3/simulator.h>
 #include <ns3/trace-source-accessor.h>
@@ -308,6 +309,7 @@ LteSpectrumPhy::Reset()
     m_endRxDlCtrlEvent.Cancel();
     m_endRxUlSrsEvent.Cancel();
     m_rxControlMessageList.clear();
+    m_rxIdealControlMessageList.clear();
     m_expectedTbs.clear();
     m_txControlMessageList.clear();
     m_rxPacketBurstList.clear();
@@ -940,6 +942,46 @@ LteSpectrumPhy::RemoveExpectedTb(uint16_t rnti)
     }
 }
 
+void
+LteSpectrumPhy::StartRxIdealCtrl(const std::list<Ptr<LteControlMessage>>& msgList,
+                                 Time duration,
+                                 bool dataFrame)
+{
+    NS_LOG_FUNCTION(this << duration << dataFrame);
+    m_rxIdealControlMessageList.insert(m_rxIdealControlMessageList.end(),
+                                       msgList.begin(),
+                                       msgList.end());
+    if (!dataFrame && !m_endRxIdealCtrlPending)
+    {
+        // ScheduleWithContext() is needed here, since the UE hands the
+        // messages in its own context
+        m_endRxIdealCtrlPending = true;
+        Simulator::ScheduleWithContext(m_device->GetNode()->GetId(),
+                                       duration,
+                                       &LteSpectrumPhy::EndRxIdealCtrl,
+                                       this);
+    }
+}
+
+void
+LteSpectrumPhy::EndRxIdealCtrl()
+{
+    NS_LOG_FUNCTION(this);
+    m_endRxIdealCtrlPending = false;
+    if (m_state == RX_DATA || m_rxIdealControlMessageList.empty())
+    {
+        // the messages are delivered by EndRxData
+        return;
+    }
+    NS_ASSERT(m_state == IDLE);
+    if (!m_ltePhyRxCtrlEndOkCallback.IsNull())
+    {
+        m_ltePhyRxCtrlEndOkCallback(m_rxIdealControlMessageList);
+    }
+    m_rxIdealControlMessageList.clear();
+    m_expectedTbs.clear();
+}
+
 void
 LteSpectrumPhy::EndRxData()
 {
@@ -1173,6 +1215,7 @@ LteSpectrumPhy::EndRxData()
         }
     }
     // forward control messages of this frame to LtePhy
+    m_rxControlMessageList.splice(m_rxControlMessageList.end(), m_rxIdealControlMessageList);
     if (!m_rxControlMessageList.empty())
     {
         if (!m_ltePhyRxCtrlEndOkCallback.IsNull())
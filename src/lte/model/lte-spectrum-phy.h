@@ -422,6 +422,26 @@ class LteSpectrumPhy : public SpectrumPhy
      */
     void RemoveExpectedTb(uint16_t rnti);
 
+    /**
+     * \brief Start the reception of the UL control messages sent by a UE in
+     * this subframe, handed directly to the PHY instead of being carried by
+     * its data frame (see LteUePhy::EnableUlCtrlBatching)
+     *
+     * The messages of all the UEs are delivered in the order they were sent,
+     * together with those of the data frames, at the end of the reception of
+     * the data frames. If no data frame is received, a single event delivers
+     * them at the end of the subframe, and discards the TBs expected in it,
+     * as the end of the reception of null bandwidth frames carrying only
+     * control messages did.
+     *
+     * \param msgList the control messages of the UE
+     * \param duration the duration of the UL data frame of the subframe
+     * \param dataFrame whether the UE sends a data frame in the subframe
+     */
+    void StartRxIdealCtrl(const std::list<Ptr<LteControlMessage>>& msgList,
+                          Time duration,
+                          bool dataFrame);
+
     /**
      *
      *
@@ -474,6 +494,8 @@ class LteSpectrumPhy : public SpectrumPhy
     void EndRxDlCtrl();
     /// End receive UL SRS function
     void EndRxUlSrs();
+    /// End receive of the UL control messages handed directly to the PHY
+    void EndRxIdealCtrl();
 
     /**
      * \brief Set transmit mode gain function
@@ -496,6 +518,9 @@ class LteSpectrumPhy : public SpectrumPhy
 
     std::list<Ptr<LteControlMessage>> m_txControlMessageList; ///< the transmit control message list
     std::list<Ptr<LteControlMessage>> m_rxControlMessageList; ///< the receive control message list
+    /// the receive control message list handed directly to the PHY
+    std::list<Ptr<LteControlMessage>> m_rxIdealControlMessageList;
+    bool m_endRxIdealCtrlPending{false}; ///< whether EndRxIdealCtrl is scheduled
 
     State m_state;          ///< the state
     Time m_firstRxStart;    ///< the first receive start
@@ -24,9 +24,12 @@
 
 #include "lte-ue-phy.h"
 
+#include "component-carrier-enb.h"
 #include "ff-mac-common.h"
 #include "lte-amc.h"
 #include "lte-common.h"
+#include "lte-enb-net-device.h"
+#include "lte-enb-phy.h"
 #include "lte-net-device.h"
 #include "lte-spectrum-value-helper.h"
 #include "lte-ue-net-device.h"
@@ -35,6 +38,7 @@
 #include <ns3/boolean.h>
 #include <ns3/double.h>
 #include <ns3/log.h>
+#include <ns3/node-list.h>
 #include <ns3/node.h>
 #include <ns3/object-factory.h>
 #include <ns3/pointer.h>
@@ -184,6 +188,7 @@ LteUePhy::DoDispose()
     NS_LOG_FUNCTION(this);
     delete m_uePhySapProvider;
     delete m_ueCphySapProvider;
+    m_servingEnbPhy = nullptr;
     LtePhy::DoDispose();
 }
 
@@ -310,6 +315,19 @@ LteUePhy::GetTypeId()
                           BooleanValue(true),
                           MakeBooleanAccessor(&LteUePhy::m_enableUplinkPowerControl),
                           MakeBooleanChecker())
+            .AddAttribute("EnableUlCtrlBatching",
+                          "If true, the UL control messages of a subframe are handed directly "
+                          "to the PHY of the serving eNB, instead of being sent in the data "
+                          "frame, or in a null bandwidth frame when there is no PUSCH (ideal "
+                          "PUCCH). The eNB PHY delivers those of all its UEs at the end of the "
+                          "UL data frames, or with a single event when it receives no data "
+                          "frame, so the null bandwidth frames are not sent. The UL channel "
+                          "must not have a propagation delay model. The DL control messages "
+                          "are not affected, as each eNB already sends those of all its UEs "
+                          "in a single frame per subframe.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&LteUePhy::m_enableUlCtrlBatching),
+                          MakeBooleanChecker())
             .AddAttribute("Qout",
                           "corresponds to 10% block error rate of a hypothetical PDCCH transmission"
                           "taking into account the PCFICH errors with transmission parameters."
@@ -1284,6 +1302,19 @@ LteUePhy::SubframeIndication(uint32_t frameNo, uint32_t subframeNo)
                           << m_cellId);
         // send the current burts of packets
         Ptr<PacketBurst> pb = GetPacketBurst();
+        bool ctrlMsgBatched = false;
+        if (m_enableUlCtrlBatching && !ctrlMsg.empty())
+        {
+            Ptr<LteEnbPhy> enbPhy = GetServingEnbPhy();
+            if (enbPhy)
+            {
+                enbPhy->GetUplinkSpectrumPhy()->StartRxIdealCtrl(ctrlMsg,
+                                                                 UL_DATA_DURATION,
+                                                                 pb != nullptr);
+                ctrlMsg.clear();
+                ctrlMsgBatched = true;
+            }
+        }
         if (pb)
         {
             if (m_enableUplinkPowerControl)
@@ -1296,7 +1327,7 @@ LteUePhy::SubframeIndication(uint32_t frameNo, uint32_t subframeNo)
         else
         {
             // send only PUCCH (ideal: fake null bandwidth signal)
-            if (!ctrlMsg.empty())
+            if (!ctrlMsg.empty() || ctrlMsgBatched)
             {
                 NS_LOG_LOGIC(this << " UE - start TX PUCCH (NO PUSCH)");
                 std::vector<int> dlRb;
@@ -1307,7 +1338,10 @@ LteUePhy::SubframeIndication(uint32_t frameNo, uint32_t subframeNo)
                 }
 
                 SetSubChannelsForTransmission(dlRb);
-                m_uplinkSpectrumPhy->StartTxDataFrame(pb, ctrlMsg, UL_DATA_DURATION);
+                if (!ctrlMsgBatched)
+                {
+                    m_uplinkSpectrumPhy->StartTxDataFrame(pb, ctrlMsg, UL_DATA_DURATION);
+                }
             }
             else
             {
@@ -1335,6 +1369,52 @@ LteUePhy::SubframeIndication(uint32_t frameNo, uint32_t subframeNo)
                         subframeNo);
 }
 
+Ptr<LteEnbPhy>
+LteUePhy::GetServingEnbPhy()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_servingEnbPhyCellId == m_cellId)
+    {
+        return m_servingEnbPhy;
+    }
+    m_servingEnbPhy = nullptr;
+    m_servingEnbPhyCellId = m_cellId;
+
+    // walk list of all nodes to get the PHY of the cell
+    for (auto i = NodeList::Begin(); (i != NodeList::End()) && !m_servingEnbPhy; ++i)
+    {
+        Ptr<Node> node = *i;
+        for (uint32_t j = 0; (j < node->GetNDevices()) && !m_servingEnbPhy; j++)
+        {
+            Ptr<LteEnbNetDevice> enbDev = node->GetDevice(j)->GetObject<LteEnbNetDevice>();
+            if (!enbDev || !enbDev->HasCellId(m_cellId))
+            {
+                continue;
+            }
+            for (const auto& cc : enbDev->GetCcMap())
+            {
+                if (cc.second->GetCellId() == m_cellId)
+                {
+                    m_servingEnbPhy = DynamicCast<ComponentCarrierEnb>(cc.second)->GetPhy();
+                    break;
+                }
+            }
+        }
+    }
+    NS_LOG_DEBUG("PHY of cell " << m_cellId << " found: " << (m_servingEnbPhy != nullptr));
+    if (m_servingEnbPhy)
+    {
+        // the messages handed to the eNB PHY skip the channel, so they must
+        // not miss the propagation delay of the signals
+        Ptr<SpectrumChannel> channel = m_uplinkSpectrumPhy->GetChannel();
+        NS_ABORT_MSG_IF(m_servingEnbPhy->GetUplinkSpectrumPhy()->GetChannel() != channel,
+                        "The PHY of cell " << m_cellId << " is not on the UL channel of the UE");
+        NS_ABORT_MSG_IF(channel->GetPropagationDelayModel(),
+                        "EnableUlCtrlBatching requires an UL channel without propagation delay");
+    }
+    return m_servingEnbPhy;
+}
+
 void
 LteUePhy::SendSrs()
 {
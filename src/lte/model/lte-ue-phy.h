@@ -406,6 +406,17 @@ class LteUePhy : public LtePhy
      * \param [in] rbMap
      */
     void QueueSubChannelsForTransmission(std::vector<int> rbMap);
+    /**
+     * \brief Get the PHY of the cell the UE is synchronized with, looked up
+     * when the cell changes, as LteUeRrcProtocolIdeal looks up the eNB RRC
+     *
+     * The simulation is aborted if the PHY is not on the UL channel of the
+     * UE, or if the channel has a propagation delay model, since the control
+     * messages handed directly to the PHY would be received without the delay.
+     *
+     * \return the PHY of the eNB, or nullptr if the cell is not found
+     */
+    Ptr<LteEnbPhy> GetServingEnbPhy();
     /**
      * \brief Get CQI, RSRP, and RSRQ
      *
@@ -670,6 +681,13 @@ class LteUePhy : public LtePhy
      * will be enabled.
      */
     bool m_enableUplinkPowerControl;
+    /**
+     * The `EnableUlCtrlBatching` attribute. If true, the UL control messages
+     * are handed directly to the PHY of the serving eNB.
+     */
+    bool m_enableUlCtrlBatching;
+    Ptr<LteEnbPhy> m_servingEnbPhy;    ///< the PHY of the serving eNB, if batching
+    uint16_t m_servingEnbPhyCellId{0}; ///< the cell ID of m_servingEnbPhy
     /// Pointer to UE Uplink Power Control entity.
     Ptr<LteUePowerControl> m_powerControl;
 
@@ -0,0 +1,209 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "lte-test-ul-ctrl-batching.h"
+
+#include <ns3/boolean.h>
+#include <ns3/config.h>
+#include <ns3/eps-bearer.h>
+#include <ns3/log.h>
+#include <ns3/lte-enb-mac.h>
+#include <ns3/lte-enb-net-device.h>
+#include <ns3/lte-helper.h>
+#include <ns3/lte-ue-net-device.h>
+#include <ns3/lte-ue-rrc.h>
+#include <ns3/mobility-helper.h>
+#include <ns3/net-device-container.h>
+#include <ns3/node-container.h>
+#include <ns3/radio-bearer-stats-calculator.h>
+#include <ns3/simulator.h>
+#include <ns3/string.h>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LteUlCtrlBatchingTest");
+
+LteUlCtrlBatchingTestSuite::LteUlCtrlBatchingTestSuite()
+    : TestSuite("lte-ul-ctrl-batching", SYSTEM)
+{
+    AddTestCase(new LteUlCtrlBatchingTestCase, TestCase::QUICK);
+}
+
+/**
+ * \ingroup lte-test
+ * Static variable for test initialization
+ */
+static LteUlCtrlBatchingTestSuite lteUlCtrlBatchingTestSuite;
+
+LteUlCtrlBatchingTestCase::LteUlCtrlBatchingTestCase()
+    : TestCase("Check the per-UE MAC and RLC statistics with and without UL control batching")
+{
+}
+
+void
+LteUlCtrlBatchingTestCase::DlScheduling(CellUeStats* stats,
+                                        uint16_t cellId,
+                                        DlSchedulingCallbackInfo info)
+{
+    UeStats& ue = (*stats)[{cellId, info.rnti}];
+    ue.dlTbs++;
+    ue.dlTbBytes += info.sizeTb1 + info.sizeTb2;
+    ue.dlMcsSum += info.mcsTb1 + info.mcsTb2;
+}
+
+void
+LteUlCtrlBatchingTestCase::UlScheduling(CellUeStats* stats,
+                                        uint16_t cellId,
+                                        uint32_t frameNo,
+                                        uint32_t subframeNo,
+                                        uint16_t rnti,
+                                        uint8_t mcs,
+                                        uint16_t tbSize,
+                                        uint8_t componentCarrierId)
+{
+    UeStats& ue = (*stats)[{cellId, rnti}];
+    ue.ulTbs++;
+    ue.ulTbBytes += tbSize;
+    ue.ulMcsSum += mcs;
+}
+
+uint64_t
+LteUlCtrlBatchingTestCase::RunScenario(bool batching, std::map<uint64_t, UeStats>& stats)
+{
+    NS_LOG_FUNCTION(this << batching);
+    Config::SetDefault("ns3::LteUePhy::EnableUlCtrlBatching", BooleanValue(batching));
+    Config::SetDefault("ns3::LteHelper::UseIdealRrc", BooleanValue(true));
+    Config::SetDefault("ns3::RadioBearerStatsCalculator::DlRlcOutputFilename",
+                       StringValue(CreateTempDirFilename("DlRlcStats.txt")));
+    Config::SetDefault("ns3::RadioBearerStatsCalculator::UlRlcOutputFilename",
+                       StringValue(CreateTempDirFilename("UlRlcStats.txt")));
+
+    // the default Friis propagation loss draws no random variable
+    Ptr<LteHelper> lteHelper = CreateObject<LteHelper>();
+    lteHelper->SetSchedulerType("ns3::RrFfMacScheduler");
+
+    const uint16_t nEnbs = 2;
+    const uint16_t nUesPerEnb = 3;
+    NodeContainer enbNodes;
+    enbNodes.Create(nEnbs);
+    std::vector<NodeContainer> ueNodes(nEnbs);
+    MobilityHelper mobility;
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(enbNodes);
+    for (uint16_t i = 0; i < nEnbs; i++)
+    {
+        enbNodes.Get(i)->GetObject<MobilityModel>()->SetPosition(Vector(500.0 * i, 0.0, 30.0));
+        ueNodes[i].Create(nUesPerEnb);
+        mobility.Install(ueNodes[i]);
+        for (uint16_t j = 0; j < nUesPerEnb; j++)
+        {
+            ueNodes[i].Get(j)->GetObject<MobilityModel>()->SetPosition(
+                Vector(500.0 * i + 50.0 * (j + 1), 20.0 * j, 1.5));
+        }
+    }
+
+    NetDeviceContainer enbDevs = lteHelper->InstallEnbDevice(enbNodes);
+    NetDeviceContainer ueDevs;
+    for (uint16_t i = 0; i < nEnbs; i++)
+    {
+        NetDeviceContainer devs = lteHelper->InstallUeDevice(ueNodes[i]);
+        lteHelper->Attach(devs, enbDevs.Get(i));
+        ueDevs.Add(devs);
+    }
+    lteHelper->ActivateDataRadioBearer(ueDevs, EpsBearer(EpsBearer::NGBR_VIDEO_TCP_DEFAULT));
+
+    // both runs draw the same random values
+    int64_t stream = 1;
+    stream += lteHelper->AssignStreams(enbDevs, stream);
+    stream += lteHelper->AssignStreams(ueDevs, stream);
+
+    CellUeStats cellStats;
+    for (uint16_t i = 0; i < nEnbs; i++)
+    {
+        Ptr<LteEnbNetDevice> enbDev = enbDevs.Get(i)->GetObject<LteEnbNetDevice>();
+        uint16_t cellId = enbDev->GetCellId();
+        enbDev->GetMac()->TraceConnectWithoutContext(
+            "DlScheduling",
+            MakeBoundCallback(&LteUlCtrlBatchingTestCase::DlScheduling, &cellStats, cellId));
+        enbDev->GetMac()->TraceConnectWithoutContext(
+            "UlScheduling",
+            MakeBoundCallback(&LteUlCtrlBatchingTestCase::UlScheduling, &cellStats, cellId));
+    }
+
+    lteHelper->EnableRlcTraces();
+    Ptr<RadioBearerStatsCalculator> rlcStats = lteHelper->GetRlcStats();
+    rlcStats->SetAttribute("StartTime", TimeValue(Seconds(0)));
+    rlcStats->SetAttribute("EpochDuration", TimeValue(Seconds(1)));
+
+    Simulator::Stop(Seconds(0.3));
+    Simulator::Run();
+
+    const uint8_t lcId = 3;
+    for (uint32_t i = 0; i < ueDevs.GetN(); i++)
+    {
+        Ptr<LteUeNetDevice> ueDev = ueDevs.Get(i)->GetObject<LteUeNetDevice>();
+        uint64_t imsi = ueDev->GetImsi();
+        UeStats& ue = stats[imsi];
+        ue = cellStats[{ueDev->GetRrc()->GetCellId(), ueDev->GetRrc()->GetRnti()}];
+        ue.dlRlcRxPackets = rlcStats->GetDlRxPackets(imsi, lcId);
+        ue.dlRlcRxBytes = rlcStats->GetDlRxData(imsi, lcId);
+        ue.ulRlcRxPackets = rlcStats->GetUlRxPackets(imsi, lcId);
+        ue.ulRlcRxBytes = rlcStats->GetUlRxData(imsi, lcId);
+    }
+    uint64_t events = Simulator::GetEventCount();
+    Simulator::Destroy();
+    Config::SetDefault("ns3::LteUePhy::EnableUlCtrlBatching", BooleanValue(false));
+    return events;
+}
+
+void
+LteUlCtrlBatchingTestCase::DoRun()
+{
+    std::map<uint64_t, UeStats> expected;
+    uint64_t expectedEvents = RunScenario(false, expected);
+    std::map<uint64_t, UeStats> batched;
+    uint64_t batchedEvents = RunScenario(true, batched);
+    NS_LOG_INFO("events executed: " << expectedEvents << " without batching, " << batchedEvents
+                                    << " with batching");
+
+    NS_TEST_ASSERT_MSG_EQ(batched.size(), expected.size(), "Wrong number of UEs");
+    for (const auto& [imsi, ue] : expected)
+    {
+        const UeStats& other = batched.at(imsi);
+        NS_TEST_EXPECT_MSG_GT(ue.dlTbs, 0, "No DL TB for IMSI " << imsi);
+        NS_TEST_EXPECT_MSG_GT(ue.ulTbs, 0, "No UL TB for IMSI " << imsi);
+        NS_TEST_EXPECT_MSG_GT(ue.ulRlcRxBytes, 0, "No UL data for IMSI " << imsi);
+        NS_TEST_EXPECT_MSG_EQ(other.dlTbs, ue.dlTbs, "DL TBs differ for IMSI " << imsi);
+        NS_TEST_EXPECT_MSG_EQ(other.dlTbBytes, ue.dlTbBytes, "DL TBs differ for IMSI " << imsi);
+        NS_TEST_EXPECT_MSG_EQ(other.dlMcsSum, ue.dlMcsSum, "DL MCS differ for IMSI " << imsi);
+        NS_TEST_EXPECT_MSG_EQ(other.ulTbs, ue.ulTbs, "UL TBs differ for IMSI " << imsi);
+        NS_TEST_EXPECT_MSG_EQ(other.ulTbBytes, ue.ulTbBytes, "UL TBs differ for IMSI " << imsi);
+        NS_TEST_EXPECT_MSG_EQ(other.ulMcsSum, ue.ulMcsSum, "UL MCS differ for IMSI " << imsi);
+        NS_TEST_EXPECT_MSG_EQ(other.dlRlcRxPackets,
+                              ue.dlRlcRxPackets,
+                              "DL RLC PDUs differ for IMSI " << imsi);
+        NS_TEST_EXPECT_MSG_EQ(other.dlRlcRxBytes,
+                              ue.dlRlcRxBytes,
+                              "DL RLC bytes differ for IMSI " << imsi);
+        NS_TEST_EXPECT_MSG_EQ(other.ulRlcRxPackets,
+                              ue.ulRlcRxPackets,
+                              "UL RLC PDUs differ for IMSI " << imsi);
+        NS_TEST_EXPECT_MSG_EQ(other.ulRlcRxBytes,
+                              ue.ulRlcRxBytes,
+                              "UL RLC bytes differ for IMSI " << imsi);
+    }
+    // the null bandwidth frames of the UEs without PUSCH are not sent
+    NS_TEST_EXPECT_MSG_LT(batchedEvents, expectedEvents, "No event saved by the batching");
+}
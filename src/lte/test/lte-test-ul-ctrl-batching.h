@@ -0,0 +1,112 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LTE_TEST_UL_CTRL_BATCHING_H
+#define LTE_TEST_UL_CTRL_BATCHING_H
+
+#include "ns3/lte-common.h"
+#include "ns3/test.h"
+
+#include <map>
+
+using namespace ns3;
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief Test that the UL control messages batched by the eNB PHY
+ * (LteUePhy::EnableUlCtrlBatching) give the same per-UE MAC and RLC
+ * statistics as the control messages sent in the UL frames, with fewer
+ * events. The scenario has two cells of three UEs each, with full buffer
+ * traffic and a deterministic propagation loss.
+ */
+class LteUlCtrlBatchingTestCase : public TestCase
+{
+  public:
+    LteUlCtrlBatchingTestCase();
+
+  private:
+    void DoRun() override;
+
+    /// The statistics of a UE
+    struct UeStats
+    {
+        uint32_t dlTbs{0};           ///< number of DL TBs scheduled
+        uint64_t dlTbBytes{0};       ///< size of the DL TBs scheduled
+        uint64_t dlMcsSum{0};        ///< sum of the MCS of the DL TBs scheduled
+        uint32_t ulTbs{0};           ///< number of UL TBs scheduled
+        uint64_t ulTbBytes{0};       ///< size of the UL TBs scheduled
+        uint64_t ulMcsSum{0};        ///< sum of the MCS of the UL TBs scheduled
+        uint32_t dlRlcRxPackets{0};  ///< number of DL RLC PDUs received
+        uint64_t dlRlcRxBytes{0};    ///< size of the DL RLC PDUs received
+        uint32_t ulRlcRxPackets{0};  ///< number of UL RLC PDUs received
+        uint64_t ulRlcRxBytes{0};    ///< size of the UL RLC PDUs received
+    };
+
+    /// The statistics of the UEs, by cell ID and RNTI
+    using CellUeStats = std::map<std::pair<uint16_t, uint16_t>, UeStats>;
+
+    /**
+     * Run the scenario.
+     *
+     * \param batching whether the UL control messages are batched
+     * \param stats the statistics of the UEs, by IMSI
+     * \returns the number of events executed
+     */
+    uint64_t RunScenario(bool batching, std::map<uint64_t, UeStats>& stats);
+
+    /**
+     * DL scheduling trace sink.
+     *
+     * \param stats the statistics of the UEs
+     * \param cellId the cell of the MAC
+     * \param info the DL scheduling information
+     */
+    static void DlScheduling(CellUeStats* stats, uint16_t cellId, DlSchedulingCallbackInfo info);
+
+    /**
+     * UL scheduling trace sink.
+     *
+     * \param stats the statistics of the UEs
+     * \param cellId the cell of the MAC
+     * \param frameNo the frame number
+     * \param subframeNo the subframe number
+     * \param rnti the RNTI
+     * \param mcs the MCS
+     * \param tbSize the TB size
+     * \param componentCarrierId the component carrier ID
+     */
+    static void UlScheduling(CellUeStats* stats,
+                             uint16_t cellId,
+                             uint32_t frameNo,
+                             uint32_t subframeNo,
+                             uint16_t rnti,
+                             uint8_t mcs,
+                             uint16_t tbSize,
+                             uint8_t componentCarrierId);
+};
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief Test suite for the batching of the UL control messages.
+ */
+class LteUlCtrlBatchingTestSuite : public TestSuite
+{
+  public:
+    LteUlCtrlBatchingTestSuite();
+};
+
+#endif /* LTE_TEST_UL_CTRL_BATCHING_H */
@@ -0,0 +1,230 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "spatial-index.h"
+
+#include "mobility-model.h"
+
+#include "ns3/assert.h"
+#include "ns3/callback.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("SpatialIndex");
+
+std::size_t
+SpatialIndex::CellHash::operator()(const Cell& cell) const
+{
+    return std::hash<uint64_t>()(static_cast<uint64_t>(cell.first) * 1000003 +
+                                 static_cast<uint64_t>(cell.second));
+}
+
+SpatialIndex::SpatialIndex(double cellSize)
+    : m_cellSize(cellSize)
+{
+    NS_LOG_FUNCTION(this << cellSize);
+    NS_ASSERT_MSG(cellSize > 0, "The cell size must be positive");
+}
+
+SpatialIndex::~SpatialIndex()
+{
+    NS_LOG_FUNCTION(this);
+    Clear();
+}
+
+void
+SpatialIndex::Clear(double cellSize)
+{
+    NS_LOG_FUNCTION(this << cellSize);
+    NS_ASSERT_MSG(cellSize > 0, "The cell size must be positive");
+    Clear();
+    m_cellSize = cellSize;
+}
+
+void
+SpatialIndex::Clear()
+{
+    NS_LOG_FUNCTION(this);
+    for (const auto& [model, items] : m_modelItems)
+    {
+        m_items[items.front()].model->TraceDisconnectWithoutContext(
+            "CourseChange",
+            MakeCallback(&SpatialIndex::NotifyCourseChange, this));
+    }
+    m_modelItems.clear();
+    m_items.clear();
+    m_cells.clear();
+    m_unindexed.clear();
+}
+
+void
+SpatialIndex::Add(std::size_t id, Ptr<MobilityModel> mobility)
+{
+    NS_LOG_FUNCTION(this << id << mobility);
+    std::size_t item = m_items.size();
+    m_items.push_back({id, mobility, false, {0, 0}});
+    if (mobility)
+    {
+        auto& items = m_modelItems[PeekPointer(mobility)];
+        if (items.empty())
+        {
+            mobility->TraceConnectWithoutContext(
+                "CourseChange",
+                MakeCallback(&SpatialIndex::NotifyCourseChange, this));
+        }
+        items.push_back(item);
+    }
+    Insert(item);
+}
+
+std::size_t
+SpatialIndex::GetN() const
+{
+    return m_items.size();
+}
+
+SpatialIndex::Cell
+SpatialIndex::GetCell(double x, double y) const
+{
+    return {static_cast<int64_t>(std::floor(x / m_cellSize)),
+            static_cast<int64_t>(std::floor(y / m_cellSize))};
+}
+
+void
+SpatialIndex::Insert(std::size_t item)
+{
+    Item& it = m_items[item];
+    // A mobility model which does not move is guaranteed to notify a
+    // course change before it starts moving.
+    if (it.model && it.model->GetVelocity().GetLength() == 0)
+    {
+        Vector position = it.model->GetPosition();
+        it.inGrid = true;
+        it.cell = GetCell(position.x, position.y);
+        m_cells[it.cell].push_back(item);
+    }
+    else
+    {
+        it.inGrid = false;
+        m_unindexed.push_back(item);
+    }
+}
+
+void
+SpatialIndex::Erase(std::size_t item)
+{
+    Item& it = m_items[item];
+    if (it.inGrid)
+    {
+        auto cell = m_cells.find(it.cell);
+        NS_ASSERT(cell != m_cells.end());
+        cell->second.erase(std::find(cell->second.begin(), cell->second.end(), item));
+        if (cell->second.empty())
+        {
+            m_cells.erase(cell);
+        }
+    }
+    else
+    {
+        m_unindexed.erase(std::find(m_unindexed.begin(), m_unindexed.end(), item));
+    }
+}
+
+void
+SpatialIndex::NotifyCourseChange(Ptr<const MobilityModel> model)
+{
+    NS_LOG_FUNCTION(this << model);
+    auto items = m_modelItems.find(PeekPointer(model));
+    if (items == m_modelItems.end())
+    {
+        return;
+    }
+    for (std::size_t item : items->second)
+    {
+        Erase(item);
+        Insert(item);
+    }
+}
+
+void
+SpatialIndex::GetItemsInRange(const Vector& position,
+                              double range,
+                              std::vector<std::size_t>& ids) const
+{
+    NS_LOG_FUNCTION(this << position << range);
+    ids.clear();
+    auto inRange = [&position, range](const Item& it) {
+        return !it.model || CalculateDistance(it.model->GetPosition(), position) <= range;
+    };
+    Cell low = GetCell(position.x - range, position.y - range);
+    Cell high = GetCell(position.x + range, position.y + range);
+    double nCells = (static_cast<double>(high.first - low.first) + 1) *
+                    (static_cast<double>(high.second - low.second) + 1);
+    if (nCells > m_cells.size())
+    {
+        // the range covers more cells than are occupied.
+        for (const auto& [cell, items] : m_cells)
+        {
+            if (cell.first < low.first || cell.first > high.first || cell.second < low.second ||
+                cell.second > high.second)
+            {
+                continue;
+            }
+            for (std::size_t item : items)
+            {
+                if (inRange(m_items[item]))
+                {
+                    ids.push_back(m_items[item].id);
+                }
+            }
+        }
+    }
+    else
+    {
+        for (int64_t x = low.first; x <= high.first; x++)
+        {
+            for (int64_t y = low.second; y <= high.second; y++)
+            {
+                auto cell = m_cells.find({x, y});
+                if (cell == m_cells.end())
+                {
+                    continue;
+                }
+                for (std::size_t item : cell->second)
+                {
+                    if (inRange(m_items[item]))
+                    {
+                        ids.push_back(m_items[item].id);
+                    }
+                }
+            }
+        }
+    }
+    for (std::size_t item : m_unindexed)
+    {
+        if (inRange(m_items[item]))
+        {
+            ids.push_back(m_items[item].id);
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+}
+
+} // namespace ns3
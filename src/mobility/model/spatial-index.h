@@ -0,0 +1,166 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef SPATIAL_INDEX_H
+#define SPATIAL_INDEX_H
+
+#include "ns3/ptr.h"
+#include "ns3/vector.h"
+
+#include <cstddef>
+#include <map>
+#include <stdint.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+class MobilityModel;
+
+/**
+ * \ingroup mobility
+ * \brief Index of the positions of mobility models, for range queries.
+ *
+ * The items of the index are identified by a number chosen by the user,
+ * typically the position of a device in the list of a channel.  An item
+ * is associated with a MobilityModel, or with none, in which case it is
+ * always returned by GetItemsInRange().
+ *
+ * The items whose mobility model does not move are kept in a uniform
+ * grid of square cells in the x-y plane, so that a query only looks at
+ * the cells around the position of interest.  The items which move are
+ * kept in a separate list, whose positions are checked at each query.
+ * Both are kept up to date through the "CourseChange" trace of the
+ * mobility models, which is fired whenever a model changes its velocity.
+ *
+ * \warning A mobility model whose velocity is zero when it is added, or
+ * when it notifies a course change, must notify another course change
+ * before it moves.  This holds for all the models of this module, except
+ * for a ConstantAccelerationMobilityModel set with a zero velocity and a
+ * non-zero acceleration.
+ */
+class SpatialIndex
+{
+  public:
+    /**
+     * Constructor.
+     * \param [in] cellSize The size of the grid cells, in meters.  The
+     *             queries are most efficient when their range is close
+     *             to the cell size.
+     */
+    SpatialIndex(double cellSize = 100);
+    /** Destructor. */
+    ~SpatialIndex();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    SpatialIndex(const SpatialIndex&) = delete;
+    SpatialIndex& operator=(const SpatialIndex&) = delete;
+
+    /**
+     * Remove all the items.
+     */
+    void Clear();
+
+    /**
+     * Remove all the items, and set the size of the grid cells.
+     * \param [in] cellSize The size of the grid cells, in meters.
+     */
+    void Clear(double cellSize);
+
+    /**
+     * Add an item.
+     * \param [in] id The identifier of the item.
+     * \param [in] mobility The mobility model of the item, or null.
+     */
+    void Add(std::size_t id, Ptr<MobilityModel> mobility);
+
+    /**
+     * \returns The number of items in the index.
+     */
+    std::size_t GetN() const;
+
+    /**
+     * Get the items within a range of a position.
+     *
+     * \param [in] position The position.
+     * \param [in] range The range, in meters.
+     * \param [out] ids The identifiers of the items within range, and of
+     *              the items without mobility model, in increasing order.
+     */
+    void GetItemsInRange(const Vector& position, double range, std::vector<std::size_t>& ids) const;
+
+  private:
+    /** The coordinates of a grid cell. */
+    typedef std::pair<int64_t, int64_t> Cell;
+
+    /** Hash of the coordinates of a grid cell. */
+    struct CellHash
+    {
+        /**
+         * \param [in] cell The cell.
+         * \returns The hash of the cell coordinates.
+         */
+        std::size_t operator()(const Cell& cell) const;
+    };
+
+    /** An item of the index. */
+    struct Item
+    {
+        std::size_t id;           //!< The identifier of the item.
+        Ptr<MobilityModel> model; //!< The mobility model of the item.
+        bool inGrid;              //!< Whether the item is in a grid cell.
+        Cell cell;                //!< The grid cell of the item, if inGrid.
+    };
+
+    /**
+     * Get the grid cell of a coordinate.
+     * \param [in] x The x coordinate.
+     * \param [in] y The y coordinate.
+     * \returns The grid cell.
+     */
+    Cell GetCell(double x, double y) const;
+
+    /**
+     * Insert an item in the grid or in the list of moving items.
+     * \param [in] item The index of the item in #m_items.
+     */
+    void Insert(std::size_t item);
+
+    /**
+     * Remove an item from the grid or from the list of moving items.
+     * \param [in] item The index of the item in #m_items.
+     */
+    void Erase(std::size_t item);
+
+    /**
+     * Move the items of a mobility model which changed its course.
+     * \param [in] model The mobility model.
+     */
+    void NotifyCourseChange(Ptr<const MobilityModel> model);
+
+    double m_cellSize;         //!< The size of the grid cells, in meters.
+    std::vector<Item> m_items; //!< The items.
+    /** The items in each non-empty grid cell, as indexes in #m_items. */
+    std::unordered_map<Cell, std::vector<std::size_t>, CellHash> m_cells;
+    /** The moving items and the items without mobility, as indexes in #m_items. */
+    std::vector<std::size_t> m_unindexed;
+    /** The items of each mobility model, as indexes in #m_items. */
+    std::map<const MobilityModel*, std::vector<std::size_t>> m_modelItems;
+};
+
+} // namespace ns3
+
+#endif /* SPATIAL_INDEX_H */
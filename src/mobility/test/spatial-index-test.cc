@@ -0,0 +1,138 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
+#include "ns3/simulator.h"
+#include "ns3/spatial-index.h"
+#include "ns3/test.h"
+
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup mobility-test
+ *
+ * \brief Range queries of a SpatialIndex, against the distances to all the items.
+ */
+class SpatialIndexTestCase : public TestCase
+{
+  public:
+    SpatialIndexTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check the items returned by a query against the exhaustive search.
+     * \param [in] position The position of the query.
+     * \param [in] range The range of the query.
+     */
+    void CheckQuery(Vector position, double range);
+
+    SpatialIndex m_index;                     //!< The index under test.
+    std::vector<Ptr<MobilityModel>> m_models; //!< The mobility models of the items.
+};
+
+SpatialIndexTestCase::SpatialIndexTestCase()
+    : TestCase("Check the range queries of the spatial index")
+{
+}
+
+void
+SpatialIndexTestCase::CheckQuery(Vector position, double range)
+{
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < m_models.size(); i++)
+    {
+        if (!m_models[i] || CalculateDistance(m_models[i]->GetPosition(), position) <= range)
+        {
+            expected.push_back(i);
+        }
+    }
+    std::vector<std::size_t> ids;
+    m_index.GetItemsInRange(position, range, ids);
+    NS_TEST_EXPECT_MSG_EQ(ids.size(),
+                          expected.size(),
+                          "Wrong number of items around " << position << " at "
+                                                          << Simulator::Now().As(Time::S));
+    NS_TEST_EXPECT_MSG_EQ((ids == expected), true, "Wrong items around " << position);
+}
+
+void
+SpatialIndexTestCase::DoRun()
+{
+    m_index.Clear(50);
+    // a grid of static items, and an item without mobility model.
+    for (int x = -200; x <= 200; x += 40)
+    {
+        for (int y = -200; y <= 200; y += 40)
+        {
+            auto model = CreateObject<ConstantPositionMobilityModel>();
+            model->SetPosition(Vector(x, y, (x + y) % 7));
+            m_index.Add(m_models.size(), model);
+            m_models.push_back(model);
+        }
+    }
+    m_index.Add(m_models.size(), nullptr);
+    m_models.emplace_back(nullptr);
+    // an item which moves across the grid.
+    auto moving = CreateObject<ConstantVelocityMobilityModel>();
+    moving->SetPosition(Vector(-300, 0, 0));
+    moving->SetVelocity(Vector(100, 10, 0));
+    m_index.Add(m_models.size(), moving);
+    m_models.push_back(moving);
+    NS_TEST_ASSERT_MSG_EQ(m_index.GetN(), m_models.size(), "Wrong number of items");
+
+    CheckQuery(Vector(0, 0, 0), 50);
+    CheckQuery(Vector(13, -77, 2), 100);
+    CheckQuery(Vector(-190, 190, 0), 60);
+    CheckQuery(Vector(1000, 1000, 0), 50);
+    CheckQuery(Vector(0, 0, 0), 10000);
+
+    // a static item which is moved, and the moving item which stops.
+    Simulator::Schedule(Seconds(2), [this]() {
+        m_models[0]->SetPosition(Vector(35, 35, 0));
+        CheckQuery(Vector(30, 30, 0), 20);
+    });
+    Simulator::Schedule(Seconds(3), [this, moving]() {
+        CheckQuery(Vector(0, 30, 0), 45);
+        moving->SetVelocity(Vector(0, 0, 0));
+        CheckQuery(Vector(0, 30, 0), 45);
+    });
+    Simulator::Schedule(Seconds(10), [this]() { CheckQuery(Vector(0, 30, 0), 45); });
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup mobility-test
+ *
+ * \brief SpatialIndex TestSuite
+ */
+class SpatialIndexTestSuite : public TestSuite
+{
+  public:
+    SpatialIndexTestSuite();
+};
+
+SpatialIndexTestSuite::SpatialIndexTestSuite()
+    : TestSuite("spatial-index", UNIT)
+{
+    AddTestCase(new SpatialIndexTestCase, TestCase::QUICK);
+}
+
+static SpatialIndexTestSuite g_spatialIndexTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,129 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * \file
+ * \ingroup mtp
+ *
+ * Run UDP echo exchanges over a ring of point-to-point links with the
+ * multithreaded simulator.
+ *
+ * Every node of the ring sends echo requests to the node facing it, so
+ * the traffic crosses every link.  Each node ends up in its own logical
+ * process, and the lookahead is the delay of the links.
+ *
+ *     n0 ---- n1 ---- n2
+ *     |                |
+ *     n5 ---- n4 ---- n3
+ *
+ * Run with the default simulator for comparison:
+ *
+ *     ./ns3 run "simple-multithreaded --multithreaded=0"
+ */
+
+#include "ns3/applications-module.h"
+#include "ns3/core-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/mtp-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+
+#include <chrono>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("SimpleMultithreaded");
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t nNodes = 6;
+    uint32_t threads = 0;
+    bool multithreaded = true;
+    Time stopTime = Seconds(10);
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("nodes", "Number of nodes in the ring", nNodes);
+    cmd.AddValue("threads", "Maximum number of threads, 0 for all the cores", threads);
+    cmd.AddValue("multithreaded", "Use the multithreaded simulator", multithreaded);
+    cmd.AddValue("stop", "Simulation stop time", stopTime);
+    cmd.Parse(argc, argv);
+
+    if (multithreaded)
+    {
+        GlobalValue::Bind("SimulatorImplementationType",
+                          StringValue("ns3::MultithreadedSimulatorImpl"));
+        Config::SetDefault("ns3::MultithreadedSimulatorImpl::MaxThreads", UintegerValue(threads));
+    }
+
+    NodeContainer nodes;
+    nodes.Create(nNodes);
+
+    PointToPointHelper pointToPoint;
+    pointToPoint.SetDeviceAttribute("DataRate", StringValue("100Mbps"));
+    pointToPoint.SetChannelAttribute("Delay", StringValue("1ms"));
+
+    InternetStackHelper stack;
+    stack.Install(nodes);
+
+    Ipv4AddressHelper address;
+    address.SetBase("10.1.0.0", "255.255.255.0");
+    for (uint32_t i = 0; i < nNodes; ++i)
+    {
+        NetDeviceContainer devices =
+            pointToPoint.Install(nodes.Get(i), nodes.Get((i + 1) % nNodes));
+        address.Assign(devices);
+        address.NewNetwork();
+    }
+    Ipv4GlobalRoutingHelper::PopulateRoutingTables();
+
+    UdpEchoServerHelper echoServer(9);
+    ApplicationContainer serverApps = echoServer.Install(nodes);
+    serverApps.Start(Seconds(0.5));
+    serverApps.Stop(stopTime);
+
+    ApplicationContainer clientApps;
+    for (uint32_t i = 0; i < nNodes; ++i)
+    {
+        Ptr<Node> peer = nodes.Get((i + nNodes / 2) % nNodes);
+        Ipv4Address peerAddress = peer->GetObject<Ipv4>()->GetAddress(1, 0).GetLocal();
+        UdpEchoClientHelper echoClient(peerAddress, 9);
+        echoClient.SetAttribute("MaxPackets", UintegerValue(0));
+        echoClient.SetAttribute("Interval", TimeValue(MicroSeconds(100)));
+        echoClient.SetAttribute("PacketSize", UintegerValue(1024));
+        clientApps.Add(echoClient.Install(nodes.Get(i)));
+    }
+    clientApps.Start(Seconds(1));
+    clientApps.Stop(stopTime);
+
+    auto start = std::chrono::steady_clock::now();
+    Simulator::Stop(stopTime);
+    Simulator::Run();
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout << "Simulated " << Simulator::Now().As(Time::S) << " in "
+              << std::chrono::duration<double>(end - start).count() << " s";
+    Ptr<MultithreadedSimulatorImpl> impl =
+        DynamicCast<MultithreadedSimulatorImpl>(Simulator::GetImplementation());
+    if (impl)
+    {
+        std::cout << " with " << impl->GetLpCount() << " logical processes, lookahead "
+                  << impl->GetLookAhead().As(Time::MS);
+    }
+    std::cout << std::endl;
+
+    Simulator::Destroy();
+    return 0;
+}
@@ -0,0 +1,270 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * \file
+ * \ingroup mtp
+ *  Implementation of class ns3::LogicalProcess.
+ */
+
+#include "logical-process.h"
+
+#include "ns3/assert.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+namespace ns3
+{
+
+// Note:  Logging in this file is largely avoided due to the
+// number of calls that are made to these functions and the fact
+// that they run concurrently in several threads.
+NS_LOG_COMPONENT_DEFINE("LogicalProcess");
+
+LogicalProcess::LogicalProcess()
+    : m_lpId(0),
+      m_events(nullptr),
+      m_uid(EventId::UID::VALID),
+      m_currentUid(EventId::UID::INVALID),
+      m_currentTs(0),
+      m_currentContext(Simulator::NO_CONTEXT),
+      m_eventCount(0),
+      m_sequence(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+LogicalProcess::~LogicalProcess()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT_MSG(!m_events, "LogicalProcess::Dispose() was not called");
+}
+
+void
+LogicalProcess::Enable(uint32_t lpId, ObjectFactory schedulerFactory)
+{
+    NS_LOG_FUNCTION(this << lpId);
+    m_lpId = lpId;
+    SetScheduler(schedulerFactory);
+}
+
+void
+LogicalProcess::Dispose()
+{
+    NS_LOG_FUNCTION(this);
+    if (!m_events)
+    {
+        return;
+    }
+    ReceiveMessages();
+    while (!m_events->IsEmpty())
+    {
+        Scheduler::Event next = m_events->RemoveNext();
+        next.impl->Unref();
+    }
+    m_events = nullptr;
+}
+
+void
+LogicalProcess::SetScheduler(ObjectFactory schedulerFactory)
+{
+    NS_LOG_FUNCTION(this << schedulerFactory);
+    Ptr<Scheduler> scheduler = schedulerFactory.Create<Scheduler>();
+
+    if (m_events)
+    {
+        while (!m_events->IsEmpty())
+        {
+            Scheduler::Event next = m_events->RemoveNext();
+            scheduler->Insert(next);
+        }
+    }
+    m_events = scheduler;
+}
+
+uint32_t
+LogicalProcess::GetLpId() const
+{
+    return m_lpId;
+}
+
+Time
+LogicalProcess::Now() const
+{
+    return TimeStep(m_currentTs);
+}
+
+uint64_t
+LogicalProcess::GetTs() const
+{
+    return m_currentTs;
+}
+
+void
+LogicalProcess::SetTs(uint64_t ts)
+{
+    NS_ASSERT(ts >= m_currentTs);
+    NS_ASSERT(ts <= GetNextTs());
+    m_currentTs = ts;
+}
+
+uint32_t
+LogicalProcess::GetContext() const
+{
+    return m_currentContext;
+}
+
+uint64_t
+LogicalProcess::GetEventCount() const
+{
+    return m_eventCount;
+}
+
+uint64_t
+LogicalProcess::GetNextTs() const
+{
+    if (m_events->IsEmpty())
+    {
+        return std::numeric_limits<uint64_t>::max();
+    }
+    return m_events->PeekNext().key.m_ts;
+}
+
+bool
+LogicalProcess::IsEmpty() const
+{
+    return m_events->IsEmpty();
+}
+
+EventId
+LogicalProcess::Schedule(uint32_t context, uint64_t ts, EventImpl* event)
+{
+    NS_ASSERT_MSG(ts >= m_currentTs, "LogicalProcess::Schedule(): event in the past");
+    Scheduler::Event ev;
+    ev.impl = event;
+    ev.key.m_ts = ts;
+    ev.key.m_context = context;
+    ev.key.m_uid = m_uid;
+    m_uid++;
+    m_events->Insert(ev);
+    return EventId(event, ev.key.m_ts, ev.key.m_context, ev.key.m_uid);
+}
+
+void
+LogicalProcess::Insert(const Scheduler::Event& ev)
+{
+    NS_ASSERT(ev.key.m_ts >= m_currentTs);
+    m_uid = std::max(m_uid, ev.key.m_uid + 1);
+    m_events->Insert(ev);
+}
+
+Scheduler::Event
+LogicalProcess::RemoveNext()
+{
+    return m_events->RemoveNext();
+}
+
+void
+LogicalProcess::Remove(const EventId& id)
+{
+    if (IsExpired(id))
+    {
+        return;
+    }
+    Scheduler::Event event;
+    event.impl = id.PeekEventImpl();
+    event.key.m_ts = id.GetTs();
+    event.key.m_context = id.GetContext();
+    event.key.m_uid = id.GetUid();
+    m_events->Remove(event);
+    event.impl->Cancel();
+    // whenever we remove an event from the event list, we have to unref it.
+    event.impl->Unref();
+}
+
+bool
+LogicalProcess::IsExpired(const EventId& id) const
+{
+    return id.PeekEventImpl() == nullptr || id.GetTs() < m_currentTs ||
+           (id.GetTs() == m_currentTs && id.GetUid() <= m_currentUid) ||
+           id.PeekEventImpl()->IsCancelled();
+}
+
+void
+LogicalProcess::ReceiveMessage(uint32_t context,
+                               uint64_t ts,
+                               uint32_t senderLp,
+                               uint64_t seq,
+                               EventImpl* event)
+{
+    std::unique_lock lock{m_mailboxMutex};
+    m_mailbox.push_back({ts, context, senderLp, seq, event});
+}
+
+void
+LogicalProcess::ReceiveMessages()
+{
+    std::vector<Message> mailbox;
+    {
+        std::unique_lock lock{m_mailboxMutex};
+        m_mailbox.swap(mailbox);
+    }
+    // The arrival order depends on the thread interleaving: sort the messages
+    // so that the uids, and thus the order of simultaneous events, are
+    // reproducible from one run to the next.
+    std::sort(mailbox.begin(), mailbox.end(), [](const Message& a, const Message& b) {
+        return std::tie(a.ts, a.senderLp, a.seq) < std::tie(b.ts, b.senderLp, b.seq);
+    });
+    for (const auto& message : mailbox)
+    {
+        Schedule(message.context, message.ts, message.event);
+    }
+}
+
+uint64_t
+LogicalProcess::NextSequence()
+{
+    return m_sequence++;
+}
+
+void
+LogicalProcess::ProcessOneEvent()
+{
+    Scheduler::Event next = m_events->RemoveNext();
+
+    NS_ASSERT(next.key.m_ts >= m_currentTs);
+    m_eventCount++;
+
+    m_currentTs = next.key.m_ts;
+    m_currentContext = next.key.m_context;
+    m_currentUid = next.key.m_uid;
+    next.impl->Invoke();
+    next.impl->Unref();
+}
+
+void
+LogicalProcess::ProcessEventsUntil(uint64_t endTs)
+{
+    while (!m_events->IsEmpty() && m_events->PeekNext().key.m_ts < endTs)
+    {
+        ProcessOneEvent();
+    }
+}
+
+} // namespace ns3
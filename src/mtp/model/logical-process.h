@@ -0,0 +1,200 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * \file
+ * \ingroup mtp
+ *  Declaration of class ns3::LogicalProcess.
+ */
+
+#ifndef NS3_LOGICAL_PROCESS_H
+#define NS3_LOGICAL_PROCESS_H
+
+#include "ns3/event-id.h"
+#include "ns3/event-impl.h"
+#include "ns3/nstime.h"
+#include "ns3/object-factory.h"
+#include "ns3/ptr.h"
+#include "ns3/scheduler.h"
+
+#include <mutex>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup mtp
+ *
+ * \brief A partition of the simulation owning its own event queue and clock.
+ *
+ * A logical process (LP) is a group of nodes whose events are executed
+ * sequentially, by one thread at a time.  Events scheduled by another LP
+ * are not inserted directly into the event queue; they are posted to the
+ * mailbox of the LP with ReceiveMessage() and moved into the queue with
+ * ReceiveMessages() once all the LPs have reached the end of the current
+ * time window.
+ *
+ * Messages are sorted by timestamp, sender LP and sender sequence number
+ * before being inserted, so the order in which events with identical
+ * timestamps are executed does not depend on the thread interleaving.
+ */
+class LogicalProcess
+{
+  public:
+    /** Constructor. */
+    LogicalProcess();
+    /** Destructor. */
+    ~LogicalProcess();
+
+    /**
+     * Initialize this LP.
+     *
+     * \param [in] lpId The id of this LP.
+     * \param [in] schedulerFactory The factory for the event queue.
+     */
+    void Enable(uint32_t lpId, ObjectFactory schedulerFactory);
+    /** Release all the pending events and messages. */
+    void Dispose();
+    /**
+     * Replace the event queue, keeping all the pending events.
+     * \param [in] schedulerFactory The factory for the new event queue.
+     */
+    void SetScheduler(ObjectFactory schedulerFactory);
+
+    /** \return The id of this LP. */
+    uint32_t GetLpId() const;
+    /** \return The current simulation time of this LP. */
+    Time Now() const;
+    /** \return The current timestamp of this LP, in time steps. */
+    uint64_t GetTs() const;
+    /**
+     * Advance the clock of this LP; used to align the LPs when the
+     * simulation stops.
+     * \param [in] ts The new timestamp, which must not be in the past.
+     */
+    void SetTs(uint64_t ts);
+    /** \return The context of the event being executed. */
+    uint32_t GetContext() const;
+    /** \return The number of events executed by this LP. */
+    uint64_t GetEventCount() const;
+    /** \return The timestamp of the next pending event, or the maximum time if none. */
+    uint64_t GetNextTs() const;
+    /** \return \c true if this LP has no pending events. */
+    bool IsEmpty() const;
+
+    /**
+     * Insert an event in the local event queue.
+     *
+     * \param [in] context The event context.
+     * \param [in] ts The absolute event timestamp.
+     * \param [in] event The event to insert.
+     * \return The id of the new event.
+     */
+    EventId Schedule(uint32_t context, uint64_t ts, EventImpl* event);
+    /**
+     * Insert an event with an already allocated key in the local event
+     * queue, for example when events are moved between LPs.
+     * \param [in] ev The event to insert.
+     */
+    void Insert(const Scheduler::Event& ev);
+    /**
+     * Remove the next event from the local event queue, without executing it.
+     * \return The removed event.
+     */
+    Scheduler::Event RemoveNext();
+    /**
+     * Remove an event from the local event queue.
+     * \param [in] id The event to remove.
+     */
+    void Remove(const EventId& id);
+    /**
+     * Check if an event owned by this LP has already run or been cancelled.
+     * \param [in] id The event to check.
+     * \return \c true if the event has expired.
+     */
+    bool IsExpired(const EventId& id) const;
+
+    /**
+     * Post an event coming from another LP.  This method is thread safe.
+     *
+     * \param [in] context The event context.
+     * \param [in] ts The absolute event timestamp.
+     * \param [in] senderLp The id of the sending LP.
+     * \param [in] seq The sequence number of the message in the sending LP.
+     * \param [in] event The event to post.
+     */
+    void ReceiveMessage(uint32_t context,
+                        uint64_t ts,
+                        uint32_t senderLp,
+                        uint64_t seq,
+                        EventImpl* event);
+    /** Move the messages posted by other LPs into the local event queue. */
+    void ReceiveMessages();
+    /** \return The next sequence number for a message sent by this LP. */
+    uint64_t NextSequence();
+
+    /**
+     * Execute all the events with a timestamp strictly lower than \pname{endTs}.
+     *
+     * \param [in] endTs The end of the time window.
+     */
+    void ProcessEventsUntil(uint64_t endTs);
+
+  private:
+    /** An event posted by another LP. */
+    struct Message
+    {
+        /** Event timestamp. */
+        uint64_t ts;
+        /** The event context. */
+        uint32_t context;
+        /** The sending LP. */
+        uint32_t senderLp;
+        /** The sequence number of the message in the sending LP. */
+        uint64_t seq;
+        /** The event implementation. */
+        EventImpl* event;
+    };
+
+    /** Process the next event. */
+    void ProcessOneEvent();
+
+    /** The id of this LP. */
+    uint32_t m_lpId;
+    /** The event priority queue. */
+    Ptr<Scheduler> m_events;
+    /** Next event unique id. */
+    uint32_t m_uid;
+    /** Unique id of the current event. */
+    uint32_t m_currentUid;
+    /** Timestamp of the current event. */
+    uint64_t m_currentTs;
+    /** Execution context of the current event. */
+    uint32_t m_currentContext;
+    /** The event count. */
+    uint64_t m_eventCount;
+    /** Next sequence number of the messages sent by this LP. */
+    uint64_t m_sequence;
+
+    /** Messages received from other LPs during the current time window. */
+    std::vector<Message> m_mailbox;
+    /** Mutex to control access to the mailbox. */
+    std::mutex m_mailboxMutex;
+};
+
+} // namespace ns3
+
+#endif /* NS3_LOGICAL_PROCESS_H */
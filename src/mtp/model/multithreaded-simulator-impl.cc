@@ -0,0 +1,616 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * \file
+ * \ingroup mtp
+ *  Implementation of class ns3::MultithreadedSimulatorImpl.
+ */
+
+#include "multithreaded-simulator-impl.h"
+
+#include "ns3/abort.h"
+#include "ns3/assert.h"
+#include "ns3/channel.h"
+#include "ns3/log.h"
+#include "ns3/net-device.h"
+#include "ns3/node-list.h"
+#include "ns3/node.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <tuple>
+
+namespace ns3
+{
+
+// Note:  Logging in this file is largely avoided due to the
+// number of calls that are made to these functions and the fact
+// that they run concurrently in several threads.
+NS_LOG_COMPONENT_DEFINE("MultithreadedSimulatorImpl");
+
+NS_OBJECT_ENSURE_REGISTERED(MultithreadedSimulatorImpl);
+
+namespace
+{
+/** The LP executed by the current thread, if any. */
+thread_local LogicalProcess* t_currentLp = nullptr;
+} // namespace
+
+TypeId
+MultithreadedSimulatorImpl::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::MultithreadedSimulatorImpl")
+            .SetParent<SimulatorImpl>()
+            .SetGroupName("Mtp")
+            .AddConstructor<MultithreadedSimulatorImpl>()
+            .AddAttribute("MaxThreads",
+                          "The maximum number of threads executing the logical processes, "
+                          "including the main thread. 0 uses one thread per hardware thread.",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&MultithreadedSimulatorImpl::m_maxThreads),
+                          MakeUintegerChecker<uint32_t>());
+    return tid;
+}
+
+MultithreadedSimulatorImpl::MultithreadedSimulatorImpl()
+    : m_partitioned(false),
+      m_lookAhead(std::numeric_limits<uint64_t>::max()),
+      m_windowEnd(0),
+      m_stop(false),
+      m_maxThreads(0),
+      m_round(0),
+      m_shutdown(false),
+      m_phase(RECEIVE),
+      m_nextLp(0),
+      m_pendingLps(0)
+{
+    NS_LOG_FUNCTION(this);
+    m_lps.push_back(std::make_unique<LogicalProcess>());
+}
+
+MultithreadedSimulatorImpl::~MultithreadedSimulatorImpl()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+MultithreadedSimulatorImpl::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    StopThreads();
+    for (auto& lp : m_lps)
+    {
+        lp->Dispose();
+    }
+    m_lps.clear();
+    m_nodeLp.clear();
+    SimulatorImpl::DoDispose();
+}
+
+void
+MultithreadedSimulatorImpl::Destroy()
+{
+    NS_LOG_FUNCTION(this);
+    while (!m_destroyEvents.empty())
+    {
+        Ptr<EventImpl> ev = m_destroyEvents.front().PeekEventImpl();
+        m_destroyEvents.pop_front();
+        NS_LOG_LOGIC("handle destroy " << ev);
+        if (!ev->IsCancelled())
+        {
+            ev->Invoke();
+        }
+    }
+}
+
+void
+MultithreadedSimulatorImpl::SetScheduler(ObjectFactory schedulerFactory)
+{
+    NS_LOG_FUNCTION(this << schedulerFactory);
+    m_schedulerFactory = schedulerFactory;
+    for (auto& lp : m_lps)
+    {
+        lp->SetScheduler(schedulerFactory);
+    }
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetSystemId() const
+{
+    return 0;
+}
+
+bool
+MultithreadedSimulatorImpl::IsFinished() const
+{
+    if (m_stop)
+    {
+        return true;
+    }
+    for (const auto& lp : m_lps)
+    {
+        if (!lp->IsEmpty())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void
+MultithreadedSimulatorImpl::Partition()
+{
+    NS_LOG_FUNCTION(this);
+
+    // Union-find over the nodes: the nodes which cannot be separated are
+    // merged, the point-to-point channels with a delay are kept as cuts.
+    uint32_t nNodes = NodeList::GetNNodes();
+    std::vector<uint32_t> parent(nNodes);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&parent](uint32_t n) {
+        while (parent[n] != n)
+        {
+            parent[n] = parent[parent[n]];
+            n = parent[n];
+        }
+        return n;
+    };
+    std::vector<std::tuple<uint32_t, uint32_t, Time>> cuts;
+
+    for (auto i = NodeList::Begin(); i != NodeList::End(); ++i)
+    {
+        Ptr<Node> node = *i;
+        for (uint32_t j = 0; j < node->GetNDevices(); ++j)
+        {
+            Ptr<NetDevice> device = node->GetDevice(j);
+            Ptr<Channel> channel = device->GetChannel();
+            if (!channel)
+            {
+                continue;
+            }
+            TimeValue delay;
+            bool splittable = device->IsPointToPoint() && channel->GetNDevices() == 2 &&
+                              channel->GetAttributeFailSafe("Delay", delay) &&
+                              delay.Get().IsStrictlyPositive();
+            for (std::size_t k = 0; k < channel->GetNDevices(); ++k)
+            {
+                Ptr<Node> remote = channel->GetDevice(k)->GetNode();
+                if (!remote || remote == node)
+                {
+                    continue;
+                }
+                if (splittable)
+                {
+                    cuts.emplace_back(node->GetId(), remote->GetId(), delay.Get());
+                }
+                else
+                {
+                    parent[find(node->GetId())] = find(remote->GetId());
+                }
+            }
+        }
+    }
+
+    // One LP per group of nodes; LP 0 is the public LP.
+    std::map<uint32_t, uint32_t> rootLp;
+    m_nodeLp.resize(nNodes);
+    for (uint32_t n = 0; n < nNodes; ++n)
+    {
+        auto it = rootLp.emplace(find(n), rootLp.size() + 1).first;
+        m_nodeLp[n] = it->second;
+    }
+
+    m_lookAhead = std::numeric_limits<uint64_t>::max();
+    for (const auto& [a, b, delay] : cuts)
+    {
+        if (m_nodeLp[a] != m_nodeLp[b])
+        {
+            m_lookAhead = std::min<uint64_t>(m_lookAhead, delay.GetTimeStep());
+        }
+    }
+
+    LogicalProcess* pub = m_lps[0].get();
+    for (uint32_t lpId = 1; lpId <= rootLp.size(); ++lpId)
+    {
+        m_lps.push_back(std::make_unique<LogicalProcess>());
+        m_lps.back()->Enable(lpId, m_schedulerFactory);
+        m_lps.back()->SetTs(pub->GetTs());
+    }
+    m_partitioned = true;
+
+    // Move the events scheduled so far to the LP owning their context.
+    std::vector<Scheduler::Event> kept;
+    while (!pub->IsEmpty())
+    {
+        Scheduler::Event ev = pub->RemoveNext();
+        LogicalProcess* lp = GetLp(ev.key.m_context);
+        if (lp == pub)
+        {
+            kept.push_back(ev);
+        }
+        else
+        {
+            lp->Insert(ev);
+        }
+    }
+    for (const auto& ev : kept)
+    {
+        pub->Insert(ev);
+    }
+
+    NS_LOG_INFO("partitioned " << nNodes << " nodes into " << rootLp.size()
+                               << " logical processes, lookahead " << GetLookAhead());
+}
+
+void
+MultithreadedSimulatorImpl::StartThreads()
+{
+    NS_LOG_FUNCTION(this);
+    if (!m_threads.empty())
+    {
+        return;
+    }
+    uint32_t threads = m_maxThreads;
+    if (threads == 0)
+    {
+        threads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    threads = std::min<uint32_t>(threads, m_lps.size() - 1);
+    for (uint32_t i = 1; i < threads; ++i)
+    {
+        m_threads.emplace_back(&MultithreadedSimulatorImpl::WorkerLoop, this);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::StopThreads()
+{
+    NS_LOG_FUNCTION(this);
+    {
+        std::unique_lock lock{m_poolMutex};
+        m_shutdown = true;
+    }
+    m_startCondition.notify_all();
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+    m_threads.clear();
+    m_shutdown = false;
+}
+
+void
+MultithreadedSimulatorImpl::WorkerLoop()
+{
+    std::unique_lock lock{m_poolMutex};
+    uint64_t round = m_round;
+    while (true)
+    {
+        m_startCondition.wait(lock, [this, round] { return m_shutdown || m_round != round; });
+        if (m_shutdown)
+        {
+            return;
+        }
+        round = m_round;
+        lock.unlock();
+        DoWork();
+        lock.lock();
+    }
+}
+
+void
+MultithreadedSimulatorImpl::RunPhase(Phase phase)
+{
+    auto count = static_cast<uint32_t>(m_lps.size());
+    if (count <= 1)
+    {
+        return;
+    }
+    // A worker late from the previous phase may pick up an LP as soon as
+    // m_nextLp is reset: everything else must be ready by then.
+    m_phase = phase;
+    m_pendingLps = count - 1;
+    m_nextLp = 1;
+    {
+        std::unique_lock lock{m_poolMutex};
+        m_round++;
+    }
+    m_startCondition.notify_all();
+
+    DoWork();
+
+    std::unique_lock lock{m_poolMutex};
+    m_doneCondition.wait(lock, [this] { return m_pendingLps == 0; });
+}
+
+void
+MultithreadedSimulatorImpl::DoWork()
+{
+    auto count = static_cast<uint32_t>(m_lps.size());
+    uint32_t i;
+    while ((i = m_nextLp++) < count)
+    {
+        LogicalProcess* lp = m_lps[i].get();
+        t_currentLp = lp;
+        if (m_phase == RECEIVE)
+        {
+            lp->ReceiveMessages();
+        }
+        else
+        {
+            lp->ProcessEventsUntil(m_windowEnd);
+        }
+        t_currentLp = nullptr;
+        if (--m_pendingLps == 0)
+        {
+            std::unique_lock lock{m_poolMutex};
+            m_doneCondition.notify_one();
+        }
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Run()
+{
+    NS_LOG_FUNCTION(this);
+    if (!m_partitioned)
+    {
+        Partition();
+    }
+    StartThreads();
+    m_stop = false;
+
+    LogicalProcess* pub = m_lps[0].get();
+    while (!m_stop)
+    {
+        RunPhase(RECEIVE);
+        pub->ReceiveMessages();
+
+        uint64_t next = std::numeric_limits<uint64_t>::max();
+        for (const auto& lp : m_lps)
+        {
+            next = std::min(next, lp->GetNextTs());
+        }
+        if (next == std::numeric_limits<uint64_t>::max())
+        {
+            break;
+        }
+
+        // The public LP may touch any node: it runs alone, and the other
+        // LPs never move past its next event.
+        uint64_t publicNext = pub->GetNextTs();
+        if (publicNext == next)
+        {
+            t_currentLp = pub;
+            pub->ProcessEventsUntil(next + 1);
+            t_currentLp = nullptr;
+            continue;
+        }
+        m_windowEnd = (publicNext - next > m_lookAhead) ? next + m_lookAhead : publicNext;
+        RunPhase(PROCESS);
+    }
+    RunPhase(RECEIVE);
+    pub->ReceiveMessages();
+
+    // Leave the public clock, used by Simulator::Now() outside of Run(),
+    // on the most recent event.
+    uint64_t now = pub->GetTs();
+    for (const auto& lp : m_lps)
+    {
+        now = std::max(now, lp->GetTs());
+    }
+    pub->SetTs(now);
+}
+
+void
+MultithreadedSimulatorImpl::Stop()
+{
+    NS_LOG_FUNCTION(this);
+    m_stop = true;
+}
+
+EventId
+MultithreadedSimulatorImpl::Stop(const Time& delay)
+{
+    NS_LOG_FUNCTION(this << delay.GetTimeStep());
+    return Simulator::Schedule(delay, &Simulator::Stop);
+}
+
+EventId
+MultithreadedSimulatorImpl::Schedule(const Time& delay, EventImpl* event)
+{
+    NS_ASSERT_MSG(delay.IsPositive(), "MultithreadedSimulatorImpl::Schedule(): Negative delay");
+    LogicalProcess* lp = GetCurrentLp();
+    uint64_t ts = lp->GetTs() + delay.GetTimeStep();
+    return lp->Schedule(lp->GetContext(), ts, event);
+}
+
+void
+MultithreadedSimulatorImpl::ScheduleWithContext(uint32_t context,
+                                                const Time& delay,
+                                                EventImpl* event)
+{
+    NS_ASSERT_MSG(delay.IsPositive(),
+                  "MultithreadedSimulatorImpl::ScheduleWithContext(): Negative delay");
+    LogicalProcess* current = GetCurrentLp();
+    LogicalProcess* target = GetLp(context);
+    uint64_t ts = current->GetTs() + delay.GetTimeStep();
+
+    // The public LP only runs while all the other LPs are idle.
+    if (target == current || current == m_lps[0].get())
+    {
+        target->Schedule(context, ts, event);
+        return;
+    }
+    NS_ABORT_MSG_IF(ts < m_windowEnd,
+                    "MultithreadedSimulatorImpl: event for context "
+                        << context << " scheduled at " << TimeStep(ts)
+                        << " violates the lookahead of " << GetLookAhead());
+    target->ReceiveMessage(context, ts, current->GetLpId(), current->NextSequence(), event);
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleNow(EventImpl* event)
+{
+    return Schedule(Time(0), event);
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleDestroy(EventImpl* event)
+{
+    EventId id(Ptr<EventImpl>(event, false), GetCurrentLp()->GetTs(), 0xffffffff, 2);
+    std::unique_lock lock{m_destroyEventsMutex};
+    m_destroyEvents.push_back(id);
+    return id;
+}
+
+Time
+MultithreadedSimulatorImpl::Now() const
+{
+    // Do not add function logging here, to avoid stack overflow
+    return GetCurrentLp()->Now();
+}
+
+Time
+MultithreadedSimulatorImpl::GetDelayLeft(const EventId& id) const
+{
+    if (IsExpired(id))
+    {
+        return TimeStep(0);
+    }
+    return TimeStep(id.GetTs() - GetCurrentLp()->GetTs());
+}
+
+void
+MultithreadedSimulatorImpl::Remove(const EventId& id)
+{
+    if (id.GetUid() == EventId::UID::DESTROY)
+    {
+        // destroy events.
+        std::unique_lock lock{m_destroyEventsMutex};
+        for (auto i = m_destroyEvents.begin(); i != m_destroyEvents.end(); i++)
+        {
+            if (*i == id)
+            {
+                m_destroyEvents.erase(i);
+                break;
+            }
+        }
+        return;
+    }
+    LogicalProcess* lp = GetLp(id.GetContext());
+    NS_ASSERT_MSG(lp == GetCurrentLp() || GetCurrentLp() == m_lps[0].get(),
+                  "MultithreadedSimulatorImpl::Remove(): event owned by another thread");
+    lp->Remove(id);
+}
+
+void
+MultithreadedSimulatorImpl::Cancel(const EventId& id)
+{
+    if (!IsExpired(id))
+    {
+        id.PeekEventImpl()->Cancel();
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsExpired(const EventId& id) const
+{
+    if (id.GetUid() == EventId::UID::DESTROY)
+    {
+        if (id.PeekEventImpl() == nullptr || id.PeekEventImpl()->IsCancelled())
+        {
+            return true;
+        }
+        // destroy events.
+        std::unique_lock lock{m_destroyEventsMutex};
+        for (auto i = m_destroyEvents.begin(); i != m_destroyEvents.end(); i++)
+        {
+            if (*i == id)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    return GetLp(id.GetContext())->IsExpired(id);
+}
+
+Time
+MultithreadedSimulatorImpl::GetMaximumSimulationTime() const
+{
+    return TimeStep(0x7fffffffffffffffLL);
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetContext() const
+{
+    return GetCurrentLp()->GetContext();
+}
+
+uint64_t
+MultithreadedSimulatorImpl::GetEventCount() const
+{
+    uint64_t count = 0;
+    for (const auto& lp : m_lps)
+    {
+        count += lp->GetEventCount();
+    }
+    return count;
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetLpCount() const
+{
+    return m_lps.size();
+}
+
+Time
+MultithreadedSimulatorImpl::GetLookAhead() const
+{
+    if (m_lookAhead == std::numeric_limits<uint64_t>::max())
+    {
+        return GetMaximumSimulationTime();
+    }
+    return TimeStep(m_lookAhead);
+}
+
+LogicalProcess*
+MultithreadedSimulatorImpl::GetCurrentLp() const
+{
+    if (t_currentLp)
+    {
+        return t_currentLp;
+    }
+    return m_lps[0].get();
+}
+
+LogicalProcess*
+MultithreadedSimulatorImpl::GetLp(uint32_t context) const
+{
+    if (context < m_nodeLp.size())
+    {
+        return m_lps[m_nodeLp[context]].get();
+    }
+    return m_lps[0].get();
+}
+
+} // namespace ns3
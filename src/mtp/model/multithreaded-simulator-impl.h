@@ -0,0 +1,195 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * \file
+ * \ingroup mtp
+ *  Declaration of class ns3::MultithreadedSimulatorImpl.
+ */
+
+#ifndef NS3_MULTITHREADED_SIMULATOR_IMPL_H
+#define NS3_MULTITHREADED_SIMULATOR_IMPL_H
+
+#include "logical-process.h"
+
+#include "ns3/simulator-impl.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \defgroup mtp Multithreaded Simulation
+ */
+
+/**
+ * \ingroup mtp
+ *
+ * \brief Conservative parallel simulator running in a single process.
+ *
+ * When the simulation starts, the nodes are partitioned into logical
+ * processes (LPs): two nodes end up in the same LP unless every channel
+ * connecting them is a point-to-point channel with a strictly positive
+ * \c Delay attribute.  The smallest delay of the channels crossing two
+ * LPs is the lookahead of the simulation.  The events are routed to the
+ * LP owning the node designated by their context; the events without a
+ * context, or whose context is not a node known at partition time, are
+ * owned by a public LP (LP 0) which is always executed alone.
+ *
+ * The simulation then proceeds in rounds: all the LPs execute, in
+ * parallel, the events of the window [T, T + lookahead[, where T is the
+ * timestamp of the earliest pending event; the window never extends past
+ * the next event of the public LP.  The events an LP schedules for
+ * another LP during a window necessarily fall beyond its end, and are
+ * delivered in a deterministic order once every LP has completed it.
+ *
+ * This implementation needs ns-3 to be built with NS3_MTP, which makes
+ * the reference counts of the core and packet objects thread safe.
+ * Simulator::Stop() invoked by an event of a node takes effect at the end
+ * of the current window, and Simulator::Schedule, Cancel and Remove may
+ * only be used, within a window, on events of the LP being executed.
+ */
+class MultithreadedSimulatorImpl : public SimulatorImpl
+{
+  public:
+    /**
+     *  Register this type.
+     *  \return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /** Constructor. */
+    MultithreadedSimulatorImpl();
+    /** Destructor. */
+    ~MultithreadedSimulatorImpl() override;
+
+    // Inherited
+    void Destroy() override;
+    bool IsFinished() const override;
+    void Stop() override;
+    EventId Stop(const Time& delay) override;
+    EventId Schedule(const Time& delay, EventImpl* event) override;
+    void ScheduleWithContext(uint32_t context, const Time& delay, EventImpl* event) override;
+    EventId ScheduleNow(EventImpl* event) override;
+    EventId ScheduleDestroy(EventImpl* event) override;
+    void Remove(const EventId& id) override;
+    void Cancel(const EventId& id) override;
+    bool IsExpired(const EventId& id) const override;
+    void Run() override;
+    Time Now() const override;
+    Time GetDelayLeft(const EventId& id) const override;
+    Time GetMaximumSimulationTime() const override;
+    void SetScheduler(ObjectFactory schedulerFactory) override;
+    uint32_t GetSystemId() const override;
+    uint32_t GetContext() const override;
+    uint64_t GetEventCount() const override;
+
+    /** \return The number of logical processes, including the public one. */
+    uint32_t GetLpCount() const;
+    /** \return The lookahead computed when the nodes were partitioned. */
+    Time GetLookAhead() const;
+
+  private:
+    void DoDispose() override;
+
+    /** The work performed on every LP during a parallel phase. */
+    enum Phase
+    {
+        RECEIVE, //!< Move the messages into the event queues.
+        PROCESS  //!< Execute the events of the current window.
+    };
+
+    /**
+     * Group the nodes into LPs, compute the lookahead and move the events
+     * scheduled so far to the LP owning their context.
+     */
+    void Partition();
+    /** Start the worker threads. */
+    void StartThreads();
+    /** Stop and join the worker threads. */
+    void StopThreads();
+    /** Main loop of a worker thread. */
+    void WorkerLoop();
+    /**
+     * Perform a phase on every LP but the public one, using all the threads,
+     * and wait until it completes.
+     * \param [in] phase The phase to perform.
+     */
+    void RunPhase(Phase phase);
+    /** Perform the current phase on LPs until there are none left. */
+    void DoWork();
+
+    /** \return The LP executing in the current thread. */
+    LogicalProcess* GetCurrentLp() const;
+    /**
+     * \param [in] context An event context.
+     * \return The LP owning the context.
+     */
+    LogicalProcess* GetLp(uint32_t context) const;
+
+    /** The LPs; the public LP is first. */
+    std::vector<std::unique_ptr<LogicalProcess>> m_lps;
+    /** LP id of every node, indexed by node id. */
+    std::vector<uint32_t> m_nodeLp;
+    /** Whether the nodes have been partitioned. */
+    bool m_partitioned;
+    /** The scheduler type used by the LPs. */
+    ObjectFactory m_schedulerFactory;
+    /** The lookahead, in time steps. */
+    uint64_t m_lookAhead;
+    /** The end (excluded) of the current time window. */
+    uint64_t m_windowEnd;
+    /** Flag calling for the end of the simulation. */
+    std::atomic<bool> m_stop;
+
+    /** Container type for the events to run at Simulator::Destroy() */
+    typedef std::list<EventId> DestroyEvents;
+    /** The container of events to run at Destroy. */
+    DestroyEvents m_destroyEvents;
+    /** Mutex to control access to the destroy events. */
+    mutable std::mutex m_destroyEventsMutex;
+
+    /** Maximum number of threads, including the main one. */
+    uint32_t m_maxThreads;
+    /** The worker threads. */
+    std::vector<std::thread> m_threads;
+    /** Mutex protecting the round counter and the shutdown flag. */
+    std::mutex m_poolMutex;
+    /** Signals the start of a phase to the worker threads. */
+    std::condition_variable m_startCondition;
+    /** Signals the end of a phase to the main thread. */
+    std::condition_variable m_doneCondition;
+    /** Number of phases started so far. */
+    uint64_t m_round;
+    /** Flag asking the worker threads to exit. */
+    bool m_shutdown;
+    /** The current phase. */
+    std::atomic<Phase> m_phase;
+    /** Index of the next LP to pick up in the current phase. */
+    std::atomic<uint32_t> m_nextLp;
+    /** Number of LPs not completed yet in the current phase. */
+    std::atomic<uint32_t> m_pendingLps;
+};
+
+} // namespace ns3
+
+#endif /* NS3_MULTITHREADED_SIMULATOR_IMPL_H */
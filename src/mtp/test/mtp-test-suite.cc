@@ -0,0 +1,265 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/config.h"
+#include "ns3/multithreaded-simulator-impl.h"
+#include "ns3/net-device-container.h"
+#include "ns3/node-container.h"
+#include "ns3/packet.h"
+#include "ns3/simple-channel.h"
+#include "ns3/simple-net-device-helper.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup mtp-tests
+ * MultithreadedSimulatorImpl test suite
+ */
+
+/**
+ * \ingroup mtp
+ * \defgroup mtp-tests Multithreaded simulation tests
+ */
+
+using namespace ns3;
+
+/**
+ * \ingroup mtp-tests
+ *
+ * \brief Relay packets around a ring of point-to-point links, and check that
+ * the multithreaded simulator reproduces the trace of the default simulator.
+ */
+class MtpRingTestCase : public TestCase
+{
+  public:
+    MtpRingTestCase();
+
+  private:
+    void DoRun() override;
+
+    /** A reception: timestamp, node id and packet size. */
+    typedef std::tuple<int64_t, uint32_t, uint32_t> Record;
+
+    /**
+     * Build the ring and run it with a given simulator implementation.
+     * \param simulatorType The simulator implementation type.
+     * \return The sorted receptions.
+     */
+    std::vector<Record> RunRing(std::string simulatorType);
+    /**
+     * Send a packet to the next node of the ring.
+     * \param node The sending node.
+     * \param size The packet size.
+     */
+    void Send(uint32_t node, uint32_t size);
+    /**
+     * Record a reception and relay the packet after a processing delay.
+     * \param device The receiving device.
+     * \param packet The packet.
+     * \param protocol The protocol number.
+     * \param from The sender address.
+     * \param to The destination address.
+     * \param type The packet type.
+     */
+    void Receive(Ptr<NetDevice> device,
+                 Ptr<const Packet> packet,
+                 uint16_t protocol,
+                 const Address& from,
+                 const Address& to,
+                 NetDevice::PacketType type);
+
+    static constexpr uint32_t N_NODES = 8;   //!< Number of nodes in the ring.
+    static constexpr uint32_t MAX_SIZE = 60; //!< Size at which packets stop being relayed.
+
+    std::vector<Ptr<NetDevice>> m_next;           //!< Device to the next node, per node.
+    std::vector<std::vector<Record>> m_receptions; //!< Receptions, per node.
+    uint32_t m_lpCount;                           //!< LPs of the multithreaded run.
+    Time m_lookAhead;                             //!< Lookahead of the multithreaded run.
+};
+
+MtpRingTestCase::MtpRingTestCase()
+    : TestCase("Check that a ring of point-to-point links gives the same trace in parallel"),
+      m_lpCount(0)
+{
+}
+
+void
+MtpRingTestCase::Send(uint32_t node, uint32_t size)
+{
+    Ptr<NetDevice> device = m_next[node];
+    device->Send(Create<Packet>(size), device->GetBroadcast(), 0x800);
+}
+
+void
+MtpRingTestCase::Receive(Ptr<NetDevice> device,
+                         Ptr<const Packet> packet,
+                         uint16_t protocol,
+                         const Address& from,
+                         const Address& to,
+                         NetDevice::PacketType type)
+{
+    uint32_t node = device->GetNode()->GetId();
+    uint32_t size = packet->GetSize();
+    // Each node only touches its own vector, from the thread executing it.
+    m_receptions[node].emplace_back(Simulator::Now().GetTimeStep(), node, size);
+    NS_ASSERT(Simulator::GetContext() == node);
+    if (size < MAX_SIZE)
+    {
+        Simulator::Schedule(MicroSeconds(10 * (node + 1)),
+                            &MtpRingTestCase::Send,
+                            this,
+                            node,
+                            size + 1);
+    }
+}
+
+std::vector<MtpRingTestCase::Record>
+MtpRingTestCase::RunRing(std::string simulatorType)
+{
+    Config::SetGlobal("SimulatorImplementationType", StringValue(simulatorType));
+    Config::SetDefault("ns3::MultithreadedSimulatorImpl::MaxThreads", UintegerValue(4));
+
+    NodeContainer nodes;
+    nodes.Create(N_NODES);
+    SimpleNetDeviceHelper helper;
+    helper.SetNetDevicePointToPointMode(true);
+    m_next.assign(N_NODES, nullptr);
+    m_receptions.assign(N_NODES, {});
+    for (uint32_t i = 0; i < N_NODES; ++i)
+    {
+        // Links of different delays: the lookahead is the smallest one.
+        helper.SetChannelAttribute("Delay", TimeValue(MicroSeconds(100 + 10 * i)));
+        NetDeviceContainer link =
+            helper.Install(NodeContainer(nodes.Get(i), nodes.Get((i + 1) % N_NODES)));
+        m_next[i] = link.Get(0);
+    }
+    for (uint32_t i = 0; i < N_NODES; ++i)
+    {
+        nodes.Get(i)->RegisterProtocolHandler(MakeCallback(&MtpRingTestCase::Receive, this),
+                                              0x800,
+                                              nullptr);
+        Simulator::ScheduleWithContext(i, MicroSeconds(i), &MtpRingTestCase::Send, this, i, 1);
+    }
+
+    Simulator::Stop(Seconds(1));
+    Simulator::Run();
+
+    Ptr<MultithreadedSimulatorImpl> impl =
+        DynamicCast<MultithreadedSimulatorImpl>(Simulator::GetImplementation());
+    if (impl)
+    {
+        m_lpCount = impl->GetLpCount();
+        m_lookAhead = impl->GetLookAhead();
+    }
+    NS_TEST_EXPECT_MSG_EQ(Simulator::Now(), Seconds(1), "Simulation did not stop at 1 s");
+    Simulator::Destroy();
+
+    std::vector<Record> records;
+    for (const auto& receptions : m_receptions)
+    {
+        records.insert(records.end(), receptions.begin(), receptions.end());
+    }
+    std::sort(records.begin(), records.end());
+    m_next.clear();
+    return records;
+}
+
+void
+MtpRingTestCase::DoRun()
+{
+    std::vector<Record> expected = RunRing("ns3::DefaultSimulatorImpl");
+    std::vector<Record> actual = RunRing("ns3::MultithreadedSimulatorImpl");
+    Config::SetGlobal("SimulatorImplementationType", StringValue("ns3::DefaultSimulatorImpl"));
+
+    NS_TEST_EXPECT_MSG_EQ(expected.size(), N_NODES * MAX_SIZE, "Wrong number of receptions");
+    NS_TEST_EXPECT_MSG_EQ((actual == expected), true, "Parallel trace differs");
+    // Every node is in its own LP, plus the public LP.
+    NS_TEST_EXPECT_MSG_EQ(m_lpCount, N_NODES + 1, "Wrong number of logical processes");
+    NS_TEST_EXPECT_MSG_EQ(m_lookAhead, MicroSeconds(100), "Wrong lookahead");
+}
+
+/**
+ * \ingroup mtp-tests
+ *
+ * \brief Check that nodes sharing a broadcast channel are kept in the same LP.
+ */
+class MtpPartitionTestCase : public TestCase
+{
+  public:
+    MtpPartitionTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+MtpPartitionTestCase::MtpPartitionTestCase()
+    : TestCase("Check the partitioning of the nodes into logical processes")
+{
+}
+
+void
+MtpPartitionTestCase::DoRun()
+{
+    Config::SetGlobal("SimulatorImplementationType",
+                      StringValue("ns3::MultithreadedSimulatorImpl"));
+
+    // Three nodes on a shared channel, one of them also linked to a fourth
+    // node by a point-to-point link, and two isolated nodes.
+    NodeContainer nodes;
+    nodes.Create(6);
+    SimpleNetDeviceHelper helper;
+    helper.SetChannelAttribute("Delay", TimeValue(MilliSeconds(1)));
+    helper.Install(NodeContainer(nodes.Get(0), nodes.Get(1), nodes.Get(2)));
+    helper.SetNetDevicePointToPointMode(true);
+    helper.SetChannelAttribute("Delay", TimeValue(MilliSeconds(5)));
+    helper.Install(NodeContainer(nodes.Get(2), nodes.Get(3)));
+
+    Simulator::Run();
+
+    Ptr<MultithreadedSimulatorImpl> impl =
+        DynamicCast<MultithreadedSimulatorImpl>(Simulator::GetImplementation());
+    NS_TEST_ASSERT_MSG_NE(impl, nullptr, "Wrong simulator implementation");
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLpCount(), 1 + 4, "Wrong number of logical processes");
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLookAhead(), MilliSeconds(5), "Wrong lookahead");
+
+    Simulator::Destroy();
+    Config::SetGlobal("SimulatorImplementationType", StringValue("ns3::DefaultSimulatorImpl"));
+}
+
+/**
+ * \ingroup mtp-tests
+ *
+ * \brief The multithreaded simulation Test Suite.
+ */
+class MtpTestSuite : public TestSuite
+{
+  public:
+    MtpTestSuite()
+        : TestSuite("mtp", UNIT)
+    {
+        AddTestCase(new MtpRingTestCase, TestCase::QUICK);
+        AddTestCase(new MtpPartitionTestCase, TestCase::QUICK);
+    }
+};
+
+/// Static variable for test initialization.
+static MtpTestSuite g_mtpTestSuite;
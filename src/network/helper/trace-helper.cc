@@ -19,14 +19,20 @@
 
 #include "ns3/abort.h"
 #include "ns3/assert.h"
+#include "ns3/boolean.h"
 #include "ns3/log.h"
 #include "ns3/names.h"
 #include "ns3/net-device.h"
 #include "ns3/node.h"
 #include "ns3/pcap-file-wrapper.h"
+#include "ns3/pcapng-file.h"
 #include "ns3/ptr.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
 
 #include <fstream>
+#include <map>
+#include <sstream>
 #include <stdint.h>
 #include <string>
 
@@ -35,6 +41,119 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("TraceHelper");
 
+/**
+ * \ingroup network
+ * The trace files shared by several devices, by file name.  The pcapng
+ * files are closed by Simulator::Destroy.
+ */
+struct SharedTraceFiles
+{
+    std::map<std::string, Ptr<PcapNgFile>> pcap;             //!< The pcapng files
+    std::map<std::string, Ptr<OutputStreamWrapper>> ascii;  //!< The ascii trace files
+    bool destroyScheduled{false};                           //!< Whether Clear is scheduled
+};
+
+/**
+ * \ingroup network
+ * \return The trace files shared by several devices.
+ */
+static SharedTraceFiles&
+GetSharedTraceFiles()
+{
+    static SharedTraceFiles files;
+    if (!files.destroyScheduled)
+    {
+        Simulator::ScheduleDestroy([]() {
+            SharedTraceFiles& files = GetSharedTraceFiles();
+            for (auto& [filename, file] : files.pcap)
+            {
+                file->Close();
+            }
+            files.pcap.clear();
+            files.ascii.clear();
+            files.destroyScheduled = false;
+        });
+        files.destroyScheduled = true;
+    }
+    return files;
+}
+
+/**
+ * \ingroup network
+ * The interface of a shared pcapng file to which PcapHelper::CreateFile
+ * writes, while PcapHelperForDevice enables the pcap output of a device.
+ */
+struct SharedPcapInterface
+{
+    std::string filename;    //!< The name of the pcapng file, or empty
+    std::string name;        //!< The name of the interface
+    std::string description; //!< The description of the interface
+};
+
+/// The interface of a shared pcapng file to which PcapHelper::CreateFile writes
+static SharedPcapInterface g_sharedPcapInterface;
+
+/**
+ * \ingroup network
+ * \param device A device.
+ * \param mode The grouping of the trace files.
+ * \return The name of the node and of the device, as in the file names of
+ * the devices, if the mode has a file per device, or the name of the node
+ * only otherwise.
+ */
+static std::string
+GetDeviceTraceName(Ptr<NetDevice> device, TraceFileMode mode)
+{
+    Ptr<Node> node = device->GetNode();
+    std::string nodename = Names::FindName(node);
+    std::string devicename = Names::FindName(device);
+
+    std::ostringstream oss;
+    if (!nodename.empty())
+    {
+        oss << nodename;
+    }
+    else
+    {
+        oss << node->GetId();
+    }
+    if (mode == TraceFileMode::PER_DEVICE)
+    {
+        oss << "-";
+        if (!devicename.empty())
+        {
+            oss << devicename;
+        }
+        else
+        {
+            oss << device->GetIfIndex();
+        }
+    }
+    return oss.str();
+}
+
+/**
+ * \ingroup network
+ * \param prefix The prefix of the trace files.
+ * \param device A device.
+ * \param mode The grouping of the trace files, which share the file.
+ * \param extension The extension of the file.
+ * \return The name of the trace file of the device.
+ */
+static std::string
+GetSharedTraceFilename(std::string prefix,
+                       Ptr<NetDevice> device,
+                       TraceFileMode mode,
+                       std::string extension)
+{
+    NS_ABORT_MSG_UNLESS(!prefix.empty(), "Empty prefix string");
+    if (mode == TraceFileMode::PER_NODE)
+    {
+        return prefix + "-" + GetDeviceTraceName(device, mode) + extension;
+    }
+    return prefix + extension;
+}
+
 PcapHelper::PcapHelper()
 {
     NS_LOG_FUNCTION_NOARGS();
@@ -55,6 +174,35 @@ PcapHelper::CreateFile(std::string filename,
     NS_LOG_FUNCTION(filename << filemode << dataLinkType << snapLen << tzCorrection);
 
     Ptr<PcapFileWrapper> file = CreateObject<PcapFileWrapper>();
+    const SharedPcapInterface& shared = g_sharedPcapInterface;
+    if (!shared.filename.empty())
+    {
+        Ptr<PcapNgFile>& ngFile = GetSharedTraceFiles().pcap[shared.filename];
+        if (!ngFile)
+        {
+            // the shared file is written as the pcap files of the devices would be
+            BooleanValue asyncWrite;
+            BooleanValue compress;
+            UintegerValue bufferSize;
+            UintegerValue pendingBuffers;
+            file->GetAttribute("AsyncWrite", asyncWrite);
+            file->GetAttribute("Compress", compress);
+            file->GetAttribute("AsyncBufferSize", bufferSize);
+            file->GetAttribute("AsyncPendingBuffers", pendingBuffers);
+            ngFile = Create<PcapNgFile>();
+            if (asyncWrite.Get() || compress.Get())
+            {
+                ngFile->EnableAsyncWrite(compress.Get(), bufferSize.Get(), pendingBuffers.Get());
+            }
+            ngFile->Open(shared.filename);
+            NS_ABORT_MSG_IF(ngFile->Fail(), "Unable to Open " << shared.filename);
+        }
+        file->Open(ngFile, shared.name, shared.description);
+        file->Init(dataLinkType, snapLen, tzCorrection);
+        NS_ABORT_MSG_IF(file->Fail(), "Unable to Init " << shared.filename);
+        return file;
+    }
+
     file->Open(filename, filemode);
     NS_ABORT_MSG_IF(file->Fail(), "Unable to Open " << filename << " for mode " << filemode);
 
@@ -416,13 +564,31 @@ AsciiTraceHelper::DefaultReceiveSinkWithContext(Ptr<OutputStreamWrapper> stream,
                          << std::endl;
 }
 
+void
+PcapHelperForDevice::SetPcapFileMode(TraceFileMode mode)
+{
+    m_pcapFileMode = mode;
+}
+
 void
 PcapHelperForDevice::EnablePcap(std::string prefix,
                                 Ptr<NetDevice> nd,
                                 bool promiscuous,
                                 bool explicitFilename)
 {
+    if (m_pcapFileMode == TraceFileMode::PER_DEVICE || explicitFilename)
+    {
+        EnablePcapInternal(prefix, nd, promiscuous, explicitFilename);
+        return;
+    }
+    // the files created by the device helper write to the shared file
+    g_sharedPcapInterface = {
+        GetSharedTraceFilename(prefix, nd, m_pcapFileMode, ".pcapng"),
+        GetDeviceTraceName(nd, TraceFileMode::PER_DEVICE),
+        nd->GetInstanceTypeId().GetName(),
+    };
     EnablePcapInternal(prefix, nd, promiscuous, explicitFilename);
+    g_sharedPcapInterface = SharedPcapInterface();
 }
 
 void
@@ -490,13 +656,22 @@ PcapHelperForDevice::EnablePcap(std::string prefix,
     }
 }
 
+//
+// Public API
+//
+void
+AsciiTraceHelperForDevice::SetAsciiFileMode(TraceFileMode mode)
+{
+    m_asciiFileMode = mode;
+}
+
 //
 // Public API
 //
 void
 AsciiTraceHelperForDevice::EnableAscii(std::string prefix, Ptr<NetDevice> nd, bool explicitFilename)
 {
-    EnableAsciiInternal(Ptr<OutputStreamWrapper>(), prefix, nd, explicitFilename);
+    EnableAsciiImpl(Ptr<OutputStreamWrapper>(), prefix, nd, explicitFilename);
 }
 
 //
@@ -538,6 +713,30 @@ AsciiTraceHelperForDevice::EnableAsciiImpl(Ptr<OutputStreamWrapper> stream,
                                            bool explicitFilename)
 {
     Ptr<NetDevice> nd = Names::Find<NetDevice>(ndName);
+    EnableAsciiImpl(stream, prefix, nd, explicitFilename);
+}
+
+//
+// Private API
+//
+void
+AsciiTraceHelperForDevice::EnableAsciiImpl(Ptr<OutputStreamWrapper> stream,
+                                           std::string prefix,
+                                           Ptr<NetDevice> nd,
+                                           bool explicitFilename)
+{
+    if (!stream && !explicitFilename && m_asciiFileMode != TraceFileMode::PER_DEVICE)
+    {
+        // the devices sharing the file write to it as to a stream
+        std::string filename = GetSharedTraceFilename(prefix, nd, m_asciiFileMode, ".tr");
+        Ptr<OutputStreamWrapper>& shared = GetSharedTraceFiles().ascii[filename];
+        if (!shared)
+        {
+            AsciiTraceHelper asciiTraceHelper;
+            shared = asciiTraceHelper.CreateFileStream(filename);
+        }
+        stream = shared;
+    }
     EnableAsciiInternal(stream, prefix, nd, explicitFilename);
 }
 
@@ -570,7 +769,7 @@ AsciiTraceHelperForDevice::EnableAsciiImpl(Ptr<OutputStreamWrapper> stream,
     for (auto i = d.Begin(); i != d.End(); ++i)
     {
         Ptr<NetDevice> dev = *i;
-        EnableAsciiInternal(stream, prefix, dev, false);
+        EnableAsciiImpl(stream, prefix, dev, false);
     }
 }
 
@@ -679,7 +878,7 @@ AsciiTraceHelperForDevice::EnableAsciiImpl(Ptr<OutputStreamWrapper> stream,
 
         Ptr<NetDevice> nd = node->GetDevice(deviceid);
 
-        EnableAsciiInternal(stream, prefix, nd, explicitFilename);
+        EnableAsciiImpl(stream, prefix, nd, explicitFilename);
         return;
     }
 }
@@ -104,6 +104,11 @@ class PcapHelper
     /**
      * @brief Create and initialize a pcap file.
      *
+     * When called while PcapHelperForDevice enables the output of a device
+     * to a pcapng file shared with other devices (see TraceFileMode), the
+     * file name and mode are ignored, and the file returned writes to a new
+     * interface of the shared file.
+     *
      * @param filename file name
      * @param filemode file mode
      * @param dataLinkType data link type of packet data
@@ -616,6 +621,21 @@ AsciiTraceHelper::HookDefaultReceiveSinkWithContext(Ptr<T> object,
                       << tracename << "\"");
 }
 
+/**
+ * \brief How the trace files of the devices enabled with a prefix are grouped
+ *
+ * With one file per node or a single file, the pcap traces are written to
+ * pcapng files, with one interface per device, named after the node and the
+ * device ids (or names) as the pcap files would be, e.g. "0-1".  The ascii
+ * traces of the devices sharing a file are written with their context.
+ */
+enum class TraceFileMode
+{
+    PER_DEVICE, //!< One file per device, e.g. prefix-0-1.pcap
+    PER_NODE,   //!< One file per node, e.g. prefix-0.pcapng
+    SINGLE_FILE //!< One file for all the devices, e.g. prefix.pcapng
+};
+
 /**
  * \brief Base class providing common user-level pcap operations for helpers
  * representing net devices.
@@ -637,6 +657,17 @@ class PcapHelperForDevice
     {
     }
 
+    /**
+     * @brief Set how the pcap files of the devices are grouped, when the
+     * pcap output is enabled with a prefix rather than an explicit filename.
+     *
+     * The pcapng files shared by several devices are also shared with the
+     * other helpers writing to the same files.
+     *
+     * @param mode The grouping of the files.
+     */
+    void SetPcapFileMode(TraceFileMode mode);
+
     /**
      * @brief Enable pcap output the indicated net device.
      *
@@ -719,6 +750,9 @@ class PcapHelperForDevice
      * @param promiscuous If true capture all possible packets available at the device.
      */
     void EnablePcapAll(std::string prefix, bool promiscuous = false);
+
+  private:
+    TraceFileMode m_pcapFileMode{TraceFileMode::PER_DEVICE}; //!< Grouping of the pcap files
 };
 
 /**
@@ -742,6 +776,18 @@ class AsciiTraceHelperForDevice
     {
     }
 
+    /**
+     * @brief Set how the ascii trace files of the devices are grouped, when
+     * the ascii output is enabled with a prefix rather than an explicit
+     * filename or a stream.
+     *
+     * The files shared by several devices are also shared with the other
+     * helpers writing to the same files.
+     *
+     * @param mode The grouping of the files.
+     */
+    void SetAsciiFileMode(TraceFileMode mode);
+
     /**
      * @brief Enable ascii trace output on the indicated net device.
      *
@@ -960,6 +1006,8 @@ class AsciiTraceHelperForDevice
                          std::string prefix,
                          Ptr<NetDevice> nd,
                          bool explicitFilename);
+
+    TraceFileMode m_asciiFileMode{TraceFileMode::PER_DEVICE}; //!< Grouping of the ascii files
 };
 
 } // namespace ns3
@@ -18,6 +18,8 @@
  */
 #include "buffer.h"
 
+#include "packet-memory-pool.h"
+
 #include "ns3/assert.h"
 #include "ns3/log.h"
 
@@ -54,96 +56,12 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("Buffer");
 
+#ifdef NS3_MTP
+thread_local uint32_t Buffer::g_recommendedStart = 0;
+#else
 uint32_t Buffer::g_recommendedStart = 0;
-#ifdef BUFFER_FREE_LIST
-/* The following macros are pretty evil but they are needed to allow us to
- * keep track of 3 possible states for the g_freeList variable:
- *  - uninitialized means that no one has created a buffer yet
- *    so no one has created the associated free list (it is created
- *    on-demand when the first buffer is created)
- *  - initialized means that the free list exists and is valid
- *  - destroyed means that the static destructors of this compilation unit
- *    have run so, the free list has been cleared from its content
- * The key is that in destroyed state, we are careful not re-create it
- * which is a typical weakness of lazy evaluation schemes which use
- * '0' as a special value to indicate both un-initialized and destroyed.
- * Note that it is important to use '0' as the marker for un-initialized state
- * because the variable holding this state information is initialized to zero
- * which the compiler assigns to zero-memory which is initialized to _zero_
- * before the constructors run so this ensures perfect handling of crazy
- * constructor orderings.
- */
-#define MAGIC_DESTROYED (~(long)0)
-#define IS_UNINITIALIZED(x) (x == (Buffer::FreeList*)0)
-#define IS_DESTROYED(x) (x == (Buffer::FreeList*)MAGIC_DESTROYED)
-#define IS_INITIALIZED(x) (!IS_UNINITIALIZED(x) && !IS_DESTROYED(x))
-#define DESTROYED ((Buffer::FreeList*)MAGIC_DESTROYED)
-#define UNINITIALIZED ((Buffer::FreeList*)0)
-uint32_t Buffer::g_maxSize = 0;
-Buffer::FreeList* Buffer::g_freeList = nullptr;
-Buffer::LocalStaticDestructor Buffer::g_localStaticDestructor;
-
-Buffer::LocalStaticDestructor::~LocalStaticDestructor()
-{
-    NS_LOG_FUNCTION(this);
-    if (IS_INITIALIZED(g_freeList))
-    {
-        for (auto i = g_freeList->begin(); i != g_freeList->end(); i++)
-        {
-            Buffer::Deallocate(*i);
-        }
-        delete g_freeList;
-        g_freeList = DESTROYED;
-    }
-}
-
-void
-Buffer::Recycle(Buffer::Data* data)
-{
-    NS_LOG_FUNCTION(data);
-    NS_ASSERT(data->m_count == 0);
-    NS_ASSERT(!IS_UNINITIALIZED(g_freeList));
-    g_maxSize = std::max(g_maxSize, data->m_size);
-    /* feed into free list */
-    if (data->m_size < g_maxSize || IS_DESTROYED(g_freeList) || g_freeList->size() > 1000)
-    {
-        Buffer::Deallocate(data);
-    }
-    else
-    {
-        NS_ASSERT(IS_INITIALIZED(g_freeList));
-        g_freeList->push_back(data);
-    }
-}
+#endif
 
-Buffer::Data*
-Buffer::Create(uint32_t dataSize)
-{
-    NS_LOG_FUNCTION(dataSize);
-    /* try to find a buffer correctly sized. */
-    if (IS_UNINITIALIZED(g_freeList))
-    {
-        g_freeList = new Buffer::FreeList();
-    }
-    else if (IS_INITIALIZED(g_freeList))
-    {
-        while (!g_freeList->empty())
-        {
-            Buffer::Data* data = g_freeList->back();
-            g_freeList->pop_back();
-            if (data->m_size >= dataSize)
-            {
-                data->m_count = 1;
-                return data;
-            }
-            Buffer::Deallocate(data);
-        }
-    }
-    Buffer::Data* data = Buffer::Allocate(dataSize);
-    NS_ASSERT(data->m_count == 1);
-    return data;
-}
-#else  /* BUFFER_FREE_LIST */
 void
 Buffer::Recycle(Buffer::Data* data)
 {
@@ -158,7 +76,6 @@ Buffer::Create(uint32_t size)
     NS_LOG_FUNCTION(size);
     return Allocate(size);
 }
-#endif /* BUFFER_FREE_LIST */
 
 constexpr uint32_t ALLOC_OVER_PROVISION = 100; //!< Additional bytes to over-provision.
 
@@ -173,9 +90,10 @@ Buffer::Allocate(uint32_t reqSize)
     NS_ASSERT(reqSize >= 1);
     reqSize += ALLOC_OVER_PROVISION;
     uint32_t size = reqSize - 1 + sizeof(Buffer::Data);
-    auto b = new uint8_t[size];
-    auto data = reinterpret_cast<Buffer::Data*>(b);
-    data->m_size = reqSize;
+    // the rest of the pool block leaves more room to grow in place.
+    auto blockSize = static_cast<uint32_t>(PacketMemoryPool::GetBlockSize(size));
+    auto data = static_cast<Buffer::Data*>(PacketMemoryPool::Allocate(size));
+    data->m_size = reqSize + blockSize - size;
     data->m_count = 1;
     return data;
 }
@@ -185,8 +103,7 @@ Buffer::Deallocate(Buffer::Data* data)
 {
     NS_LOG_FUNCTION(data);
     NS_ASSERT(data->m_count == 0);
-    auto buf = reinterpret_cast<uint8_t*>(data);
-    delete[] buf;
+    PacketMemoryPool::Deallocate(data, data->m_size - 1 + sizeof(Buffer::Data));
 }
 
 Buffer::Buffer()
@@ -266,8 +183,7 @@ Buffer::operator=(const Buffer& o)
     if (m_data != o.m_data)
     {
         // not assignment to self.
-        m_data->m_count--;
-        if (m_data->m_count == 0)
+        if (--m_data->m_count == 0)
         {
             Recycle(m_data);
         }
@@ -289,8 +205,7 @@ Buffer::~Buffer()
     NS_LOG_FUNCTION(this);
     NS_ASSERT(CheckInternalState());
     g_recommendedStart = std::max(g_recommendedStart, m_maxZeroAreaStart);
-    m_data->m_count--;
-    if (m_data->m_count == 0)
+    if (--m_data->m_count == 0)
     {
         Recycle(m_data);
     }
@@ -315,7 +230,12 @@ Buffer::AddAtStart(uint32_t start)
 {
     NS_LOG_FUNCTION(this << start);
     NS_ASSERT(CheckInternalState());
+#ifdef NS3_MTP
+    // another thread may own a reference to the same data: never write into it
+    bool isDirty = m_data->m_count > 1;
+#else
     bool isDirty = m_data->m_count > 1 && m_start > m_data->m_dirtyStart;
+#endif
     if (m_start >= start && !isDirty)
     {
         /* enough space in the buffer and not dirty.
@@ -333,8 +253,7 @@ Buffer::AddAtStart(uint32_t start)
         uint32_t newSize = GetInternalSize() + start;
         Buffer::Data* newData = Buffer::Create(newSize);
         memcpy(newData->m_data + start, m_data->m_data + m_start, GetInternalSize());
-        m_data->m_count--;
-        if (m_data->m_count == 0)
+        if (--m_data->m_count == 0)
         {
             Buffer::Recycle(m_data);
         }
@@ -361,7 +280,12 @@ Buffer::AddAtEnd(uint32_t end)
 {
     NS_LOG_FUNCTION(this << end);
     NS_ASSERT(CheckInternalState());
+#ifdef NS3_MTP
+    // another thread may own a reference to the same data: never write into it
+    bool isDirty = m_data->m_count > 1;
+#else
     bool isDirty = m_data->m_count > 1 && m_end < m_data->m_dirtyEnd;
+#endif
     if (GetInternalEnd() + end <= m_data->m_size && !isDirty)
     {
         /* enough space in buffer and not dirty
@@ -379,8 +303,7 @@ Buffer::AddAtEnd(uint32_t end)
         uint32_t newSize = GetInternalSize() + end;
         Buffer::Data* newData = Buffer::Create(newSize);
         memcpy(newData->m_data, m_data->m_data + m_start, GetInternalSize());
-        m_data->m_count--;
-        if (m_data->m_count == 0)
+        if (--m_data->m_count == 0)
         {
             Buffer::Recycle(m_data);
         }
@@ -407,15 +330,20 @@ Buffer::AddAtEnd(const Buffer& o)
 {
     NS_LOG_FUNCTION(this << &o);
 
-    if (m_data->m_count == 1 && (m_end == m_zeroAreaEnd || m_zeroAreaStart == m_zeroAreaEnd) &&
-        m_end == m_data->m_dirtyEnd && o.m_start == o.m_zeroAreaStart &&
-        o.m_zeroAreaEnd - o.m_zeroAreaStart > 0)
+    if ((m_end == m_zeroAreaEnd || m_zeroAreaStart == m_zeroAreaEnd) &&
+        o.m_start == o.m_zeroAreaStart && o.m_zeroAreaEnd - o.m_zeroAreaStart > 0)
     {
         /**
          * This is an optimization which kicks in when
          * we attempt to aggregate two buffers which contain
          * adjacent zero areas.
          */
+        if (m_data->m_count != 1 || m_end != m_data->m_dirtyEnd)
+        {
+            // The zero area is about to grow: the real bytes must not be
+            // shared with other buffers, but the zero area is not copied.
+            Unshare();
+        }
         if (m_zeroAreaStart == m_zeroAreaEnd)
         {
             m_zeroAreaStart = m_end;
@@ -435,7 +363,13 @@ Buffer::AddAtEnd(const Buffer& o)
         return;
     }
 
-    *this = CreateFullCopy();
+    // The bytes of o are appended after the real bytes which follow the
+    // zero area of this buffer, which is kept virtual.
+    if (m_data == o.m_data)
+    {
+        // the bytes of o cannot be written over themselves.
+        Unshare();
+    }
     AddAtEnd(o.GetSize());
     Buffer::Iterator destStart = End();
     destStart.Prev(o.GetSize());
@@ -537,6 +471,31 @@ Buffer::CreateFragment(uint32_t start, uint32_t length) const
     return tmp;
 }
 
+void
+Buffer::Unshare()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(CheckInternalState());
+    Buffer::Data* newData = Buffer::Create(GetInternalSize());
+    memcpy(newData->m_data, m_data->m_data + m_start, GetInternalSize());
+    if (--m_data->m_count == 0)
+    {
+        Buffer::Recycle(m_data);
+    }
+    m_data = newData;
+
+    int32_t delta = -m_start;
+    m_zeroAreaStart += delta;
+    m_zeroAreaEnd += delta;
+    m_end += delta;
+    m_start += delta;
+
+    // update dirty area
+    m_data->m_dirtyStart = m_start;
+    m_data->m_dirtyEnd = m_end;
+    NS_ASSERT(CheckInternalState());
+}
+
 Buffer
 Buffer::CreateFullCopy() const
 {
@@ -838,27 +797,36 @@ Buffer::Iterator::Write(Iterator start, Iterator end)
     NS_ASSERT(m_data != start.m_data);
     uint32_t size = end.m_current - start.m_current;
     NS_ASSERT_MSG(CheckNoZero(m_current, m_current + size), GetWriteErrorMessage());
+    // the destination bytes may follow the zero area of this buffer.
+    uint8_t* to;
+    if (m_current <= m_zeroStart)
+    {
+        to = &m_data[m_current];
+    }
+    else
+    {
+        to = &m_data[m_current - (m_zeroEnd - m_zeroStart)];
+    }
+    m_current += size;
     if (start.m_current <= start.m_zeroStart)
     {
         uint32_t toCopy = std::min(size, start.m_zeroStart - start.m_current);
-        memcpy(&m_data[m_current], &start.m_data[start.m_current], toCopy);
+        memcpy(to, &start.m_data[start.m_current], toCopy);
         start.m_current += toCopy;
-        m_current += toCopy;
+        to += toCopy;
         size -= toCopy;
     }
     if (start.m_current <= start.m_zeroEnd)
     {
         uint32_t toCopy = std::min(size, start.m_zeroEnd - start.m_current);
-        memset(&m_data[m_current], 0, toCopy);
+        memset(to, 0, toCopy);
         start.m_current += toCopy;
-        m_current += toCopy;
+        to += toCopy;
         size -= toCopy;
     }
     uint32_t toCopy = std::min(size, start.m_dataEnd - start.m_current);
     uint8_t* from = &start.m_data[start.m_current - (start.m_zeroEnd - start.m_zeroStart)];
-    uint8_t* to = &m_data[m_current];
     memcpy(to, from, toCopy);
-    m_current += toCopy;
 }
 
 void
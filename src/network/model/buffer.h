@@ -25,7 +25,9 @@
 #include <stdint.h>
 #include <vector>
 
-#define BUFFER_FREE_LIST 1
+#ifdef NS3_MTP
+#include <atomic>
+#endif
 
 namespace ns3
 {
@@ -66,10 +68,13 @@ namespace ns3
  * contains real data bytes in its BufferData instance but it also
  * contains "virtual zero data" which typically is used to represent
  * application-level payload. No memory is allocated to store the
- * zero bytes of application-level payload unless the user fragments
- * a Buffer: this application-level payload is kept track of with
- * a pair of integers which describe where in the buffer content
- * the "virtual zero area" starts and ends.
+ * zero bytes of application-level payload: this application-level
+ * payload is kept track of with a pair of integers which describe where
+ * in the buffer content the "virtual zero area" starts and ends.
+ * Fragmenting a Buffer never copies its zero area, and neither does
+ * concatenating Buffers: the zero area of the appended Buffer is merged
+ * into the zero area of this Buffer when the two are adjacent, and is
+ * only written as real bytes when they are separated by real bytes.
  *
  * \verbatim
  * ***: unused bytes
@@ -665,7 +670,11 @@ class Buffer
          * The reference count of an instance of this data structure.
          * Each buffer which references an instance holds a count.
          */
+#ifdef NS3_MTP
+        std::atomic<uint32_t> m_count;
+#else
         uint32_t m_count;
+#endif
         /**
          * the size of the m_data field below.
          */
@@ -695,6 +704,13 @@ class Buffer
      */
     Buffer CreateFullCopy() const;
 
+    /**
+     * \brief Give this buffer its own copy of its real bytes.
+     *
+     * Unlike CreateFullCopy(), the virtual zero area is not copied.
+     */
+    void Unshare();
+
     /**
      * \brief Transform a "Virtual byte buffer" into a "Real byte buffer"
      */
@@ -769,7 +785,11 @@ class Buffer
      * writing data. i.e., m_start should be initialized to this
      * value.
      */
+#ifdef NS3_MTP
+    static thread_local uint32_t g_recommendedStart;
+#else
     static uint32_t g_recommendedStart;
+#endif
 
     /**
      * offset to the start of the virtual zero area from the start
@@ -791,21 +811,6 @@ class Buffer
      * instance from the start of m_data->m_data
      */
     uint32_t m_end;
-
-#ifdef BUFFER_FREE_LIST
-    /// Container for buffer data
-    typedef std::vector<Buffer::Data*> FreeList;
-
-    /// Local static destructor structure
-    struct LocalStaticDestructor
-    {
-        ~LocalStaticDestructor();
-    };
-
-    static uint32_t g_maxSize;                            //!< Max observed data size
-    static FreeList* g_freeList;                          //!< Buffer data container
-    static LocalStaticDestructor g_localStaticDestructor; //!< Local static destructor
-#endif
 };
 
 } // namespace ns3
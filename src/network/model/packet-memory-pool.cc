@@ -0,0 +1,237 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "packet-memory-pool.h"
+
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <new>
+
+/**
+ * \file
+ * \ingroup packet
+ * ns3::PacketMemoryPool implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("PacketMemoryPool");
+
+namespace
+{
+
+/**
+ * \ingroup packet
+ * The per-thread free lists of packet memory, one per size class.
+ *
+ * Logging is avoided here: packets are created and destroyed while logging.
+ */
+class Pool
+{
+  public:
+    /** Size of the smallest size class, and granularity up to 64 bytes. */
+    static constexpr std::size_t GRANULARITY = 16;
+    /** Number of size classes: four up to 64 bytes, then four per power of two. */
+    static constexpr std::size_t N_CLASSES = 44;
+    /** Maximum number of bytes kept in the free list of a size class. */
+    static constexpr std::size_t MAX_FREE_BYTES = 2 * 1024 * 1024;
+
+    /** Constructor. */
+    Pool();
+    /** Destructor; releases the free lists. */
+    ~Pool();
+
+    /**
+     * Get the size class of a requested size.
+     * \param [in] size The requested size, at most PacketMemoryPool::MAX_BLOCK_SIZE.
+     * \param [out] blockSize The size of the blocks of the class.
+     * \returns The size class.
+     */
+    static std::size_t GetSizeClass(std::size_t size, std::size_t& blockSize);
+
+    /**
+     * Allocate a block.
+     * \param [in] size The requested size.
+     * \returns The block.
+     */
+    void* Allocate(std::size_t size);
+    /**
+     * Release a block.
+     * \param [in] p The block.
+     * \param [in] size The requested size of the block.
+     */
+    void Deallocate(void* p, std::size_t size);
+
+    /** The pool statistics. */
+    PacketMemoryPool::Statistics m_stats;
+
+  private:
+    /** A free block, linked into the free list of its size class. */
+    struct FreeBlock
+    {
+        FreeBlock* next; //!< Next free block of the same size class.
+    };
+
+    /** The free list heads, indexed by size class. */
+    FreeBlock* m_freeLists[N_CLASSES];
+    /** The number of blocks in each free list. */
+    std::size_t m_freeCounts[N_CLASSES];
+};
+
+/**
+ * The packet memory pool of the current thread.  Blocks released by static
+ * destructors after it is destroyed go to the system allocator.
+ */
+thread_local Pool t_pool;
+/** Whether t_pool has been destroyed. */
+thread_local bool t_poolDestroyed = false;
+
+Pool::Pool()
+    : m_stats{0, 0, 0, 0},
+      m_freeLists{},
+      m_freeCounts{}
+{
+}
+
+Pool::~Pool()
+{
+    for (std::size_t i = 0; i < N_CLASSES; i++)
+    {
+        while (m_freeLists[i] != nullptr)
+        {
+            FreeBlock* block = m_freeLists[i];
+            m_freeLists[i] = block->next;
+            ::operator delete(block);
+        }
+    }
+    t_poolDestroyed = true;
+}
+
+std::size_t
+Pool::GetSizeClass(std::size_t size, std::size_t& blockSize)
+{
+    if (size <= 4 * GRANULARITY)
+    {
+        std::size_t n = std::max<std::size_t>((size + GRANULARITY - 1) / GRANULARITY, 1);
+        blockSize = n * GRANULARITY;
+        return n - 1;
+    }
+    // size - 1 is in [2^log, 2^(log + 1)), which is split in four classes.
+    std::size_t log = 6;
+    while (((size - 1) >> (log + 1)) != 0)
+    {
+        log++;
+    }
+    std::size_t step = std::size_t(1) << (log - 2);
+    std::size_t n = (size - 1) / step + 1;
+    blockSize = n * step;
+    return 4 + (log - 6) * 4 + (n - 5);
+}
+
+void*
+Pool::Allocate(std::size_t size)
+{
+    m_stats.inUse++;
+    m_stats.highWaterMark = std::max(m_stats.highWaterMark, m_stats.inUse);
+    if (size > PacketMemoryPool::MAX_BLOCK_SIZE)
+    {
+        m_stats.misses++;
+        return ::operator new(size);
+    }
+    std::size_t blockSize;
+    std::size_t sizeClass = GetSizeClass(size, blockSize);
+    if (m_freeLists[sizeClass] != nullptr)
+    {
+        m_stats.hits++;
+        FreeBlock* block = m_freeLists[sizeClass];
+        m_freeLists[sizeClass] = block->next;
+        m_freeCounts[sizeClass]--;
+        return block;
+    }
+    m_stats.misses++;
+    return ::operator new(blockSize);
+}
+
+void
+Pool::Deallocate(void* p, std::size_t size)
+{
+    m_stats.inUse--;
+    if (size > PacketMemoryPool::MAX_BLOCK_SIZE)
+    {
+        ::operator delete(p);
+        return;
+    }
+    std::size_t blockSize;
+    std::size_t sizeClass = GetSizeClass(size, blockSize);
+    if ((m_freeCounts[sizeClass] + 1) * blockSize > MAX_FREE_BYTES)
+    {
+        ::operator delete(p);
+        return;
+    }
+    auto block = static_cast<FreeBlock*>(p);
+    block->next = m_freeLists[sizeClass];
+    m_freeLists[sizeClass] = block;
+    m_freeCounts[sizeClass]++;
+}
+
+} // unnamed namespace
+
+std::size_t
+PacketMemoryPool::GetBlockSize(std::size_t size)
+{
+    if (size > MAX_BLOCK_SIZE)
+    {
+        return size;
+    }
+    std::size_t blockSize;
+    Pool::GetSizeClass(size, blockSize);
+    return blockSize;
+}
+
+void*
+PacketMemoryPool::Allocate(std::size_t size)
+{
+    if (t_poolDestroyed)
+    {
+        return ::operator new(GetBlockSize(size));
+    }
+    return t_pool.Allocate(size);
+}
+
+void
+PacketMemoryPool::Deallocate(void* p, std::size_t size)
+{
+    if (t_poolDestroyed)
+    {
+        ::operator delete(p);
+        return;
+    }
+    t_pool.Deallocate(p, size);
+}
+
+PacketMemoryPool::Statistics
+PacketMemoryPool::GetStatistics()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    if (t_poolDestroyed)
+    {
+        return {0, 0, 0, 0};
+    }
+    return t_pool.m_stats;
+}
+
+} // namespace ns3
@@ -0,0 +1,102 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef PACKET_MEMORY_POOL_H
+#define PACKET_MEMORY_POOL_H
+
+#include <cstddef>
+#include <stdint.h>
+
+/**
+ * \file
+ * \ingroup packet
+ * ns3::PacketMemoryPool declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup packet
+ * \brief Size-class memory pool for the packet objects and their storage.
+ *
+ * Packet objects, and the variable-size storage of their Buffer,
+ * PacketMetadata, ByteTagList and PacketTagList, are allocated from this
+ * pool.  The requested sizes are rounded up to a size class: multiples of
+ * 16 bytes up to 64 bytes, then four classes per power of two up to
+ * #MAX_BLOCK_SIZE.  Each thread keeps a free list per size class, so that
+ * creating and copying packets does not call the system allocator once the
+ * simulation has reached a steady state.  Larger blocks are allocated with
+ * the global \c operator \c new.
+ *
+ * The users of the pool should make use of the whole block returned by
+ * GetBlockSize(), which leaves room to grow in place.
+ */
+class PacketMemoryPool
+{
+  public:
+    /** The size of the largest size class. */
+    static constexpr std::size_t MAX_BLOCK_SIZE = 65536;
+
+    /** Statistics of the pool of a thread. */
+    struct Statistics
+    {
+        /** Number of blocks allocated from the free lists. */
+        uint64_t hits;
+        /** Number of blocks allocated with the system allocator. */
+        uint64_t misses;
+        /** Number of blocks currently allocated by this thread. */
+        int64_t inUse;
+        /** Largest value reached by \c inUse. */
+        int64_t highWaterMark;
+    };
+
+    /**
+     * Get the size of the block allocated for a requested size.
+     * \param [in] size The requested size.
+     * \returns The size of the block, at least \pname{size}.
+     */
+    static std::size_t GetBlockSize(std::size_t size);
+
+    /**
+     * Allocate a block from the pool of the calling thread.
+     * \param [in] size The requested size.
+     * \returns A block of GetBlockSize(size) bytes.
+     */
+    static void* Allocate(std::size_t size);
+
+    /**
+     * Return a block to the pool of the calling thread.
+     * \param [in] p The block.
+     * \param [in] size The size requested for the block, or any size with
+     *             the same block size.
+     */
+    static void Deallocate(void* p, std::size_t size);
+
+    /**
+     * Get the statistics of the pool of the calling thread.
+     *
+     * Blocks freed by a thread other than the one which allocated them
+     * are returned to the pool of the freeing thread, so \c inUse is only
+     * exact when packets are created and destroyed by the same thread.
+     *
+     * \returns The pool statistics.
+     */
+    static Statistics GetStatistics();
+};
+
+} // namespace ns3
+
+#endif /* PACKET_MEMORY_POOL_H */
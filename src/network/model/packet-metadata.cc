@@ -20,12 +20,14 @@
 
 #include "buffer.h"
 #include "header.h"
+#include "packet-memory-pool.h"
 #include "trailer.h"
 
 #include "ns3/assert.h"
 #include "ns3/fatal-error.h"
 #include "ns3/log.h"
 
+#include <algorithm>
 #include <list>
 #include <utility>
 
@@ -38,18 +40,11 @@ bool PacketMetadata::m_enable = false;
 bool PacketMetadata::m_enableChecking = false;
 bool PacketMetadata::m_metadataSkipped = false;
 uint32_t PacketMetadata::m_maxSize = 0;
+#ifdef NS3_MTP
+std::atomic<uint16_t> PacketMetadata::m_chunkUid = 0;
+#else
 uint16_t PacketMetadata::m_chunkUid = 0;
-PacketMetadata::DataFreeList PacketMetadata::m_freeList;
-
-PacketMetadata::DataFreeList::~DataFreeList()
-{
-    NS_LOG_FUNCTION(this);
-    for (auto i = begin(); i != end(); i++)
-    {
-        PacketMetadata::Deallocate(*i);
-    }
-    PacketMetadata::m_enable = false;
-}
+#endif
 
 void
 PacketMetadata::Enable()
@@ -80,8 +75,7 @@ PacketMetadata::ReserveCopy(uint32_t size)
     PacketMetadata::Data* newData = PacketMetadata::Create(m_used + size);
     memcpy(newData->m_data, m_data->m_data, m_used);
     newData->m_dirtyEnd = m_used;
-    m_data->m_count--;
-    if (m_data->m_count == 0)
+    if (--m_data->m_count == 0)
     {
         PacketMetadata::Recycle(m_data);
     }
@@ -104,8 +98,13 @@ PacketMetadata::Reserve(uint32_t size)
 {
     NS_LOG_FUNCTION(this << size);
     NS_ASSERT(m_data != nullptr);
+#ifdef NS3_MTP
+    // shared data may be concurrently appended to by another thread
+    if (m_data->m_size >= m_used + size && (m_head == 0xffff || m_data->m_count == 1))
+#else
     if (m_data->m_size >= m_used + size &&
         (m_head == 0xffff || m_data->m_count == 1 || m_data->m_dirtyEnd == m_used))
+#endif
     {
         /* enough room, not dirty. */
     }
@@ -384,8 +383,12 @@ PacketMetadata::AddSmall(const PacketMetadata::SmallItem* item)
     uint32_t typeUidSize = GetUleb128Size(item->typeUid);
     uint32_t sizeSize = GetUleb128Size(item->size);
     uint32_t n = 2 + 2 + typeUidSize + sizeSize + 2;
+#ifdef NS3_MTP
+    if (m_used + n > m_data->m_size || (m_head != 0xffff && m_data->m_count != 1))
+#else
     if (m_used + n > m_data->m_size ||
         (m_head != 0xffff && m_data->m_count != 1 && m_used != m_data->m_dirtyEnd))
+#endif
     {
         ReserveCopy(n);
     }
@@ -421,8 +424,12 @@ PacketMetadata::AddBig(uint32_t next,
     uint32_t fragEndSize = GetUleb128Size(extraItem->fragmentEnd);
     uint32_t n = 2 + 2 + typeUidSize + sizeSize + 2 + fragStartSize + fragEndSize + 4;
 
+#ifdef NS3_MTP
+    if (m_used + n > m_data->m_size || (m_head != 0xffff && m_data->m_count != 1))
+#else
     if (m_used + n > m_data->m_size ||
         (m_head != 0xffff && m_data->m_count != 1 && m_used != m_data->m_dirtyEnd))
+#endif
     {
         ReserveCopy(n);
     }
@@ -568,46 +575,21 @@ PacketMetadata::Create(uint32_t size)
 {
     NS_LOG_FUNCTION(size);
     NS_LOG_LOGIC("create size=" << size << ", max=" << m_maxSize);
-    if (size > m_maxSize)
-    {
-        m_maxSize = size;
-    }
-    while (!m_freeList.empty())
-    {
-        PacketMetadata::Data* data = m_freeList.back();
-        m_freeList.pop_back();
-        if (data->m_size >= size)
-        {
-            NS_LOG_LOGIC("create found size=" << data->m_size);
-            data->m_count = 1;
-            return data;
-        }
-        NS_LOG_LOGIC("create dealloc size=" << data->m_size);
-        PacketMetadata::Deallocate(data);
-    }
-    NS_LOG_LOGIC("create alloc size=" << m_maxSize);
-    return PacketMetadata::Allocate(m_maxSize);
+#ifndef NS3_MTP
+    // allocate the largest size seen so far, so that the metadata of most
+    // packets does not need to grow when headers are added.
+    m_maxSize = std::max(m_maxSize, size);
+    size = m_maxSize;
+#endif
+    return PacketMetadata::Allocate(size);
 }
 
 void
 PacketMetadata::Recycle(PacketMetadata::Data* data)
 {
     NS_LOG_FUNCTION(data);
-    if (!m_enable)
-    {
-        PacketMetadata::Deallocate(data);
-        return;
-    }
-    NS_LOG_LOGIC("recycle size=" << data->m_size << ", list=" << m_freeList.size());
     NS_ASSERT(data->m_count == 0);
-    if (m_freeList.size() > 1000 || data->m_size < m_maxSize)
-    {
-        PacketMetadata::Deallocate(data);
-    }
-    else
-    {
-        m_freeList.push_back(data);
-    }
+    PacketMetadata::Deallocate(data);
 }
 
 PacketMetadata::Data*
@@ -620,9 +602,10 @@ PacketMetadata::Allocate(uint32_t n)
         n = PACKET_METADATA_DATA_M_DATA_SIZE;
     }
     size += n - PACKET_METADATA_DATA_M_DATA_SIZE;
-    auto buf = new uint8_t[size];
-    auto data = (PacketMetadata::Data*)buf;
-    data->m_size = n;
+    // the rest of the pool block leaves more room to grow in place.
+    auto blockSize = static_cast<uint32_t>(PacketMemoryPool::GetBlockSize(size));
+    auto data = static_cast<PacketMetadata::Data*>(PacketMemoryPool::Allocate(size));
+    data->m_size = n + blockSize - size;
     data->m_count = 1;
     data->m_dirtyEnd = 0;
     return data;
@@ -632,8 +615,8 @@ void
 PacketMetadata::Deallocate(PacketMetadata::Data* data)
 {
     NS_LOG_FUNCTION(data);
-    auto buf = (uint8_t*)data;
-    delete[] buf;
+    PacketMemoryPool::Deallocate(data,
+                                 sizeof(Data) + data->m_size - PACKET_METADATA_DATA_M_DATA_SIZE);
 }
 
 PacketMetadata
@@ -670,8 +653,7 @@ PacketMetadata::DoAddHeader(uint32_t uid, uint32_t size)
     item.prev = 0xffff;
     item.typeUid = uid;
     item.size = size;
-    item.chunkUid = m_chunkUid;
-    m_chunkUid++;
+    item.chunkUid = m_chunkUid++;
     uint16_t written = AddSmall(&item);
     UpdateHead(written);
 }
@@ -736,8 +718,7 @@ PacketMetadata::AddTrailer(const Trailer& trailer, uint32_t size)
     item.prev = m_tail;
     item.typeUid = uid;
     item.size = size;
-    item.chunkUid = m_chunkUid;
-    m_chunkUid++;
+    item.chunkUid = m_chunkUid++;
     uint16_t written = AddSmall(&item);
     UpdateTail(written);
     NS_ASSERT(IsStateOk());
@@ -29,6 +29,10 @@
 #include <stdint.h>
 #include <vector>
 
+#ifdef NS3_MTP
+#include <atomic>
+#endif
+
 namespace ns3
 {
 
@@ -426,7 +430,11 @@ class PacketMetadata
     struct Data
     {
         /** number of references to this struct Data instance. */
+#ifdef NS3_MTP
+        std::atomic<uint32_t> m_count;
+#else
         uint32_t m_count;
+#endif
         /** size (in bytes) of m_data buffer below */
         uint32_t m_size;
         /** max of the m_used field over all objects which reference this struct Data instance */
@@ -509,16 +517,6 @@ class PacketMetadata
         uint64_t packetUid;
     };
 
-    /**
-     * \brief Class to hold all the metadata
-     */
-    class DataFreeList : public std::vector<Data*>
-    {
-      public:
-        ~DataFreeList();
-    };
-
-    friend DataFreeList::~DataFreeList();
     /// Friend class
     friend class ItemIterator;
 
@@ -675,9 +673,8 @@ class PacketMetadata
      */
     static void Deallocate(PacketMetadata::Data* data);
 
-    static DataFreeList m_freeList; //!< the metadata data storage
-    static bool m_enable;           //!< Enable the packet metadata
-    static bool m_enableChecking;   //!< Enable the packet metadata checking
+    static bool m_enable;         //!< Enable the packet metadata
+    static bool m_enableChecking; //!< Enable the packet metadata checking
 
     /**
      * Set to true when adding metadata to a packet is skipped because
@@ -687,7 +684,11 @@ class PacketMetadata
     static bool m_metadataSkipped;
 
     static uint32_t m_maxSize;  //!< maximum metadata size
+#ifdef NS3_MTP
+    static std::atomic<uint16_t> m_chunkUid; //!< Chunk Uid
+#else
     static uint16_t m_chunkUid; //!< Chunk Uid
+#endif
 
     Data* m_data; //!< Metadata storage
     /*
@@ -739,8 +740,7 @@ PacketMetadata::operator=(const PacketMetadata& o)
     {
         // not self assignment
         NS_ASSERT(m_data != nullptr);
-        m_data->m_count--;
-        if (m_data->m_count == 0)
+        if (--m_data->m_count == 0)
         {
             PacketMetadata::Recycle(m_data);
         }
@@ -758,8 +758,7 @@ PacketMetadata::operator=(const PacketMetadata& o)
 PacketMetadata::~PacketMetadata()
 {
     NS_ASSERT(m_data != nullptr);
-    m_data->m_count--;
-    if (m_data->m_count == 0)
+    if (--m_data->m_count == 0)
     {
         PacketMetadata::Recycle(m_data);
     }
@@ -24,6 +24,8 @@
 
 #include "packet-tag-list.h"
 
+#include "packet-memory-pool.h"
+
 #include "tag-buffer.h"
 #include "tag.h"
 
@@ -44,14 +46,22 @@ PacketTagList::CreateTagData(size_t dataSize)
                   "Requested TagData size " << dataSize << " exceeds maximum "
                                             << std::numeric_limits<decltype(TagData::size)>::max());
 
-    void* p = std::malloc(sizeof(TagData) + dataSize - 1);
-    // The matching frees are in RemoveAll and RemoveWriter
+    void* p = PacketMemoryPool::Allocate(sizeof(TagData) + dataSize - 1);
+    // The matching frees are in FreeTagData
 
     auto tag = new (p) TagData;
     tag->size = dataSize;
     return tag;
 }
 
+void
+PacketTagList::FreeTagData(TagData* tag)
+{
+    std::size_t size = sizeof(TagData) + tag->size - 1;
+    tag->~TagData();
+    PacketMemoryPool::Deallocate(tag, size);
+}
+
 bool
 PacketTagList::COWTraverse(Tag& tag, PacketTagList::COWWriter Writer)
 {
@@ -195,8 +205,7 @@ PacketTagList::RemoveWriter(Tag& tag,
     if (preMerge)
     {
         // found tid before first merge, so delete cur
-        cur->~TagData();
-        std::free(cur);
+        FreeTagData(cur);
     }
     else
     {
@@ -29,6 +29,10 @@
 #include <ostream>
 #include <stdint.h>
 
+#ifdef NS3_MTP
+#include <atomic>
+#endif
+
 namespace ns3
 {
 
@@ -142,7 +146,11 @@ class PacketTagList
     struct TagData
     {
         TagData* next;   //!< Pointer to next in list
-        uint32_t count;  //!< Number of incoming links
+#ifdef NS3_MTP
+        std::atomic<uint32_t> count; //!< Number of incoming links
+#else
+        uint32_t count; //!< Number of incoming links
+#endif
         TypeId tid;      //!< Type of the tag serialized into #data
         uint32_t size;   //!< Size of the \c data buffer
         uint8_t data[1]; //!< Serialization buffer
@@ -253,6 +261,13 @@ class PacketTagList
      */
     static TagData* CreateTagData(size_t dataSize);
 
+    /**
+     * Destroy and free a TagData struct created by CreateTagData().
+     *
+     * \param [in] tag The TagData object.
+     */
+    static void FreeTagData(TagData* tag);
+
     /**
      * Typedef of method function pointer for copy-on-write operations
      *
@@ -358,22 +373,19 @@ PacketTagList::RemoveAll()
     TagData* prev = nullptr;
     for (TagData* cur = m_next; cur != nullptr; cur = cur->next)
     {
-        cur->count--;
-        if (cur->count > 0)
+        if (--cur->count > 0)
         {
             break;
         }
         if (prev != nullptr)
         {
-            prev->~TagData();
-            std::free(prev);
+            FreeTagData(prev);
         }
         prev = cur;
     }
     if (prev != nullptr)
     {
-        prev->~TagData();
-        std::free(prev);
+        FreeTagData(prev);
     }
     m_next = nullptr;
 }
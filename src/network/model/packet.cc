@@ -18,6 +18,8 @@
  */
 #include "packet.h"
 
+#include "packet-memory-pool.h"
+
 #include "ns3/assert.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
@@ -30,7 +32,11 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("Packet");
 
+#ifdef NS3_MTP
+std::atomic<uint32_t> Packet::m_globalUid = 0;
+#else
 uint32_t Packet::m_globalUid = 0;
+#endif
 
 TypeId
 ByteTagIterator::Item::GetTypeId() const
@@ -136,6 +142,18 @@ Packet::Copy() const
     return Ptr<Packet>(new Packet(*this), false);
 }
 
+void*
+Packet::operator new(std::size_t size)
+{
+    return PacketMemoryPool::Allocate(size);
+}
+
+void
+Packet::operator delete(void* p, std::size_t size)
+{
+    PacketMemoryPool::Deallocate(p, size);
+}
+
 Packet::Packet()
     : m_buffer(),
       m_byteTagList(),
@@ -146,10 +164,9 @@ Packet::Packet()
        * zero.  The lower 32 bits are for the
        * global UID
        */
-      m_metadata(static_cast<uint64_t>(Simulator::GetSystemId()) << 32 | m_globalUid, 0),
+      m_metadata(static_cast<uint64_t>(Simulator::GetSystemId()) << 32 | m_globalUid++, 0),
       m_nixVector(nullptr)
 {
-    m_globalUid++;
 }
 
 Packet::Packet(const Packet& o)
@@ -186,10 +203,9 @@ Packet::Packet(uint32_t size)
        * zero.  The lower 32 bits are for the
        * global UID
        */
-      m_metadata(static_cast<uint64_t>(Simulator::GetSystemId()) << 32 | m_globalUid, size),
+      m_metadata(static_cast<uint64_t>(Simulator::GetSystemId()) << 32 | m_globalUid++, size),
       m_nixVector(nullptr)
 {
-    m_globalUid++;
 }
 
 Packet::Packet(const uint8_t* buffer, uint32_t size, bool magic)
@@ -213,10 +229,9 @@ Packet::Packet(const uint8_t* buffer, uint32_t size)
        * zero.  The lower 32 bits are for the
        * global UID
        */
-      m_metadata(static_cast<uint64_t>(Simulator::GetSystemId()) << 32 | m_globalUid, size),
+      m_metadata(static_cast<uint64_t>(Simulator::GetSystemId()) << 32 | m_globalUid++, size),
       m_nixVector(nullptr)
 {
-    m_globalUid++;
     m_buffer.AddAtStart(size);
     Buffer::Iterator i = m_buffer.Begin();
     i.Write(buffer, size);
@@ -33,6 +33,7 @@
 #include "ns3/mac48-address.h"
 #include "ns3/ptr.h"
 
+#include <cstddef>
 #include <stdint.h>
 
 namespace ns3
@@ -716,6 +717,19 @@ class Packet : public SimpleRefCount<Packet>
      */
     Ptr<NixVector> GetNixVector() const;
 
+    /**
+     * Allocate the memory of a packet from the PacketMemoryPool.
+     * \param [in] size The size of the packet object.
+     * \returns The allocated memory.
+     */
+    static void* operator new(std::size_t size);
+    /**
+     * Return the memory of a packet to the PacketMemoryPool.
+     * \param [in] p The packet memory.
+     * \param [in] size The size of the packet object.
+     */
+    static void operator delete(void* p, std::size_t size);
+
     /**
      * TracedCallback signature for Ptr<Packet>
      *
@@ -795,7 +809,11 @@ class Packet : public SimpleRefCount<Packet>
     /* Please see comments above about nix-vector */
     mutable Ptr<NixVector> m_nixVector; //!< the packet's Nix vector
 
+#ifdef NS3_MTP
+    static std::atomic<uint32_t> m_globalUid; //!< Global counter of packets Uid
+#else
     static uint32_t m_globalUid; //!< Global counter of packets Uid
+#endif
 };
 
 /**
@@ -393,6 +393,49 @@ BufferTest::DoRun()
     val2 <<= 8;
     val2 |= i.ReadU8();
     NS_TEST_ASSERT_MSG_EQ(val1, val2, "Bad ReadNtohU16()");
+
+    // Segmenting and reassembling a large zero payload, as TCP does,
+    // keeps the payload virtual.
+    buffer = Buffer(100000);
+    buffer.AddAtStart(2);
+    i = buffer.Begin();
+    i.WriteU8(0x1);
+    i.WriteU8(0x2);
+    Buffer segment = buffer.CreateFragment(0, 1000);
+    for (uint32_t start = 1000; start < 10000; start += 1000)
+    {
+        segment.AddAtEnd(buffer.CreateFragment(start, 1000));
+    }
+    NS_TEST_ASSERT_MSG_EQ(segment.GetSize(), 10000, "Bad reassembled size");
+    NS_TEST_EXPECT_MSG_LT(segment.GetSerializedSize(), 100, "Zero payload was copied");
+    ENSURE_WRITTEN_BYTES(segment, 4, 0x1, 0x2, 0x00, 0x00);
+    ENSURE_WRITTEN_BYTES(buffer, 4, 0x1, 0x2, 0x00, 0x00);
+    // a segment which shares its real bytes with another is not modified.
+    Buffer copy = segment;
+    segment.AddAtEnd(buffer.CreateFragment(10000, 1000));
+    NS_TEST_ASSERT_MSG_EQ(copy.GetSize(), 10000, "Shared segment was modified");
+    NS_TEST_ASSERT_MSG_EQ(segment.GetSize(), 11000, "Bad reassembled size");
+    // real bytes after the zero area of the appended buffer are kept, and
+    // the zero area of this buffer stays virtual when real bytes follow it.
+    other = Buffer(1000);
+    other.AddAtEnd(1);
+    i = other.End();
+    i.Prev(1);
+    i.WriteU8(0x3);
+    segment.AddAtEnd(other);
+    segment.AddAtEnd(other);
+    NS_TEST_ASSERT_MSG_EQ(segment.GetSize(), 13002, "Bad reassembled size");
+    NS_TEST_EXPECT_MSG_LT(segment.GetSerializedSize(), 1100, "Zero payload was copied");
+    i = segment.End();
+    i.Prev(1002);
+    uint8_t real = i.ReadU8();
+    uint8_t zero = i.ReadU8();
+    NS_TEST_EXPECT_MSG_EQ(real, 0x3, "Bad real byte");
+    NS_TEST_EXPECT_MSG_EQ(zero, 0x00, "Bad zero byte");
+    i = segment.End();
+    i.Prev(1);
+    real = i.ReadU8();
+    NS_TEST_EXPECT_MSG_EQ(real, 0x3, "Bad real byte");
 }
 
 /**
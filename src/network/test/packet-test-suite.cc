@@ -16,6 +16,7 @@
  *
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
+#include "ns3/packet-memory-pool.h"
 #include "ns3/packet-tag-list.h"
 #include "ns3/packet.h"
 #include "ns3/test.h"
@@ -26,6 +27,7 @@
 #include <iostream>
 #include <limits> // std:numeric_limits
 #include <string>
+#include <vector>
 
 using namespace ns3;
 
@@ -1268,6 +1270,81 @@ PacketTagListTest::DoRun()
     } // Timing
 }
 
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * PacketMemoryPool unit tests.
+ */
+class PacketMemoryPoolTest : public TestCase
+{
+  public:
+    PacketMemoryPoolTest();
+
+  private:
+    void DoRun() override;
+};
+
+PacketMemoryPoolTest::PacketMemoryPoolTest()
+    : TestCase("PacketMemoryPool")
+{
+}
+
+void
+PacketMemoryPoolTest::DoRun()
+{
+    for (std::size_t size = 1; size <= PacketMemoryPool::MAX_BLOCK_SIZE; size++)
+    {
+        std::size_t blockSize = PacketMemoryPool::GetBlockSize(size);
+        NS_TEST_ASSERT_MSG_GT_OR_EQ(blockSize, size, "block too small for " << size);
+        NS_TEST_ASSERT_MSG_LT_OR_EQ(blockSize, size + size / 4 + 16, "block too large for " << size);
+        NS_TEST_ASSERT_MSG_EQ(PacketMemoryPool::GetBlockSize(blockSize),
+                              blockSize,
+                              "block size of " << size << " is not a size class");
+    }
+    NS_TEST_ASSERT_MSG_EQ(PacketMemoryPool::GetBlockSize(PacketMemoryPool::MAX_BLOCK_SIZE + 1),
+                          PacketMemoryPool::MAX_BLOCK_SIZE + 1,
+                          "large blocks are not rounded");
+
+    // a freed block is reused for the next request of the same class.
+    void* p = PacketMemoryPool::Allocate(100);
+    PacketMemoryPool::Deallocate(p, 100);
+    PacketMemoryPool::Statistics before = PacketMemoryPool::GetStatistics();
+    void* q = PacketMemoryPool::Allocate(PacketMemoryPool::GetBlockSize(100));
+    PacketMemoryPool::Statistics after = PacketMemoryPool::GetStatistics();
+    NS_TEST_EXPECT_MSG_EQ(q, p, "the free block was not reused");
+    NS_TEST_EXPECT_MSG_EQ(after.hits, before.hits + 1, "allocation not counted as a hit");
+    NS_TEST_EXPECT_MSG_EQ(after.inUse, before.inUse + 1, "allocation not counted");
+    PacketMemoryPool::Deallocate(q, 100);
+
+    // copying and releasing packets does not call the system allocator
+    // once the pool is warm.
+    for (int round = 0; round < 2; round++)
+    {
+        before = PacketMemoryPool::GetStatistics();
+        Ptr<Packet> p = Create<Packet>(1000);
+        ATestHeader<10> h;
+        p->AddHeader(h);
+        ATestTag<5> tag;
+        p->AddPacketTag(tag);
+        p->AddByteTag(tag);
+        std::vector<Ptr<Packet>> copies;
+        for (int i = 0; i < 10; i++)
+        {
+            copies.push_back(p->Copy());
+            copies.back()->AddHeader(h);
+        }
+        copies.clear();
+        p = nullptr;
+        after = PacketMemoryPool::GetStatistics();
+        NS_TEST_EXPECT_MSG_EQ(after.inUse, before.inUse, "packet memory leaked in round " << round);
+        if (round == 1)
+        {
+            NS_TEST_EXPECT_MSG_EQ(after.misses, before.misses, "the warm pool missed");
+        }
+    }
+}
+
 /**
  * \ingroup network-test
  * \ingroup tests
@@ -1285,6 +1362,7 @@ PacketTestSuite::PacketTestSuite()
 {
     AddTestCase(new PacketTest, TestCase::QUICK);
     AddTestCase(new PacketTagListTest, TestCase::QUICK);
+    AddTestCase(new PacketMemoryPoolTest, TestCase::QUICK);
 }
 
 static PacketTestSuite g_packetTestSuite; //!< Static variable for test initialization
@@ -16,14 +16,23 @@
  */
 
 #include "ns3/log.h"
+#include "ns3/packet.h"
 #include "ns3/pcap-file.h"
 #include "ns3/test.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <sstream>
+#include <vector>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
 
 using namespace ns3;
 
@@ -1375,6 +1384,114 @@ DiffTestCase::DoRun()
     NS_TEST_EXPECT_MSG_EQ(usec, 3696, "Files are different from 2.3696 seconds");
 }
 
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Test case to make sure that the files written by a background
+ * thread, compressed or not, are the files written directly.
+ */
+class AsyncWriteTestCase : public TestCase
+{
+  public:
+    AsyncWriteTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Write a file with records of all sizes.
+     * \param f the file, opened for writing
+     */
+    void WriteRecords(PcapFile& f);
+};
+
+AsyncWriteTestCase::AsyncWriteTestCase()
+    : TestCase("Check to see that PcapFile can write a file from a background thread")
+{
+}
+
+void
+AsyncWriteTestCase::WriteRecords(PcapFile& f)
+{
+    f.Init(1, 256);
+    NS_TEST_ASSERT_MSG_EQ(f.Fail(), false, "Init (1, 256) returns error");
+
+    std::vector<uint8_t> data(300);
+    for (uint32_t i = 0; i < data.size(); i++)
+    {
+        data[i] = i % 251;
+    }
+    // records smaller and larger than the buffers, some of them truncated
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        uint32_t size = (i * 37) % data.size();
+        if (i % 2 == 0)
+        {
+            f.Write(i, i * 10, data.data(), size);
+        }
+        else
+        {
+            f.Write(i, i * 10, Create<Packet>(data.data(), size));
+        }
+        NS_TEST_EXPECT_MSG_EQ(f.Fail(), false, "Write must not fail");
+    }
+    f.Close();
+    NS_TEST_EXPECT_MSG_EQ(f.Fail(), false, "Close must not fail");
+}
+
+void
+AsyncWriteTestCase::DoRun()
+{
+    std::string syncFilename = CreateTempDirFilename("sync.pcap");
+    PcapFile syncFile;
+    syncFile.Open(syncFilename, std::ios::out);
+    NS_TEST_ASSERT_MSG_EQ(syncFile.Fail(), false, "Open (" << syncFilename << ") returns error");
+    WriteRecords(syncFile);
+
+    // small buffers, for the writes to wait for the background thread
+    std::string asyncFilename = CreateTempDirFilename("async.pcap");
+    PcapFile asyncFile;
+    asyncFile.EnableAsyncWrite(false, 64, 1);
+    asyncFile.Open(asyncFilename, std::ios::out);
+    NS_TEST_ASSERT_MSG_EQ(asyncFile.Fail(), false, "Open (" << asyncFilename << ") returns error");
+    WriteRecords(asyncFile);
+
+    std::ifstream syncStream(syncFilename, std::ios::binary);
+    std::vector<char> expected{std::istreambuf_iterator<char>(syncStream),
+                               std::istreambuf_iterator<char>()};
+    std::ifstream asyncStream(asyncFilename, std::ios::binary);
+    std::vector<char> written{std::istreambuf_iterator<char>(asyncStream),
+                              std::istreambuf_iterator<char>()};
+    bool same = written == expected;
+    NS_TEST_EXPECT_MSG_EQ(same, true, "The files written directly and asynchronously differ");
+
+    uint32_t sec = 0;
+    uint32_t usec = 0;
+    uint32_t packets = 0;
+    bool diff = PcapFile::Diff(syncFilename, asyncFilename, sec, usec, packets, 256);
+    NS_TEST_EXPECT_MSG_EQ(diff, false, "PcapDiff(sync, async) must be false");
+    NS_TEST_EXPECT_MSG_EQ(packets, 1000, "Not all the packets were read back");
+
+#ifdef HAVE_ZLIB
+    std::string gzipFilename = CreateTempDirFilename("async.pcap.gz");
+    PcapFile gzipFile;
+    gzipFile.EnableAsyncWrite(true, 512, 2);
+    gzipFile.Open(gzipFilename, std::ios::out);
+    NS_TEST_ASSERT_MSG_EQ(gzipFile.Fail(), false, "Open (" << gzipFilename << ") returns error");
+    WriteRecords(gzipFile);
+
+    gzFile gz = gzopen(gzipFilename.c_str(), "rb");
+    NS_TEST_ASSERT_MSG_NE(gz, nullptr, "Unable to read " << gzipFilename);
+    std::vector<char> uncompressed(expected.size() + 1);
+    int length = gzread(gz, uncompressed.data(), uncompressed.size());
+    gzclose(gz);
+    uncompressed.resize(std::max(length, 0));
+    same = uncompressed == expected;
+    NS_TEST_EXPECT_MSG_EQ(same, true, "The compressed file differs");
+#endif
+}
+
 /**
  * \ingroup network-test
  * \ingroup tests
@@ -1398,6 +1515,7 @@ PcapFileTestSuite::PcapFileTestSuite()
     AddTestCase(new RecordHeaderTestCase, TestCase::QUICK);
     AddTestCase(new ReadFileTestCase, TestCase::QUICK);
     AddTestCase(new DiffTestCase, TestCase::QUICK);
+    AddTestCase(new AsyncWriteTestCase, TestCase::QUICK);
 }
 
 static PcapFileTestSuite pcapFileTestSuite; //!< Static variable for test initialization
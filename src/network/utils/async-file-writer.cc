@@ -0,0 +1,296 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "async-file-writer.h"
+
+#include "ns3/assert.h"
+#include "ns3/fatal-error.h"
+#include "ns3/log.h"
+
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("AsyncFileWriter");
+
+/**
+ * \ingroup network
+ *
+ * \brief The background thread writing the buffers of all the AsyncFileWriter.
+ *
+ * The thread is started when the first file is opened.  It is never
+ * stopped, and waits for buffers when all the files are closed.
+ */
+class AsyncFileWriterThread
+{
+  public:
+    /**
+     * \return The thread, started if needed.
+     */
+    static AsyncFileWriterThread* Get();
+
+    /**
+     * Queue a buffer to be written, waiting while too many buffers of the
+     * file are waiting to be written.
+     *
+     * \param writer The file.
+     * \param buffer The buffer, which is replaced by an empty one.
+     */
+    void Push(AsyncFileWriter* writer, std::vector<uint8_t>& buffer);
+
+    /**
+     * Wait until all the buffers of a file are written.
+     *
+     * \param writer The file.
+     */
+    void Wait(AsyncFileWriter* writer);
+
+  private:
+    /** Write the buffers queued. */
+    void Run();
+
+    std::mutex m_mutex;                //!< Protects the queue and the buffer counts
+    std::condition_variable m_work;    //!< Signals a buffer queued
+    std::condition_variable m_written; //!< Signals a buffer written
+    /// The buffers waiting to be written, in order
+    std::deque<std::pair<AsyncFileWriter*, std::vector<uint8_t>>> m_queue;
+};
+
+AsyncFileWriterThread*
+AsyncFileWriterThread::Get()
+{
+    // Never deleted, as the files may be closed by static destructors
+    static AsyncFileWriterThread* thread = [] {
+        auto instance = new AsyncFileWriterThread;
+        std::thread(&AsyncFileWriterThread::Run, instance).detach();
+        return instance;
+    }();
+    return thread;
+}
+
+void
+AsyncFileWriterThread::Push(AsyncFileWriter* writer, std::vector<uint8_t>& buffer)
+{
+    std::unique_lock lock(m_mutex);
+    m_written.wait(lock, [writer] {
+        return writer->m_pendingBuffers < writer->m_maxPendingBuffers;
+    });
+    writer->m_pendingBuffers++;
+    m_queue.emplace_back(writer, std::move(buffer));
+    buffer.clear();
+    if (!writer->m_spare.empty())
+    {
+        buffer = std::move(writer->m_spare.back());
+        writer->m_spare.pop_back();
+    }
+    lock.unlock();
+    m_work.notify_one();
+}
+
+void
+AsyncFileWriterThread::Wait(AsyncFileWriter* writer)
+{
+    std::unique_lock lock(m_mutex);
+    m_written.wait(lock, [writer] { return writer->m_pendingBuffers == 0; });
+}
+
+void
+AsyncFileWriterThread::Run()
+{
+    std::unique_lock lock(m_mutex);
+    for (;;)
+    {
+        m_work.wait(lock, [this] { return !m_queue.empty(); });
+        auto [writer, buffer] = std::move(m_queue.front());
+        m_queue.pop_front();
+        lock.unlock();
+        writer->WriteBuffer(buffer);
+        buffer.clear();
+        lock.lock();
+        writer->m_spare.push_back(std::move(buffer));
+        writer->m_pendingBuffers--;
+        m_written.notify_all();
+    }
+}
+
+AsyncFileWriter::AsyncFileWriter()
+    : m_gzFile(nullptr),
+      m_open(false),
+      m_fail(false),
+      m_bufferSize(0),
+      m_maxPendingBuffers(0),
+      m_pendingBuffers(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+    NS_LOG_FUNCTION(this);
+    Close();
+}
+
+bool
+AsyncFileWriter::Open(const std::string& filename,
+                      bool compress,
+                      uint32_t bufferSize,
+                      uint32_t maxPendingBuffers)
+{
+    NS_LOG_FUNCTION(this << filename << compress << bufferSize << maxPendingBuffers);
+    NS_ASSERT(!m_open);
+    NS_ASSERT(bufferSize > 0 && maxPendingBuffers > 0);
+    if (compress)
+    {
+#ifdef HAVE_ZLIB
+        m_gzFile = gzopen(filename.c_str(), "wb");
+        m_fail = (m_gzFile == nullptr);
+#else
+        NS_FATAL_ERROR("Compressing " << filename << " requires ns-3 to be built with zlib");
+#endif
+    }
+    else
+    {
+        m_file.open(filename, std::ios::out | std::ios::trunc | std::ios::binary);
+        m_fail = m_file.fail();
+    }
+    if (m_fail)
+    {
+        return false;
+    }
+    m_open = true;
+    m_bufferSize = bufferSize;
+    m_maxPendingBuffers = maxPendingBuffers;
+    m_buffer.reserve(bufferSize);
+    return true;
+}
+
+bool
+AsyncFileWriter::IsOpen() const
+{
+    return m_open;
+}
+
+bool
+AsyncFileWriter::Fail() const
+{
+    return m_fail;
+}
+
+void
+AsyncFileWriter::Write(const void* data, uint32_t size)
+{
+    std::memcpy(Reserve(size), data, size);
+}
+
+uint8_t*
+AsyncFileWriter::Reserve(uint32_t size)
+{
+    NS_ASSERT(m_open);
+    // a buffer holds at least the data of one call
+    if (!m_buffer.empty() && m_buffer.size() + size > m_bufferSize)
+    {
+        Submit();
+    }
+    std::size_t offset = m_buffer.size();
+    m_buffer.resize(offset + size);
+    return m_buffer.data() + offset;
+}
+
+void
+AsyncFileWriter::Submit()
+{
+    NS_LOG_FUNCTION(this << m_buffer.size());
+    AsyncFileWriterThread::Get()->Push(this, m_buffer);
+    m_buffer.reserve(m_bufferSize);
+}
+
+void
+AsyncFileWriter::Flush()
+{
+    NS_LOG_FUNCTION(this);
+    if (!m_open)
+    {
+        return;
+    }
+    if (!m_buffer.empty())
+    {
+        Submit();
+    }
+    AsyncFileWriterThread::Get()->Wait(this);
+}
+
+void
+AsyncFileWriter::Close()
+{
+    NS_LOG_FUNCTION(this);
+    if (!m_open)
+    {
+        return;
+    }
+    Flush();
+    if (m_gzFile != nullptr)
+    {
+#ifdef HAVE_ZLIB
+        if (gzclose(static_cast<gzFile>(m_gzFile)) != Z_OK)
+        {
+            m_fail = true;
+        }
+#endif
+        m_gzFile = nullptr;
+    }
+    else
+    {
+        m_file.close();
+        m_fail = m_fail || m_file.fail();
+    }
+    m_open = false;
+    m_buffer = std::vector<uint8_t>();
+    m_spare.clear();
+}
+
+void
+AsyncFileWriter::WriteBuffer(const std::vector<uint8_t>& buffer)
+{
+    if (m_gzFile != nullptr)
+    {
+#ifdef HAVE_ZLIB
+        int written = gzwrite(static_cast<gzFile>(m_gzFile), buffer.data(), buffer.size());
+        if (written != static_cast<int>(buffer.size()))
+        {
+            m_fail = true;
+        }
+#endif
+    }
+    else
+    {
+        m_file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+        if (m_file.fail())
+        {
+            m_fail = true;
+        }
+    }
+}
+
+} // namespace ns3
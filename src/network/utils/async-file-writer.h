@@ -0,0 +1,131 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef ASYNC_FILE_WRITER_H
+#define ASYNC_FILE_WRITER_H
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup network
+ *
+ * \brief A file written by a background thread.
+ *
+ * The data written is appended to a buffer, and the full buffers are
+ * written, in order, by a background thread shared by all the files.
+ * At most a given number of buffers of a file are waiting to be
+ * written: when the limit is reached, the writing thread blocks until
+ * the background thread has written one of them.
+ *
+ * The file can be compressed on the fly with gzip, if ns-3 was built
+ * with zlib support.
+ */
+class AsyncFileWriter
+{
+  public:
+    AsyncFileWriter();
+    ~AsyncFileWriter();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    AsyncFileWriter(const AsyncFileWriter&) = delete;
+    AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+    /**
+     * Create a file, or truncate an existing one.
+     *
+     * \param filename The name of the file.
+     * \param compress Whether the file is compressed with gzip.
+     * \param bufferSize The size of the buffers handed to the background thread.
+     * \param maxPendingBuffers The maximum number of buffers waiting to be written.
+     * \return true if the file was opened.
+     */
+    bool Open(const std::string& filename,
+              bool compress,
+              uint32_t bufferSize,
+              uint32_t maxPendingBuffers);
+
+    /**
+     * \return true if the file is open.
+     */
+    bool IsOpen() const;
+
+    /**
+     * \return true if the file could not be opened or written.
+     */
+    bool Fail() const;
+
+    /**
+     * Append data to the file.
+     *
+     * \param data The data.
+     * \param size The size of the data.
+     */
+    void Write(const void* data, uint32_t size);
+
+    /**
+     * Append data to the file, to be filled by the caller.
+     *
+     * \param size The size of the data.
+     * \return The location of the data, valid until the next call.
+     */
+    uint8_t* Reserve(uint32_t size);
+
+    /**
+     * Wait until all the data appended is written.
+     */
+    void Flush();
+
+    /**
+     * Write all the data appended, and close the file.
+     */
+    void Close();
+
+  private:
+    friend class AsyncFileWriterThread;
+
+    /**
+     * Hand the current buffer to the background thread, waiting while too
+     * many buffers of the file are waiting to be written.
+     */
+    void Submit();
+
+    /**
+     * Write a buffer to the file, from the background thread.
+     *
+     * \param buffer The buffer.
+     */
+    void WriteBuffer(const std::vector<uint8_t>& buffer);
+
+    std::ofstream m_file;                      //!< The file, if not compressed
+    void* m_gzFile;                            //!< The compressed file, if any
+    bool m_open;                               //!< Whether the file is open
+    std::atomic<bool> m_fail;                  //!< Whether an error occurred
+    std::vector<uint8_t> m_buffer;             //!< The buffer being filled
+    uint32_t m_bufferSize;                     //!< Size of the buffers
+    uint32_t m_maxPendingBuffers;              //!< Maximum number of buffers waiting
+    uint32_t m_pendingBuffers;                 //!< Buffers waiting to be written
+    std::vector<std::vector<uint8_t>> m_spare; //!< Buffers written, for reuse
+};
+
+} // namespace ns3
+
+#endif /* ASYNC_FILE_WRITER_H */
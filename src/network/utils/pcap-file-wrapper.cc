@@ -48,11 +48,35 @@ PcapFileWrapper::GetTypeId()
                           "microseconds(default).",
                           BooleanValue(false),
                           MakeBooleanAccessor(&PcapFileWrapper::m_nanosecMode),
+                          MakeBooleanChecker())
+            .AddAttribute("AsyncWrite",
+                          "Whether the records are written to the file by a background thread. "
+                          "The file is then complete only when it is closed.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&PcapFileWrapper::m_asyncWrite),
+                          MakeBooleanChecker())
+            .AddAttribute("AsyncBufferSize",
+                          "Size of the buffers of records handed to the background thread",
+                          UintegerValue(PcapFile::ASYNC_BUFFER_SIZE_DEFAULT),
+                          MakeUintegerAccessor(&PcapFileWrapper::m_asyncBufferSize),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("AsyncPendingBuffers",
+                          "Maximum number of buffers waiting to be written by the background "
+                          "thread, before the simulation waits for it",
+                          UintegerValue(PcapFile::ASYNC_PENDING_BUFFERS_DEFAULT),
+                          MakeUintegerAccessor(&PcapFileWrapper::m_asyncPendingBuffers),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("Compress",
+                          "Whether the file is compressed with gzip, which requires ns-3 to be "
+                          "built with zlib. The file is then written by a background thread.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&PcapFileWrapper::m_compress),
                           MakeBooleanChecker());
     return tid;
 }
 
 PcapFileWrapper::PcapFileWrapper()
+    : m_interface(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -67,6 +91,10 @@ bool
 PcapFileWrapper::Fail() const
 {
     NS_LOG_FUNCTION(this);
+    if (m_ngFile)
+    {
+        return m_ngFile->Fail();
+    }
     return m_file.Fail();
 }
 
@@ -88,6 +116,8 @@ void
 PcapFileWrapper::Close()
 {
     NS_LOG_FUNCTION(this);
+    // a shared pcapng file is closed by its last wrapper, or by Simulator::Destroy
+    m_ngFile = nullptr;
     m_file.Close();
 }
 
@@ -95,9 +125,22 @@ void
 PcapFileWrapper::Open(const std::string& filename, std::ios::openmode mode)
 {
     NS_LOG_FUNCTION(this << filename << mode);
+    if (m_asyncWrite || m_compress)
+    {
+        m_file.EnableAsyncWrite(m_compress, m_asyncBufferSize, m_asyncPendingBuffers);
+    }
     m_file.Open(filename, mode);
 }
 
+void
+PcapFileWrapper::Open(Ptr<PcapNgFile> file, const std::string& name, const std::string& description)
+{
+    NS_LOG_FUNCTION(this << file << name << description);
+    m_ngFile = file;
+    m_interfaceName = name;
+    m_description = description;
+}
+
 void
 PcapFileWrapper::Init(uint32_t dataLinkType, uint32_t snapLen, int32_t tzCorrection)
 {
@@ -107,6 +150,18 @@ PcapFileWrapper::Init(uint32_t dataLinkType, uint32_t snapLen, int32_t tzCorrect
     // a snaplen, we use the one provided.
     //
     NS_LOG_FUNCTION(this << dataLinkType << snapLen << tzCorrection);
+    if (m_ngFile)
+    {
+        // the timestamps of a pcapng file are in UTC
+        m_interface =
+            m_ngFile->AddInterface(dataLinkType,
+                                   snapLen != std::numeric_limits<uint32_t>::max() ? snapLen
+                                                                                   : m_snapLen,
+                                   m_nanosecMode,
+                                   m_interfaceName,
+                                   m_description);
+        return;
+    }
     if (snapLen != std::numeric_limits<uint32_t>::max())
     {
         m_file.Init(dataLinkType, snapLen, tzCorrection, false, m_nanosecMode);
@@ -121,6 +176,11 @@ void
 PcapFileWrapper::Write(Time t, Ptr<const Packet> p)
 {
     NS_LOG_FUNCTION(this << t << p);
+    if (m_ngFile)
+    {
+        m_ngFile->Write(m_interface, t, p);
+        return;
+    }
     if (m_file.IsNanoSecMode())
     {
         uint64_t current = t.GetNanoSeconds();
@@ -141,6 +201,11 @@ void
 PcapFileWrapper::Write(Time t, const Header& header, Ptr<const Packet> p)
 {
     NS_LOG_FUNCTION(this << t << &header << p);
+    if (m_ngFile)
+    {
+        m_ngFile->Write(m_interface, t, header, p);
+        return;
+    }
     if (m_file.IsNanoSecMode())
     {
         uint64_t current = t.GetNanoSeconds();
@@ -161,6 +226,11 @@ void
 PcapFileWrapper::Write(Time t, const uint8_t* buffer, uint32_t length)
 {
     NS_LOG_FUNCTION(this << t << &buffer << length);
+    if (m_ngFile)
+    {
+        m_ngFile->Write(m_interface, t, buffer, length);
+        return;
+    }
     if (m_file.IsNanoSecMode())
     {
         uint64_t current = t.GetNanoSeconds();
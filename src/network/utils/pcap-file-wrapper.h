@@ -19,6 +19,7 @@
 #define PCAP_FILE_WRAPPER_H
 
 #include "pcap-file.h"
+#include "pcapng-file.h"
 
 #include "ns3/nstime.h"
 #include "ns3/object.h"
@@ -78,6 +79,19 @@ class PcapFileWrapper : public Object
      */
     void Open(const std::string& filename, std::ios::openmode mode);
 
+    /**
+     * Write the packets to a new interface of a pcapng file, which can be
+     * shared with other wrappers, rather than to a pcap file of their own.
+     *
+     * The interface is added to the file by Init, with its data link type
+     * and snap length.  Only the Write methods apply to such a wrapper.
+     *
+     * \param file The pcapng file, already opened.
+     * \param name The name of the interface.
+     * \param description The description of the interface.
+     */
+    void Open(Ptr<PcapNgFile> file, const std::string& name, const std::string& description);
+
     /**
      * Close the underlying pcap file.
      */
@@ -222,9 +236,17 @@ class PcapFileWrapper : public Object
     uint32_t GetDataLinkType();
 
   private:
-    PcapFile m_file;    //!< Pcap file
-    uint32_t m_snapLen; //!< max length of saved packets
-    bool m_nanosecMode; //!< Timestamps in nanosecond mode
+    PcapFile m_file;                //!< Pcap file
+    uint32_t m_snapLen;             //!< max length of saved packets
+    bool m_nanosecMode;             //!< Timestamps in nanosecond mode
+    bool m_asyncWrite;              //!< Records written by a background thread
+    uint32_t m_asyncBufferSize;     //!< Size of the buffers of the background thread
+    uint32_t m_asyncPendingBuffers; //!< Maximum number of buffers waiting to be written
+    bool m_compress;                //!< File compressed with gzip
+    Ptr<PcapNgFile> m_ngFile;       //!< Pcapng file, if the packets are written to one
+    uint32_t m_interface;           //!< Interface of the pcapng file
+    std::string m_interfaceName;    //!< Name of the interface of the pcapng file
+    std::string m_description;      //!< Description of the interface of the pcapng file
 };
 
 } // namespace ns3
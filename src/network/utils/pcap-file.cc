@@ -54,7 +54,11 @@ const uint16_t VERSION_MINOR = 4; /**< Minor version of supported pcap file form
 PcapFile::PcapFile()
     : m_file(),
       m_swapMode(false),
-      m_nanosecMode(false)
+      m_nanosecMode(false),
+      m_async(false),
+      m_compress(false),
+      m_bufferSize(ASYNC_BUFFER_SIZE_DEFAULT),
+      m_maxPendingBuffers(ASYNC_PENDING_BUFFERS_DEFAULT)
 {
     NS_LOG_FUNCTION(this);
     FatalImpl::RegisterStream(&m_file);
@@ -71,7 +75,7 @@ bool
 PcapFile::Fail() const
 {
     NS_LOG_FUNCTION(this);
-    return m_file.fail();
+    return m_file.fail() || m_writer.Fail();
 }
 
 bool
@@ -92,9 +96,24 @@ void
 PcapFile::Close()
 {
     NS_LOG_FUNCTION(this);
+    if (m_writer.IsOpen())
+    {
+        m_writer.Close();
+        return;
+    }
     m_file.close();
 }
 
+void
+PcapFile::EnableAsyncWrite(bool compress, uint32_t bufferSize, uint32_t maxPendingBuffers)
+{
+    NS_LOG_FUNCTION(this << compress << bufferSize << maxPendingBuffers);
+    m_async = true;
+    m_compress = compress;
+    m_bufferSize = bufferSize;
+    m_maxPendingBuffers = maxPendingBuffers;
+}
+
 uint32_t
 PcapFile::GetMagic()
 {
@@ -203,15 +222,32 @@ PcapFile::Swap(PcapRecordHeader* from, PcapRecordHeader* to)
     to->m_origLen = Swap(from->m_origLen);
 }
 
+void
+PcapFile::WriteData(const void* data, uint32_t size)
+{
+    if (m_writer.IsOpen())
+    {
+        m_writer.Write(data, size);
+    }
+    else
+    {
+        m_file.write(static_cast<const char*>(data), size);
+    }
+}
+
 void
 PcapFile::WriteFileHeader()
 {
     NS_LOG_FUNCTION(this);
     //
     // If we're initializing the file, we need to write the pcap file header
-    // at the start of the file.
+    // at the start of the file.  The file written in the background is
+    // initialized right after it is opened.
     //
-    m_file.seekp(0, std::ios::beg);
+    if (!m_writer.IsOpen())
+    {
+        m_file.seekp(0, std::ios::beg);
+    }
 
     //
     // We have the ability to write out the pcap file header in a foreign endian
@@ -239,13 +275,13 @@ PcapFile::WriteFileHeader()
     // Watch out for memory alignment differences between machines, so write
     // them all individually.
     //
-    m_file.write((const char*)&headerOut->m_magicNumber, sizeof(headerOut->m_magicNumber));
-    m_file.write((const char*)&headerOut->m_versionMajor, sizeof(headerOut->m_versionMajor));
-    m_file.write((const char*)&headerOut->m_versionMinor, sizeof(headerOut->m_versionMinor));
-    m_file.write((const char*)&headerOut->m_zone, sizeof(headerOut->m_zone));
-    m_file.write((const char*)&headerOut->m_sigFigs, sizeof(headerOut->m_sigFigs));
-    m_file.write((const char*)&headerOut->m_snapLen, sizeof(headerOut->m_snapLen));
-    m_file.write((const char*)&headerOut->m_type, sizeof(headerOut->m_type));
+    WriteData(&headerOut->m_magicNumber, sizeof(headerOut->m_magicNumber));
+    WriteData(&headerOut->m_versionMajor, sizeof(headerOut->m_versionMajor));
+    WriteData(&headerOut->m_versionMinor, sizeof(headerOut->m_versionMinor));
+    WriteData(&headerOut->m_zone, sizeof(headerOut->m_zone));
+    WriteData(&headerOut->m_sigFigs, sizeof(headerOut->m_sigFigs));
+    WriteData(&headerOut->m_snapLen, sizeof(headerOut->m_snapLen));
+    WriteData(&headerOut->m_type, sizeof(headerOut->m_type));
 }
 
 void
@@ -339,6 +375,15 @@ PcapFile::Open(const std::string& filename, std::ios::openmode mode)
     mode |= std::ios::binary;
 
     m_filename = filename;
+    if (m_async && (mode & std::ios::in) == 0)
+    {
+        // the file stream is left closed, and fails if the writer does
+        if (!m_writer.Open(filename, m_compress, m_bufferSize, m_maxPendingBuffers))
+        {
+            m_file.setstate(std::ios::failbit);
+        }
+        return;
+    }
     m_file.open(filename, mode);
     if (mode & std::ios::in)
     {
@@ -413,7 +458,7 @@ uint32_t
 PcapFile::WritePacketHeader(uint32_t tsSec, uint32_t tsUsec, uint32_t totalLen)
 {
     NS_LOG_FUNCTION(this << tsSec << tsUsec << totalLen);
-    NS_ASSERT(m_file.good());
+    NS_ASSERT(m_writer.IsOpen() || m_file.good());
 
     uint32_t inclLen = totalLen > m_fileHeader.m_snapLen ? m_fileHeader.m_snapLen : totalLen;
 
@@ -432,10 +477,10 @@ PcapFile::WritePacketHeader(uint32_t tsSec, uint32_t tsUsec, uint32_t totalLen)
     // Watch out for memory alignment differences between machines, so write
     // them all individually.
     //
-    m_file.write((const char*)&header.m_tsSec, sizeof(header.m_tsSec));
-    m_file.write((const char*)&header.m_tsUsec, sizeof(header.m_tsUsec));
-    m_file.write((const char*)&header.m_inclLen, sizeof(header.m_inclLen));
-    m_file.write((const char*)&header.m_origLen, sizeof(header.m_origLen));
+    WriteData(&header.m_tsSec, sizeof(header.m_tsSec));
+    WriteData(&header.m_tsUsec, sizeof(header.m_tsUsec));
+    WriteData(&header.m_inclLen, sizeof(header.m_inclLen));
+    WriteData(&header.m_origLen, sizeof(header.m_origLen));
     NS_BUILD_DEBUG(m_file.flush());
     return inclLen;
 }
@@ -445,7 +490,7 @@ PcapFile::Write(uint32_t tsSec, uint32_t tsUsec, const uint8_t* const data, uint
 {
     NS_LOG_FUNCTION(this << tsSec << tsUsec << &data << totalLen);
     uint32_t inclLen = WritePacketHeader(tsSec, tsUsec, totalLen);
-    m_file.write((const char*)data, inclLen);
+    WriteData(data, inclLen);
     NS_BUILD_DEBUG(m_file.flush());
 }
 
@@ -454,6 +499,11 @@ PcapFile::Write(uint32_t tsSec, uint32_t tsUsec, Ptr<const Packet> p)
 {
     NS_LOG_FUNCTION(this << tsSec << tsUsec << p);
     uint32_t inclLen = WritePacketHeader(tsSec, tsUsec, p->GetSize());
+    if (m_writer.IsOpen())
+    {
+        p->CopyData(m_writer.Reserve(inclLen), inclLen);
+        return;
+    }
     p->CopyData(&m_file, inclLen);
     NS_BUILD_DEBUG(m_file.flush());
 }
@@ -470,6 +520,13 @@ PcapFile::Write(uint32_t tsSec, uint32_t tsUsec, const Header& header, Ptr<const
     headerBuffer.AddAtStart(headerSize);
     header.Serialize(headerBuffer.Begin());
     uint32_t toCopy = std::min(headerSize, inclLen);
+    if (m_writer.IsOpen())
+    {
+        headerBuffer.CopyData(m_writer.Reserve(toCopy), toCopy);
+        inclLen -= toCopy;
+        p->CopyData(m_writer.Reserve(inclLen), inclLen);
+        return;
+    }
     headerBuffer.CopyData(&m_file, toCopy);
     inclLen -= toCopy;
     p->CopyData(&m_file, inclLen);
@@ -20,6 +20,8 @@
 #ifndef PCAP_FILE_H
 #define PCAP_FILE_H
 
+#include "async-file-writer.h"
+
 #include "ns3/ptr.h"
 
 #include <fstream>
@@ -45,6 +47,10 @@ class PcapFile
     static const int32_t ZONE_DEFAULT = 0; //!< Time zone offset for current location
     static const uint32_t SNAPLEN_DEFAULT =
         65535; //!< Default value for maximum octets to save per packet
+    static const uint32_t ASYNC_BUFFER_SIZE_DEFAULT =
+        65536; //!< Default size of the buffers written by the background thread
+    static const uint32_t ASYNC_PENDING_BUFFERS_DEFAULT =
+        16; //!< Default maximum number of buffers waiting to be written
 
   public:
     PcapFile();
@@ -86,6 +92,23 @@ class PcapFile
      */
     void Close();
 
+    /**
+     * Write the file from a background thread, see AsyncFileWriter.
+     *
+     * The records are copied in buffers, which are written by a background
+     * thread, so the file is complete only when it is closed.  This only
+     * applies to the files opened afterwards in write-only mode.
+     *
+     * \param compress Whether the file is compressed with gzip, which
+     * requires ns-3 to be built with zlib.
+     * \param bufferSize The size of the buffers handed to the background thread.
+     * \param maxPendingBuffers The maximum number of buffers waiting to be
+     * written, before Write blocks.
+     */
+    void EnableAsyncWrite(bool compress,
+                          uint32_t bufferSize = ASYNC_BUFFER_SIZE_DEFAULT,
+                          uint32_t maxPendingBuffers = ASYNC_PENDING_BUFFERS_DEFAULT);
+
     /**
      * Initialize the pcap file associated with this object.  This file must have
      * been previously opened with write permissions.
@@ -351,6 +374,13 @@ class PcapFile
      */
     void Swap(PcapRecordHeader* from, PcapRecordHeader* to);
 
+    /**
+     * \brief Write data to the file stream, or to the background writer
+     * \param data the data
+     * \param size the size of the data
+     */
+    void WriteData(const void* data, uint32_t size);
+
     /**
      * \brief Write a Pcap file header
      */
@@ -373,11 +403,16 @@ class PcapFile
      */
     void ReadAndVerifyFileHeader();
 
-    std::string m_filename;      //!< file name
-    std::fstream m_file;         //!< file stream
-    PcapFileHeader m_fileHeader; //!< file header
-    bool m_swapMode;             //!< swap mode
-    bool m_nanosecMode;          //!< nanosecond timestamp mode
+    std::string m_filename;       //!< file name
+    std::fstream m_file;          //!< file stream
+    PcapFileHeader m_fileHeader;  //!< file header
+    bool m_swapMode;              //!< swap mode
+    bool m_nanosecMode;           //!< nanosecond timestamp mode
+    bool m_async;                 //!< whether the file is written by a background thread
+    bool m_compress;              //!< whether the file written asynchronously is compressed
+    uint32_t m_bufferSize;        //!< size of the buffers of the background writer
+    uint32_t m_maxPendingBuffers; //!< maximum number of buffers waiting to be written
+    AsyncFileWriter m_writer;     //!< background writer, when open
 };
 
 } // namespace ns3
@@ -0,0 +1,288 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "pcapng-file.h"
+
+#include "pcap-file.h"
+
+#include "ns3/assert.h"
+#include "ns3/buffer.h"
+#include "ns3/build-profile.h"
+#include "ns3/header.h"
+#include "ns3/log.h"
+#include "ns3/packet.h"
+
+#include <algorithm>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("PcapNgFile");
+
+const uint32_t SECTION_HEADER_BLOCK = 0x0a0d0d0a;   /**< Section Header Block type */
+const uint32_t INTERFACE_DESCRIPTION_BLOCK = 1;     /**< Interface Description Block type */
+const uint32_t ENHANCED_PACKET_BLOCK = 6;           /**< Enhanced Packet Block type */
+const uint32_t BYTE_ORDER_MAGIC = 0x1a2b3c4d;       /**< Byte-order magic of a section */
+const uint16_t OPT_ENDOFOPT = 0;                    /**< End of the options of a block */
+const uint16_t IF_NAME = 2;                         /**< Interface name option */
+const uint16_t IF_DESCRIPTION = 3;                  /**< Interface description option */
+const uint16_t IF_TSRESOL = 9;                      /**< Interface timestamp resolution option */
+const uint32_t ENHANCED_PACKET_BLOCK_OVERHEAD = 32; /**< Size of a packet block without data */
+
+/**
+ * \param size A size.
+ * \return The size padded to 32 bits.
+ */
+static uint32_t
+Pad32(uint32_t size)
+{
+    return (size + 3) & ~3U;
+}
+
+/**
+ * \param value An option value.
+ * \return The size of the option.
+ */
+static uint32_t
+GetOptionSize(const std::string& value)
+{
+    return value.empty() ? 0 : 4 + Pad32(value.size());
+}
+
+PcapNgFile::PcapNgFile()
+    : m_async(false),
+      m_compress(false),
+      m_bufferSize(PcapFile::ASYNC_BUFFER_SIZE_DEFAULT),
+      m_maxPendingBuffers(PcapFile::ASYNC_PENDING_BUFFERS_DEFAULT)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+PcapNgFile::~PcapNgFile()
+{
+    NS_LOG_FUNCTION(this);
+    Close();
+}
+
+bool
+PcapNgFile::Fail() const
+{
+    return m_file.fail() || m_writer.Fail();
+}
+
+void
+PcapNgFile::EnableAsyncWrite(bool compress, uint32_t bufferSize, uint32_t maxPendingBuffers)
+{
+    NS_LOG_FUNCTION(this << compress << bufferSize << maxPendingBuffers);
+    m_async = true;
+    m_compress = compress;
+    m_bufferSize = bufferSize;
+    m_maxPendingBuffers = maxPendingBuffers;
+}
+
+void
+PcapNgFile::Open(const std::string& filename)
+{
+    NS_LOG_FUNCTION(this << filename);
+    if (m_async)
+    {
+        if (!m_writer.Open(filename, m_compress, m_bufferSize, m_maxPendingBuffers))
+        {
+            m_file.setstate(std::ios::failbit);
+            return;
+        }
+    }
+    else
+    {
+        m_file.open(filename, std::ios::out | std::ios::trunc | std::ios::binary);
+        if (m_file.fail())
+        {
+            return;
+        }
+    }
+    m_interfaces.clear();
+
+    // The section length is unknown, as the file is written sequentially
+    const uint32_t size = 28;
+    WriteUint32(SECTION_HEADER_BLOCK);
+    WriteUint32(size);
+    WriteUint32(BYTE_ORDER_MAGIC);
+    uint16_t version[2] = {1, 0};
+    WriteData(version, sizeof(version));
+    int64_t sectionLength = -1;
+    WriteData(&sectionLength, sizeof(sectionLength));
+    WriteUint32(size);
+}
+
+void
+PcapNgFile::Close()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_writer.IsOpen())
+    {
+        m_writer.Close();
+    }
+    else if (m_file.is_open())
+    {
+        m_file.close();
+    }
+}
+
+uint32_t
+PcapNgFile::AddInterface(uint32_t dataLinkType,
+                         uint32_t snapLen,
+                         bool nanosecMode,
+                         const std::string& name,
+                         const std::string& description)
+{
+    NS_LOG_FUNCTION(this << dataLinkType << snapLen << nanosecMode << name << description);
+    // the default timestamp resolution is the microsecond
+    std::string resolution = nanosecMode ? std::string(1, 9) : std::string();
+    uint32_t size = 24 + GetOptionSize(name) + GetOptionSize(description) +
+                    GetOptionSize(resolution);
+
+    WriteUint32(INTERFACE_DESCRIPTION_BLOCK);
+    WriteUint32(size);
+    uint16_t linkType[2] = {static_cast<uint16_t>(dataLinkType), 0};
+    WriteData(linkType, sizeof(linkType));
+    WriteUint32(snapLen);
+    WriteOption(IF_NAME, name);
+    WriteOption(IF_DESCRIPTION, description);
+    WriteOption(IF_TSRESOL, resolution);
+    uint16_t end[2] = {OPT_ENDOFOPT, 0};
+    WriteData(end, sizeof(end));
+    WriteUint32(size);
+    NS_BUILD_DEBUG(m_file.flush());
+
+    m_interfaces.push_back({snapLen, nanosecMode});
+    return m_interfaces.size() - 1;
+}
+
+uint32_t
+PcapNgFile::GetNInterfaces() const
+{
+    return m_interfaces.size();
+}
+
+void
+PcapNgFile::WriteData(const void* data, uint32_t size)
+{
+    if (m_writer.IsOpen())
+    {
+        m_writer.Write(data, size);
+    }
+    else
+    {
+        m_file.write(static_cast<const char*>(data), size);
+    }
+}
+
+void
+PcapNgFile::WriteUint32(uint32_t value)
+{
+    WriteData(&value, sizeof(value));
+}
+
+void
+PcapNgFile::WriteOption(uint16_t code, const std::string& value)
+{
+    if (value.empty())
+    {
+        return;
+    }
+    uint16_t header[2] = {code, static_cast<uint16_t>(value.size())};
+    WriteData(header, sizeof(header));
+    WriteData(value.data(), value.size());
+    const uint8_t padding[3] = {0, 0, 0};
+    WriteData(padding, Pad32(value.size()) - value.size());
+}
+
+uint32_t
+PcapNgFile::WritePacketHeader(uint32_t interface, Time t, uint32_t totalLen)
+{
+    NS_ASSERT_MSG(interface < m_interfaces.size(), "Unknown interface " << interface);
+    const Interface& description = m_interfaces[interface];
+    uint32_t inclLen = std::min(totalLen, description.snapLen);
+    uint64_t timestamp = description.nanosecMode ? t.GetNanoSeconds() : t.GetMicroSeconds();
+
+    WriteUint32(ENHANCED_PACKET_BLOCK);
+    WriteUint32(ENHANCED_PACKET_BLOCK_OVERHEAD + Pad32(inclLen));
+    WriteUint32(interface);
+    WriteUint32(timestamp >> 32);
+    WriteUint32(timestamp & 0xffffffff);
+    WriteUint32(inclLen);
+    WriteUint32(totalLen);
+    return inclLen;
+}
+
+void
+PcapNgFile::WritePacketTrailer(uint32_t inclLen)
+{
+    const uint8_t padding[3] = {0, 0, 0};
+    WriteData(padding, Pad32(inclLen) - inclLen);
+    WriteUint32(ENHANCED_PACKET_BLOCK_OVERHEAD + Pad32(inclLen));
+    NS_BUILD_DEBUG(m_file.flush());
+}
+
+void
+PcapNgFile::Write(uint32_t interface, Time t, const uint8_t* data, uint32_t totalLen)
+{
+    NS_LOG_FUNCTION(this << interface << t << &data << totalLen);
+    uint32_t inclLen = WritePacketHeader(interface, t, totalLen);
+    WriteData(data, inclLen);
+    WritePacketTrailer(inclLen);
+}
+
+void
+PcapNgFile::Write(uint32_t interface, Time t, Ptr<const Packet> p)
+{
+    NS_LOG_FUNCTION(this << interface << t << p);
+    uint32_t inclLen = WritePacketHeader(interface, t, p->GetSize());
+    if (m_writer.IsOpen())
+    {
+        p->CopyData(m_writer.Reserve(inclLen), inclLen);
+    }
+    else
+    {
+        p->CopyData(&m_file, inclLen);
+    }
+    WritePacketTrailer(inclLen);
+}
+
+void
+PcapNgFile::Write(uint32_t interface, Time t, const Header& header, Ptr<const Packet> p)
+{
+    NS_LOG_FUNCTION(this << interface << t << &header << p);
+    uint32_t headerSize = header.GetSerializedSize();
+    uint32_t inclLen = WritePacketHeader(interface, t, headerSize + p->GetSize());
+
+    Buffer headerBuffer;
+    headerBuffer.AddAtStart(headerSize);
+    header.Serialize(headerBuffer.Begin());
+    uint32_t headerLen = std::min(headerSize, inclLen);
+    if (m_writer.IsOpen())
+    {
+        headerBuffer.CopyData(m_writer.Reserve(headerLen), headerLen);
+        p->CopyData(m_writer.Reserve(inclLen - headerLen), inclLen - headerLen);
+    }
+    else
+    {
+        headerBuffer.CopyData(&m_file, headerLen);
+        p->CopyData(&m_file, inclLen - headerLen);
+    }
+    WritePacketTrailer(inclLen);
+}
+
+} // namespace ns3
@@ -0,0 +1,189 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef PCAPNG_FILE_H
+#define PCAPNG_FILE_H
+
+#include "async-file-writer.h"
+
+#include "ns3/nstime.h"
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+
+#include <fstream>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+class Packet;
+class Header;
+
+/**
+ * \brief A pcapng file holding the packets of several interfaces
+ *
+ * A pcapng file starts with a Section Header Block, and describes each
+ * interface with an Interface Description Block, which holds the data
+ * link type, the snap length, the name and the description of the
+ * interface.  The packets are then written in Enhanced Packet Blocks,
+ * identified by the index of their interface, in the order of the
+ * AddInterface calls.  Interfaces can be added at any time.
+ *
+ * The blocks are written in the byte order of the writing system, as
+ * the byte-order magic of the section allows.  The file is write-only.
+ *
+ * See https://www.ietf.org/archive/id/draft-ietf-opsawg-pcapng-01.html
+ */
+class PcapNgFile : public SimpleRefCount<PcapNgFile>
+{
+  public:
+    PcapNgFile();
+    ~PcapNgFile();
+
+    /**
+     * \return true if the file could not be opened or written.
+     */
+    bool Fail() const;
+
+    /**
+     * Write the file from a background thread, see PcapFile::EnableAsyncWrite.
+     *
+     * \param compress Whether the file is compressed with gzip.
+     * \param bufferSize The size of the buffers handed to the background thread.
+     * \param maxPendingBuffers The maximum number of buffers waiting to be written.
+     */
+    void EnableAsyncWrite(bool compress, uint32_t bufferSize, uint32_t maxPendingBuffers);
+
+    /**
+     * Create a new pcapng file, or truncate an existing one, and write the
+     * section header.
+     *
+     * \param filename The name of the file.
+     */
+    void Open(const std::string& filename);
+
+    /**
+     * Close the file.
+     */
+    void Close();
+
+    /**
+     * Describe a new interface.
+     *
+     * \param dataLinkType The data link type of the packets of the interface.
+     * \param snapLen The maximum size of the packets written.
+     * \param nanosecMode Whether the timestamps have a nanosecond resolution,
+     * rather than a microsecond one.
+     * \param name The name of the interface, or empty.
+     * \param description The description of the interface, or empty.
+     * \return The index of the interface.
+     */
+    uint32_t AddInterface(uint32_t dataLinkType,
+                          uint32_t snapLen,
+                          bool nanosecMode,
+                          const std::string& name,
+                          const std::string& description);
+
+    /**
+     * \return The number of interfaces.
+     */
+    uint32_t GetNInterfaces() const;
+
+    /**
+     * \brief Write a packet of an interface
+     *
+     * \param interface The index of the interface.
+     * \param t The packet timestamp.
+     * \param data The packet data.
+     * \param totalLen The size of the packet.
+     */
+    void Write(uint32_t interface, Time t, const uint8_t* data, uint32_t totalLen);
+
+    /**
+     * \brief Write a packet of an interface
+     *
+     * \param interface The index of the interface.
+     * \param t The packet timestamp.
+     * \param p The packet.
+     */
+    void Write(uint32_t interface, Time t, Ptr<const Packet> p);
+
+    /**
+     * \brief Write a packet of an interface
+     *
+     * \param interface The index of the interface.
+     * \param t The packet timestamp.
+     * \param header The header to write in front of the packet.
+     * \param p The packet.
+     */
+    void Write(uint32_t interface, Time t, const Header& header, Ptr<const Packet> p);
+
+  private:
+    /** \brief An interface of the file */
+    struct Interface
+    {
+        uint32_t snapLen; //!< Maximum size of the packets written
+        bool nanosecMode; //!< Timestamps in nanoseconds rather than microseconds
+    };
+
+    /**
+     * \brief Write data to the file stream, or to the background writer
+     * \param data the data
+     * \param size the size of the data
+     */
+    void WriteData(const void* data, uint32_t size);
+
+    /**
+     * \brief Write a 32-bit value
+     * \param value the value
+     */
+    void WriteUint32(uint32_t value);
+
+    /**
+     * \brief Write an option of a block
+     * \param code the option code
+     * \param value the option value, padded to 32 bits
+     */
+    void WriteOption(uint16_t code, const std::string& value);
+
+    /**
+     * \brief Write the start of an Enhanced Packet Block
+     * \param interface the index of the interface
+     * \param t the packet timestamp
+     * \param totalLen the size of the packet
+     * \return the size of the packet data to write
+     */
+    uint32_t WritePacketHeader(uint32_t interface, Time t, uint32_t totalLen);
+
+    /**
+     * \brief Write the padding and the end of an Enhanced Packet Block
+     * \param inclLen the size of the packet data written
+     */
+    void WritePacketTrailer(uint32_t inclLen);
+
+    std::ofstream m_file;                //!< file stream
+    bool m_async;                        //!< whether the file is written by a background thread
+    bool m_compress;                     //!< whether the file written asynchronously is compressed
+    uint32_t m_bufferSize;               //!< size of the buffers of the background writer
+    uint32_t m_maxPendingBuffers;        //!< maximum number of buffers waiting to be written
+    AsyncFileWriter m_writer;            //!< background writer, when open
+    std::vector<Interface> m_interfaces; //!< interfaces, by index
+};
+
+} // namespace ns3
+
+#endif /* PCAPNG_FILE_H */
@@ -20,11 +20,15 @@
 #include "ns3/drop-tail-queue.h"
 #include "ns3/net-device-queue-interface.h"
 #include "ns3/point-to-point-channel.h"
+#include "ns3/point-to-point-helper.h"
 #include "ns3/point-to-point-net-device.h"
 #include "ns3/simulator.h"
 #include "ns3/test.h"
 
+#include <cstdio>
+#include <fstream>
 #include <string>
+#include <vector>
 
 using namespace ns3;
 
@@ -139,6 +143,102 @@ PointToPointTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \brief Test the trace files shared by the devices of a PointToPointHelper
+ *
+ * Two links carry one packet each.  The pcap output of the four devices is
+ * written in one pcapng file, and their ascii output in one trace file.
+ */
+class PointToPointTraceFileTest : public TestCase
+{
+  public:
+    /**
+     * \brief Create the test
+     */
+    PointToPointTraceFileTest();
+
+    /**
+     * \brief Run the test
+     */
+    void DoRun() override;
+};
+
+PointToPointTraceFileTest::PointToPointTraceFileTest()
+    : TestCase("PointToPoint devices sharing their trace files")
+{
+}
+
+void
+PointToPointTraceFileTest::DoRun()
+{
+    NodeContainer nodes(3);
+    PointToPointHelper p2p;
+    NetDeviceContainer devices = p2p.Install(nodes.Get(0), nodes.Get(1));
+    devices.Add(p2p.Install(nodes.Get(1), nodes.Get(2)));
+
+    std::string prefix = CreateTempDirFilename("p2p-trace");
+    p2p.SetPcapFileMode(TraceFileMode::SINGLE_FILE);
+    p2p.EnablePcapAll(prefix);
+    p2p.SetAsciiFileMode(TraceFileMode::SINGLE_FILE);
+    p2p.EnableAsciiAll(prefix);
+
+    for (uint32_t i : {0, 3})
+    {
+        Ptr<NetDevice> device = devices.Get(i);
+        Simulator::Schedule(Seconds(1.0), [device]() {
+            device->Send(Create<Packet>(100), device->GetBroadcast(), 0x800);
+        });
+    }
+    Simulator::Run();
+    Simulator::Destroy();
+
+    // each packet is written when sent, and when received
+    std::ifstream pcap(prefix + ".pcapng", std::ios::binary);
+    NS_TEST_ASSERT_MSG_EQ(pcap.good(), true, "The pcapng file is missing");
+    std::vector<uint32_t> interfacePackets;
+    uint32_t blocks = 0;
+    uint32_t header[3];
+    while (pcap.read(reinterpret_cast<char*>(header), sizeof(header)))
+    {
+        blocks++;
+        if (header[0] == 1)
+        {
+            interfacePackets.push_back(0);
+        }
+        else if (header[0] == 6)
+        {
+            NS_TEST_ASSERT_MSG_LT(header[2], interfacePackets.size(), "Unknown interface");
+            interfacePackets[header[2]]++;
+        }
+        pcap.seekg(header[1] - sizeof(header), std::ios::cur);
+    }
+    pcap.close();
+    NS_TEST_EXPECT_MSG_EQ(blocks, 1 + 4 + 4, "Expected a section, 4 interfaces and 4 packets");
+    uint32_t nInterfaces = interfacePackets.size();
+    NS_TEST_ASSERT_MSG_EQ(nInterfaces, 4, "Expected one interface per device");
+    for (uint32_t packets : interfacePackets)
+    {
+        NS_TEST_EXPECT_MSG_EQ(packets, 1, "Expected one packet per device");
+    }
+
+    std::ifstream ascii(prefix + ".tr");
+    NS_TEST_ASSERT_MSG_EQ(ascii.good(), true, "The trace file is missing");
+    bool node0 = false;
+    bool node2 = false;
+    std::string line;
+    while (std::getline(ascii, line))
+    {
+        node0 = node0 || line.find("/NodeList/0/") != std::string::npos;
+        node2 = node2 || line.find("/NodeList/2/") != std::string::npos;
+    }
+    ascii.close();
+    NS_TEST_EXPECT_MSG_EQ(node0, true, "Expected the events of node 0");
+    NS_TEST_EXPECT_MSG_EQ(node2, true, "Expected the events of node 2");
+
+    std::remove((prefix + ".pcapng").c_str());
+    std::remove((prefix + ".tr").c_str());
+}
+
 /**
  * \brief TestSuite for PointToPoint module
  */
@@ -154,6 +254,8 @@ class PointToPointTestSuite : public TestSuite
 PointToPointTestSuite::PointToPointTestSuite()
     : TestSuite("devices-point-to-point", UNIT)
 {
+    // first, as the ascii traces enable the packet metadata before any packet is created
+    AddTestCase(new PointToPointTraceFileTest, TestCase::QUICK);
     AddTestCase(new PointToPointTest, TestCase::QUICK);
 }
 
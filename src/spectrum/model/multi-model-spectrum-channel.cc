@@ -81,7 +81,10 @@ RxSpectrumModelInfo::RxSpectrumModelInfo(Ptr<const SpectrumModel> rxSpectrumMode
 }
 
 MultiModelSpectrumChannel::MultiModelSpectrumChannel()
-    : m_numDevices{0}
+    : m_numDevices{0},
+      m_maxRange{0},
+      m_indexDirty{true},
+      m_indexRange{0}
 {
     NS_LOG_FUNCTION(this);
 }
@@ -92,18 +95,27 @@ MultiModelSpectrumChannel::DoDispose()
     NS_LOG_FUNCTION(this);
     m_txSpectrumModelInfoMap.clear();
     m_rxSpectrumModelInfoMap.clear();
+    m_index.Clear();
+    m_indexDirty = true;
     SpectrumChannel::DoDispose();
 }
 
 TypeId
 MultiModelSpectrumChannel::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::MultiModelSpectrumChannel")
-                            .SetParent<SpectrumChannel>()
-                            .SetGroupName("Spectrum")
-                            .AddConstructor<MultiModelSpectrumChannel>()
-
-        ;
+    static TypeId tid =
+        TypeId("ns3::MultiModelSpectrumChannel")
+            .SetParent<SpectrumChannel>()
+            .SetGroupName("Spectrum")
+            .AddConstructor<MultiModelSpectrumChannel>()
+            .AddAttribute("MaxRange",
+                          "If positive, the receivers farther than this distance (m) from the "
+                          "transmitter are skipped, without computing the propagation loss. It "
+                          "must be larger than the distance at which the loss always exceeds "
+                          "MaxLossDb.",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&MultiModelSpectrumChannel::m_maxRange),
+                          MakeDoubleChecker<double>(0));
     return tid;
 }
 
@@ -127,6 +139,7 @@ MultiModelSpectrumChannel::RemoveRx(Ptr<SpectrumPhy> phy)
         {
             rxInfoIterator->second.m_rxPhys.erase(phyIt);
             --m_numDevices;
+            m_indexDirty = true;
             break; // there should be at most one entry
         }
     }
@@ -148,6 +161,7 @@ MultiModelSpectrumChannel::AddRx(Ptr<SpectrumPhy> phy)
     RemoveRx(phy);
 
     ++m_numDevices;
+    m_indexDirty = true;
 
     auto [rxInfoIterator, inserted] =
         m_rxSpectrumModelInfoMap.emplace(rxSpectrumModelUid, RxSpectrumModelInfo(rxSpectrumModel));
@@ -252,10 +266,27 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
     NS_LOG_LOGIC("converter map first element: "
                  << txInfoIteratorerator->second.m_spectrumConverterMap.begin()->first);
 
+    // the receivers within range, by their number in the index
+    std::vector<bool> inRange;
+    if (m_maxRange > 0 && txMobility)
+    {
+        UpdateIndex();
+        std::vector<std::size_t> ids;
+        m_index.GetItemsInRange(txMobility->GetPosition(), m_maxRange, ids);
+        inRange.resize(m_numDevices, false);
+        for (std::size_t id : ids)
+        {
+            inRange[id] = true;
+        }
+    }
+
+    std::size_t firstRxId = 0;
     for (auto rxInfoIterator = m_rxSpectrumModelInfoMap.begin();
          rxInfoIterator != m_rxSpectrumModelInfoMap.end();
          ++rxInfoIterator)
     {
+        std::size_t rxId = firstRxId;
+        firstRxId += rxInfoIterator->second.m_rxPhys.size();
         SpectrumModelUid_t rxSpectrumModelUid = rxInfoIterator->second.m_rxSpectrumModel->GetUid();
         NS_LOG_LOGIC("rxSpectrumModelUids " << rxSpectrumModelUid);
 
@@ -281,8 +312,12 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
 
         for (auto rxPhyIterator = rxInfoIterator->second.m_rxPhys.begin();
              rxPhyIterator != rxInfoIterator->second.m_rxPhys.end();
-             ++rxPhyIterator)
+             ++rxPhyIterator, ++rxId)
         {
+            if (!inRange.empty() && !inRange[rxId])
+            {
+                continue;
+            }
             NS_ASSERT_MSG((*rxPhyIterator)->GetRxSpectrumModel()->GetUid() == rxSpectrumModelUid,
                           "SpectrumModel change was not notified to MultiModelSpectrumChannel "
                           "(i.e., AddRx should be called again after model is changed)");
@@ -427,6 +462,29 @@ MultiModelSpectrumChannel::StartRx(Ptr<SpectrumSignalParameters> params, Ptr<Spe
     receiver->StartRx(params);
 }
 
+void
+MultiModelSpectrumChannel::UpdateIndex()
+{
+    // the mobility model of a receiver may be set after it is added to the
+    // channel, so the index is only built when a signal is transmitted.
+    if (!m_indexDirty && m_indexRange == m_maxRange)
+    {
+        return;
+    }
+    NS_LOG_FUNCTION(this);
+    m_index.Clear(m_maxRange);
+    std::size_t id = 0;
+    for (const auto& [uid, rxInfo] : m_rxSpectrumModelInfoMap)
+    {
+        for (const auto& phy : rxInfo.m_rxPhys)
+        {
+            m_index.Add(id++, phy->GetMobility());
+        }
+    }
+    m_indexDirty = false;
+    m_indexRange = m_maxRange;
+}
+
 std::size_t
 MultiModelSpectrumChannel::GetNDevices() const
 {
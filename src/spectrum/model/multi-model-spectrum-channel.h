@@ -26,6 +26,7 @@
 #include "spectrum-value.h"
 
 #include <ns3/propagation-delay-model.h>
+#include <ns3/spatial-index.h>
 
 #include <map>
 #include <set>
@@ -99,6 +100,12 @@ typedef std::map<SpectrumModelUid_t, RxSpectrumModelInfo> RxSpectrumModelInfoMap
  * for this to work is that, after the SpectrumPhy switched its
  * SpectrumModel,  MultiModelSpectrumChannel::AddRx () is
  * called again passing the pointer to that SpectrumPhy.
+ *
+ * When the MaxRange attribute is set, the receiving SpectrumPhy instances
+ * are kept in a SpatialIndex of their positions, and those farther than
+ * MaxRange from the transmitter are skipped before any propagation loss
+ * is computed, which is cheaper than the MaxLossDb cutoff in large
+ * scenarios.  The gain and path loss traces are not fired for them.
  */
 class MultiModelSpectrumChannel : public SpectrumChannel
 {
@@ -145,6 +152,13 @@ class MultiModelSpectrumChannel : public SpectrumChannel
      */
     virtual void StartRx(Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver);
 
+    /**
+     * Rebuild the spatial index if receivers were added or removed, or
+     * MaxRange was changed, since it was built.  The receivers are numbered
+     * in the order of m_rxSpectrumModelInfoMap and of their m_rxPhys lists.
+     */
+    void UpdateIndex();
+
     /**
      * Data structure holding, for each TX SpectrumModel,  all the
      * converters to any RX SpectrumModel, and all the corresponding
@@ -163,6 +177,11 @@ class MultiModelSpectrumChannel : public SpectrumChannel
      * Number of devices connected to the channel.
      */
     std::size_t m_numDevices;
+
+    double m_maxRange;    //!< Range beyond which receivers are skipped (m), or 0
+    SpatialIndex m_index; //!< Positions of the receivers
+    bool m_indexDirty;    //!< Whether m_index must be rebuilt
+    double m_indexRange;  //!< The MaxRange with which m_index was built
 };
 
 } // namespace ns3
@@ -171,6 +171,12 @@ SpectrumChannel::SetPropagationDelayModel(Ptr<PropagationDelayModel> delay)
     m_propagationDelay = delay;
 }
 
+Ptr<PropagationDelayModel>
+SpectrumChannel::GetPropagationDelayModel() const
+{
+    return m_propagationDelay;
+}
+
 Ptr<SpectrumPropagationLossModel>
 SpectrumChannel::GetSpectrumPropagationLossModel()
 {
@@ -97,6 +97,13 @@ class SpectrumChannel : public Channel
      */
     void SetPropagationDelayModel(Ptr<PropagationDelayModel> delay);
 
+    /**
+     * Get the propagation delay model.
+     * \returns a pointer to the propagation delay model, or nullptr if the
+     * signals are received without delay.
+     */
+    Ptr<PropagationDelayModel> GetPropagationDelayModel() const;
+
     /**
      * Get the frequency-dependent propagation loss model.
      * \returns a pointer to the propagation loss model.
@@ -80,16 +80,20 @@ SpectrumConverter::Convert(Ptr<const SpectrumValue> fvvf) const
 
     Ptr<SpectrumValue> tvvf = Create<SpectrumValue>(m_toSpectrumModel);
 
+    // the coefficients of each row are summed in order, through raw
+    // pointers rather than bound-checked accesses.
+    auto from = fvvf->ConstValuesBegin();
     auto tvit = tvvf->ValuesBegin();
+    const double* coefficients = m_conversionMatrix.data();
+    const size_t* columns = m_conversionColInd.data();
     size_t i = 0; // Index of conversion coefficient
 
-    for (auto convIt = m_conversionRowPtr.begin(); convIt != m_conversionRowPtr.end(); ++convIt)
+    for (size_t rowEnd : m_conversionRowPtr)
     {
         double sum = 0;
-        while (i < *convIt)
+        for (; i < rowEnd; i++)
         {
-            sum += (*fvvf)[m_conversionColInd.at(i)] * m_conversionMatrix.at(i);
-            i++;
+            sum += from[columns[i]] * coefficients[i];
         }
         *tvit = sum;
         ++tvit;
@@ -23,11 +23,61 @@
 #include <ns3/log.h>
 #include <ns3/math.h>
 
+#include <algorithm>
+
 namespace ns3
 {
 
 NS_LOG_COMPONENT_DEFINE("SpectrumValue");
 
+namespace
+{
+
+/**
+ * Apply an operation to all the values, in place.
+ *
+ * The loops over the values are written with a trip count known before
+ * the loop and raw pointers, so that the compiler can vectorize them.
+ *
+ * \param [in,out] a The values.
+ * \param [in] op The operation, which returns the new value of an element.
+ */
+template <typename Op>
+inline void
+Apply(Values& a, Op op)
+{
+    double* pa = a.data();
+    const std::size_t n = a.size();
+    for (std::size_t i = 0; i < n; i++)
+    {
+        pa[i] = op(pa[i]);
+    }
+}
+
+/**
+ * Combine the values with those of another SpectrumValue, in place.
+ *
+ * \param [in,out] a The values.
+ * \param [in] b The other values, of the same size.
+ * \param [in] op The operation, which returns the new value of an element
+ *             from the elements of a and b.
+ */
+template <typename Op>
+inline void
+Apply(Values& a, const Values& b, Op op)
+{
+    NS_ASSERT(a.size() == b.size());
+    double* pa = a.data();
+    const double* pb = b.data();
+    const std::size_t n = a.size();
+    for (std::size_t i = 0; i < n; i++)
+    {
+        pa[i] = op(pa[i], pb[i]);
+    }
+}
+
+} // unnamed namespace
+
 SpectrumValue::SpectrumValue()
 {
 }
@@ -101,47 +151,21 @@ SpectrumValue::ConstBandsEnd() const
 void
 SpectrumValue::Add(const SpectrumValue& x)
 {
-    auto it1 = m_values.begin();
-    auto it2 = x.m_values.begin();
-
     NS_ASSERT(m_spectrumModel == x.m_spectrumModel);
-    NS_ASSERT(m_values.size() == x.m_values.size());
-
-    while (it1 != m_values.end())
-    {
-        *it1 += *it2;
-        ++it1;
-        ++it2;
-    }
+    Apply(m_values, x.m_values, [](double a, double b) { return a + b; });
 }
 
 void
 SpectrumValue::Add(double s)
 {
-    auto it1 = m_values.begin();
-
-    while (it1 != m_values.end())
-    {
-        *it1 += s;
-        ++it1;
-    }
+    Apply(m_values, [s](double a) { return a + s; });
 }
 
 void
 SpectrumValue::Subtract(const SpectrumValue& x)
 {
-    auto it1 = m_values.begin();
-    auto it2 = x.m_values.begin();
-
     NS_ASSERT(m_spectrumModel == x.m_spectrumModel);
-    NS_ASSERT(m_values.size() == x.m_values.size());
-
-    while (it1 != m_values.end())
-    {
-        *it1 -= *it2;
-        ++it1;
-        ++it2;
-    }
+    Apply(m_values, x.m_values, [](double a, double b) { return a - b; });
 }
 
 void
@@ -153,71 +177,56 @@ SpectrumValue::Subtract(double s)
 void
 SpectrumValue::Multiply(const SpectrumValue& x)
 {
-    auto it1 = m_values.begin();
-    auto it2 = x.m_values.begin();
-
     NS_ASSERT(m_spectrumModel == x.m_spectrumModel);
-    NS_ASSERT(m_values.size() == x.m_values.size());
-
-    while (it1 != m_values.end())
-    {
-        *it1 *= *it2;
-        ++it1;
-        ++it2;
-    }
+    Apply(m_values, x.m_values, [](double a, double b) { return a * b; });
 }
 
 void
 SpectrumValue::Multiply(double s)
 {
-    auto it1 = m_values.begin();
-
-    while (it1 != m_values.end())
-    {
-        *it1 *= s;
-        ++it1;
-    }
+    Apply(m_values, [s](double a) { return a * s; });
 }
 
 void
 SpectrumValue::Divide(const SpectrumValue& x)
 {
-    auto it1 = m_values.begin();
-    auto it2 = x.m_values.begin();
-
     NS_ASSERT(m_spectrumModel == x.m_spectrumModel);
-    NS_ASSERT(m_values.size() == x.m_values.size());
-
-    while (it1 != m_values.end())
-    {
-        *it1 /= *it2;
-        ++it1;
-        ++it2;
-    }
+    Apply(m_values, x.m_values, [](double a, double b) { return a / b; });
 }
 
 void
 SpectrumValue::Divide(double s)
 {
     NS_LOG_FUNCTION(this << s);
-    auto it1 = m_values.begin();
-
-    while (it1 != m_values.end())
-    {
-        *it1 /= s;
-        ++it1;
-    }
+    Apply(m_values, [s](double a) { return a / s; });
 }
 
 void
 SpectrumValue::ChangeSign()
 {
-    auto it1 = m_values.begin();
+    Apply(m_values, [](double a) { return -a; });
+}
 
-    while (it1 != m_values.end())
+void
+SpectrumValue::MultiplyAdd(const SpectrumValue& x, double s)
+{
+    NS_ASSERT(m_spectrumModel == x.m_spectrumModel);
+    Apply(m_values, x.m_values, [s](double a, double b) { return a + b * s; });
+}
+
+void
+SpectrumValue::MultiplyAdd(const SpectrumValue& x, const SpectrumValue& y)
+{
+    NS_ASSERT(m_spectrumModel == x.m_spectrumModel);
+    NS_ASSERT(m_spectrumModel == y.m_spectrumModel);
+    NS_ASSERT(m_values.size() == x.m_values.size() && m_values.size() == y.m_values.size());
+    double* pa = m_values.data();
+    const double* px = x.m_values.data();
+    const double* py = y.m_values.data();
+    const std::size_t n = m_values.size();
+    for (std::size_t i = 0; i < n; i++)
     {
-        *it1 = -(*it1);
-        ++it1;
+        pa[i] += px[i] * py[i];
     }
 }
 
@@ -360,17 +369,15 @@ Prod(const SpectrumValue& x)
 double
 Integral(const SpectrumValue& arg)
 {
+    const double* values = arg.m_values.data();
+    auto bands = arg.ConstBandsBegin();
+    const std::size_t n = arg.m_values.size();
+    NS_ASSERT(static_cast<std::size_t>(arg.ConstBandsEnd() - bands) == n);
     double i = 0;
-    auto vit = arg.ConstValuesBegin();
-    auto bit = arg.ConstBandsBegin();
-    while (vit != arg.ConstValuesEnd())
+    for (std::size_t k = 0; k < n; k++)
     {
-        NS_ASSERT(bit != arg.ConstBandsEnd());
-        i += (*vit) * (bit->fh - bit->fl);
-        ++vit;
-        ++bit;
+        i += values[k] * (bands[k].fh - bands[k].fl);
     }
-    NS_ASSERT(bit == arg.ConstBandsEnd());
     return i;
 }
 
@@ -442,9 +449,8 @@ operator+(double lhs, const SpectrumValue& rhs)
 SpectrumValue
 operator-(const SpectrumValue& lhs, const SpectrumValue& rhs)
 {
-    SpectrumValue res = rhs;
-    res.ChangeSign();
-    res.Add(lhs);
+    SpectrumValue res = lhs;
+    res.Subtract(rhs);
     return res;
 }
 
@@ -625,13 +631,7 @@ SpectrumValue::operator/=(double rhs)
 SpectrumValue&
 SpectrumValue::operator=(double rhs)
 {
-    auto it1 = m_values.begin();
-
-    while (it1 != m_values.end())
-    {
-        *it1 = rhs;
-        ++it1;
-    }
+    std::fill(m_values.begin(), m_values.end(), rhs);
     return *this;
 }
 
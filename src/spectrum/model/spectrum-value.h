@@ -464,6 +464,26 @@ class SpectrumValue : public SimpleRefCount<SpectrumValue>
      */
     SpectrumValue& operator/=(double rhs);
 
+    /**
+     * Add the product of a SpectrumValue and a scalar to *this,
+     * component by component: this is *this += x * s without the
+     * temporary SpectrumValue.
+     *
+     * @param x the SpectrumValue
+     * @param s the scalar
+     */
+    void MultiplyAdd(const SpectrumValue& x, double s);
+
+    /**
+     * Add the product of two SpectrumValue instances to *this, component
+     * by component: this is *this += x * y without the temporary
+     * SpectrumValue.
+     *
+     * @param x the first SpectrumValue
+     * @param y the second SpectrumValue
+     */
+    void MultiplyAdd(const SpectrumValue& x, const SpectrumValue& y);
+
     /**
      * Assign each component of *this to the value of the Right Hand
      * Side of the operator
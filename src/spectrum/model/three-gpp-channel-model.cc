@@ -29,6 +29,7 @@
 #include "ns3/phased-array-model.h"
 #include "ns3/pointer.h"
 #include "ns3/string.h"
+#include "ns3/uinteger.h"
 #include <ns3/simulator.h>
 
 #include <algorithm>
@@ -246,6 +247,7 @@ static const double sqrtC_office_NLOS[6][6] = {
 };
 
 ThreeGppChannelModel::ThreeGppChannelModel()
+    : m_maxCachedChannels(0)
 {
     NS_LOG_FUNCTION(this);
     m_uniformRv = CreateObject<UniformRandomVariable>();
@@ -272,6 +274,8 @@ ThreeGppChannelModel::DoDispose()
     }
     m_channelMatrixMap.clear();
     m_channelParamsMap.clear();
+    m_channelMatrixLru.Clear();
+    m_channelParamsLru.Clear();
     m_channelConditionModel = nullptr;
 }
 
@@ -307,6 +311,13 @@ ThreeGppChannelModel::GetTypeId()
                           TimeValue(MilliSeconds(0)),
                           MakeTimeAccessor(&ThreeGppChannelModel::m_updatePeriod),
                           MakeTimeChecker())
+            .AddAttribute("MaxCachedChannels",
+                          "The maximum number of channel matrices, and of sets of channel "
+                          "parameters, which are kept; the least recently used ones are "
+                          "evicted beyond it. 0 means no limit.",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&ThreeGppChannelModel::m_maxCachedChannels),
+                          MakeUintegerChecker<uint32_t>())
             // attributes for the blockage model
             .AddAttribute("Blockage",
                           "Enable blockage model A (sec 7.6.4.1)",
@@ -1114,9 +1125,10 @@ ThreeGppChannelModel::GetChannel(Ptr<const MobilityModel> aMob,
     Ptr<ChannelMatrix> channelMatrix;
     Ptr<ThreeGppChannelParams> channelParams;
 
-    if (m_channelParamsMap.find(channelParamsKey) != m_channelParamsMap.end())
+    auto paramsIt = m_channelParamsMap.find(channelParamsKey);
+    if (paramsIt != m_channelParamsMap.end())
     {
-        channelParams = m_channelParamsMap[channelParamsKey];
+        channelParams = paramsIt->second;
         // check if it has to be updated
         updateParams = ChannelParamsNeedsUpdate(channelParams, condition);
     }
@@ -1152,12 +1164,14 @@ ThreeGppChannelModel::GetChannel(Ptr<const MobilityModel> aMob,
         // store or replace the channel parameters
         m_channelParamsMap[channelParamsKey] = channelParams;
     }
+    TouchCacheEntry(m_channelParamsMap, m_channelParamsLru, channelParamsKey);
 
-    if (m_channelMatrixMap.find(channelMatrixKey) != m_channelMatrixMap.end())
+    auto matrixIt = m_channelMatrixMap.find(channelMatrixKey);
+    if (matrixIt != m_channelMatrixMap.end())
     {
         // channel matrix present in the map
         NS_LOG_DEBUG("channel matrix present in the map");
-        channelMatrix = m_channelMatrixMap[channelMatrixKey];
+        channelMatrix = matrixIt->second;
         updateMatrix = ChannelMatrixNeedsUpdate(channelParams, channelMatrix);
     }
     else
@@ -1180,10 +1194,69 @@ ThreeGppChannelModel::GetChannel(Ptr<const MobilityModel> aMob,
         // store or replace the channel matrix in the channel map
         m_channelMatrixMap[channelMatrixKey] = channelMatrix;
     }
+    TouchCacheEntry(m_channelMatrixMap, m_channelMatrixLru, channelMatrixKey);
 
     return channelMatrix;
 }
 
+template <class Map>
+void
+ThreeGppChannelModel::TouchCacheEntry(Map& map, LruKeys& lru, uint64_t key)
+{
+    if (m_maxCachedChannels == 0)
+    {
+        return;
+    }
+    lru.Touch(key);
+    uint64_t evicted;
+    while (lru.Evict(m_maxCachedChannels, evicted))
+    {
+        NS_LOG_DEBUG("evicting the channel map entry " << evicted);
+        map.erase(evicted);
+    }
+}
+
+uint32_t
+ThreeGppChannelModel::GetMaxCachedChannels() const
+{
+    return m_maxCachedChannels;
+}
+
+void
+ThreeGppChannelModel::LruKeys::Touch(uint64_t key)
+{
+    auto position = m_positions.find(key);
+    if (position != m_positions.end())
+    {
+        m_keys.splice(m_keys.begin(), m_keys, position->second);
+    }
+    else
+    {
+        m_keys.push_front(key);
+        m_positions[key] = m_keys.begin();
+    }
+}
+
+bool
+ThreeGppChannelModel::LruKeys::Evict(uint32_t capacity, uint64_t& key)
+{
+    if (m_keys.size() <= capacity)
+    {
+        return false;
+    }
+    key = m_keys.back();
+    m_positions.erase(key);
+    m_keys.pop_back();
+    return true;
+}
+
+void
+ThreeGppChannelModel::LruKeys::Clear()
+{
+    m_keys.clear();
+    m_positions.clear();
+}
+
 Ptr<const MatrixBasedChannelModel::ChannelParams>
 ThreeGppChannelModel::GetParams(Ptr<const MobilityModel> aMob, Ptr<const MobilityModel> bMob) const
 {
@@ -1193,9 +1266,10 @@ ThreeGppChannelModel::GetParams(Ptr<const MobilityModel> aMob, Ptr<const Mobilit
     uint64_t channelParamsKey =
         GetKey(aMob->GetObject<Node>()->GetId(), bMob->GetObject<Node>()->GetId());
 
-    if (m_channelParamsMap.find(channelParamsKey) != m_channelParamsMap.end())
+    auto paramsIt = m_channelParamsMap.find(channelParamsKey);
+    if (paramsIt != m_channelParamsMap.end())
     {
-        return m_channelParamsMap.find(channelParamsKey)->second;
+        return paramsIt->second;
     }
     else
     {
@@ -28,6 +28,7 @@
 #include <ns3/channel-condition-model.h>
 
 #include <complex.h>
+#include <list>
 #include <unordered_map>
 
 namespace ns3
@@ -42,6 +43,12 @@ class MobilityModel;
  * The class implements the channel matrix generation procedure
  * described in 3GPP TR 38.901.
  *
+ * The channel parameters of each pair of nodes, and the channel matrix of
+ * each pair of antennas, are kept until they have to be updated.  With the
+ * MaxCachedChannels attribute, the number of entries kept in each map is
+ * bounded, and the least recently used entries are evicted: a new
+ * realization is generated if the pair is used again.
+ *
  * \see GetChannel
  */
 class ThreeGppChannelModel : public MatrixBasedChannelModel
@@ -137,6 +144,44 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
      */
     int64_t AssignStreams(int64_t stream);
 
+    /**
+     * Get the maximum number of entries of each channel map.
+     * \return the value of the MaxCachedChannels attribute, 0 meaning no limit
+     */
+    uint32_t GetMaxCachedChannels() const;
+
+    /**
+     * The keys of a cache, in least recently used order.
+     */
+    class LruKeys
+    {
+      public:
+        /**
+         * Mark a key as the most recently used, adding it if needed.
+         * \param key the key
+         */
+        void Touch(uint64_t key);
+
+        /**
+         * Remove the least recently used key if there are more keys than
+         * a capacity.
+         * \param capacity the maximum number of keys
+         * \param [out] key the key removed
+         * \return true if a key was removed
+         */
+        bool Evict(uint32_t capacity, uint64_t& key);
+
+        /**
+         * Remove all the keys.
+         */
+        void Clear();
+
+      private:
+        std::list<uint64_t> m_keys; //!< The keys, from the most to the least recently used
+        std::unordered_map<uint64_t, std::list<uint64_t>::iterator>
+            m_positions; //!< The position of each key in m_keys
+    };
+
   protected:
     /**
      * Wrap an (azimuth, inclination) angle pair in a valid range.
@@ -335,6 +380,17 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
     bool ChannelMatrixNeedsUpdate(Ptr<const ThreeGppChannelParams> channelParams,
                                   Ptr<const ChannelMatrix> channelMatrix);
 
+    /**
+     * Mark an entry of a channel map as the most recently used, and evict the
+     * least recently used entries beyond m_maxCachedChannels.
+     *
+     * \param map the channel map
+     * \param lru the keys of the map, in least recently used order
+     * \param key the key of the entry
+     */
+    template <class Map>
+    void TouchCacheEntry(Map& map, LruKeys& lru, uint64_t key);
+
     std::unordered_map<uint64_t, Ptr<ChannelMatrix>>
         m_channelMatrixMap; //!< map containing the channel realizations per pair of
                             //!< PhasedAntennaArray instances, the key of this map is reciprocal
@@ -343,7 +399,10 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
         m_channelParamsMap; //!< map containing the common channel parameters per pair of nodes, the
                             //!< key of this map is reciprocal and uniquely identifies a pair of
                             //!< nodes
-    Time m_updatePeriod;    //!< the channel update period
+    uint32_t m_maxCachedChannels; //!< maximum number of entries of each map, or 0
+    LruKeys m_channelMatrixLru;   //!< the keys of m_channelMatrixMap in LRU order
+    LruKeys m_channelParamsLru;   //!< the keys of m_channelParamsMap in LRU order
+    Time m_updatePeriod;          //!< the channel update period
     double m_frequency;     //!< the operating frequency
     std::string m_scenario; //!< the 3GPP scenario
     Ptr<ChannelConditionModel> m_channelConditionModel; //!< the channel condition model
@@ -55,6 +55,7 @@ void
 ThreeGppSpectrumPropagationLossModel::DoDispose()
 {
     m_longTermMap.clear();
+    m_longTermLru.Clear();
     m_channelModel->Dispose();
     m_channelModel = nullptr;
 }
@@ -452,7 +453,10 @@ ThreeGppSpectrumPropagationLossModel::GetLongTerm(
         // check if the channel matrix has been updated
         // or the s beam has been changed
         // or the u beam has been changed
-        update = (m_longTermMap[longTermId]->m_channel->m_generatedTime !=
+        // (a channel matrix evicted from the cache of the channel model may
+        // be regenerated at the same time, hence the pointer comparison)
+        update = (m_longTermMap[longTermId]->m_channel != channelMatrix ||
+                  m_longTermMap[longTermId]->m_channel->m_generatedTime !=
                       channelMatrix->m_generatedTime ||
                   m_longTermMap[longTermId]->m_sW != sW || m_longTermMap[longTermId]->m_uW != uW);
     }
@@ -478,6 +482,21 @@ ThreeGppSpectrumPropagationLossModel::GetLongTerm(
         m_longTermMap[longTermId] = longTermItem;
     }
 
+    // the long term components are evicted with the channel matrices of the
+    // channel model, which they keep alive, as they have the same keys and
+    // the channel matrix of a pair is always got before its long term
+    auto threeGppChannelModel = DynamicCast<ThreeGppChannelModel>(m_channelModel);
+    if (threeGppChannelModel && threeGppChannelModel->GetMaxCachedChannels() > 0)
+    {
+        m_longTermLru.Touch(longTermId);
+        uint64_t evicted;
+        while (m_longTermLru.Evict(threeGppChannelModel->GetMaxCachedChannels(), evicted))
+        {
+            NS_LOG_DEBUG("evicting the long term component " << evicted);
+            m_longTermMap.erase(evicted);
+        }
+    }
+
     return longTerm;
 }
 
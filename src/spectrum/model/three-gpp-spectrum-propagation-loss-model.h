@@ -23,6 +23,7 @@
 
 #include "matrix-based-channel-model.h"
 #include "phased-array-spectrum-propagation-loss-model.h"
+#include "three-gpp-channel-model.h"
 
 #include "ns3/random-variable-stream.h"
 
@@ -116,7 +117,9 @@ class ThreeGppSpectrumPropagationLossModel : public PhasedArraySpectrumPropagati
      * the propagation delay.
      * To reduce the computational load, the long term component associated with
      * a certain channel is cached and recomputed only when the channel realization
-     * is updated, or when the beamforming vectors change.
+     * is updated, or when the beamforming vectors change. When the channel model is a
+     * ThreeGppChannelModel with the MaxCachedChannels attribute set, the long
+     * term components are evicted with the channel matrices of its cache.
      *
      * \param spectrumSignalParams spectrum signal tx parameters
      * \param a first node mobility model
@@ -246,6 +249,8 @@ class ThreeGppSpectrumPropagationLossModel : public PhasedArraySpectrumPropagati
 
     mutable std::unordered_map<uint64_t, Ptr<const LongTerm>>
         m_longTermMap;                           //!< map containing the long term components
+    /// the keys of m_longTermMap in LRU order, when the channel model bounds its cache
+    mutable ThreeGppChannelModel::LruKeys m_longTermLru;
     Ptr<MatrixBasedChannelModel> m_channelModel; //!< the model to generate the channel matrix
 };
 } // namespace ns3
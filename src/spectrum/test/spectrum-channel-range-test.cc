@@ -0,0 +1,182 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/double.h>
+#include <ns3/multi-model-spectrum-channel.h>
+#include <ns3/net-device.h>
+#include <ns3/simulator.h>
+#include <ns3/spectrum-phy.h>
+#include <ns3/spectrum-signal-parameters.h>
+#include <ns3/test.h>
+
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief A SpectrumPhy which counts the signals it receives.
+ */
+class CountingSpectrumPhy : public SpectrumPhy
+{
+  public:
+    /**
+     * Constructor
+     * \param model the RX spectrum model
+     */
+    CountingSpectrumPhy(Ptr<const SpectrumModel> model)
+        : m_model(model),
+          m_nRx(0)
+    {
+    }
+
+    void SetDevice(Ptr<NetDevice> d) override
+    {
+    }
+
+    Ptr<NetDevice> GetDevice() const override
+    {
+        return nullptr;
+    }
+
+    void SetMobility(Ptr<MobilityModel> m) override
+    {
+        m_mobility = m;
+    }
+
+    Ptr<MobilityModel> GetMobility() const override
+    {
+        return m_mobility;
+    }
+
+    void SetChannel(Ptr<SpectrumChannel> c) override
+    {
+    }
+
+    Ptr<const SpectrumModel> GetRxSpectrumModel() const override
+    {
+        return m_model;
+    }
+
+    Ptr<Object> GetAntenna() const override
+    {
+        return nullptr;
+    }
+
+    void StartRx(Ptr<SpectrumSignalParameters> params) override
+    {
+        m_nRx++;
+    }
+
+    Ptr<const SpectrumModel> m_model; //!< RX spectrum model
+    Ptr<MobilityModel> m_mobility;    //!< Mobility model
+    uint32_t m_nRx;                   //!< Number of signals received
+};
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief Check that the receivers beyond the MaxRange of a
+ * MultiModelSpectrumChannel are skipped, including after they move.
+ */
+class SpectrumChannelRangeTestCase : public TestCase
+{
+  public:
+    SpectrumChannelRangeTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Transmit a signal from a PHY.
+     * \param tx the transmitting PHY
+     */
+    void Transmit(Ptr<SpectrumPhy> tx);
+
+    Ptr<MultiModelSpectrumChannel> m_channel; //!< The channel
+    Ptr<const SpectrumModel> m_model;         //!< The spectrum model
+};
+
+SpectrumChannelRangeTestCase::SpectrumChannelRangeTestCase()
+    : TestCase("Check the MaxRange cutoff of MultiModelSpectrumChannel")
+{
+}
+
+void
+SpectrumChannelRangeTestCase::Transmit(Ptr<SpectrumPhy> tx)
+{
+    Ptr<SpectrumSignalParameters> params = Create<SpectrumSignalParameters>();
+    params->duration = MicroSeconds(10);
+    params->txPhy = tx;
+    params->psd = Create<SpectrumValue>(m_model);
+    *params->psd = 1e-9;
+    m_channel->StartTx(params);
+}
+
+void
+SpectrumChannelRangeTestCase::DoRun()
+{
+    m_model = Create<SpectrumModel>(std::vector<double>{2.4e9, 2.41e9});
+    m_channel = CreateObject<MultiModelSpectrumChannel>();
+    m_channel->SetAttribute("MaxRange", DoubleValue(500));
+
+    std::vector<Ptr<CountingSpectrumPhy>> phys;
+    for (double x : {0.0, 10.0, 400.0, 1000.0})
+    {
+        auto phy = CreateObject<CountingSpectrumPhy>(m_model);
+        auto mobility = CreateObject<ConstantPositionMobilityModel>();
+        mobility->SetPosition(Vector(x, 0, 0));
+        phy->SetMobility(mobility);
+        m_channel->AddRx(phy);
+        phys.push_back(phy);
+    }
+
+    Simulator::Schedule(Seconds(1), &SpectrumChannelRangeTestCase::Transmit, this, phys[0]);
+    Simulator::Schedule(Seconds(2), [&phys]() {
+        phys[3]->GetMobility()->SetPosition(Vector(450, 0, 0));
+    });
+    Simulator::Schedule(Seconds(3), &SpectrumChannelRangeTestCase::Transmit, this, phys[0]);
+    Simulator::Run();
+
+    NS_TEST_EXPECT_MSG_EQ(phys[0]->m_nRx, 0, "The transmitter received its own signal");
+    NS_TEST_EXPECT_MSG_EQ(phys[1]->m_nRx, 2, "A receiver within range missed a signal");
+    NS_TEST_EXPECT_MSG_EQ(phys[2]->m_nRx, 2, "A receiver within range missed a signal");
+    NS_TEST_EXPECT_MSG_EQ(phys[3]->m_nRx, 1, "The receiver was not moved within range");
+
+    m_channel->Dispose();
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief MultiModelSpectrumChannel MaxRange TestSuite
+ */
+class SpectrumChannelRangeTestSuite : public TestSuite
+{
+  public:
+    SpectrumChannelRangeTestSuite();
+};
+
+SpectrumChannelRangeTestSuite::SpectrumChannelRangeTestSuite()
+    : TestSuite("spectrum-channel-range", UNIT)
+{
+    AddTestCase(new SpectrumChannelRangeTestCase, TestCase::QUICK);
+}
+
+/// Static variable for test initialization
+static SpectrumChannelRangeTestSuite g_spectrumChannelRangeTestSuite;
@@ -268,6 +268,16 @@ SpectrumValueTestSuite::SpectrumValueTestSuite()
     v1rs3[4] = v1[1];
     tv1rs3 = v1 >> 3;
     AddTestCase(new SpectrumValueTestCase(tv1rs3, v1rs3, "tv1rs3 = v1 >> 3"), TestCase::QUICK);
+
+    SpectrumValue tv11a = v1;
+    tv11a.MultiplyAdd(v2, doubleValue);
+    AddTestCase(new SpectrumValueTestCase(tv11a, v1 + v2 * doubleValue, "tv11a = v1 + v2 * s"),
+                TestCase::QUICK);
+
+    SpectrumValue tv11b = v1;
+    tv11b.MultiplyAdd(v2, v1);
+    AddTestCase(new SpectrumValueTestCase(tv11b, v1 + v2 * v1, "tv11b = v1 + v2 * v1"),
+                TestCase::QUICK);
 }
 
 /**
@@ -1213,6 +1213,189 @@ ThreeGppMimoPolarizationTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup spectrum-tests
+ *
+ * Test case for the MaxCachedChannels attribute of the ThreeGppChannelModel
+ * class. It checks that the least recently used channels are evicted, and
+ * that the other ones are kept.
+ */
+class ThreeGppChannelCacheTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     */
+    ThreeGppChannelCacheTest();
+
+  private:
+    /**
+     * Build the test scenario
+     */
+    void DoRun() override;
+};
+
+ThreeGppChannelCacheTest::ThreeGppChannelCacheTest()
+    : TestCase("Check the eviction of the least recently used channels")
+{
+}
+
+void
+ThreeGppChannelCacheTest::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    Ptr<ThreeGppChannelModel> channelModel = CreateObject<ThreeGppChannelModel>();
+    channelModel->SetAttribute("Frequency", DoubleValue(28.0e9));
+    channelModel->SetAttribute("Scenario", StringValue("UMa"));
+    channelModel->SetAttribute("ChannelConditionModel",
+                               PointerValue(CreateObject<AlwaysLosChannelConditionModel>()));
+    channelModel->SetAttribute("MaxCachedChannels", UintegerValue(2));
+    channelModel->AssignStreams(1);
+
+    // a base station and three user terminals, each with its antenna
+    NodeContainer nodes;
+    nodes.Create(4);
+    std::vector<Ptr<MobilityModel>> mobs;
+    std::vector<Ptr<PhasedArrayModel>> antennas;
+    for (uint32_t i = 0; i < nodes.GetN(); i++)
+    {
+        Ptr<MobilityModel> mob = CreateObject<ConstantPositionMobilityModel>();
+        mob->SetPosition(Vector(50.0 * i, 10.0 * i, i == 0 ? 25.0 : 1.5));
+        nodes.Get(i)->AggregateObject(mob);
+        mobs.push_back(mob);
+        antennas.push_back(CreateObjectWithAttributes<UniformPlanarArray>(
+            "NumColumns",
+            UintegerValue(2),
+            "NumRows",
+            UintegerValue(2),
+            "AntennaElement",
+            PointerValue(CreateObject<IsotropicAntennaModel>())));
+    }
+
+    Ptr<const ThreeGppChannelModel::ChannelMatrix> first =
+        channelModel->GetChannel(mobs[0], mobs[1], antennas[0], antennas[1]);
+    channelModel->GetChannel(mobs[0], mobs[2], antennas[0], antennas[2]);
+    // the channel with the first terminal is used again, and is kept
+    Ptr<const ThreeGppChannelModel::ChannelMatrix> again =
+        channelModel->GetChannel(mobs[0], mobs[1], antennas[0], antennas[1]);
+    NS_TEST_ASSERT_MSG_EQ(again, first, "The channel should be found in the cache");
+    channelModel->GetChannel(mobs[0], mobs[3], antennas[0], antennas[3]);
+
+    Ptr<const ThreeGppChannelModel::ChannelParams> params01 =
+        channelModel->GetParams(mobs[0], mobs[1]);
+    Ptr<const ThreeGppChannelModel::ChannelParams> params02 =
+        channelModel->GetParams(mobs[0], mobs[2]);
+    Ptr<const ThreeGppChannelModel::ChannelParams> params03 =
+        channelModel->GetParams(mobs[0], mobs[3]);
+    NS_TEST_ASSERT_MSG_NE(params01, nullptr, "The recently used parameters should be kept");
+    NS_TEST_ASSERT_MSG_EQ(params02,
+                          nullptr,
+                          "The least recently used parameters should be evicted");
+    NS_TEST_ASSERT_MSG_NE(params03, nullptr, "The last parameters should be kept");
+
+    // an evicted channel is generated again, and evicts the oldest one
+    Ptr<const ThreeGppChannelModel::ChannelMatrix> regenerated =
+        channelModel->GetChannel(mobs[0], mobs[2], antennas[0], antennas[2]);
+    NS_TEST_ASSERT_MSG_NE(regenerated, nullptr, "The evicted channel should be generated again");
+    params01 = channelModel->GetParams(mobs[0], mobs[1]);
+    NS_TEST_ASSERT_MSG_EQ(params01,
+                          nullptr,
+                          "The least recently used parameters should be evicted");
+
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * Test case for the long term components of the ThreeGppSpectrumPropagationLossModel
+ * class, when the MaxCachedChannels attribute of its channel model is set. It checks
+ * that the channel matrix of a long term component is released when the channel
+ * model evicts it.
+ */
+class ThreeGppLongTermCacheTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     */
+    ThreeGppLongTermCacheTest();
+
+  private:
+    /**
+     * Build the test scenario
+     */
+    void DoRun() override;
+};
+
+ThreeGppLongTermCacheTest::ThreeGppLongTermCacheTest()
+    : TestCase("Check the eviction of the long term components with the channels")
+{
+}
+
+void
+ThreeGppLongTermCacheTest::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    Ptr<ThreeGppSpectrumPropagationLossModel> lossModel =
+        CreateObject<ThreeGppSpectrumPropagationLossModel>();
+    lossModel->SetChannelModelAttribute("Frequency", DoubleValue(2.4e9));
+    lossModel->SetChannelModelAttribute("Scenario", StringValue("UMa"));
+    lossModel->SetChannelModelAttribute(
+        "ChannelConditionModel",
+        PointerValue(CreateObject<AlwaysLosChannelConditionModel>()));
+    lossModel->SetChannelModelAttribute("MaxCachedChannels", UintegerValue(1));
+    Ptr<ThreeGppChannelModel> channelModel =
+        DynamicCast<ThreeGppChannelModel>(lossModel->GetChannelModel());
+
+    // a base station and two user terminals, each with its antenna
+    NodeContainer nodes;
+    nodes.Create(3);
+    std::vector<Ptr<MobilityModel>> mobs;
+    std::vector<Ptr<PhasedArrayModel>> antennas;
+    for (uint32_t i = 0; i < nodes.GetN(); i++)
+    {
+        Ptr<MobilityModel> mob = CreateObject<ConstantPositionMobilityModel>();
+        mob->SetPosition(Vector(50.0 * i, 10.0 * i, i == 0 ? 25.0 : 1.5));
+        nodes.Get(i)->AggregateObject(mob);
+        mobs.push_back(mob);
+        Ptr<PhasedArrayModel> antenna = CreateObjectWithAttributes<UniformPlanarArray>(
+            "NumColumns",
+            UintegerValue(2),
+            "NumRows",
+            UintegerValue(2),
+            "AntennaElement",
+            PointerValue(CreateObject<IsotropicAntennaModel>()));
+        antenna->SetBeamformingVector(antenna->GetBeamformingVector(Angles(0, M_PI / 2)));
+        antennas.push_back(antenna);
+    }
+
+    SpectrumValue5MhzFactory sf;
+    Ptr<SpectrumSignalParameters> txParams = Create<SpectrumSignalParameters>();
+    txParams->psd = sf.CreateTxPowerSpectralDensity(0.1, 1);
+
+    lossModel->DoCalcRxPowerSpectralDensity(txParams, mobs[0], mobs[1], antennas[0], antennas[1]);
+    Ptr<const ThreeGppChannelModel::ChannelMatrix> matrix =
+        channelModel->GetChannel(mobs[0], mobs[1], antennas[0], antennas[1]);
+    NS_TEST_ASSERT_MSG_EQ(matrix->GetReferenceCount(),
+                          3,
+                          "The channel matrix should be kept by the channel model and the "
+                          "long term component");
+
+    // the channel with the second terminal evicts the channel with the first one
+    lossModel->DoCalcRxPowerSpectralDensity(txParams, mobs[0], mobs[2], antennas[0], antennas[2]);
+    NS_TEST_EXPECT_MSG_EQ(matrix->GetReferenceCount(),
+                          1,
+                          "The evicted channel matrix should have been released");
+
+    lossModel->Dispose();
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup spectrum-tests
  *
@@ -1244,6 +1427,8 @@ ThreeGppChannelTestSuite::ThreeGppChannelTestSuite()
     AddTestCase(new ThreeGppSpectrumPropagationLossModelTest(4, 2, 2, 2), TestCase::QUICK);
     AddTestCase(new ThreeGppSpectrumPropagationLossModelTest(4, 2, 2, 1), TestCase::QUICK);
     AddTestCase(new ThreeGppCalcLongTermMultiPortTest(), TestCase::QUICK);
+    AddTestCase(new ThreeGppChannelCacheTest(), TestCase::QUICK);
+    AddTestCase(new ThreeGppLongTermCacheTest(), TestCase::QUICK);
 
     /**
      *  The TX and RX antennas are configured face-to-face.
@@ -0,0 +1,81 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "error-rate-lookup-table.h"
+
+#include "ns3/log.h"
+
+#include <cmath>
+#include <map>
+
+#ifdef NS3_MTP
+#include <mutex>
+#endif
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("ErrorRateLookupTable");
+
+ErrorRateLookupTable::ErrorRateLookupTable(const Function& function)
+{
+    NS_LOG_FUNCTION(this);
+    auto size = static_cast<std::size_t>(std::round((MAX_SNR_DB - MIN_SNR_DB) / STEP_DB)) + 1;
+    m_values.reserve(size);
+    m_logs.reserve(size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        double value = function(std::pow(10, (MIN_SNR_DB + i * STEP_DB) / 10));
+        m_values.push_back(value);
+        m_logs.push_back(value > 0 ? std::log(value) : 0);
+    }
+}
+
+double
+ErrorRateLookupTable::GetValue(double snr, const Function& function) const
+{
+    double position = (10 * std::log10(snr) - MIN_SNR_DB) / STEP_DB;
+    // NaN and -inf positions, for a null or negative SNR, are not on the grid either
+    if (!(position >= 0) || position >= m_values.size() - 1)
+    {
+        return function(snr);
+    }
+    auto index = static_cast<std::size_t>(position);
+    double fraction = position - index;
+    if (m_values[index] == 0 || m_values[index + 1] == 0)
+    {
+        return (1 - fraction) * m_values[index] + fraction * m_values[index + 1];
+    }
+    return std::exp(m_logs[index] + fraction * (m_logs[index + 1] - m_logs[index]));
+}
+
+const ErrorRateLookupTable&
+ErrorRateLookupTable::GetShared(const std::string& name, const Function& function)
+{
+    static std::map<std::string, ErrorRateLookupTable> tables;
+#ifdef NS3_MTP
+    static std::mutex mutex;
+    std::lock_guard lock(mutex);
+#endif
+    auto it = tables.find(name);
+    if (it == tables.end())
+    {
+        NS_LOG_DEBUG("Build the table " << name);
+        it = tables.emplace(name, ErrorRateLookupTable(function)).first;
+    }
+    return it->second;
+}
+
+} // namespace ns3
@@ -0,0 +1,84 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef ERROR_RATE_LOOKUP_TABLE_H
+#define ERROR_RATE_LOOKUP_TABLE_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup wifi
+ * \brief A table of an error probability as a function of the SNR
+ *
+ * The probability is sampled on a grid of SNRs in dB, from MIN_SNR_DB to
+ * MAX_SNR_DB every STEP_DB, and interpolated linearly in its logarithm,
+ * which varies smoothly with the SNR in dB for the error rate models of
+ * Wi-Fi.  Outside the grid, the probability is computed by the function,
+ * which the table does not keep, as it may be bound to the model which
+ * built the table first.
+ *
+ * The error rate models use it for the coded bit error probability, which
+ * does not depend on the size of the chunk.  A relative error e of this
+ * probability changes the success rate of a chunk by less than e, whatever
+ * the size of the chunk.  The tables are shared by all the error rate
+ * models, and built at first use.
+ */
+class ErrorRateLookupTable
+{
+  public:
+    /// A function returning an error probability for a given SNR (linear scale)
+    using Function = std::function<double(double)>;
+
+    static constexpr double MIN_SNR_DB = -10; //!< smallest SNR of the grid, in dB
+    static constexpr double MAX_SNR_DB = 60;  //!< largest SNR of the grid, in dB
+    static constexpr double STEP_DB = 0.01;   //!< step of the grid, in dB
+
+    /**
+     * Sample a function on the grid.
+     *
+     * \param function the function returning the error probability
+     */
+    ErrorRateLookupTable(const Function& function);
+
+    /**
+     * \param snr the SNR (linear scale)
+     * \param function the function returning the error probability, called outside the grid
+     * \return the error probability at the given SNR
+     */
+    double GetValue(double snr, const Function& function) const;
+
+    /**
+     * Get the table shared by all the error rate models for a given name,
+     * built from the function the first time.
+     *
+     * \param name the name of the table, which identifies the function
+     * \param function the function returning the error probability
+     * \return the shared table
+     */
+    static const ErrorRateLookupTable& GetShared(const std::string& name, const Function& function);
+
+  private:
+    std::vector<double> m_values; //!< the error probabilities on the grid
+    std::vector<double> m_logs;   //!< the logarithms of the error probabilities on the grid
+};
+
+} // namespace ns3
+
+#endif /* ERROR_RATE_LOOKUP_TABLE_H */
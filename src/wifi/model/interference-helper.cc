@@ -32,6 +32,7 @@
 #include "ns3/simulator.h"
 
 #include <algorithm>
+#include <iterator>
 #include <numeric>
 
 namespace ns3
@@ -251,6 +252,22 @@ InterferenceHelper::HasBand(const WifiSpectrumBandInfo& band) const
     return (m_niChanges.count(band) > 0);
 }
 
+std::size_t
+InterferenceHelper::GetNiChangesCount(const WifiSpectrumBandInfo& band) const
+{
+    auto niIt = m_niChanges.find(band);
+    NS_ABORT_IF(niIt == m_niChanges.end());
+    return niIt->second.size();
+}
+
+double
+InterferenceHelper::GetFirstPower(const WifiSpectrumBandInfo& band) const
+{
+    auto firstPowerIt = m_firstPowers.find(band);
+    NS_ABORT_IF(firstPowerIt == m_firstPowers.end());
+    return firstPowerIt->second;
+}
+
 void
 InterferenceHelper::AddBand(const WifiSpectrumBandInfo& band)
 {
@@ -357,6 +374,10 @@ InterferenceHelper::AppendEvent(Ptr<Event> event, bool isStartHePortionRxing)
     {
         auto niIt = m_niChanges.find(band);
         NS_ABORT_IF(niIt == m_niChanges.end());
+        if (m_rxing)
+        {
+            RemoveExpiredNiChanges(niIt->second);
+        }
         double previousPowerStart = 0;
         double previousPowerEnd = 0;
         auto previousPowerPosition = GetPreviousPosition(event->GetStartTime(), niIt);
@@ -377,14 +398,47 @@ InterferenceHelper::AppendEvent(Ptr<Event> event, bool isStartHePortionRxing)
         }
         auto first =
             AddNiChangeEvent(event->GetStartTime(), NiChange(previousPowerStart, event), niIt);
+        // adding the end NiChange invalidates the iterators, but not the position of the start one
+        auto firstIndex = std::distance(niIt->second.begin(), first);
         auto last = AddNiChangeEvent(event->GetEndTime(), NiChange(previousPowerEnd, event), niIt);
-        for (auto i = first; i != last; ++i)
+        for (auto i = std::next(niIt->second.begin(), firstIndex); i != last; ++i)
         {
             i->second.AddPower(power);
         }
     }
 }
 
+void
+InterferenceHelper::RemoveExpiredNiChanges(NiChanges& niChanges)
+{
+    NS_LOG_FUNCTION(this);
+    if (niChanges.size() <= 2)
+    {
+        return;
+    }
+    // Always leave the first zero power noise event in the list, and the last NiChange,
+    // which holds the current power
+    auto firstKept = std::next(niChanges.begin());
+    auto last = std::prev(niChanges.end());
+    Time now = Simulator::Now();
+    while (firstKept != last && firstKept->second.GetEvent()->GetEndTime() < now)
+    {
+        ++firstKept;
+    }
+    // Keep the NiChanges at the same time as the first NiChange kept
+    firstKept = std::lower_bound(std::next(niChanges.begin()),
+                                 firstKept,
+                                 firstKept->first,
+                                 [](const auto& change, Time t) { return change.first < t; });
+    if (firstKept == std::next(niChanges.begin()))
+    {
+        return;
+    }
+    // Also keep the NiChange before them: NotifyRxEnd reads the power before the start of an
+    // event still in the air when another PPDU is selected during preamble detection
+    niChanges.erase(std::next(niChanges.begin()), std::prev(firstKept));
+}
+
 void
 InterferenceHelper::UpdateEvent(Ptr<Event> event, const RxPowerWattPerChannelBand& rxPower)
 {
@@ -447,7 +501,7 @@ InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
     double noiseInterferenceW = firstPower_it->second;
     auto niIt = m_niChanges.find(band);
     NS_ABORT_IF(niIt == m_niChanges.end());
-    auto it = niIt->second.find(event->GetStartTime());
+    auto it = FindNiChange(event->GetStartTime(), niIt->second);
     double muMimoPowerW = (event->GetPpdu()->GetType() == WIFI_PPDU_TYPE_UL_MU)
                               ? CalculateMuMimoPowerW(event, band)
                               : 0.0;
@@ -467,20 +521,19 @@ InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
             noiseInterferenceW = 0.0;
         }
     }
-    it = niIt->second.find(event->GetStartTime());
+    it = FindNiChange(event->GetStartTime(), niIt->second);
     NS_ABORT_IF(it == niIt->second.end());
     for (; it != niIt->second.end() && it->second.GetEvent() != event; ++it)
     {
         ;
     }
-    NiChanges ni;
-    ni.emplace(event->GetStartTime(), NiChange(0, event));
+    NiChanges& ni = nis[band];
+    ni.emplace_back(event->GetStartTime(), NiChange(0, event));
     while (++it != niIt->second.end() && it->second.GetEvent() != event)
     {
-        ni.insert(*it);
+        ni.push_back(*it);
     }
-    ni.emplace(event->GetEndTime(), NiChange(0, event));
-    nis.insert({band, ni});
+    ni.emplace_back(event->GetEndTime(), NiChange(0, event));
     NS_ASSERT_MSG(noiseInterferenceW >= 0.0,
                   "CalculateNoiseInterferenceW returns negative value " << noiseInterferenceW);
     return noiseInterferenceW;
@@ -658,8 +711,8 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
 {
     NS_LOG_FUNCTION(this << band);
     double psr = 1.0; /* Packet Success Rate */
-    auto niIt = nis->find(band)->second;
-    auto j = niIt.begin();
+    const auto& niIt = nis->find(band)->second;
+    auto j = niIt.cbegin();
 
     NS_ASSERT(!phyHeaderSections.empty());
     Time stopLastSection = Seconds(0);
@@ -672,7 +725,7 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
     NS_ABORT_IF(m_firstPowers.count(band) == 0);
     double noiseInterferenceW = m_firstPowers.at(band);
     double powerW = event->GetRxPowerW(band);
-    while (++j != niIt.end())
+    while (++j != niIt.cend())
     {
         Time current = j->first;
         NS_LOG_DEBUG("previous= " << previous << ", current=" << current);
@@ -720,7 +773,7 @@ InterferenceHelper::CalculatePhyHeaderPer(Ptr<const Event> event,
                                           WifiPpduField header) const
 {
     NS_LOG_FUNCTION(this << band << header);
-    auto niIt = nis->find(band)->second;
+    const auto& niIt = nis->find(band)->second;
     auto phyEntity =
         WifiPhy::GetStaticPhyEntity(event->GetPpdu()->GetTxVector().GetModulationClass());
 
@@ -800,7 +853,20 @@ InterferenceHelper::CalculatePhyHeaderSnrPer(Ptr<Event> event,
 InterferenceHelper::NiChanges::iterator
 InterferenceHelper::GetNextPosition(Time moment, NiChangesPerBand::iterator niIt)
 {
-    return niIt->second.upper_bound(moment);
+    return std::upper_bound(niIt->second.begin(),
+                            niIt->second.end(),
+                            moment,
+                            [](Time t, const auto& change) { return t < change.first; });
+}
+
+InterferenceHelper::NiChanges::const_iterator
+InterferenceHelper::FindNiChange(Time moment, const NiChanges& niChanges)
+{
+    auto it = std::lower_bound(niChanges.cbegin(),
+                               niChanges.cend(),
+                               moment,
+                               [](const auto& change, Time t) { return change.first < t; });
+    return (it != niChanges.cend() && it->first == moment) ? it : niChanges.cend();
 }
 
 InterferenceHelper::NiChanges::iterator
@@ -816,7 +882,7 @@ InterferenceHelper::GetPreviousPosition(Time moment, NiChangesPerBand::iterator
 InterferenceHelper::NiChanges::iterator
 InterferenceHelper::AddNiChangeEvent(Time moment, NiChange change, NiChangesPerBand::iterator niIt)
 {
-    return niIt->second.insert(GetNextPosition(moment, niIt), std::make_pair(moment, change));
+    return niIt->second.emplace(GetNextPosition(moment, niIt), moment, change);
 }
 
 void
@@ -24,6 +24,8 @@
 
 #include "ns3/object.h"
 
+#include <vector>
+
 namespace ns3
 {
 
@@ -347,6 +349,19 @@ class InterferenceHelper : public Object
                                             const WifiTxVector& txVector,
                                             uint16_t staId = SU_STA_ID) const;
 
+    /**
+     * \param band the band
+     * \return the number of NiChanges recorded for the given band
+     */
+    std::size_t GetNiChangesCount(const WifiSpectrumBandInfo& band) const;
+
+    /**
+     * \param band the band
+     * \return the noise and interference power (W) at the start of the PPDU being received on
+     *         the given band
+     */
+    double GetFirstPower(const WifiSpectrumBandInfo& band) const;
+
   private:
     /**
      * Noise and Interference (thus Ni) event.
@@ -387,9 +402,10 @@ class InterferenceHelper : public Object
     };
 
     /**
-     * typedef for a multimap of NiChange
+     * NiChanges of a band, sorted by time.  The NiChanges at the same time are
+     * kept in the order they were added.
      */
-    using NiChanges = std::multimap<Time, NiChange>;
+    using NiChanges = std::vector<std::pair<Time, NiChange>>;
 
     /**
      * Map of NiChanges per band
@@ -428,6 +444,16 @@ class InterferenceHelper : public Object
      */
     void AppendEvent(Ptr<Event> event, bool isStartHePortionRxing);
 
+    /**
+     * Remove the NiChanges older than the first NiChange of an event which
+     * has not ended yet, since no SNR computation can involve them anymore.
+     * The NiChange right before it is kept, since it holds the power at the
+     * start of that event.
+     *
+     * \param niChanges the NiChanges of a band
+     */
+    void RemoveExpiredNiChanges(NiChanges& niChanges);
+
     /**
      * Calculate noise and interference power in W.
      *
@@ -522,6 +548,15 @@ class InterferenceHelper : public Object
      * \returns an iterator to the list of NiChanges
      */
     NiChanges::iterator GetNextPosition(Time moment, NiChangesPerBand::iterator niIt);
+    /**
+     * Returns an iterator to the first NiChange that is at moment
+     *
+     * \param moment time to check
+     * \param niChanges the NiChanges of the band to check
+     * \returns an iterator to the list of NiChanges, or the end of the list if
+     * there is no NiChange at moment
+     */
+    static NiChanges::const_iterator FindNiChange(Time moment, const NiChanges& niChanges);
     /**
      * Returns an iterator to the last NiChange that is before than moment
      *
@@ -22,10 +22,12 @@
 
 #include "wifi-tx-vector.h"
 
+#include "ns3/boolean.h"
 #include "ns3/log.h"
 
 #include <bitset>
 #include <cmath>
+#include <string>
 
 namespace ns3
 {
@@ -37,14 +39,22 @@ NS_OBJECT_ENSURE_REGISTERED(NistErrorRateModel);
 TypeId
 NistErrorRateModel::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::NistErrorRateModel")
-                            .SetParent<ErrorRateModel>()
-                            .SetGroupName("Wifi")
-                            .AddConstructor<NistErrorRateModel>();
+    static TypeId tid =
+        TypeId("ns3::NistErrorRateModel")
+            .SetParent<ErrorRateModel>()
+            .SetGroupName("Wifi")
+            .AddConstructor<NistErrorRateModel>()
+            .AddAttribute("LookupTableEnabled",
+                          "Whether the coded BER is interpolated from lookup tables shared by all "
+                          "the models, rather than computed for each chunk",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&NistErrorRateModel::m_lookupTableEnabled),
+                          MakeBooleanChecker());
     return tid;
 }
 
 NistErrorRateModel::NistErrorRateModel()
+    : m_lookupTableEnabled(false)
 {
 }
 
@@ -180,6 +190,55 @@ NistErrorRateModel::GetFecQamBer(uint16_t constellationSize,
     return pms;
 }
 
+double
+NistErrorRateModel::GetCodedBer(uint16_t constellationSize, double snr, uint8_t bValue) const
+{
+    NS_LOG_FUNCTION(this << constellationSize << snr << +bValue);
+    double ber;
+    if (constellationSize == 2)
+    {
+        ber = GetBpskBer(snr);
+    }
+    else if (constellationSize == 4)
+    {
+        ber = GetQpskBer(snr);
+    }
+    else
+    {
+        ber = GetQamBer(constellationSize, snr);
+    }
+    if (ber == 0.0)
+    {
+        return 0.0;
+    }
+    return CalculatePe(ber, bValue);
+}
+
+double
+NistErrorRateModel::GetLookupTableSuccessRate(WifiMode mode, double snr, uint64_t nbits) const
+{
+    NS_LOG_FUNCTION(this << mode << snr << nbits);
+    // the modes are only queried once, as the queries cost more than the interpolation
+    auto it = m_lookupTables.find(mode.GetUid());
+    if (it == m_lookupTables.end())
+    {
+        uint16_t constellationSize = mode.GetConstellationSize();
+        uint8_t bValue = GetBValue(mode.GetCodeRate());
+        LookupTable lookupTable;
+        lookupTable.function = [this, constellationSize, bValue](double snr) {
+            return GetCodedBer(constellationSize, snr, bValue);
+        };
+        // the modes with the same modulation and coding rate share a table
+        lookupTable.table = &ErrorRateLookupTable::GetShared(
+            "Nist/" + std::to_string(constellationSize) + "/" + std::to_string(bValue),
+            lookupTable.function);
+        it = m_lookupTables.emplace(mode.GetUid(), lookupTable).first;
+    }
+    // the coded BER is clamped after the interpolation, as its knee at 1 is not smooth
+    double pe = std::min(it->second.table->GetValue(snr, it->second.function), 1.0);
+    return std::pow(1 - pe, nbits);
+}
+
 uint8_t
 NistErrorRateModel::GetBValue(WifiCodeRate codeRate) const
 {
@@ -213,6 +272,10 @@ NistErrorRateModel::DoGetChunkSuccessRate(WifiMode mode,
     NS_LOG_FUNCTION(this << mode << snr << nbits << +numRxAntennas << field << staId);
     if (mode.GetModulationClass() >= WIFI_MOD_CLASS_ERP_OFDM)
     {
+        if (m_lookupTableEnabled)
+        {
+            return GetLookupTableSuccessRate(mode, snr, nbits);
+        }
         if (mode.GetConstellationSize() == 2)
         {
             return GetFecBpskBer(snr, nbits, GetBValue(mode.GetCodeRate()));
@@ -20,9 +20,12 @@
 #ifndef NIST_ERROR_RATE_MODEL_H
 #define NIST_ERROR_RATE_MODEL_H
 
+#include "error-rate-lookup-table.h"
 #include "error-rate-model.h"
 #include "wifi-mode.h"
 
+#include <map>
+
 namespace ns3
 {
 
@@ -33,6 +36,10 @@ namespace ns3
  * the model description and validation can be found in
  * http://www.nsnam.org/~pei/80211ofdm.pdf.  For DSSS modulations (802.11b),
  * the model uses the DsssErrorRateModel.
+ *
+ * When the LookupTableEnabled attribute is set, the coded BER is interpolated
+ * from an ErrorRateLookupTable per constellation size and coding rate, shared
+ * by all the models, instead of being computed for each chunk.
  */
 class NistErrorRateModel : public ErrorRateModel
 {
@@ -128,6 +135,37 @@ class NistErrorRateModel : public ErrorRateModel
                         double snr,
                         uint64_t nbits,
                         uint8_t bValue) const;
+    /**
+     * Return the coded BER of a constellation size at the given SNR.
+     *
+     * \param constellationSize the constellation size (M)
+     * \param snr SNR ratio (in linear scale)
+     * \param bValue the bValue such that coding rate = bValue / (bValue + 1)
+     *
+     * \return the coded BER, which may be larger than 1
+     */
+    double GetCodedBer(uint16_t constellationSize, double snr, uint8_t bValue) const;
+    /**
+     * Return the success rate of a chunk, with the coded BER interpolated from a lookup table.
+     *
+     * \param mode the OFDM mode of the chunk
+     * \param snr SNR ratio (in linear scale)
+     * \param nbits the number of bits in the chunk
+     *
+     * \return the success rate of the chunk
+     */
+    double GetLookupTableSuccessRate(WifiMode mode, double snr, uint64_t nbits) const;
+
+    /// A lookup table of the coded BER, and the function computing it outside the table
+    struct LookupTable
+    {
+        const ErrorRateLookupTable* table;       //!< the table shared by all the models
+        ErrorRateLookupTable::Function function; //!< the coded BER computed by this model
+    };
+
+    bool m_lookupTableEnabled; //!< whether the coded BER is interpolated from lookup tables
+    /// The lookup tables used by this model, indexed by mode UID
+    mutable std::map<uint32_t, LookupTable> m_lookupTables;
 };
 
 } // namespace ns3
@@ -23,9 +23,11 @@
 #include "wifi-tx-vector.h"
 #include "wifi-utils.h"
 
+#include "ns3/boolean.h"
 #include "ns3/log.h"
 
 #include <cmath>
+#include <string>
 
 namespace ns3
 {
@@ -37,14 +39,22 @@ NS_OBJECT_ENSURE_REGISTERED(YansErrorRateModel);
 TypeId
 YansErrorRateModel::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::YansErrorRateModel")
-                            .SetParent<ErrorRateModel>()
-                            .SetGroupName("Wifi")
-                            .AddConstructor<YansErrorRateModel>();
+    static TypeId tid =
+        TypeId("ns3::YansErrorRateModel")
+            .SetParent<ErrorRateModel>()
+            .SetGroupName("Wifi")
+            .AddConstructor<YansErrorRateModel>()
+            .AddAttribute("LookupTableEnabled",
+                          "Whether the coded BER is interpolated from lookup tables shared by all "
+                          "the models, rather than computed for each chunk",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&YansErrorRateModel::m_lookupTableEnabled),
+                          MakeBooleanChecker());
     return tid;
 }
 
 YansErrorRateModel::YansErrorRateModel()
+    : m_lookupTableEnabled(false)
 {
 }
 
@@ -193,6 +203,75 @@ YansErrorRateModel::GetFecQamBer(double snr,
     return pms;
 }
 
+double
+YansErrorRateModel::GetCodedBer(double ebNo,
+                                uint32_t m,
+                                uint32_t dFree,
+                                uint32_t adFree,
+                                uint32_t adFreePlusOne) const
+{
+    NS_LOG_FUNCTION(this << ebNo << m << dFree << adFree << adFreePlusOne);
+    // a signal spread equal to the PHY rate makes the SNR the Eb/No
+    double ber = (m == 2) ? GetBpskBer(ebNo, 1, 1) : GetQamBer(ebNo, m, 1, 1);
+    if (ber == 0.0)
+    {
+        return 0.0;
+    }
+    double pmu = adFree * CalculatePd(ber, dFree);
+    if (m != 2)
+    {
+        pmu += adFreePlusOne * CalculatePd(ber, dFree + 1);
+    }
+    return pmu;
+}
+
+YansErrorRateModel::FecCode
+YansErrorRateModel::GetFecCode(WifiMode mode)
+{
+    uint32_t m = mode.GetConstellationSize();
+    WifiCodeRate codeRate = mode.GetCodeRate();
+    if (codeRate == WIFI_CODE_RATE_1_2 && m <= 16)
+    {
+        return {10, 11, 0};
+    }
+    if (codeRate == WIFI_CODE_RATE_2_3 && m == 64)
+    {
+        return {6, 1, 16};
+    }
+    if (codeRate == WIFI_CODE_RATE_5_6 && m >= 64)
+    {
+        // Table B.32  in Pâl Frenger et al., "Multi-rate Convolutional Codes".
+        return {4, 14, 69};
+    }
+    return {5, 8, (m == 2) ? 0U : 31U};
+}
+
+double
+YansErrorRateModel::GetLookupTableSuccessRate(WifiMode mode, double ebNo, uint64_t nbits) const
+{
+    NS_LOG_FUNCTION(this << mode << ebNo << nbits);
+    // the modes are only queried once, as the queries cost more than the interpolation
+    auto it = m_lookupTables.find(mode.GetUid());
+    if (it == m_lookupTables.end())
+    {
+        uint32_t m = mode.GetConstellationSize();
+        FecCode code = GetFecCode(mode);
+        LookupTable lookupTable;
+        lookupTable.function = [this, m, code](double ebNo) {
+            return GetCodedBer(ebNo, m, code.dFree, code.adFree, code.adFreePlusOne);
+        };
+        // the modes with the same modulation and code share a table
+        lookupTable.table = &ErrorRateLookupTable::GetShared(
+            "Yans/" + std::to_string(m) + "/" + std::to_string(code.dFree) + "/" +
+                std::to_string(code.adFree) + "/" + std::to_string(code.adFreePlusOne),
+            lookupTable.function);
+        it = m_lookupTables.emplace(mode.GetUid(), lookupTable).first;
+    }
+    // the coded BER is clamped after the interpolation, as its knee at 1 is not smooth
+    double pmu = std::min(it->second.table->GetValue(ebNo, it->second.function), 1.0);
+    return std::pow(1 - pmu, nbits);
+}
+
 double
 YansErrorRateModel::DoGetChunkSuccessRate(WifiMode mode,
                                           const WifiTxVector& txVector,
@@ -216,195 +295,30 @@ YansErrorRateModel::DoGetChunkSuccessRate(WifiMode mode,
         {
             phyRate = mode.GetPhyRate(txVector, staId);
         }
-        if (mode.GetConstellationSize() == 2)
-        {
-            if (mode.GetCodeRate() == WIFI_CODE_RATE_1_2)
-            {
-                return GetFecBpskBer(snr,
-                                     nbits,
-                                     txVector.GetChannelWidth() * 1000000, // signal spread
-                                     phyRate,                              // PHY rate
-                                     10,                                   // dFree
-                                     11);                                  // adFree
-            }
-            else
-            {
-                return GetFecBpskBer(snr,
-                                     nbits,
-                                     txVector.GetChannelWidth() * 1000000, // signal spread
-                                     phyRate,                              // PHY rate
-                                     5,                                    // dFree
-                                     8);                                   // adFree
-            }
-        }
-        else if (mode.GetConstellationSize() == 4)
-        {
-            if (mode.GetCodeRate() == WIFI_CODE_RATE_1_2)
-            {
-                return GetFecQamBer(snr,
-                                    nbits,
-                                    txVector.GetChannelWidth() * 1000000, // signal spread
-                                    phyRate,                              // PHY rate
-                                    4,                                    // m
-                                    10,                                   // dFree
-                                    11,                                   // adFree
-                                    0);                                   // adFreePlusOne
-            }
-            else
-            {
-                return GetFecQamBer(snr,
-                                    nbits,
-                                    txVector.GetChannelWidth() * 1000000, // signal spread
-                                    phyRate,                              // PHY rate
-                                    4,                                    // m
-                                    5,                                    // dFree
-                                    8,                                    // adFree
-                                    31);                                  // adFreePlusOne
-            }
-        }
-        else if (mode.GetConstellationSize() == 16)
-        {
-            if (mode.GetCodeRate() == WIFI_CODE_RATE_1_2)
-            {
-                return GetFecQamBer(snr,
-                                    nbits,
-                                    txVector.GetChannelWidth() * 1000000, // signal spread
-                                    phyRate,                              // PHY rate
-                                    16,                                   // m
-                                    10,                                   // dFree
-                                    11,                                   // adFree
-                                    0);                                   // adFreePlusOne
-            }
-            else
-            {
-                return GetFecQamBer(snr,
-                                    nbits,
-                                    txVector.GetChannelWidth() * 1000000, // signal spread
-                                    phyRate,                              // PHY rate
-                                    16,                                   // m
-                                    5,                                    // dFree
-                                    8,                                    // adFree
-                                    31);                                  // adFreePlusOne
-            }
-        }
-        else if (mode.GetConstellationSize() == 64)
-        {
-            if (mode.GetCodeRate() == WIFI_CODE_RATE_2_3)
-            {
-                return GetFecQamBer(snr,
-                                    nbits,
-                                    txVector.GetChannelWidth() * 1000000, // signal spread
-                                    phyRate,                              // PHY rate
-                                    64,                                   // m
-                                    6,                                    // dFree
-                                    1,                                    // adFree
-                                    16);                                  // adFreePlusOne
-            }
-            if (mode.GetCodeRate() == WIFI_CODE_RATE_5_6)
-            {
-                // Table B.32  in Pâl Frenger et al., "Multi-rate Convolutional Codes".
-                return GetFecQamBer(snr,
-                                    nbits,
-                                    txVector.GetChannelWidth() * 1000000, // signal spread
-                                    phyRate,                              // PHY rate
-                                    64,                                   // m
-                                    4,                                    // dFree
-                                    14,                                   // adFree
-                                    69);                                  // adFreePlusOne
-            }
-            else
-            {
-                return GetFecQamBer(snr,
-                                    nbits,
-                                    txVector.GetChannelWidth() * 1000000, // signal spread
-                                    phyRate,                              // PHY rate
-                                    64,                                   // m
-                                    5,                                    // dFree
-                                    8,                                    // adFree
-                                    31);                                  // adFreePlusOne
-            }
-        }
-        else if (mode.GetConstellationSize() == 256)
-        {
-            if (mode.GetCodeRate() == WIFI_CODE_RATE_5_6)
-            {
-                return GetFecQamBer(snr,
-                                    nbits,
-                                    txVector.GetChannelWidth() * 1000000, // signal spread
-                                    phyRate,                              // PHY rate
-                                    256,                                  // m
-                                    4,                                    // dFree
-                                    14,                                   // adFree
-                                    69                                    // adFreePlusOne
-                );
-            }
-            else
-            {
-                return GetFecQamBer(snr,
-                                    nbits,
-                                    txVector.GetChannelWidth() * 1000000, // signal spread
-                                    phyRate,                              // PHY rate
-                                    256,                                  // m
-                                    5,                                    // dFree
-                                    8,                                    // adFree
-                                    31                                    // adFreePlusOne
-                );
-            }
-        }
-        else if (mode.GetConstellationSize() == 1024)
+        if (m_lookupTableEnabled)
         {
-            if (mode.GetCodeRate() == WIFI_CODE_RATE_5_6)
-            {
-                return GetFecQamBer(snr,
-                                    nbits,
-                                    txVector.GetChannelWidth() * 1000000, // signal spread
-                                    phyRate,                              // PHY rate
-                                    1024,                                 // m
-                                    4,                                    // dFree
-                                    14,                                   // adFree
-                                    69                                    // adFreePlusOne
-                );
-            }
-            else
-            {
-                return GetFecQamBer(snr,
-                                    nbits,
-                                    txVector.GetChannelWidth() * 1000000, // signal spread
-                                    phyRate,                              // PHY rate
-                                    1024,                                 // m
-                                    5,                                    // dFree
-                                    8,                                    // adFree
-                                    31                                    // adFreePlusOne
-                );
-            }
+            uint32_t signalSpread = txVector.GetChannelWidth() * 1000000;
+            return GetLookupTableSuccessRate(mode, snr * signalSpread / phyRate, nbits);
         }
-        else if (mode.GetConstellationSize() == 4096)
+        uint32_t m = mode.GetConstellationSize();
+        FecCode code = GetFecCode(mode);
+        if (m == 2)
         {
-            if (mode.GetCodeRate() == WIFI_CODE_RATE_5_6)
-            {
-                return GetFecQamBer(snr,
-                                    nbits,
-                                    txVector.GetChannelWidth() * 1000000, // signal spread
-                                    phyRate,                              // PHY rate
-                                    4096,                                 // m
-                                    4,                                    // dFree
-                                    14,                                   // adFree
-                                    69                                    // adFreePlusOne
-                );
-            }
-            else
-            {
-                return GetFecQamBer(snr,
-                                    nbits,
-                                    txVector.GetChannelWidth() * 1000000, // signal spread
-                                    phyRate,                              // PHY rate
-                                    4096,                                 // m
-                                    5,                                    // dFree
-                                    8,                                    // adFree
-                                    31                                    // adFreePlusOne
-                );
-            }
+            return GetFecBpskBer(snr,
+                                 nbits,
+                                 txVector.GetChannelWidth() * 1000000, // signal spread
+                                 phyRate,                              // PHY rate
+                                 code.dFree,
+                                 code.adFree);
         }
+        return GetFecQamBer(snr,
+                            nbits,
+                            txVector.GetChannelWidth() * 1000000, // signal spread
+                            phyRate,                              // PHY rate
+                            m,
+                            code.dFree,
+                            code.adFree,
+                            code.adFreePlusOne);
     }
     return 0;
 }
@@ -20,8 +20,11 @@
 #ifndef YANS_ERROR_RATE_MODEL_H
 #define YANS_ERROR_RATE_MODEL_H
 
+#include "error-rate-lookup-table.h"
 #include "error-rate-model.h"
 
+#include <map>
+
 namespace ns3
 {
 
@@ -49,6 +52,10 @@ namespace ns3
  *      57(2):440-449, February 2009.
  *    - More detailed description and validation can be found in
  *      http://www.nsnam.org/~pei/80211b.pdf
+ *
+ * When the LookupTableEnabled attribute is set, the coded BER is interpolated
+ * from an ErrorRateLookupTable of the Eb/No per modulation and code, shared
+ * by all the models, instead of being computed for each chunk.
  */
 class YansErrorRateModel : public ErrorRateModel
 {
@@ -165,6 +172,55 @@ class YansErrorRateModel : public ErrorRateModel
                         uint32_t dfree,
                         uint32_t adFree,
                         uint32_t adFreePlusOne) const;
+    /**
+     * \param ebNo Eb/No ratio (not dB)
+     * \param m the constellation size, 2 for BPSK
+     * \param dFree
+     * \param adFree
+     * \param adFreePlusOne
+     *
+     * \return the coded BER, which may be larger than 1
+     */
+    double GetCodedBer(double ebNo,
+                       uint32_t m,
+                       uint32_t dFree,
+                       uint32_t adFree,
+                       uint32_t adFreePlusOne) const;
+
+    /// The distance spectrum of a convolutional code
+    struct FecCode
+    {
+        uint32_t dFree;         //!< the free distance of the code
+        uint32_t adFree;        //!< the number of paths at the free distance
+        uint32_t adFreePlusOne; //!< the number of paths at the free distance plus one
+    };
+
+    /**
+     * \param mode an OFDM mode
+     * \return the convolutional code of the mode
+     */
+    static FecCode GetFecCode(WifiMode mode);
+    /**
+     * Return the success rate of a chunk, with the coded BER interpolated from a lookup table.
+     *
+     * \param mode the OFDM mode of the chunk
+     * \param ebNo Eb/No ratio (not dB)
+     * \param nbits the number of bits in the chunk
+     *
+     * \return the success rate of the chunk
+     */
+    double GetLookupTableSuccessRate(WifiMode mode, double ebNo, uint64_t nbits) const;
+
+    /// A lookup table of the coded BER, and the function computing it outside the table
+    struct LookupTable
+    {
+        const ErrorRateLookupTable* table;       //!< the table shared by all the models
+        ErrorRateLookupTable::Function function; //!< the coded BER computed by this model
+    };
+
+    bool m_lookupTableEnabled; //!< whether the coded BER is interpolated from lookup tables
+    /// The lookup tables used by this model, indexed by mode UID
+    mutable std::map<uint32_t, LookupTable> m_lookupTables;
 };
 
 } // namespace ns3
@@ -25,6 +25,7 @@
 #include "wifi-utils.h"
 #include "yans-wifi-phy.h"
 
+#include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/mobility-model.h"
 #include "ns3/node.h"
@@ -33,6 +34,8 @@
 #include "ns3/propagation-loss-model.h"
 #include "ns3/simulator.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -57,11 +60,21 @@ YansWifiChannel::GetTypeId()
                           "A pointer to the propagation delay model attached to this channel.",
                           PointerValue(),
                           MakePointerAccessor(&YansWifiChannel::m_delay),
-                          MakePointerChecker<PropagationDelayModel>());
+                          MakePointerChecker<PropagationDelayModel>())
+            .AddAttribute("MaxRange",
+                          "If positive, the PHYs farther than this distance (m) from the sender "
+                          "are ignored, without computing the propagation loss. It must be "
+                          "larger than the distance beyond which the received power is always "
+                          "below the sensitivity of the receivers.",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&YansWifiChannel::m_maxRange),
+                          MakeDoubleChecker<double>(0));
     return tid;
 }
 
 YansWifiChannel::YansWifiChannel()
+    : m_maxRange(0),
+      m_indexRange(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -72,6 +85,16 @@ YansWifiChannel::~YansWifiChannel()
     m_phyList.clear();
 }
 
+void
+YansWifiChannel::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_index.Clear();
+    m_unindexed.clear();
+    m_phyList.clear();
+    Channel::DoDispose();
+}
+
 void
 YansWifiChannel::SetPropagationLossModel(const Ptr<PropagationLossModel> loss)
 {
@@ -92,41 +115,96 @@ YansWifiChannel::Send(Ptr<YansWifiPhy> sender, Ptr<const WifiPpdu> ppdu, double
     NS_LOG_FUNCTION(this << sender << ppdu << txPowerDbm);
     Ptr<MobilityModel> senderMobility = sender->GetMobility();
     NS_ASSERT(senderMobility);
-    for (auto i = m_phyList.begin(); i != m_phyList.end(); i++)
+    if (m_maxRange > 0)
+    {
+        UpdateIndex();
+        std::vector<std::size_t> receivers;
+        m_index.GetItemsInRange(senderMobility->GetPosition(), m_maxRange, receivers);
+        for (std::size_t i : receivers)
+        {
+            SendTo(sender, m_phyList[i], ppdu, txPowerDbm);
+        }
+        return;
+    }
+    for (const auto& receiver : m_phyList)
+    {
+        SendTo(sender, receiver, ppdu, txPowerDbm);
+    }
+}
+
+void
+YansWifiChannel::SendTo(Ptr<YansWifiPhy> sender,
+                        Ptr<YansWifiPhy> receiver,
+                        Ptr<const WifiPpdu> ppdu,
+                        double txPowerDbm) const
+{
+    if (sender == receiver)
+    {
+        return;
+    }
+    // For now don't account for inter channel interference nor channel bonding
+    if (receiver->GetChannelNumber() != sender->GetChannelNumber())
+    {
+        return;
+    }
+
+    Ptr<MobilityModel> senderMobility = sender->GetMobility();
+    Ptr<MobilityModel> receiverMobility = receiver->GetMobility()->GetObject<MobilityModel>();
+    Time delay = m_delay->GetDelay(senderMobility, receiverMobility);
+    double rxPowerDbm = m_loss->CalcRxPower(txPowerDbm, senderMobility, receiverMobility);
+    NS_LOG_DEBUG("propagation: txPower="
+                 << txPowerDbm << "dbm, rxPower=" << rxPowerDbm << "dbm, "
+                 << "distance=" << senderMobility->GetDistanceFrom(receiverMobility)
+                 << "m, delay=" << delay);
+    Ptr<NetDevice> dstNetDevice = receiver->GetDevice();
+    uint32_t dstNode;
+    if (!dstNetDevice)
+    {
+        dstNode = 0xffffffff;
+    }
+    else
+    {
+        dstNode = dstNetDevice->GetNode()->GetId();
+    }
+
+    Simulator::ScheduleWithContext(dstNode,
+                                   delay,
+                                   &YansWifiChannel::Receive,
+                                   receiver,
+                                   ppdu,
+                                   rxPowerDbm);
+}
+
+void
+YansWifiChannel::UpdateIndex() const
+{
+    // the mobility model of a PHY may be set after it is added to the
+    // channel, so the PHYs are indexed when a PPDU is sent, and those
+    // without mobility model yet, which are returned by all the queries,
+    // are indexed again once they have one.
+    bool rebuild = m_indexRange != m_maxRange ||
+                   std::any_of(m_unindexed.begin(), m_unindexed.end(), [this](std::size_t i) {
+                       return m_phyList[i]->GetMobility() != nullptr;
+                   });
+    if (!rebuild && m_index.GetN() == m_phyList.size())
+    {
+        return;
+    }
+    NS_LOG_FUNCTION(this);
+    if (rebuild)
+    {
+        m_index.Clear(m_maxRange);
+        m_unindexed.clear();
+        m_indexRange = m_maxRange;
+    }
+    for (std::size_t i = m_index.GetN(); i < m_phyList.size(); i++)
     {
-        if (sender != (*i))
+        Ptr<MobilityModel> mobility = m_phyList[i]->GetMobility();
+        if (!mobility)
         {
-            // For now don't account for inter channel interference nor channel bonding
-            if ((*i)->GetChannelNumber() != sender->GetChannelNumber())
-            {
-                continue;
-            }
-
-            Ptr<MobilityModel> receiverMobility = (*i)->GetMobility()->GetObject<MobilityModel>();
-            Time delay = m_delay->GetDelay(senderMobility, receiverMobility);
-            double rxPowerDbm = m_loss->CalcRxPower(txPowerDbm, senderMobility, receiverMobility);
-            NS_LOG_DEBUG("propagation: txPower="
-                         << txPowerDbm << "dbm, rxPower=" << rxPowerDbm << "dbm, "
-                         << "distance=" << senderMobility->GetDistanceFrom(receiverMobility)
-                         << "m, delay=" << delay);
-            Ptr<NetDevice> dstNetDevice = (*i)->GetDevice();
-            uint32_t dstNode;
-            if (!dstNetDevice)
-            {
-                dstNode = 0xffffffff;
-            }
-            else
-            {
-                dstNode = dstNetDevice->GetNode()->GetId();
-            }
-
-            Simulator::ScheduleWithContext(dstNode,
-                                           delay,
-                                           &YansWifiChannel::Receive,
-                                           (*i),
-                                           ppdu,
-                                           rxPowerDbm);
+            m_unindexed.push_back(i);
         }
+        m_index.Add(i, mobility);
     }
 }
 
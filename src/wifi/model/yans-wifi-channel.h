@@ -21,6 +21,9 @@
 #define YANS_WIFI_CHANNEL_H
 
 #include "ns3/channel.h"
+#include "ns3/spatial-index.h"
+
+#include <vector>
 
 namespace ns3
 {
@@ -41,6 +44,14 @@ class WifiPpdu;
  * class and supports an ns3::PropagationLossModel and an
  * ns3::PropagationDelayModel.  By default, no propagation models are set;
  * it is the caller's responsibility to set them before using the channel.
+ *
+ * By default, a PPDU is delivered to all the other PHYs of the channel,
+ * which each compute the propagation loss.  When the MaxRange attribute
+ * is set, the PHYs are kept in a SpatialIndex of their positions, and
+ * only the PHYs within MaxRange of the sender are considered.  MaxRange
+ * must then be larger than the distance beyond which the received power
+ * is always below the sensitivity of the receivers; note that fewer
+ * random variates are drawn by a random propagation loss model.
  */
 class YansWifiChannel : public Channel
 {
@@ -96,6 +107,9 @@ class YansWifiChannel : public Channel
      */
     int64_t AssignStreams(int64_t stream);
 
+  protected:
+    void DoDispose() override;
+
   private:
     /**
      * A vector of pointers to YansWifiPhy.
@@ -113,9 +127,34 @@ class YansWifiChannel : public Channel
      */
     static void Receive(Ptr<YansWifiPhy> receiver, Ptr<const WifiPpdu> ppdu, double txPowerDbm);
 
+    /**
+     * Schedule the reception of a PPDU by a PHY, unless the PHY is the sender
+     * or is tuned to another channel.
+     *
+     * \param sender the PHY object from which the packet is originating
+     * \param receiver the PHY which may receive the PPDU
+     * \param ppdu the PPDU being sent
+     * \param txPowerDbm the TX power associated to the packet being sent (dBm)
+     */
+    void SendTo(Ptr<YansWifiPhy> sender,
+                Ptr<YansWifiPhy> receiver,
+                Ptr<const WifiPpdu> ppdu,
+                double txPowerDbm) const;
+
+    /**
+     * Add the PHYs added since the spatial index was built, or rebuild it
+     * if MaxRange was changed or a PHY without mobility model got one.
+     */
+    void UpdateIndex() const;
+
     PhyList m_phyList;                  //!< List of YansWifiPhys connected to this YansWifiChannel
     Ptr<PropagationLossModel> m_loss;   //!< Propagation loss model
     Ptr<PropagationDelayModel> m_delay; //!< Propagation delay model
+    double m_maxRange;                  //!< Range beyond which PHYs are ignored (m), or 0
+    mutable SpatialIndex m_index;       //!< Positions of the PHYs, indexed in m_phyList
+    mutable double m_indexRange;        //!< The MaxRange with which m_index was built
+    /// The PHYs which had no mobility model when they were indexed
+    mutable std::vector<std::size_t> m_unindexed;
 };
 
 } // namespace ns3
@@ -25,11 +25,13 @@
 #include <gsl/gsl_sf_bessel.h>
 #endif
 
+#include "ns3/boolean.h"
 #include "ns3/dsss-error-rate-model.h"
 #include "ns3/he-phy.h" //includes HT and VHT
 #include "ns3/interference-helper.h"
 #include "ns3/log.h"
 #include "ns3/nist-error-rate-model.h"
+#include "ns3/object-factory.h"
 #include "ns3/table-based-error-rate-model.h"
 #include "ns3/test.h"
 #include "ns3/wifi-phy.h"
@@ -1039,6 +1041,83 @@ TableBasedErrorRateTestCase::DoRun()
     }
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Wifi Error Rate Lookup Table Test Case
+ *
+ * Compare the success rates of an error rate model using lookup tables with
+ * the ones it computes without them, for all the OFDM modulations and codes,
+ * several chunk sizes and SNRs between the points of the tables.
+ */
+class ErrorRateLookupTableTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param model the TypeId name of the error rate model to test
+     */
+    ErrorRateLookupTableTestCase(const std::string& model);
+
+  private:
+    void DoRun() override;
+
+    std::string m_model; ///< The TypeId name of the error rate model to test
+};
+
+ErrorRateLookupTableTestCase::ErrorRateLookupTableTestCase(const std::string& model)
+    : TestCase("Lookup tables of " + model),
+      m_model(model)
+{
+}
+
+void
+ErrorRateLookupTableTestCase::DoRun()
+{
+    ObjectFactory factory(m_model);
+    auto analytic = factory.Create<ErrorRateModel>();
+    factory.Set("LookupTableEnabled", BooleanValue(true));
+    auto interpolated = factory.Create<ErrorRateModel>();
+
+    std::vector<WifiTxVector> txVectors;
+    // the BPSK 3/4 code is only used by non-HT modes
+    txVectors.emplace_back(OfdmPhy::GetOfdmRate9Mbps(), 0, WIFI_PREAMBLE_LONG, 800, 1, 1, 0, 20, false);
+    for (uint8_t mcs = 0; mcs <= 11; mcs++)
+    {
+        txVectors.emplace_back(HePhy::GetHeMcs(mcs),
+                               0,
+                               WIFI_PREAMBLE_HE_SU,
+                               800,
+                               1,
+                               1,
+                               0,
+                               20,
+                               false);
+    }
+
+    for (const auto& txVector : txVectors)
+    {
+        // the SNR steps do not fall on the points of the tables, which extend from -10 to 60 dB
+        for (double snrDb = -12; snrDb <= 62; snrDb += 0.0537)
+        {
+            double snr = std::pow(10, snrDb / 10);
+            for (uint64_t nbits : {1, 8 * 32, 8 * 1500, 8 * 65535})
+            {
+                double expected =
+                    analytic->GetChunkSuccessRate(txVector.GetMode(), txVector, snr, nbits);
+                double actual =
+                    interpolated->GetChunkSuccessRate(txVector.GetMode(), txVector, snr, nbits);
+                NS_TEST_ASSERT_MSG_EQ_TOL(actual,
+                                          expected,
+                                          1e-5,
+                                          txVector.GetMode() << " at " << snrDb << " dB");
+            }
+        }
+    }
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -1106,6 +1185,8 @@ WifiErrorRateModelsTestSuite::WifiErrorRateModelsTestSuite()
                                                 HePhy::GetHeMcs11(),
                                                 1458),
                 TestCase::QUICK);
+    AddTestCase(new ErrorRateLookupTableTestCase("ns3::NistErrorRateModel"), TestCase::QUICK);
+    AddTestCase(new ErrorRateLookupTableTestCase("ns3::YansErrorRateModel"), TestCase::QUICK);
 }
 
 static WifiErrorRateModelsTestSuite wifiErrorRateModelsTestSuite; ///< the test suite
@@ -24,6 +24,7 @@
 #include "ns3/ap-wifi-mac.h"
 #include "ns3/config.h"
 #include "ns3/constant-position-mobility-model.h"
+#include "ns3/double.h"
 #include "ns3/error-model.h"
 #include "ns3/fcfs-wifi-queue-scheduler.h"
 #include "ns3/frame-exchange-manager.h"
@@ -33,6 +34,8 @@
 #include "ns3/mgt-headers.h"
 #include "ns3/mobility-helper.h"
 #include "ns3/multi-model-spectrum-channel.h"
+#include "ns3/nist-error-rate-model.h"
+#include "ns3/ofdm-phy.h"
 #include "ns3/packet-socket-client.h"
 #include "ns3/packet-socket-helper.h"
 #include "ns3/packet-socket-server.h"
@@ -53,6 +56,7 @@
 #include "ns3/wifi-ppdu.h"
 #include "ns3/wifi-psdu.h"
 #include "ns3/wifi-spectrum-signal-parameters.h"
+#include "ns3/wifi-spectrum-value-helper.h"
 #include "ns3/yans-error-rate-model.h"
 #include "ns3/yans-wifi-helper.h"
 #include "ns3/yans-wifi-phy.h"
@@ -3778,6 +3782,326 @@ WifiMgtHeaderTest::DoRun()
     TestHeaderSerialization(frame);
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Check that the PHYs beyond the MaxRange of a YansWifiChannel
+ * receive nothing, and that those within range receive the same signals
+ * as without MaxRange.  Two PHYs are added after the first transmission,
+ * on another channel and without mobility model, and get one before the
+ * last transmission, on the channel of the sender.
+ */
+class YansWifiChannelRangeTest : public TestCase
+{
+  public:
+    YansWifiChannelRangeTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Run the scenario.
+     * \param maxRange the MaxRange of the channel, in meters
+     */
+    void RunOne(double maxRange);
+
+    /**
+     * Create a PHY on the channel.
+     * \param channelNumber the number of the operating channel of the PHY
+     */
+    void CreatePhy(uint8_t channelNumber);
+
+    /**
+     * Set the position of a PHY, and tune it to the channel of the sender.
+     * \param index the index of the PHY
+     * \param position the position of the PHY
+     */
+    void Place(std::size_t index, Vector position);
+
+    /**
+     * Transmit a PSDU from the first PHY.
+     */
+    void Transmit();
+
+    /**
+     * Callback invoked when a PHY starts receiving a PPDU.
+     * \param index the index of the PHY
+     * \param packet the packet being received
+     * \param rxPowersW the receive power per channel band in Watts
+     */
+    void RxBegin(std::size_t index, Ptr<const Packet> packet, RxPowerWattPerChannelBand rxPowersW);
+
+    Ptr<YansWifiChannel> m_channel;       ///< the channel
+    std::vector<Ptr<YansWifiPhy>> m_phys; ///< the PHYs
+    /// The powers received by each PHY, in Watts, in the order of reception
+    std::vector<std::vector<double>> m_rxPowersW;
+};
+
+YansWifiChannelRangeTest::YansWifiChannelRangeTest()
+    : TestCase("Check the MaxRange cutoff of YansWifiChannel")
+{
+}
+
+void
+YansWifiChannelRangeTest::CreatePhy(uint8_t channelNumber)
+{
+    auto phy = CreateObject<YansWifiPhy>();
+    phy->SetInterferenceHelper(CreateObject<InterferenceHelper>());
+    phy->SetErrorRateModel(CreateObject<NistErrorRateModel>());
+    phy->SetChannel(m_channel);
+    phy->ConfigureStandard(WIFI_STANDARD_80211a);
+    phy->SetOperatingChannel(WifiPhy::ChannelTuple{channelNumber, 20, WIFI_PHY_BAND_5GHZ, 0});
+    phy->SetTxPowerStart(30);
+    phy->SetTxPowerEnd(30);
+    phy->TraceConnectWithoutContext(
+        "PhyRxBegin",
+        MakeCallback(&YansWifiChannelRangeTest::RxBegin, this).Bind(m_phys.size()));
+    m_phys.push_back(phy);
+    m_rxPowersW.emplace_back();
+}
+
+void
+YansWifiChannelRangeTest::Place(std::size_t index, Vector position)
+{
+    auto mobility = CreateObject<ConstantPositionMobilityModel>();
+    mobility->SetPosition(position);
+    m_phys[index]->SetMobility(mobility);
+    m_phys[index]->SetOperatingChannel(WifiPhy::ChannelTuple{36, 20, WIFI_PHY_BAND_5GHZ, 0});
+}
+
+void
+YansWifiChannelRangeTest::Transmit()
+{
+    WifiMacHeader hdr;
+    hdr.SetType(WIFI_MAC_DATA);
+    hdr.SetAddr1(Mac48Address::GetBroadcast());
+    auto psdu = Create<WifiPsdu>(Create<Packet>(100), hdr);
+    WifiTxVector txVector(OfdmPhy::GetOfdmRate6Mbps(), 0, WIFI_PREAMBLE_LONG, 800, 1, 1, 0, 20, false);
+    m_phys[0]->Send(psdu, txVector);
+}
+
+void
+YansWifiChannelRangeTest::RxBegin(std::size_t index,
+                                  Ptr<const Packet> packet,
+                                  RxPowerWattPerChannelBand rxPowersW)
+{
+    m_rxPowersW[index].push_back(rxPowersW.begin()->second);
+}
+
+void
+YansWifiChannelRangeTest::RunOne(double maxRange)
+{
+    m_channel = CreateObject<YansWifiChannel>();
+    m_channel->SetAttribute("MaxRange", DoubleValue(maxRange));
+    m_channel->SetPropagationDelayModel(CreateObject<ConstantSpeedPropagationDelayModel>());
+    m_channel->SetPropagationLossModel(CreateObject<FriisPropagationLossModel>());
+    m_phys.clear();
+    m_rxPowersW.clear();
+
+    for (double x : {0.0, 10.0, 300.0, 800.0})
+    {
+        CreatePhy(36);
+        Place(m_phys.size() - 1, Vector(x, 0, 0));
+    }
+
+    Simulator::Schedule(Seconds(1), &YansWifiChannelRangeTest::Transmit, this);
+    Simulator::Schedule(Seconds(2), &YansWifiChannelRangeTest::CreatePhy, this, 40);
+    Simulator::Schedule(Seconds(2), &YansWifiChannelRangeTest::CreatePhy, this, 40);
+    Simulator::Schedule(Seconds(3), &YansWifiChannelRangeTest::Transmit, this);
+    Simulator::Schedule(Seconds(4), &YansWifiChannelRangeTest::Place, this, 4, Vector(450, 0, 0));
+    Simulator::Schedule(Seconds(4), &YansWifiChannelRangeTest::Place, this, 5, Vector(900, 0, 0));
+    Simulator::Schedule(Seconds(5), &YansWifiChannelRangeTest::Transmit, this);
+    Simulator::Run();
+
+    for (auto& phy : m_phys)
+    {
+        phy->Dispose();
+    }
+    m_channel->Dispose();
+    Simulator::Destroy();
+}
+
+void
+YansWifiChannelRangeTest::DoRun()
+{
+    RunOne(0);
+    auto expected = m_rxPowersW;
+    NS_TEST_ASSERT_MSG_EQ(expected[3].size(), 3, "The PHYs should be in reception range");
+    NS_TEST_ASSERT_MSG_EQ(expected[5].size(), 1, "The PHYs should be in reception range");
+
+    RunOne(500);
+    for (std::size_t i : {0, 1, 2, 4})
+    {
+        NS_TEST_ASSERT_MSG_EQ(m_rxPowersW[i].size(),
+                              expected[i].size(),
+                              "PHY " << i << " within range missed a PPDU");
+        for (std::size_t j = 0; j < expected[i].size(); j++)
+        {
+            NS_TEST_EXPECT_MSG_EQ(m_rxPowersW[i][j],
+                                  expected[i][j],
+                                  "PHY " << i << " within range received another power");
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ(m_rxPowersW[3].size(), 0, "A PHY beyond range received a PPDU");
+    NS_TEST_EXPECT_MSG_EQ(m_rxPowersW[5].size(), 0, "A PHY placed beyond range received a PPDU");
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief InterferenceHelper giving access to the number of NiChanges of a band and to the
+ * power at the start of the PPDU being received.
+ */
+class NiChangesTestInterferenceHelper : public InterferenceHelper
+{
+  public:
+    using InterferenceHelper::GetFirstPower;
+    using InterferenceHelper::GetNiChangesCount;
+};
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Check that the InterferenceHelper removes the NiChanges of the signals which have
+ * ended while it records a reception, and that it keeps the power at the start of a signal
+ * still in the air, which is read when the PHY switches to that signal during preamble
+ * detection.
+ */
+class InterferenceHelperNiChangesTest : public TestCase
+{
+  public:
+    InterferenceHelperNiChangesTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Add a signal to the interference helper.
+     * \param duration the duration of the signal
+     * \param powerW the received power of the signal in Watts
+     */
+    void AddSignal(Time duration, double powerW);
+
+    /**
+     * Switch the reception to the signal started at the given time, as the PHY does when it
+     * gets a stronger PPDU during preamble detection.
+     * \param startTime the start time of the signal
+     */
+    void SwitchReception(Time startTime);
+
+    /**
+     * Check the number of NiChanges of the band.
+     * \param expected the expected number of NiChanges
+     */
+    void CheckNiChangesCount(std::size_t expected);
+
+    Ptr<NiChangesTestInterferenceHelper> m_interference; ///< the interference helper
+    WifiSpectrumBandInfo m_band;                         ///< the band of the signals
+};
+
+InterferenceHelperNiChangesTest::InterferenceHelperNiChangesTest()
+    : TestCase("Check the removal of the expired NiChanges of the InterferenceHelper"),
+      m_band{{0, 0}, {5170000000, 5190000000}}
+{
+}
+
+void
+InterferenceHelperNiChangesTest::AddSignal(Time duration, double powerW)
+{
+    RxPowerWattPerChannelBand rxPowerW{{m_band, powerW}};
+    m_interference->AddForeignSignal(duration, rxPowerW);
+}
+
+void
+InterferenceHelperNiChangesTest::SwitchReception(Time startTime)
+{
+    m_interference->NotifyRxEnd(startTime, WHOLE_WIFI_SPECTRUM);
+    m_interference->NotifyRxStart();
+}
+
+void
+InterferenceHelperNiChangesTest::CheckNiChangesCount(std::size_t expected)
+{
+    NS_TEST_EXPECT_MSG_EQ(m_interference->GetNiChangesCount(m_band),
+                          expected,
+                          "Unexpected number of NiChanges at " << Simulator::Now().As(Time::US));
+}
+
+void
+InterferenceHelperNiChangesTest::DoRun()
+{
+    m_interference = CreateObject<NiChangesTestInterferenceHelper>();
+    m_interference->AddBand(m_band);
+
+    const double interferenceW = 1e-10;
+    // A reception starts with a signal that ends before the signal finally received,
+    // which starts while the first one is in the air
+    Simulator::Schedule(MicroSeconds(0), &InterferenceHelper::NotifyRxStart, m_interference);
+    Simulator::Schedule(MicroSeconds(0),
+                        &InterferenceHelperNiChangesTest::AddSignal,
+                        this,
+                        MicroSeconds(10),
+                        interferenceW);
+    Simulator::Schedule(MicroSeconds(5),
+                        &InterferenceHelperNiChangesTest::AddSignal,
+                        this,
+                        MicroSeconds(100),
+                        1e-9);
+    // The changes of the first signal are before the start of the second one, which is
+    // still in the air: only the one giving the power at that start may be removed, and it
+    // is kept since the reception may switch to the second signal
+    Simulator::Schedule(MicroSeconds(20),
+                        &InterferenceHelperNiChangesTest::AddSignal,
+                        this,
+                        MicroSeconds(5),
+                        1e-11);
+    Simulator::Schedule(MicroSeconds(20),
+                        &InterferenceHelperNiChangesTest::CheckNiChangesCount,
+                        this,
+                        7);
+    Simulator::Schedule(MicroSeconds(20),
+                        &InterferenceHelperNiChangesTest::SwitchReception,
+                        this,
+                        MicroSeconds(5));
+    Simulator::Schedule(MicroSeconds(20), [=, this]() {
+        NS_TEST_EXPECT_MSG_EQ(m_interference->GetFirstPower(m_band),
+                              interferenceW,
+                              "The power at the start of the second signal was lost");
+    });
+
+    // Once all the signals have ended, each new signal only leaves the last two changes of
+    // the previous ones, however long the reception lasts
+    Simulator::Schedule(MicroSeconds(200),
+                        &InterferenceHelperNiChangesTest::AddSignal,
+                        this,
+                        MicroSeconds(10),
+                        1e-11);
+    Simulator::Schedule(MicroSeconds(200),
+                        &InterferenceHelperNiChangesTest::CheckNiChangesCount,
+                        this,
+                        5);
+    for (int64_t i = 1; i <= 10; ++i)
+    {
+        Simulator::Schedule(MicroSeconds(200 + i * 50),
+                            &InterferenceHelperNiChangesTest::AddSignal,
+                            this,
+                            MicroSeconds(10),
+                            1e-11);
+        Simulator::Schedule(MicroSeconds(200 + i * 50),
+                            &InterferenceHelperNiChangesTest::CheckNiChangesCount,
+                            this,
+                            5);
+    }
+
+    Simulator::Run();
+    Simulator::Destroy();
+    m_interference->Dispose();
+    m_interference = nullptr;
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -3811,6 +4135,8 @@ WifiTestSuite::WifiTestSuite()
     AddTestCase(new IdealRateManagerMimoTest, TestCase::QUICK);
     AddTestCase(new HeRuMcsDataRateTestCase, TestCase::QUICK);
     AddTestCase(new WifiMgtHeaderTest, TestCase::QUICK);
+    AddTestCase(new YansWifiChannelRangeTest, TestCase::QUICK);
+    AddTestCase(new InterferenceHelperNiChangesTest, TestCase::QUICK);
 }
 
 static WifiTestSuite g_wifiTestSuite; ///< the test suite
@@ -0,0 +1,209 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the InterferenceHelper of a Wi-Fi
+// receiver which hears the PPDUs of many BSSs on its channel.  Each BSS
+// sends PPDUs at random, and the receiver receives each PPDU arriving
+// while it is idle, computing the SNR after the preamble and the PER of the
+// payload at its end, as the PHY does.
+// Sample usage:  ./ns3 run 'bench-interference-helper --bss=200 --load=0.02'
+
+#include "ns3/command-line.h"
+#include "ns3/double.h"
+#include "ns3/interference-helper.h"
+#include "ns3/nist-error-rate-model.h"
+#include "ns3/ofdm-phy.h"
+#include "ns3/ofdm-ppdu.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/simulator.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/wifi-phy-operating-channel.h"
+#include "ns3/wifi-phy.h"
+#include "ns3/wifi-psdu.h"
+#include "ns3/wifi-utils.h"
+
+#include <algorithm>
+#include <iostream>
+
+using namespace ns3;
+
+/// The receiver of the PPDUs of all the BSSs.
+class Receiver
+{
+  public:
+    /**
+     * \param load The fraction of the time during which a BSS transmits.
+     * \param ppduDuration The duration of the PPDUs.
+     */
+    Receiver(double load, Time ppduDuration);
+
+    /**
+     * Start a BSS.
+     * \param bss The index of the BSS.
+     */
+    void StartBss(uint32_t bss);
+
+    /**
+     * Print the statistics.
+     * \param elapsed The wall-clock time of the simulation, in milliseconds.
+     */
+    void Print(int64_t elapsed) const;
+
+  private:
+    /**
+     * A BSS sends a PPDU, and schedules the next one.
+     * \param bss The index of the BSS.
+     */
+    void Send(uint32_t bss);
+
+    /**
+     * Compute the SNR after the preamble of the PPDU received.
+     * \param event The PPDU received.
+     */
+    void EndPreamble(Ptr<Event> event);
+
+    /**
+     * Compute the PER of the payload of the PPDU received.
+     * \param event The PPDU received.
+     */
+    void EndReceive(Ptr<Event> event);
+
+    Ptr<InterferenceHelper> m_interference;    //!< The interference helper benchmarked
+    WifiSpectrumBandInfo m_band;               //!< The band of the channel
+    FrequencyRange m_freqRange;                //!< The frequency range of the channel
+    WifiTxVector m_txVector;                   //!< The TXVECTOR of the PPDUs
+    Ptr<const WifiPsdu> m_psdu;                //!< The PSDU of the PPDUs
+    Time m_ppduDuration;                       //!< The duration of the PPDUs
+    Ptr<ExponentialRandomVariable> m_interval; //!< The time between the PPDUs of a BSS
+    Ptr<UniformRandomVariable> m_rxPowerDbm;   //!< The power of the PPDUs received
+    bool m_rxing{false};                       //!< Whether a PPDU is being received
+    uint64_t m_uid{0};                         //!< The UID of the next PPDU
+    uint64_t m_ppdus{0};                       //!< The number of PPDUs sent
+    uint64_t m_received{0};                    //!< The number of PPDUs received
+    double m_perSum{0};                        //!< The sum of the PERs of the PPDUs received
+};
+
+Receiver::Receiver(double load, Time ppduDuration)
+    : m_band{{1, 64}, {5170e6, 5190e6}},
+      m_freqRange{5170, 5190},
+      m_txVector(OfdmPhy::GetOfdmRate6Mbps(), 0, WIFI_PREAMBLE_LONG, 800, 1, 1, 0, 20, false),
+      m_ppduDuration(ppduDuration)
+{
+    m_interference = CreateObject<InterferenceHelper>();
+    m_interference->SetNoiseFigure(DbToRatio(7));
+    m_interference->SetErrorRateModel(CreateObject<NistErrorRateModel>());
+    m_interference->AddBand(m_band);
+
+    WifiMacHeader hdr;
+    hdr.SetType(WIFI_MAC_QOSDATA);
+    hdr.SetQosTid(0);
+    m_psdu = Create<WifiPsdu>(Create<Packet>(1000), hdr);
+
+    m_interval = CreateObject<ExponentialRandomVariable>();
+    m_interval->SetAttribute("Mean", DoubleValue(ppduDuration.GetSeconds() / load));
+    m_rxPowerDbm = CreateObject<UniformRandomVariable>();
+    m_rxPowerDbm->SetAttribute("Min", DoubleValue(-95));
+    m_rxPowerDbm->SetAttribute("Max", DoubleValue(-60));
+}
+
+void
+Receiver::StartBss(uint32_t bss)
+{
+    Simulator::Schedule(Seconds(m_interval->GetValue()), &Receiver::Send, this, bss);
+}
+
+void
+Receiver::Send(uint32_t bss)
+{
+    m_ppdus++;
+    auto ppdu = Create<OfdmPpdu>(m_psdu, m_txVector, WifiPhyOperatingChannel(), m_uid++);
+    RxPowerWattPerChannelBand rxPower{{m_band, DbmToW(m_rxPowerDbm->GetValue())}};
+    Ptr<Event> event = m_interference->Add(ppdu, m_ppduDuration, rxPower);
+    if (!m_rxing)
+    {
+        m_rxing = true;
+        m_interference->NotifyRxStart();
+        Simulator::Schedule(WifiPhy::CalculatePhyPreambleAndHeaderDuration(m_txVector),
+                            &Receiver::EndPreamble,
+                            this,
+                            event);
+        Simulator::Schedule(m_ppduDuration, &Receiver::EndReceive, this, event);
+    }
+    Simulator::Schedule(m_ppduDuration + Seconds(m_interval->GetValue()),
+                        &Receiver::Send,
+                        this,
+                        bss);
+}
+
+void
+Receiver::EndPreamble(Ptr<Event> event)
+{
+    m_interference->CalculateSnr(event, 20, 1, m_band);
+}
+
+void
+Receiver::EndReceive(Ptr<Event> event)
+{
+    Time payload = m_ppduDuration - WifiPhy::CalculatePhyPreambleAndHeaderDuration(m_txVector);
+    auto snrPer =
+        m_interference->CalculatePayloadSnrPer(event, 20, m_band, SU_STA_ID, {Time(), payload});
+    m_perSum += snrPer.per;
+    m_received++;
+    m_interference->NotifyRxEnd(Simulator::Now(), m_freqRange);
+    m_rxing = false;
+}
+
+void
+Receiver::Print(int64_t elapsed) const
+{
+    std::cout << m_ppdus << " PPDUs sent, " << m_received << " received, mean PER "
+              << (m_received > 0 ? m_perSum / m_received : 0) << std::endl;
+    std::cout << elapsed << " ms elapsed, "
+              << (m_received * 1000.0) / std::max<int64_t>(elapsed, 1) << " receptions/s"
+              << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t nBss = 200;
+    double load = 0.02;
+    Time ppduDuration = MicroSeconds(1500);
+    Time duration = Seconds(10);
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the InterferenceHelper of a receiver hearing many BSSs");
+    cmd.AddValue("bss", "number of BSSs heard by the receiver", nBss);
+    cmd.AddValue("load", "fraction of the time during which a BSS transmits", load);
+    cmd.AddValue("ppduDuration", "duration of the PPDUs", ppduDuration);
+    cmd.AddValue("duration", "simulated time", duration);
+    cmd.Parse(argc, argv);
+
+    Receiver receiver(load, ppduDuration);
+    for (uint32_t bss = 0; bss < nBss; bss++)
+    {
+        receiver.StartBss(bss);
+    }
+
+    SystemWallClockMs time;
+    time.Start();
+    Simulator::Stop(duration);
+    Simulator::Run();
+    int64_t elapsed = time.End();
+    receiver.Print(elapsed);
+    Simulator::Destroy();
+
+    return 0;
+}
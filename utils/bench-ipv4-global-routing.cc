@@ -0,0 +1,154 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the route lookups of Ipv4GlobalRouting,
+// for various numbers of network routes.  The lookups are compared with a
+// scan of the same routes, as done by the lookups before they were indexed.
+// Sample usage:  ./ns3 run 'bench-ipv4-global-routing --routes=10000'
+
+#include "ns3/command-line.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-global-routing.h"
+#include "ns3/ipv4-route.h"
+#include "ns3/ipv4-routing-table-entry.h"
+#include "ns3/node.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/simulator.h"
+#include "ns3/system-wall-clock-ms.h"
+
+#include <algorithm>
+#include <iostream>
+#include <list>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * Run a number of lookups, and print the time per lookup.
+ * \param lookup The lookup function, which returns the gateway of a destination.
+ * \param dests The destinations to look up, in turn.
+ * \param n Number of lookups.
+ * \param name Benchmark name.
+ * \return A checksum of the gateways found.
+ */
+template <class Lookup>
+static uint32_t
+runBench(Lookup lookup, const std::vector<Ipv4Address>& dests, uint32_t n, const char* name)
+{
+    uint32_t sum = 0;
+    SystemWallClockMs time;
+    time.Start();
+    for (uint32_t i = 0; i < n; i++)
+    {
+        sum += lookup(dests[i % dests.size()]).Get();
+    }
+    double ms = std::max<int64_t>(time.End(), 1);
+    std::cout << (ms * 1e6 / n) << " ns/lookup (" << ms << " ms elapsed)\t" << name << std::endl;
+    return sum;
+}
+
+/**
+ * Benchmark the lookups in a routing table of a given size.
+ * \param nRoutes Number of network routes.
+ * \param n Number of lookups.
+ */
+static void
+benchRoutes(uint32_t nRoutes, uint32_t n)
+{
+    std::cout << nRoutes << " routes:" << std::endl;
+
+    Ptr<Node> node = CreateObject<Node>();
+    InternetStackHelper internet;
+    internet.Install(node);
+    Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+    Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice>();
+    device->SetAddress(Mac48Address::Allocate());
+    node->AddDevice(device);
+    int32_t ifIndex = ipv4->AddInterface(device);
+    ipv4->AddAddress(ifIndex, Ipv4InterfaceAddress(Ipv4Address("1.0.0.1"), Ipv4Mask("/24")));
+    ipv4->SetUp(ifIndex);
+
+    Ptr<Ipv4GlobalRouting> routing = CreateObject<Ipv4GlobalRouting>();
+    routing->SetIpv4(ipv4);
+    std::list<Ipv4RoutingTableEntry> scanned;
+    std::vector<Ipv4Address> dests;
+    for (uint32_t i = 0; i < nRoutes; i++)
+    {
+        // /24 networks from 10.0.0.0, a few of them with /30 subnets
+        Ipv4Address network((10 << 24) + (i << 8));
+        Ipv4Mask mask(i % 16 == 0 ? "/30" : "/24");
+        Ipv4Address gateway((1 << 24) + 2 + i % 200);
+        routing->AddNetworkRouteTo(network, mask, gateway, ifIndex);
+        scanned.push_back(
+            Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, mask, gateway, ifIndex));
+        dests.emplace_back(network.Get() + 1);
+    }
+    // look up the destinations in a scattered order
+    for (uint32_t i = 0; i < dests.size(); i++)
+    {
+        std::swap(dests[i], dests[(i * 7919) % dests.size()]);
+    }
+
+    auto indexed = [routing](Ipv4Address dest) {
+        Ipv4Header header;
+        header.SetDestination(dest);
+        Socket::SocketErrno sockerr;
+        return routing->RouteOutput(nullptr, header, nullptr, sockerr)->GetGateway();
+    };
+    auto scan = [&scanned](Ipv4Address dest) {
+        for (const auto& route : scanned)
+        {
+            if (route.GetDestNetworkMask().IsMatch(dest, route.GetDestNetwork()))
+            {
+                return route.GetGateway();
+            }
+        }
+        return Ipv4Address::GetAny();
+    };
+
+    indexed(dests.front()); // index the routes
+    uint32_t sumIndexed = runBench(indexed, dests, n, "Ipv4GlobalRouting::RouteOutput");
+    uint32_t sumScan = runBench(scan, dests, std::max(n / nRoutes, 1U) * 100, "scan");
+    std::cout << "(" << sumIndexed + sumScan << ")" << std::endl;
+
+    routing->Dispose();
+    Simulator::Destroy();
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t n = 1000000;
+    uint32_t nRoutes = 0;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the route lookups of Ipv4GlobalRouting");
+    cmd.AddValue("n", "number of lookups", n);
+    cmd.AddValue("routes", "number of routes, or 0 for 1000, 10000 and 100000", nRoutes);
+    cmd.Parse(argc, argv);
+
+    if (nRoutes > 0)
+    {
+        benchRoutes(nRoutes, n);
+    }
+    else
+    {
+        for (uint32_t routes : {1000, 10000, 100000})
+        {
+            benchRoutes(routes, n);
+        }
+    }
+    return 0;
+}
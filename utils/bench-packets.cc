@@ -22,6 +22,7 @@
 // Sample usage:  ./ns3 run 'bench-packets --n=10000'
 
 #include "ns3/command-line.h"
+#include "ns3/packet-memory-pool.h"
 #include "ns3/packet-metadata.h"
 #include "ns3/packet.h"
 #include "ns3/system-wall-clock-ms.h"
@@ -32,6 +33,7 @@
 #include <sstream>
 #include <stdlib.h> // for exit ()
 #include <string>
+#include <vector>
 
 using namespace ns3;
 
@@ -350,6 +352,31 @@ benchByteTags(uint32_t n)
     }
 }
 
+static void
+benchBroadcast(uint32_t n)
+{
+    BenchHeader<25> ipv4;
+    BenchHeader<8> udp;
+    BenchTag<16> tag;
+
+    // A broadcast to many receivers: each one gets a copy, tags it
+    // and strips the headers.
+    std::vector<Ptr<Packet>> copies(16);
+    for (uint32_t i = 0; i < n; i++)
+    {
+        Ptr<Packet> p = Create<Packet>(1500);
+        p->AddHeader(udp);
+        p->AddHeader(ipv4);
+        for (auto& copy : copies)
+        {
+            copy = p->Copy();
+            copy->AddPacketTag(tag);
+            copy->RemoveHeader(ipv4);
+            copy->RemoveHeader(udp);
+        }
+    }
+}
+
 static uint64_t
 runBenchOneIteration(void (*bench)(uint32_t), uint32_t n)
 {
@@ -407,6 +434,11 @@ main(int argc, char* argv[])
     runBench(&benchD, n, minIterations, "Intermixed add/remove headers and tags");
     runBench(&benchFragment, n, minIterations, "Fragmentation and concatenation");
     runBench(&benchByteTags, n, minIterations, "Benchmark byte tags");
+    runBench(&benchBroadcast, n, minIterations, "Copy packet to 16 receivers");
+
+    PacketMemoryPool::Statistics stats = PacketMemoryPool::GetStatistics();
+    std::cout << "Packet memory pool: " << stats.hits << " hits, " << stats.misses
+              << " misses, high water mark " << stats.highWaterMark << " blocks" << std::endl;
 
     return 0;
 }
@@ -0,0 +1,214 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the arithmetic of SpectrumValue,
+// as used by the interference computations, for various numbers of bands.
+// Sample usage:  ./ns3 run 'bench-spectrum-value --bands=100 --n=100000'
+
+#include "ns3/command-line.h"
+#include "ns3/spectrum-converter.h"
+#include "ns3/spectrum-value.h"
+#include "ns3/system-wall-clock-ms.h"
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+using namespace ns3;
+
+/// The operands of the benchmarks.
+struct Operands
+{
+    SpectrumValue a;             //!< The value which is updated
+    SpectrumValue b;             //!< The first operand
+    SpectrumValue c;             //!< The second operand
+    SpectrumConverter converter; //!< A converter to a model with half the bands
+    double sink; //!< Result of the reductions, to keep them from being optimized out
+};
+
+/// The operands of the benchmarks.
+static Operands* g_ops;
+
+/**
+ * Sum of two values, with a temporary.
+ * \param n Number of iterations.
+ */
+static void
+benchSum(uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++)
+    {
+        g_ops->a = g_ops->b + g_ops->c;
+    }
+}
+
+/**
+ * In place accumulation.
+ * \param n Number of iterations.
+ */
+static void
+benchAccumulate(uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++)
+    {
+        g_ops->a += g_ops->b;
+        g_ops->a -= g_ops->b;
+    }
+}
+
+/**
+ * Scaled accumulation with a temporary.
+ * \param n Number of iterations.
+ */
+static void
+benchScaledAccumulate(uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++)
+    {
+        g_ops->a += g_ops->b * 1e-3;
+    }
+}
+
+/**
+ * Scaled accumulation with MultiplyAdd().
+ * \param n Number of iterations.
+ */
+static void
+benchMultiplyAdd(uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++)
+    {
+        g_ops->a.MultiplyAdd(g_ops->b, 1e-3);
+    }
+}
+
+/**
+ * Signal to interference plus noise ratio, as computed by SpectrumInterference.
+ * \param n Number of iterations.
+ */
+static void
+benchSinr(uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++)
+    {
+        g_ops->a = g_ops->b / (g_ops->c - g_ops->b + g_ops->b);
+    }
+}
+
+/**
+ * Integral of the power spectral density.
+ * \param n Number of iterations.
+ */
+static void
+benchIntegral(uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++)
+    {
+        g_ops->sink += Integral(g_ops->b);
+    }
+}
+
+/**
+ * Conversion to another spectrum model.
+ * \param n Number of iterations.
+ */
+static void
+benchConvert(uint32_t n)
+{
+    Ptr<const SpectrumValue> b = Create<const SpectrumValue>(g_ops->b);
+    for (uint32_t i = 0; i < n; i++)
+    {
+        g_ops->sink += (*g_ops->converter.Convert(b))[0];
+    }
+}
+
+/**
+ * Run a benchmark several times, and print the fastest run.
+ * \param bench Benchmark function pointer.
+ * \param n Number of iterations.
+ * \param minIterations Number of runs.
+ * \param name Benchmark name.
+ */
+static void
+runBench(void (*bench)(uint32_t), uint32_t n, uint32_t minIterations, const char* name)
+{
+    uint64_t minDelay = std::numeric_limits<uint64_t>::max();
+    for (uint32_t i = 0; i < minIterations; i++)
+    {
+        SystemWallClockMs time;
+        time.Start();
+        (*bench)(n);
+        minDelay = std::min(minDelay, static_cast<uint64_t>(time.End()));
+    }
+    double ops = n;
+    ops *= 1000;
+    ops /= std::max<uint64_t>(minDelay, 1);
+    std::cout << ops << " ops/s"
+              << " (" << minDelay << " ms elapsed)\t" << name << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t n = 100000;
+    uint32_t bands = 100;
+    uint32_t minIterations = 1;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark SpectrumValue arithmetic");
+    cmd.AddValue("n", "number of iterations", n);
+    cmd.AddValue("bands", "number of bands of the spectrum model", bands);
+    cmd.AddValue("min-iterations",
+                 "number of subiterations to minimize iteration time over",
+                 minIterations);
+    cmd.Parse(argc, argv);
+
+    std::vector<double> freqs;
+    std::vector<double> halfFreqs;
+    for (uint32_t i = 0; i < std::max<uint32_t>(bands, 4); i++)
+    {
+        freqs.push_back(2e9 + i * 180e3);
+        if (i % 2 == 1)
+        {
+            halfFreqs.push_back(2e9 + i * 180e3);
+        }
+    }
+    Ptr<SpectrumModel> model = Create<SpectrumModel>(freqs);
+    Ptr<SpectrumModel> halfModel = Create<SpectrumModel>(halfFreqs);
+
+    Operands ops{SpectrumValue(model),
+                 SpectrumValue(model),
+                 SpectrumValue(model),
+                 SpectrumConverter(model, halfModel),
+                 0};
+    for (uint32_t i = 0; i < ops.b.GetValuesN(); i++)
+    {
+        ops.b[i] = 1e-12 * (i + 1);
+        ops.c[i] = 3e-12 * (i + 1);
+    }
+    g_ops = &ops;
+
+    runBench(&benchSum, n, minIterations, "a = b + c");
+    runBench(&benchAccumulate, n, minIterations, "a += b; a -= b");
+    runBench(&benchScaledAccumulate, n, minIterations, "a += b * s");
+    runBench(&benchMultiplyAdd, n, minIterations, "a.MultiplyAdd (b, s)");
+    runBench(&benchSinr, n, minIterations, "a = b / (c - b + b)");
+    runBench(&benchIntegral, n, minIterations, "Integral (b)");
+    runBench(&benchConvert, n, minIterations, "SpectrumConverter::Convert (b)");
+    std::cout << "(" << ops.sink << ")" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,189 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark TcpTxBuffer and TcpRxBuffer, with a
+// window of one bandwidth-delay product in flight and some segments lost.
+// The sender processes one SACK per segment received, and retransmits the
+// lost segments, while the receiver buffers the segments out of order.
+// Sample usage:  ./ns3 run 'bench-tcp-buffers --bandwidth=10Gbps --rtt=100ms'
+
+#include "ns3/command-line.h"
+#include "ns3/data-rate.h"
+#include "ns3/nstime.h"
+#include "ns3/packet.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/tcp-header.h"
+#include "ns3/tcp-rx-buffer.h"
+#include "ns3/tcp-tx-buffer.h"
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+using namespace ns3;
+
+/**
+ * The receiver window, as seen by the sender.
+ * \return the receiver window
+ */
+static uint32_t
+GetRWnd()
+{
+    return std::numeric_limits<uint32_t>::max();
+}
+
+/**
+ * Print the time spent per segment.
+ * \param ms Elapsed time.
+ * \param n Number of segments.
+ * \param name Benchmark name.
+ */
+static void
+printBench(int64_t ms, uint32_t n, const char* name)
+{
+    double elapsed = std::max<int64_t>(ms, 1);
+    std::cout << (elapsed * 1e6 / n) << " ns/segment (" << ms << " ms elapsed)\t" << name
+              << std::endl;
+}
+
+/**
+ * Send a window of segments, process the SACKs of the segments received,
+ * and retransmit the lost ones.
+ * \param segments Number of segments in the window.
+ * \param segmentSize Segment size.
+ * \param lossInterval One segment every lossInterval is lost.
+ */
+static void
+benchTxBuffer(uint32_t segments, uint32_t segmentSize, uint32_t lossInterval)
+{
+    Ptr<TcpTxBuffer> txBuffer = CreateObject<TcpTxBuffer>(1);
+    txBuffer->SetMaxBufferSize(segments * segmentSize);
+    txBuffer->SetSegmentSize(segmentSize);
+    txBuffer->SetDupAckThresh(3);
+    txBuffer->SetRWndCallback(MakeCallback(&GetRWnd));
+    for (uint32_t i = 0; i < segments; i++)
+    {
+        txBuffer->Add(Create<Packet>(segmentSize));
+    }
+
+    SystemWallClockMs time;
+    time.Start();
+    SequenceNumber32 head(1);
+    for (uint32_t i = 0; i < segments; i++)
+    {
+        txBuffer->CopyFromSequence(segmentSize, head + i * segmentSize);
+    }
+    printBench(time.End(), segments, "TcpTxBuffer::CopyFromSequence (new data)");
+
+    // The first segment is lost, so that SND.UNA does not move
+    time.Start();
+    uint32_t retransmitted = 0;
+    for (uint32_t i = 1; i < segments; i++)
+    {
+        if (i % lossInterval == 0)
+        {
+            continue;
+        }
+        // The block containing the segment received, and the two blocks below it
+        TcpOptionSack::SackList sackList;
+        uint32_t blockStart = i - i % lossInterval;
+        for (uint32_t j = 0; j < 3; j++)
+        {
+            uint32_t end = (j == 0) ? i + 1 : blockStart + lossInterval;
+            sackList.emplace_back(head + (blockStart + 1) * segmentSize, head + end * segmentSize);
+            if (blockStart < lossInterval)
+            {
+                break;
+            }
+            blockStart -= lossInterval;
+        }
+        txBuffer->Update(sackList);
+
+        // Only the segments detected as lost are retransmitted, as there is no new data
+        SequenceNumber32 next;
+        SequenceNumber32 nextHigh;
+        txBuffer->IsLost(head);
+        if (txBuffer->NextSeg(&next, &nextHigh, false))
+        {
+            txBuffer->CopyFromSequence(segmentSize, next);
+            retransmitted++;
+        }
+        txBuffer->BytesInFlight();
+        txBuffer->IsRetransmittedDataAcked(head + segmentSize);
+    }
+    printBench(time.End(), segments, "TcpTxBuffer::Update (SACK) and retransmissions");
+
+    time.Start();
+    txBuffer->DiscardUpTo(head + segments * segmentSize);
+    printBench(time.End(), segments, "TcpTxBuffer::DiscardUpTo");
+    std::cout << "(" << retransmitted << " retransmissions)" << std::endl;
+}
+
+/**
+ * Receive a window of segments, the first one last.
+ * \param segments Number of segments in the window.
+ * \param segmentSize Segment size.
+ */
+static void
+benchRxBuffer(uint32_t segments, uint32_t segmentSize)
+{
+    Ptr<TcpRxBuffer> rxBuffer = CreateObject<TcpRxBuffer>(1);
+    rxBuffer->SetMaxBufferSize(segments * segmentSize);
+    SequenceNumber32 head(1);
+    TcpHeader tcpHeader;
+
+    SystemWallClockMs time;
+    time.Start();
+    for (uint32_t i = 1; i < segments; i++)
+    {
+        tcpHeader.SetSequenceNumber(head + i * segmentSize);
+        rxBuffer->Add(Create<Packet>(segmentSize), tcpHeader);
+    }
+    tcpHeader.SetSequenceNumber(head);
+    rxBuffer->Add(Create<Packet>(segmentSize), tcpHeader);
+    printBench(time.End(), segments, "TcpRxBuffer::Add (out of order)");
+
+    time.Start();
+    while (rxBuffer->Available() > 0)
+    {
+        rxBuffer->Extract(segmentSize);
+    }
+    printBench(time.End(), segments, "TcpRxBuffer::Extract");
+}
+
+int
+main(int argc, char* argv[])
+{
+    DataRate bandwidth("10Gbps");
+    Time rtt = MilliSeconds(100);
+    uint32_t segmentSize = 1448;
+    uint32_t lossInterval = 100;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark TcpTxBuffer and TcpRxBuffer with one bandwidth-delay product in flight");
+    cmd.AddValue("bandwidth", "bottleneck bandwidth", bandwidth);
+    cmd.AddValue("rtt", "round trip time", rtt);
+    cmd.AddValue("segmentSize", "segment size", segmentSize);
+    cmd.AddValue("lossInterval", "one segment lost every lossInterval segments", lossInterval);
+    cmd.Parse(argc, argv);
+
+    auto bdp = static_cast<uint64_t>(bandwidth.GetBitRate() * rtt.GetSeconds() / 8);
+    auto segments = static_cast<uint32_t>(std::max<uint64_t>(bdp / segmentSize, 2));
+    std::cout << segments << " segments in flight:" << std::endl;
+
+    benchTxBuffer(segments, segmentSize, std::max<uint32_t>(lossInterval, 2));
+    benchRxBuffer(segments, segmentSize);
+    return 0;
+}